@@ -2,6 +2,7 @@
 
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
 #include <optional>
 #include <string>
@@ -12,7 +13,10 @@
 
 namespace asn1::crypto
 {
-using object_identifier_type = decoded_object_identifier<std::vector<std::uint32_t>>;
+//Maximum number of components of the OIDs in the crypto structures
+constexpr std::size_t max_oid_components = 32u;
+
+using object_identifier_type = decoded_object_identifier<inline_oid<max_oid_components>>;
 
 template<typename RangeType>
 struct algorithm_identifier
@@ -238,4 +242,13 @@ using directory_string = std::variant<
 	std::string, //utf8_string
 	std::u16string //bmp_string
 >;
+
+//All alternatives are transcoded to UTF-8 during decoding
+using utf8_directory_string = std::variant<
+	std::u8string, //teletex_string
+	std::u8string, //printable_string
+	std::u8string, //universal_string
+	std::u8string, //utf8_string
+	std::u8string //bmp_string
+>;
 } //namespace asn1::crypto
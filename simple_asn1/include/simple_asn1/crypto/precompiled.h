@@ -0,0 +1,65 @@
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include "simple_asn1/der_decode.h"
+#include "simple_asn1/crypto/pkcs7/authenticode/spec.h"
+#include "simple_asn1/crypto/pkcs7/authenticode/types.h"
+#include "simple_asn1/crypto/pkcs7/cms/spec.h"
+#include "simple_asn1/crypto/pkcs7/cms/types.h"
+#include "simple_asn1/crypto/tst/spec.h"
+#include "simple_asn1/crypto/tst/types.h"
+#include "simple_asn1/crypto/x509/spec.h"
+#include "simple_asn1/crypto/x509/types.h"
+
+//Common crypto structure decoders, which are explicitly instantiated
+//by the SimpleAsn1Crypto library. Linking against it defines
+//SIMPLE_ASN1_PRECOMPILED_CRYPTO, which turns the declarations below on:
+//translation units including this header then call the library copies
+//of asn1::der::decode and asn1::der::try_decode for these types instead of
+//instantiating the decoders again.
+//Without the library, this header only includes the crypto specifications and types.
+namespace asn1::crypto::precompiled
+{
+using range_type = std::span<const std::uint8_t>;
+using pointer_type = const std::uint8_t*;
+using vector_iterator_type = std::vector<std::uint8_t>::const_iterator;
+
+using certificate = x509::certificate<range_type>;
+using certificate_choices = pkcs7::cms::certificate_choices_type<range_type>;
+using authenticode_content_info = pkcs7::authenticode::content_info<range_type>;
+using tst_info = tst::tst_info<range_type>;
+} //namespace asn1::crypto::precompiled
+
+//Explicit instantiations of the decode entry points for the Value decoded
+//with Spec from Iterator input. Prefix is either extern or empty.
+#define SIMPLE_ASN1_CRYPTO_DECODER(Prefix, Spec, Value, Iterator) \
+	Prefix template Iterator asn1::der::decode<Spec, asn1::decode_options<>, \
+		Iterator, Iterator, Value>(asn1::decode_state<Iterator, Iterator>&, Value&); \
+	Prefix template Value asn1::der::decode<Value, Spec, asn1::decode_options<>, \
+		Iterator, Iterator>(asn1::decode_state<Iterator, Iterator>&); \
+	Prefix template asn1::decode_result<Iterator> asn1::der::try_decode<Spec, \
+		asn1::decode_options<>, asn1::nothrow_decode_state<asn1::decode_state<Iterator, Iterator>>, \
+		Value>(asn1::nothrow_decode_state<asn1::decode_state<Iterator, Iterator>>&, Value&);
+
+#define SIMPLE_ASN1_CRYPTO_DECODERS_FOR(Prefix, Iterator) \
+	SIMPLE_ASN1_CRYPTO_DECODER(Prefix, asn1::spec::crypto::x509::certificate, \
+		asn1::crypto::precompiled::certificate, Iterator) \
+	SIMPLE_ASN1_CRYPTO_DECODER(Prefix, asn1::spec::crypto::pkcs7::cms::certificate_choices, \
+		asn1::crypto::precompiled::certificate_choices, Iterator) \
+	SIMPLE_ASN1_CRYPTO_DECODER(Prefix, asn1::spec::crypto::pkcs7::authenticode::content_info, \
+		asn1::crypto::precompiled::authenticode_content_info, Iterator) \
+	SIMPLE_ASN1_CRYPTO_DECODER(Prefix, asn1::spec::crypto::tst::tst_info, \
+		asn1::crypto::precompiled::tst_info, Iterator)
+
+#define SIMPLE_ASN1_CRYPTO_DECODERS(Prefix) \
+	SIMPLE_ASN1_CRYPTO_DECODERS_FOR(Prefix, asn1::crypto::precompiled::pointer_type) \
+	SIMPLE_ASN1_CRYPTO_DECODERS_FOR(Prefix, asn1::crypto::precompiled::vector_iterator_type)
+
+#ifdef SIMPLE_ASN1_PRECOMPILED_CRYPTO
+SIMPLE_ASN1_CRYPTO_DECODERS(extern)
+#endif //SIMPLE_ASN1_PRECOMPILED_CRYPTO
@@ -3,49 +3,70 @@
 #pragma once
 
 #include <array>
-#include <charconv>
+#include <bit>
 #include <concepts>
 #include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <exception>
 #include <limits>
 #include <memory>
+#include <memory_resource>
+#include <iterator>
 #include <optional>
-#include <stdexcept>
+#include <span>
 #include <type_traits>
 #include <string_view>
 #include <utility>
+#include <variant>
 #include <vector>
+#include <version>
 
+#include "simple_asn1/decode_error.h"
 #include "simple_asn1/spec.h"
 
 namespace asn1
 {
-struct spec_context_entry
-{
-	std::string_view spec_name;
-	std::string_view spec_type;
-};
-
-class parse_error : public std::runtime_error
+//Thrown on decode errors. Nothing is allocated (except for the exception object itself):
+//the message is a static string, and the context points to the static context list.
+class parse_error : public std::exception
 {
 public:
-	using context_type = std::vector<spec_context_entry>;
+	using context_type = std::span<const spec_context_entry>;
 
 public:
-	template<typename Text, typename Context>
-	parse_error(const Text& str, Context&& context)
-		: std::runtime_error(str)
-		, context_(std::forward<Context>(context))
+	explicit parse_error(const char* message, context_type context = {},
+		std::size_t offset = 0u) noexcept
+		: message_(message)
+		, context_(context)
+		, offset_(offset)
+	{
+	}
+
+	[[nodiscard]]
+	const char* what() const noexcept override
 	{
+		return message_;
 	}
 
 	[[nodiscard]]
-	const context_type& get_context() const noexcept
+	context_type get_context() const noexcept
 	{
 		return context_;
 	}
 
+	//Offset of the byte at which the error was detected
+	[[nodiscard]]
+	std::size_t get_offset() const noexcept
+	{
+		return offset_;
+	}
+
 private:
+	const char* message_;
 	context_type context_;
+	std::size_t offset_;
 };
 
 namespace detail
@@ -159,58 +180,129 @@ struct first_spec_name_helper<parent_context_list<Context, Contexts...>>
 
 struct sentinel final {};
 
+//Decode states which report errors by storing them instead of throwing
+template<typename DecodeState>
+concept NothrowDecodeState = requires(std::remove_cvref_t<DecodeState>& state) {
+	{ state.error } -> std::same_as<decode_error&>;
+};
+
+//Decode states whose lengths are validated against the enclosing TLV extents
+//(see validated_extent_decode_state), so end-of-buffer checks can be skipped
+template<typename DecodeState>
+concept ValidatedExtentDecodeState = requires {
+	requires std::remove_cvref_t<DecodeState>::has_validated_extent;
+};
+
+//Always false for throwing decode states, so the checks are optimized out
+template<typename DecodeState>
+[[nodiscard]] constexpr bool failed(const DecodeState& state) noexcept
+{
+	if constexpr (NothrowDecodeState<DecodeState>)
+		return state.error.code != decode_errc::none;
+	else
+		return false;
+}
+
+//States which decode a part of a larger input (like the stream decoder ones)
+//store the offset of their origin in origin_offset
+template<typename DecodeState>
+[[nodiscard]] std::size_t error_offset(const DecodeState& state)
+{
+	auto offset = static_cast<std::size_t>(std::distance(state.origin, state.begin));
+	if constexpr (requires { state.origin_offset; })
+		offset += state.origin_offset;
+	return offset;
+}
+
 template<typename Spec>
 struct error_helper final {};
 
 template<typename... Contexts>
 struct error_helper<parent_context_list<Contexts...>> final
 {
-private:
-	static parse_error::context_type get_context()
+public:
+	static constexpr std::array<spec_context_entry, sizeof...(Contexts)> context{
+		spec_context_entry{ Contexts::spec_name.str, Contexts::spec_type.str }... };
+
+	[[noreturn]]
+	static void throw_with_context(const char* str, std::size_t offset)
 	{
-		return parse_error::context_type{
-			spec_context_entry{ Contexts::spec_name.str, Contexts::spec_type.str }... };
+		throw parse_error(str, context, offset);
 	}
 
-public:
-	template<typename Text>
 	[[noreturn]]
-	static void throw_with_context(Text&& str)
+	static void throw_with_context_nested(const char* str, std::size_t offset)
 	{
-		throw parse_error(std::forward<Text>(str), get_context());
+		std::throw_with_nested(parse_error(str, context, offset));
 	}
 
-	template<typename Text>
-	[[noreturn]]
-	static void throw_with_context_nested(Text&& str)
+	//Throws for regular decode states. For nothrow decode states, stores the error
+	//in the state, and the caller must return as soon as failed(state) is true.
+	template<typename DecodeState>
+	static void report(DecodeState& state, decode_errc code, const char* str)
 	{
-		std::throw_with_nested(parse_error(std::forward<Text>(str), get_context()));
+		if constexpr (NothrowDecodeState<DecodeState>)
+		{
+			if (state.error.code == decode_errc::none)
+				state.error = decode_error{ code, str, error_offset(state), context };
+		}
+		else
+		{
+			throw_with_context(str, error_offset(state));
+		}
 	}
 };
 
 template<typename Options, typename ParentContexts,
-	typename Spec, typename Value>
-void try_validate_value(const Value& value)
+	typename Spec, typename Value, typename DecodeState>
+void try_validate_value(const Value& value, DecodeState& state)
 {
 	using validator_option_type = option_by_cat<Spec, option_cat::validator>;
 	if constexpr (!std::is_same_v<validator_option_type, void>)
 	{
-		try
+		using merged_specs = typename Options
+			::template merge_spec_names<ParentContexts, Spec>;
+		using validator_type = typename validator_option_type::validator_type;
+		using validator_result_type = decltype(validator_type{}(value));
+		//Validators may either throw or return false to report an error
+		if constexpr (std::is_same_v<validator_result_type, bool>)
 		{
-			(typename validator_option_type::validator_type{})(value);
+			if (!validator_type{}(value))
+			{
+				error_helper<merged_specs>::report(state,
+					decode_errc::validation_failed, "Value validation error");
+			}
 		}
-		catch (...)
+		else
 		{
-			using merged_specs = typename Options
-				::template merge_spec_names<ParentContexts, Spec>;
-			error_helper<merged_specs>
-				::throw_with_context_nested("Value validation error");
+#if defined(__cpp_exceptions) || defined(_CPPUNWIND)
+			try
+			{
+				validator_type{}(value);
+			}
+			catch (...)
+			{
+				if constexpr (NothrowDecodeState<DecodeState>)
+				{
+					error_helper<merged_specs>::report(state,
+						decode_errc::validation_failed, "Value validation error");
+				}
+				else
+				{
+					error_helper<merged_specs>
+						::throw_with_context_nested("Value validation error", error_offset(state));
+				}
+			}
+#else
+			validator_type{}(value);
+#endif
 		}
 	}
 }
 
-constexpr auto default_throw = [](const auto& message) {
-	throw std::runtime_error(message);
+constexpr auto default_throw = [](const auto& state,
+	decode_errc /* code */, const char* message) {
+	throw parse_error(message, {}, error_offset(state));
 };
 
 template<typename It>
@@ -238,6 +330,156 @@ concept SequentialContainer = requires (Value& value) {
 	typename Value::value_type;
 };
 
+//Containers like asn1::inline_oid, which can not grow beyond their capacity
+template<typename Value>
+concept FixedCapacityContainer = requires {
+	{ std::integral_constant<std::size_t, Value::capacity()>::value };
+};
+
+template<typename Value>
+concept MemoryResourceAware = requires (const Value& value) {
+	typename Value::allocator_type;
+	value.get_allocator();
+} && std::is_constructible_v<typename Value::allocator_type, std::pmr::memory_resource*>;
+
+//Rebinds an allocator-aware value to the memory resource of the decode state.
+//The contents of the value are discarded if its allocator is different.
+template<typename Value, typename DecodeState>
+void use_memory_resource(Value& value, const DecodeState& state)
+{
+	if constexpr (MemoryResourceAware<Value>)
+	{
+		using allocator_type = typename Value::allocator_type;
+		if (state.memory_resource
+			&& value.get_allocator() != allocator_type(state.memory_resource))
+		{
+			std::destroy_at(&value);
+			std::construct_at(&value, allocator_type(state.memory_resource));
+		}
+	}
+}
+
+template<typename Value, typename DecodeState>
+[[nodiscard]] Value make_value(const DecodeState& state)
+{
+	if constexpr (MemoryResourceAware<Value>)
+	{
+		if (state.memory_resource)
+			return Value(typename Value::allocator_type(state.memory_resource));
+	}
+	return Value{};
+}
+
+template<typename Iterator>
+concept ContiguousByteIterator = std::contiguous_iterator<Iterator>
+	&& sizeof(std::iter_value_t<Iterator>) == 1u;
+
+template<typename Value>
+concept ResizableByteContainer = requires (Value& value, std::size_t size) {
+	typename Value::value_type;
+	value.resize(size);
+	value.data();
+} && sizeof(typename Value::value_type) == 1u
+	&& std::is_trivially_copyable_v<typename Value::value_type>
+	&& !std::is_same_v<typename Value::value_type, bool>;
+
+template<typename Iterator>
+[[nodiscard]] const std::uint8_t* to_byte_pointer(Iterator it) noexcept
+{
+	return reinterpret_cast<const std::uint8_t*>(std::to_address(it));
+}
+
+//Copies len bytes starting at begin to dst and advances begin
+template<typename Iterator, typename Byte>
+void copy_bytes(Iterator& begin, std::size_t len, Byte* dst)
+{
+	if constexpr (ContiguousByteIterator<Iterator>)
+	{
+		if (len)
+			std::memcpy(dst, std::to_address(begin), len);
+		begin += static_cast<std::iter_difference_t<Iterator>>(len);
+	}
+	else
+	{
+		while (len--)
+			*dst++ = static_cast<Byte>(*begin++);
+	}
+}
+
+[[nodiscard]] inline std::uint64_t byteswap64(std::uint64_t value) noexcept
+{
+#if defined(__GNUC__) || defined(__clang__)
+	return __builtin_bswap64(value);
+#elif defined(_MSC_VER)
+	return _byteswap_uint64(value);
+#else
+	std::uint64_t result = 0;
+	for (std::size_t i = 0; i != sizeof(value); ++i, value >>= 8u)
+		result = (result << 8u) | (value & 0xffu);
+	return result;
+#endif
+}
+
+//Reads length (1-8) big-endian bytes. When at least 8 bytes are available,
+//this is a single unaligned 64-bit load followed by a byte swap and a shift.
+[[nodiscard]] inline std::uint64_t load_big_endian(const std::uint8_t* data,
+	std::size_t length, std::size_t available) noexcept
+{
+	std::uint64_t word = 0;
+	std::size_t unused_bits = 0;
+	if (available >= sizeof(word))
+	{
+		std::memcpy(&word, data, sizeof(word));
+		unused_bits = (sizeof(word) - length) * 8u;
+	}
+	else
+	{
+		std::memcpy(reinterpret_cast<std::uint8_t*>(&word)
+			+ (sizeof(word) - length), data, length);
+	}
+
+	if constexpr (std::endian::native == std::endian::little)
+		word = byteswap64(word);
+	return unused_bits ? word >> unused_bits : word;
+}
+
+//Resizes the value, which will be overwritten completely,
+//skipping the initialization of the new elements where possible
+template<typename Value>
+void resize_for_overwrite(Value& value, std::size_t size)
+{
+#ifdef __cpp_lib_string_resize_and_overwrite
+	if constexpr (requires { value.resize_and_overwrite(size,
+		[](auto*, std::size_t count) { return count; }); })
+	{
+		value.resize_and_overwrite(size, [](auto*, std::size_t count) { return count; });
+		return;
+	}
+#endif
+	value.resize(size);
+}
+
+template<typename Value, typename DecodeState, typename BufferIterator>
+void assign_range(Value& value, BufferIterator begin, BufferIterator end,
+	const DecodeState& state)
+{
+	if constexpr (ContiguousByteIterator<BufferIterator> && ResizableByteContainer<Value>)
+	{
+		use_memory_resource(value, state);
+		resize_for_overwrite(value, static_cast<std::size_t>(end - begin));
+		copy_bytes(begin, value.size(), value.data());
+	}
+	else if constexpr (MemoryResourceAware<Value>)
+	{
+		use_memory_resource(value, state);
+		value.assign(begin, end);
+	}
+	else
+	{
+		value = Value{ begin, end };
+	}
+}
+
 template<typename T>
 struct is_decoded_oid : std::false_type {};
 template<SequentialContainer T>
@@ -252,24 +494,34 @@ template<std::unsigned_integral T, typename DecodeState, auto Throw = default_th
 T decode_base128(length_type& length, DecodeState& state)
 {
 	if (!length)
-		Throw("Invalid base128 integer length");
+	{
+		Throw(state, decode_errc::invalid_value, "Invalid base128 integer length");
+		return {};
+	}
 
 	static constexpr bool is_random_access_iterator
 		= RandomAccessIterator<decltype(state.begin)>;
-	if constexpr (is_random_access_iterator)
+	static constexpr bool check_end = !ValidatedExtentDecodeState<DecodeState>;
+	if constexpr (is_random_access_iterator && check_end)
 	{
 		if (static_cast<length_type>(state.end - state.begin) < length)
-			Throw("Invalid base128 integer length");
+		{
+			Throw(state, decode_errc::invalid_value, "Invalid base128 integer length");
+			return {};
+		}
 	}
 
 	T result{};
 	std::uint32_t read_bytes{};
 	while (length && read_bytes < sizeof(T))
 	{
-		if constexpr (!is_random_access_iterator)
+		if constexpr (!is_random_access_iterator && check_end)
 		{
 			if (state.begin == state.end)
-				Throw("Invalid base128 integer length");
+			{
+				Throw(state, decode_errc::invalid_value, "Invalid base128 integer length");
+				return {};
+			}
 		}
 
 		auto value = static_cast<std::uint8_t>(*state.begin++);
@@ -286,8 +538,8 @@ T decode_base128(length_type& length, DecodeState& state)
 			return result;
 		}
 	}
-	Throw("Invalid or too big base128 integer value");
-	return result; //previous statement is noreturn, this never happens
+	Throw(state, decode_errc::invalid_value, "Invalid or too big base128 integer value");
+	return result; //previous statement only returns for nothrow decode states
 }
 
 template<typename T, bool IsRelative,
@@ -295,35 +547,49 @@ template<typename T, bool IsRelative,
 T decode_oid(length_type length, DecodeState& state)
 {
 	if (!length)
-		Throw("Invalid OID length");
+	{
+		Throw(state, decode_errc::invalid_value, "Invalid OID length");
+		return {};
+	}
 
-	static constexpr bool is_random_access_iterator
-		= RandomAccessIterator<decltype(state.begin)>;
-	if constexpr (is_random_access_iterator)
+	if constexpr (RandomAccessIterator<decltype(state.begin)>
+		&& !ValidatedExtentDecodeState<DecodeState>)
 	{
 		if (static_cast<length_type>(state.end - state.begin) < length)
-			Throw("Invalid OID length");
+		{
+			Throw(state, decode_errc::invalid_value, "Invalid OID length");
+			return {};
+		}
 	}
 
-	T result;
+	auto result = make_value<T>(state);
 	using value_type = typename T::value_type;
 
 	if constexpr (!IsRelative)
 	{
 		auto first_component = decode_base128<std::uint32_t,
 			DecodeState, Throw>(length, state);
+		if (failed(state))
+			return result;
+
 		if (first_component > 0x4fu)
 		{
 			result.emplace_back(static_cast<value_type>(2u));
 			first_component -= 80u;
 			if (first_component > (std::numeric_limits<value_type>::max)())
-				Throw("Too large OID component value");
+			{
+				Throw(state, decode_errc::invalid_value, "Too large OID component value");
+				return result;
+			}
 			result.emplace_back(static_cast<value_type>(first_component));
 		}
 		else
 		{
 			if (first_component / 40u > (std::numeric_limits<value_type>::max)())
-				Throw("Too large OID component value");
+			{
+				Throw(state, decode_errc::invalid_value, "Too large OID component value");
+				return result;
+			}
 			result.emplace_back(static_cast<value_type>(first_component / 40u));
 			result.emplace_back(static_cast<value_type>(first_component % 40u));
 		}
@@ -331,8 +597,19 @@ T decode_oid(length_type length, DecodeState& state)
 
 	while (length)
 	{
+		if constexpr (FixedCapacityContainer<T>)
+		{
+			if (result.size() == result.capacity())
+			{
+				Throw(state, decode_errc::invalid_value, "Too many OID components");
+				return result;
+			}
+		}
+
 		result.emplace_back(decode_base128<value_type,
 			DecodeState, Throw>(length, state));
+		if (failed(state))
+			break;
 	}
 	return result;
 }
@@ -342,25 +619,57 @@ T decode_integer(length_type length, DecodeState& state)
 {
 	std::make_unsigned_t<T> value{};
 	if (length > sizeof(value))
-		Throw("Too long integer (unsupported)");
+	{
+		Throw(state, decode_errc::invalid_value, "Too long integer (unsupported)");
+		return {};
+	}
 
 	if (!length)
-		Throw("Invalid integer length");
+	{
+		Throw(state, decode_errc::invalid_value, "Invalid integer length");
+		return {};
+	}
 
 	static constexpr bool is_random_access_iterator
 		= RandomAccessIterator<decltype(state.begin)>;
-	if constexpr (is_random_access_iterator)
+	static constexpr bool check_end = !ValidatedExtentDecodeState<DecodeState>;
+	if constexpr (is_random_access_iterator && check_end)
 	{
 		if (static_cast<length_type>(state.end - state.begin) < length)
-			Throw("Invalid integer length");
+		{
+			Throw(state, decode_errc::invalid_value, "Invalid integer length");
+			return {};
+		}
+	}
+
+	if constexpr (ContiguousByteIterator<decltype(state.begin)>
+		&& sizeof(value) <= sizeof(std::uint64_t))
+	{
+		auto word = load_big_endian(to_byte_pointer(state.begin), length,
+			static_cast<std::size_t>(state.end - state.begin));
+		state.begin += static_cast<std::iter_difference_t<decltype(state.begin)>>(length);
+		if constexpr (std::is_signed_v<T>)
+		{
+			//Arithmetic shift propagates negativeness
+			const auto unused_bits = (sizeof(word) - length) * 8u;
+			return static_cast<T>(static_cast<std::int64_t>(word << unused_bits)
+				>> unused_bits);
+		}
+		else
+		{
+			return static_cast<T>(word);
+		}
 	}
 
 	for (length_type i = 0; i != length; ++i)
 	{
-		if constexpr (!is_random_access_iterator)
+		if constexpr (!is_random_access_iterator && check_end)
 		{
 			if (state.begin == state.end)
-				Throw("Invalid integer length");
+			{
+				Throw(state, decode_errc::invalid_value, "Invalid integer length");
+				return {};
+			}
 		}
 
 		if constexpr (sizeof(value) > sizeof(std::uint8_t))
@@ -391,29 +700,124 @@ T decode_integer(length_type length, DecodeState& state)
 	return static_cast<T>(value);
 }
 
+template<typename Specs>
+constexpr auto report_with_context = [](auto& state,
+	decode_errc code, const auto& message) {
+	error_helper<Specs>::report(state, code, message);
+};
+
 template<std::integral T, typename Specs, typename DecodeState>
 T decode_integer_with_context(length_type length, DecodeState& state)
 {
-	return decode_integer<T, DecodeState, ([](const auto& message) {
-		error_helper<Specs>::throw_with_context(message);
-	})>(length, state);
+	return decode_integer<T, DecodeState, report_with_context<Specs>>(length, state);
 }
 
-template<length_type Length, typename Spec,
-	typename T, typename DecodeState>
-void string_to_integer(T& value, DecodeState& state)
+//Loads up to 8 characters to a 64-bit word, the first character is the least significant byte
+[[nodiscard]] constexpr std::uint64_t load_digit_word(const std::uint8_t* chars) noexcept
 {
-	std::array<char, Length> temp;
-	for (char& ch : temp)
-		ch = static_cast<char>(*state.begin++);
-	auto rc = std::from_chars(temp.data(), temp.data() + Length, value);
-	if (rc.ec != std::errc{} || rc.ptr != temp.data() + Length)
-		error_helper<Spec>::throw_with_context("Unable to parse integer");
+	std::uint64_t result = 0;
+	for (std::size_t i = 0; i != sizeof(result); ++i)
+		result |= static_cast<std::uint64_t>(chars[i]) << (i * 8u);
+	return result;
+}
+
+[[nodiscard]] constexpr bool is_digit_word(std::uint64_t word) noexcept
+{
+	//High nibbles must be 3, low nibbles must not carry when adding 6
+	return (word & 0xf0f0f0f0f0f0f0f0ull) == 0x3030303030303030ull
+		&& ((word + 0x0606060606060606ull) & 0xf0f0f0f0f0f0f0f0ull) == 0x3030303030303030ull;
+}
+
+//Converts 8 digits to 4 two-digit values, which are placed to the low bytes of 16-bit lanes
+[[nodiscard]] constexpr std::uint64_t digit_word_to_pairs(std::uint64_t word) noexcept
+{
+	word -= 0x3030303030303030ull;
+	return (word * 10u + (word >> 8u)) & 0x00ff00ff00ff00ffull;
+}
+
+//Parses Length decimal digits as Length / 2 two-digit values.
+//All digits are validated and converted at once, 8 characters at a time.
+template<length_type Length, typename Spec, typename DecodeState>
+	requires (Length % 2u == 0u && Length <= 16u)
+[[nodiscard]] std::array<std::uint8_t, Length / 2u> parse_digit_pairs(DecodeState& state)
+{
+	std::array<std::uint8_t, 16u> chars;
+	chars.fill(static_cast<std::uint8_t>('0'));
+	copy_bytes(state.begin, Length, chars.data());
+
+	const std::array<std::uint64_t, 2u> words{
+		load_digit_word(chars.data()), load_digit_word(chars.data() + 8u) };
+
+	std::array<std::uint8_t, Length / 2u> result{};
+	if (!is_digit_word(words[0]) || !is_digit_word(words[1]))
+	{
+		error_helper<Spec>::report(state,
+			decode_errc::invalid_value, "Unable to parse integer");
+		return result;
+	}
+
+	const std::array<std::uint64_t, 2u> pairs{
+		digit_word_to_pairs(words[0]), digit_word_to_pairs(words[1]) };
+	for (std::size_t i = 0; i != result.size(); ++i)
+		result[i] = static_cast<std::uint8_t>(pairs[i / 4u] >> ((i % 4u) * 16u));
+	return result;
 }
 
 constexpr std::array<std::uint8_t, 13u> days_in_month{
 	0, 31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31 };
 
+//Returns the error message if the date or time is out of range.
+//full_year is zero if the century is unknown, then February 29 is always accepted.
+template<typename DateTime>
+[[nodiscard]] constexpr const char* check_date_time(std::uint16_t full_year,
+	const DateTime& value) noexcept
+{
+	if (value.month < 1 || value.month > 12)
+		return "Invalid datetime month value";
+	if (value.hour > 23)
+		return "Invalid datetime hour value";
+	if (value.minute > 59)
+		return "Invalid datetime minute value";
+	if (value.second > 59)
+		return "Invalid datetime second value";
+	if (value.day < 1)
+		return "Invalid datetime day value";
+
+	if (value.day > days_in_month[value.month])
+	{
+		if (value.day == 29u && value.month == 2u)
+		{
+			if (!full_year)
+				return nullptr;
+
+			bool is_leap_year = (full_year % 4u == 0u
+				&& full_year % 100u != 0u) || (full_year % 400u == 0u);
+			if (is_leap_year)
+				return nullptr;
+		}
+
+		return "Invalid datetime day value";
+	}
+	return nullptr;
+}
+
+template<typename SpecOptions>
+[[nodiscard]] constexpr std::uint16_t utc_time_full_year(std::uint8_t year) noexcept
+{
+	using zero_year_option_type = typename spec::utc_time<SpecOptions>
+		::template option_by_category<option_cat::zero_year>;
+	if constexpr (!std::is_same_v<zero_year_option_type, void>)
+	{
+		return static_cast<std::uint16_t>(year <= 50u
+			? year + zero_year_option_type::value
+			: year + zero_year_option_type::value - 100u);
+	}
+	else
+	{
+		return 0u;
+	}
+}
+
 template<typename DecodeState>
 concept WithRecursionDepthLimit = requires(DecodeState s) {
 	{ s.max_recursion_depth } -> std::same_as<std::size_t&>;
@@ -438,6 +842,9 @@ using no_context = detail::parent_context_list<>;
 struct parse_options
 {
 	static constexpr bool ignore_bit_string_invalid_unused_count = false;
+	//Validate NumericString, PrintableString, IA5String, VisibleString,
+	//UTF8String, BMPString and UniversalString contents
+	static constexpr bool validate_string_contents = false;
 };
 
 template<template <typename, typename> typename ExceptionContextPolicy
@@ -462,16 +869,36 @@ struct [[nodiscard]] decode_state
 		noexcept(noexcept(BufferIteratorEnd(end)))
 		: begin(begin)
 		, end(end)
+		, origin(begin)
+	{
+	}
+
+	explicit decode_state(BufferIterator begin, BufferIteratorEnd end,
+		std::pmr::memory_resource* memory_resource)
+		noexcept(noexcept(BufferIteratorEnd(end)))
+		: begin(begin)
+		, end(end)
+		, origin(begin)
+		, memory_resource(memory_resource)
 	{
 	}
 
 	BufferIterator begin;
 	BufferIteratorEnd end;
+	//Start of the buffer, error offsets are relative to it
+	BufferIterator origin;
+	//Memory resource for the allocator-aware containers and strings
+	//(e.g. std::pmr::vector, std::pmr::string) of the decoded value.
+	//If null, the containers keep their own allocators.
+	std::pmr::memory_resource* memory_resource{};
 };
 
 template<typename BufferIterator, typename BufferIteratorEnd>
 decode_state(BufferIterator, BufferIteratorEnd)
 	-> decode_state<BufferIterator, BufferIteratorEnd>;
+template<typename BufferIterator, typename BufferIteratorEnd>
+decode_state(BufferIterator, BufferIteratorEnd, std::pmr::memory_resource*)
+	-> decode_state<BufferIterator, BufferIteratorEnd>;
 
 template<std::forward_iterator BufferIterator,
 	std::sentinel_for<BufferIterator> BufferIteratorEnd = BufferIterator>
@@ -485,4 +912,32 @@ struct [[nodiscard]] decode_state_with_recursion_depth_limit
 template<typename BufferIterator, typename BufferIteratorEnd>
 decode_state_with_recursion_depth_limit(BufferIterator, BufferIteratorEnd)
 	-> decode_state_with_recursion_depth_limit<BufferIterator, BufferIteratorEnd>;
+template<typename BufferIterator, typename BufferIteratorEnd>
+decode_state_with_recursion_depth_limit(BufferIterator, BufferIteratorEnd,
+	std::pmr::memory_resource*)
+	-> decode_state_with_recursion_depth_limit<BufferIterator, BufferIteratorEnd>;
+
+//Skips the end-of-buffer checks in the primitive decoders. Every element length
+//is still validated against the length of the enclosing element (and the top-level
+//element against the buffer size), so this is safe for untrusted input,
+//as long as the decoding is started with asn1::der::decode or asn1::der::try_decode.
+//Can be used with decode_state, decode_state_with_recursion_depth_limit
+//and nothrow_decode_state.
+template<typename DecodeState>
+struct [[nodiscard]] validated_extent_decode_state : DecodeState
+{
+	using DecodeState::DecodeState;
+
+	static constexpr bool has_validated_extent = true;
+};
+
+//Stores the first decode error instead of throwing parse_error.
+//Can be used with both decode_state and decode_state_with_recursion_depth_limit.
+template<typename DecodeState>
+struct [[nodiscard]] nothrow_decode_state : DecodeState
+{
+	using DecodeState::DecodeState;
+
+	decode_error error{};
+};
 } //namespace asn1
@@ -0,0 +1,124 @@
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <variant>
+
+namespace asn1
+{
+struct spec_context_entry
+{
+	std::string_view spec_name;
+	std::string_view spec_type;
+};
+
+enum class decode_errc : std::uint8_t
+{
+	none,
+	invalid_header, //Invalid or truncated tag and length
+	unexpected_tag,
+	invalid_value,
+	missing_element,
+	duplicate_element,
+	element_count, //Number of SEQUENCE OF / SET OF elements is out of bounds
+	unconsumed_data,
+	recursion_depth,
+	validation_failed
+};
+
+struct decode_error
+{
+	decode_errc code{};
+	const char* message = "";
+	//Offset of the byte at which the error was detected
+	std::size_t offset{};
+	//Points to the static context list, same as parse_error::get_context()
+	std::span<const spec_context_entry> context;
+};
+
+template<typename T>
+class [[nodiscard]] decode_result
+{
+public:
+	decode_result(T value) noexcept(std::is_nothrow_move_constructible_v<T>)
+		: storage_(std::in_place_index<0>, std::move(value))
+	{
+	}
+
+	decode_result(const decode_error& error) noexcept
+		: storage_(std::in_place_index<1>, error)
+	{
+	}
+
+	[[nodiscard]]
+	bool has_value() const noexcept
+	{
+		return storage_.index() == 0;
+	}
+
+	[[nodiscard]]
+	explicit operator bool() const noexcept
+	{
+		return has_value();
+	}
+
+	//The following accessors require has_value() to be true
+	[[nodiscard]]
+	T& value() & noexcept
+	{
+		return *std::get_if<0>(&storage_);
+	}
+
+	[[nodiscard]]
+	const T& value() const & noexcept
+	{
+		return *std::get_if<0>(&storage_);
+	}
+
+	[[nodiscard]]
+	T&& value() && noexcept
+	{
+		return std::move(*std::get_if<0>(&storage_));
+	}
+
+	[[nodiscard]]
+	T& operator*() & noexcept
+	{
+		return value();
+	}
+
+	[[nodiscard]]
+	const T& operator*() const & noexcept
+	{
+		return value();
+	}
+
+	[[nodiscard]]
+	T* operator->() noexcept
+	{
+		return std::get_if<0>(&storage_);
+	}
+
+	[[nodiscard]]
+	const T* operator->() const noexcept
+	{
+		return std::get_if<0>(&storage_);
+	}
+
+	//Requires has_value() to be false
+	[[nodiscard]]
+	const decode_error& error() const noexcept
+	{
+		return *std::get_if<1>(&storage_);
+	}
+
+private:
+	std::variant<T, decode_error> storage_;
+};
+} //namespace asn1
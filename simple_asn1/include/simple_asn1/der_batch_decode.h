@@ -0,0 +1,317 @@
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <concepts>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <exception>
+#include <memory>
+#include <memory_resource>
+#include <mutex>
+#include <ranges>
+#include <stdexcept>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#include "simple_asn1/decode.h"
+#include "simple_asn1/der_decode.h"
+
+namespace asn1
+{
+//Executor for der::decode_batch. concurrency() is the number of workers,
+//bulk(count, func) calls func(worker, index) once for every index in [0, count)
+//and returns when all calls complete. worker is in [0, concurrency()),
+//calls with the same worker index never run concurrently.
+template<typename Executor>
+concept BatchExecutor = requires(Executor& executor,
+	void(*func)(std::size_t, std::size_t))
+{
+	{ executor.concurrency() } -> std::convertible_to<std::size_t>;
+	executor.bulk(std::size_t{}, func);
+};
+
+//Runs everything on the calling thread
+class sequential_executor
+{
+public:
+	[[nodiscard]] std::size_t concurrency() const noexcept
+	{
+		return 1u;
+	}
+
+	template<typename Func>
+	void bulk(std::size_t count, Func&& func) const
+	{
+		for (std::size_t index = 0; index != count; ++index)
+			func(std::size_t{}, index);
+	}
+};
+
+//Fixed-size thread pool. The calling thread takes part in each bulk job
+//as worker 0. Indexes are handed out in chunks from a shared counter, so
+//workers which finish their chunks early take the remaining ones.
+//bulk() is not reentrant and must not be called concurrently.
+class thread_pool_executor
+{
+public:
+	explicit thread_pool_executor(std::size_t thread_count
+		= (std::max)(std::thread::hardware_concurrency(), 1u))
+	{
+		for (std::size_t worker = 1; worker < thread_count; ++worker)
+			threads_.emplace_back([this, worker] { worker_loop(worker); });
+	}
+
+	thread_pool_executor(const thread_pool_executor&) = delete;
+	thread_pool_executor& operator=(const thread_pool_executor&) = delete;
+
+	~thread_pool_executor()
+	{
+		{
+			std::lock_guard lock(mutex_);
+			stop_ = true;
+		}
+		wake_.notify_all();
+		for (auto& thread : threads_)
+			thread.join();
+	}
+
+	[[nodiscard]] std::size_t concurrency() const noexcept
+	{
+		return threads_.size() + 1u;
+	}
+
+	//Rethrows the first exception thrown by func after all workers stop
+	template<typename Func>
+	void bulk(std::size_t count, Func&& func)
+	{
+		if (!count)
+			return;
+
+		using func_type = std::remove_reference_t<Func>;
+		job_type job;
+		job.count = count;
+		job.chunk_size = (std::max)(count / (concurrency() * 8u), std::size_t{ 1u });
+		job.func = std::addressof(func);
+		job.call = [](void* func, std::size_t worker, std::size_t index) {
+			(*static_cast<func_type*>(func))(worker, index);
+		};
+
+		{
+			std::lock_guard lock(mutex_);
+			job_ = &job;
+			pending_ = threads_.size();
+			++generation_;
+		}
+		wake_.notify_all();
+
+		run(job, 0u);
+
+		{
+			std::unique_lock lock(mutex_);
+			done_.wait(lock, [this] { return !pending_; });
+			job_ = nullptr;
+		}
+
+		if (job.exception)
+			std::rethrow_exception(job.exception);
+	}
+
+private:
+	struct job_type
+	{
+		std::size_t count{};
+		std::size_t chunk_size{};
+		void* func{};
+		void(*call)(void*, std::size_t, std::size_t){};
+		std::atomic<std::size_t> next{};
+		std::exception_ptr exception;
+	};
+
+	void run(job_type& job, std::size_t worker) noexcept
+	{
+#if defined(__cpp_exceptions) || defined(_CPPUNWIND)
+		try
+		{
+#endif //defined(__cpp_exceptions) || defined(_CPPUNWIND)
+			for (;;)
+			{
+				auto first = job.next.fetch_add(job.chunk_size, std::memory_order_relaxed);
+				if (first >= job.count)
+					break;
+
+				auto last = (std::min)(first + job.chunk_size, job.count);
+				for (; first != last; ++first)
+					job.call(job.func, worker, first);
+			}
+#if defined(__cpp_exceptions) || defined(_CPPUNWIND)
+		}
+		catch (...)
+		{
+			//Other workers stop after their current chunks
+			job.next.store(job.count, std::memory_order_relaxed);
+			std::lock_guard lock(mutex_);
+			if (!job.exception)
+				job.exception = std::current_exception();
+		}
+#endif //defined(__cpp_exceptions) || defined(_CPPUNWIND)
+	}
+
+	void worker_loop(std::size_t worker) noexcept
+	{
+		std::uint64_t generation = 0;
+		for (;;)
+		{
+			job_type* job{};
+			{
+				std::unique_lock lock(mutex_);
+				wake_.wait(lock, [this, generation] {
+					return stop_ || generation_ != generation;
+				});
+				if (stop_)
+					return;
+
+				generation = generation_;
+				job = job_;
+			}
+
+			run(*job, worker);
+
+			std::lock_guard lock(mutex_);
+			if (!--pending_)
+				done_.notify_one();
+		}
+	}
+
+private:
+	std::vector<std::thread> threads_;
+	std::mutex mutex_;
+	std::condition_variable wake_;
+	std::condition_variable done_;
+	job_type* job_{};
+	std::size_t pending_{};
+	std::uint64_t generation_{};
+	bool stop_{};
+};
+
+//One monotonic arena per executor worker for der::decode_batch.
+//Allocator-aware containers and strings of the decoded values allocate from
+//the arena of the worker which decoded them (see decode_state::memory_resource),
+//so the arenas must outlive the decoded values. The arenas are not synchronized,
+//each one is only used by a single worker at a time.
+class batch_arenas
+{
+public:
+	explicit batch_arenas(std::size_t count,
+		std::pmr::memory_resource* upstream = std::pmr::get_default_resource())
+	{
+		arenas_.reserve(count);
+		for (std::size_t i = 0; i != count; ++i)
+			arenas_.emplace_back(std::make_unique<std::pmr::monotonic_buffer_resource>(upstream));
+	}
+
+	[[nodiscard]] std::size_t size() const noexcept
+	{
+		return arenas_.size();
+	}
+
+	[[nodiscard]] std::pmr::memory_resource* operator[](std::size_t worker) const noexcept
+	{
+		return arenas_[worker].get();
+	}
+
+	//Releases the memory of all decoded values at once
+	void release() noexcept
+	{
+		for (auto& arena : arenas_)
+			arena->release();
+	}
+
+private:
+	std::vector<std::unique_ptr<std::pmr::monotonic_buffer_resource>> arenas_;
+};
+} //namespace asn1
+
+namespace asn1::detail
+{
+[[noreturn]] inline void throw_invalid_batch_argument(const char* message)
+{
+#if defined(__cpp_exceptions) || defined(_CPPUNWIND)
+	throw std::invalid_argument(message);
+#else //defined(__cpp_exceptions) || defined(_CPPUNWIND)
+	(void)message;
+	std::abort();
+#endif //defined(__cpp_exceptions) || defined(_CPPUNWIND)
+}
+} //namespace asn1::detail
+
+namespace asn1::der
+{
+//Decodes every element of inputs (byte ranges, like std::span<const std::uint8_t>)
+//into the element of outputs with the same index, using the executor workers.
+//outputs must have at least as many elements as inputs, its elements are reset
+//before decoding. Decoding errors do not stop the batch: the result contains
+//an error slot per input, with decode_errc::none for the inputs decoded successfully.
+//If arenas are provided, there must be at least executor.concurrency() of them.
+//Throws std::invalid_argument if outputs or arenas are too small.
+template<typename Spec, typename DecodeOptions,
+	std::ranges::random_access_range Inputs,
+	std::ranges::random_access_range Outputs,
+	BatchExecutor Executor>
+	requires std::ranges::sized_range<Inputs>
+		&& std::ranges::contiguous_range<std::ranges::range_reference_t<const Inputs&>>
+std::vector<decode_error> decode_batch(const Inputs& inputs, Outputs&& outputs,
+	Executor& executor, const batch_arenas* arenas = nullptr)
+{
+	using value_type = std::ranges::range_value_t<Outputs>;
+
+	const auto count = static_cast<std::size_t>(std::ranges::size(inputs));
+	if constexpr (std::ranges::sized_range<Outputs>)
+	{
+		if (static_cast<std::size_t>(std::ranges::size(outputs)) < count)
+			detail::throw_invalid_batch_argument("Not enough outputs for the batch inputs");
+	}
+	if (arenas && arenas->size() < executor.concurrency())
+		detail::throw_invalid_batch_argument("Not enough arenas for the executor workers");
+
+	std::vector<decode_error> errors(count);
+	executor.bulk(count, [&inputs, &outputs, &errors, arenas](
+		std::size_t worker, std::size_t index) {
+		const auto& input = std::ranges::begin(inputs)[index];
+		auto& value = std::ranges::begin(outputs)[index];
+		value = value_type{};
+
+		using iterator_type = std::ranges::iterator_t<decltype(input)>;
+		nothrow_decode_state<decode_state<iterator_type>> state(
+			std::ranges::begin(input), std::ranges::end(input),
+			arenas ? (*arenas)[worker] : nullptr);
+		if (auto decoded = try_decode<Spec, DecodeOptions>(state, value); !decoded)
+		{
+			errors[index] = decoded.error();
+		}
+		else if (state.begin != state.end)
+		{
+			errors[index] = decode_error{ decode_errc::unconsumed_data,
+				"Not all data was consumed by the parser", detail::error_offset(state), {} };
+		}
+	});
+	return errors;
+}
+
+template<typename Spec,
+	std::ranges::random_access_range Inputs,
+	std::ranges::random_access_range Outputs,
+	BatchExecutor Executor>
+	requires std::ranges::sized_range<Inputs>
+		&& std::ranges::contiguous_range<std::ranges::range_reference_t<const Inputs&>>
+std::vector<decode_error> decode_batch(const Inputs& inputs, Outputs&& outputs,
+	Executor& executor, const batch_arenas* arenas = nullptr)
+{
+	return decode_batch<Spec, decode_options<>>(inputs, outputs, executor, arenas);
+}
+} //namespace asn1::der
@@ -2,70 +2,181 @@
 
 #pragma once
 
+#include <algorithm>
 #include <array>
-#include <charconv>
+#include <atomic>
+#include <bitset>
+#include <chrono>
 #include <cstddef>
 #include <cstdint>
+#include <cstdlib>
 #include <concepts>
 #include <iterator>
 #include <limits>
+#include <optional>
+#include <ranges>
 #include <string>
+#include <thread>
+#include <tuple>
 #include <type_traits>
 #include <utility>
 #include <variant>
+#include <vector>
 
 #include <boost/pfr/core.hpp>
 
 #include "simple_asn1/decode.h"
+#include "simple_asn1/oid_map.h"
 #include "simple_asn1/spec.h"
+#include "simple_asn1/string_transcoding.h"
+#include "simple_asn1/string_validation.h"
 #include "simple_asn1/types.h"
 
 namespace asn1::detail::der
 {
+//Decodes the base-128 tag number, which follows the first identifier byte
+template<typename DecodeState, auto Throw>
+tag_type decode_high_tag_number(tag_type first_byte,
+	DecodeState& state, std::size_t* max_length)
+{
+	//With a validated extent, *max_length never exceeds the buffer size
+	const bool check_end = !ValidatedExtentDecodeState<DecodeState> || !max_length;
+	std::uint32_t number = 0;
+	std::uint8_t byte = 0;
+	do
+	{
+		if ((check_end && state.begin == state.end) || (max_length && !*max_length))
+		{
+			Throw(state, decode_errc::invalid_header, "No tag and length");
+			return {};
+		}
+
+		if (max_length)
+			--*max_length;
+
+		byte = static_cast<std::uint8_t>(*state.begin++);
+		if ((!number && byte == 0x80u) || number > (max_tag_number >> 7u))
+		{
+			Throw(state, decode_errc::invalid_header, "Invalid tag number");
+			return {};
+		}
+
+		number = (number << 7u) | (byte & 0x7fu);
+	}
+	while (byte & 0x80u);
+
+	if (number < high_tag_number_form)
+	{
+		Throw(state, decode_errc::invalid_header, "Invalid tag number");
+		return {};
+	}
+
+	return make_tag(number, static_cast<std::uint8_t>(first_byte));
+}
+
 template<typename DecodeState, auto Throw = default_throw>
 std::pair<tag_type, length_type> decode_type_length(
 	DecodeState& state,
 	std::size_t* max_length = nullptr)
 {
+	//With a validated extent, *max_length never exceeds the buffer size
+	const bool check_end = !ValidatedExtentDecodeState<DecodeState> || !max_length;
+	if constexpr (ContiguousByteIterator<decltype(state.begin)>)
+	{
+		//Low tag number form: the 2-byte header is checked once,
+		//the long form length is read with a single load.
+		//Everything else (including errors) takes the generic path below.
+		const auto* data = to_byte_pointer(state.begin);
+		if ((!check_end || state.end - state.begin >= 2)
+			&& (!max_length || *max_length >= 2u)
+			&& !is_high_tag_number(data[0]))
+		{
+			const auto tag = static_cast<tag_type>(data[0]);
+			length_type length = data[1];
+			if (length < 0x80u)
+			{
+				if (max_length)
+					*max_length -= 2u;
+				state.begin += 2;
+				return { tag, length };
+			}
+
+			if (length != 0xffu && (!max_length || length <= *max_length - 2u))
+			{
+				length &= 0x7fu;
+				if (max_length)
+					*max_length -= 2u + length;
+				state.begin += 2;
+				return { tag, decode_integer<length_type,
+					DecodeState, Throw>(length, state) };
+			}
+		}
+	}
+
 	static constexpr bool is_random_access_iterator
 		= RandomAccessIterator<decltype(state.begin)>;
-	if constexpr (is_random_access_iterator)
+	if (check_end)
 	{
-		if (state.end - state.begin < 2)
-			Throw("No tag and length");
-	}
-	else
-	{
-		if (state.begin == state.end)
-			Throw("No tag and length");
+		if constexpr (is_random_access_iterator)
+		{
+			if (state.end - state.begin < 2)
+			{
+				Throw(state, decode_errc::invalid_header, "No tag and length");
+				return {};
+			}
+		}
+		else
+		{
+			if (state.begin == state.end)
+			{
+				Throw(state, decode_errc::invalid_header, "No tag and length");
+				return {};
+			}
+		}
 	}
 
 	if (max_length)
 	{
 		if (*max_length < 2)
-			Throw("No tag and length");
+		{
+			Throw(state, decode_errc::invalid_header, "No tag and length");
+			return {};
+		}
 
 		*max_length -= 2;
 	}
 
-	auto tag = static_cast<tag_type>(*state.begin++);
-	if constexpr (!is_random_access_iterator)
+	auto tag = static_cast<tag_type>(static_cast<std::uint8_t>(*state.begin++));
+	if (is_high_tag_number(tag))
+	{
+		tag = decode_high_tag_number<DecodeState, Throw>(tag, state, max_length);
+		if (failed(state))
+			return {};
+	}
+
+	if (check_end && (!is_random_access_iterator || is_high_tag_number(tag)))
 	{
 		if (state.begin == state.end)
-			Throw("No tag and length");
+		{
+			Throw(state, decode_errc::invalid_header, "No tag and length");
+			return {};
+		}
 	}
 
 	length_type length = static_cast<std::uint8_t>(*state.begin++);
 	if (length > 127u)
 	{
-		if (length == 0xffu)
-			Throw("Invalid length");
-
-		if (max_length && length > *max_length)
-			Throw("Invalid length");
+		if (length == 0xffu || (max_length && length > *max_length))
+		{
+			Throw(state, decode_errc::invalid_header, "Invalid length");
+			return {};
+		}
 
-		length = decode_integer<length_type,
-			DecodeState, Throw>(length & 0x7fu, state);
+		//Long form length octets are a part of the extent too
+		length &= 0x7fu;
+		if (max_length)
+			*max_length -= length;
+		length = decode_integer<length_type, DecodeState, Throw>(length, state);
 	}
 
 	return { tag, length };
@@ -76,9 +187,30 @@ std::pair<tag_type, length_type> decode_type_length_with_context(
 	DecodeState& state,
 	std::size_t* max_length = nullptr)
 {
-	return decode_type_length<DecodeState, ([](const auto& message) {
-		error_helper<Specs>::throw_with_context(message);
-	})>(state, max_length);
+	return decode_type_length<DecodeState,
+		report_with_context<Specs>>(state, max_length);
+}
+
+//Returns the tag of the next element without consuming it.
+//Malformed high tag numbers are returned as the first identifier byte,
+//which does not match any spec tag, the errors are reported when decoding the element.
+template<typename DecodeState>
+[[nodiscard]] tag_type peek_tag(const DecodeState& state)
+{
+	auto it = state.begin;
+	auto first_byte = static_cast<tag_type>(static_cast<std::uint8_t>(*it));
+	if (!is_high_tag_number(first_byte))
+		return first_byte;
+
+	std::uint32_t number = 0;
+	while (++it != state.end && number <= (max_tag_number >> 7u))
+	{
+		auto byte = static_cast<std::uint8_t>(*it);
+		number = (number << 7u) | (byte & 0x7fu);
+		if (!(byte & 0x80u))
+			return make_tag(number, static_cast<std::uint8_t>(first_byte));
+	}
+	return first_byte;
 }
 
 template<typename DecodeState, typename Options,
@@ -195,7 +327,7 @@ struct select_nested_der_decoder<DecodeState, Options, ParentContexts, Spec,
 	{
 		auto old_begin = state.begin;
 		base_der_decoder_type::decode_explicit(value.value, state, length);
-		value.raw = RangeType{ old_begin, state.begin };
+		assign_range(value.raw, old_begin, state.begin, state);
 	}
 
 	static constexpr void decode_implicit(length_type length,
@@ -203,7 +335,143 @@ struct select_nested_der_decoder<DecodeState, Options, ParentContexts, Spec,
 	{
 		auto old_begin = state.begin;
 		base_der_decoder_type::decode_implicit(length, value.value, state);
-		value.raw = RangeType{ old_begin, state.begin };
+		assign_range(value.raw, old_begin, state.begin, state);
+	}
+};
+
+template<typename DecodeState>
+[[nodiscard]] deferred_decode_limits get_deferred_decode_limits(const DecodeState& state) noexcept
+{
+	deferred_decode_limits limits;
+	limits.memory_resource = state.memory_resource;
+	if constexpr (WithRecursionDepthLimit<DecodeState>)
+		limits.max_recursion_depth = state.max_recursion_depth;
+	return limits;
+}
+
+//Decodes the data skipped by the outer decoder with a decode state
+//of the same kind (with or without the recursion depth limit), which has
+//the limits of the outer state. func(state) decodes the value.
+//Throws parse_error if error is null, otherwise stores the error and returns false.
+//Without exceptions, errors without the error pointer terminate the program.
+template<typename DecodeState, typename Iterator, typename IteratorEnd, typename Func>
+[[nodiscard]] bool deferred_decode(Iterator origin, Iterator begin, IteratorEnd end,
+	const deferred_decode_limits& limits, decode_error* error, const Func& func)
+{
+	using state_type = std::conditional_t<
+		WithRecursionDepthLimit<std::remove_cvref_t<DecodeState>>,
+		decode_state_with_recursion_depth_limit<Iterator, IteratorEnd>,
+		decode_state<Iterator, IteratorEnd>>;
+
+	const auto init_state = [&](auto& state) {
+		state.begin = begin;
+		if constexpr (WithRecursionDepthLimit<state_type>)
+			state.max_recursion_depth = limits.max_recursion_depth;
+	};
+
+#if defined(__cpp_exceptions) || defined(_CPPUNWIND)
+	if (!error)
+	{
+		state_type state(origin, end, limits.memory_resource);
+		init_state(state);
+		func(state);
+		return true;
+	}
+#endif //defined(__cpp_exceptions) || defined(_CPPUNWIND)
+
+	nothrow_decode_state<state_type> state(origin, end, limits.memory_resource);
+	init_state(state);
+	func(state);
+	if (!failed(state))
+		return true;
+
+	if (!error)
+		std::abort();
+	*error = state.error;
+	return false;
+}
+
+template<typename DecodeState, typename Options,
+	typename ParentContexts, typename Spec, typename RangeType, typename Value>
+struct select_nested_der_decoder<DecodeState, Options, ParentContexts, Spec,
+	lazy<RangeType, Value>>
+{
+	using base_der_decoder_type = select_nested_der_decoder<DecodeState, Options, ParentContexts, Spec,
+		Value>;
+	using lazy_value_type = lazy<RangeType, Value>;
+	using merged_specs = typename Options::template merge_spec_names<ParentContexts, Spec>;
+
+	template<typename RawDecodeState>
+	using raw_der_decoder_type = select_nested_der_decoder<RawDecodeState&,
+		Options, ParentContexts, Spec, Value>;
+
+	static constexpr bool can_decode(tag_type tag)
+	{
+		return base_der_decoder_type::can_decode(tag);
+	}
+
+	static void decode_explicit(lazy_value_type& value,
+		DecodeState& state, length_type max_length)
+	{
+		auto old_begin = state.begin;
+		auto [tag, len] = decode_type_length_with_context<merged_specs>(state,
+			&max_length);
+		if (failed(state))
+			return;
+
+		if (!can_decode(tag))
+		{
+			if constexpr (requires { base_der_decoder_type::length_decode_error_text; })
+			{
+				error_helper<merged_specs>::report(state, decode_errc::unexpected_tag,
+					base_der_decoder_type::length_decode_error_text);
+			}
+			else
+			{
+				error_helper<merged_specs>::report(state,
+					decode_errc::unexpected_tag, "Unexpected tag");
+			}
+			return;
+		}
+		if (len > max_length)
+		{
+			error_helper<merged_specs>::report(state, decode_errc::invalid_header,
+				"Length is too big and overruns buffer");
+			return;
+		}
+
+		std::advance(state.begin, len);
+		value = lazy_value_type(RangeType{ old_begin, state.begin }, &decode_raw_explicit,
+			get_deferred_decode_limits(state));
+	}
+
+	static void decode_implicit(length_type length,
+		lazy_value_type& value, DecodeState& state)
+	{
+		auto old_begin = state.begin;
+		std::advance(state.begin, length);
+		value = lazy_value_type(RangeType{ old_begin, state.begin }, &decode_raw_implicit,
+			get_deferred_decode_limits(state));
+	}
+
+	static bool decode_raw_explicit(const RangeType& raw, Value& value,
+		const deferred_decode_limits& limits, decode_error* error)
+	{
+		return deferred_decode<DecodeState>(std::ranges::cbegin(raw), std::ranges::cbegin(raw),
+			std::ranges::cend(raw), limits, error, [&](auto& state) {
+				raw_der_decoder_type<std::remove_reference_t<decltype(state)>>::decode_explicit(
+					value, state, std::ranges::size(raw));
+			});
+	}
+
+	static bool decode_raw_implicit(const RangeType& raw, Value& value,
+		const deferred_decode_limits& limits, decode_error* error)
+	{
+		return deferred_decode<DecodeState>(std::ranges::cbegin(raw), std::ranges::cbegin(raw),
+			std::ranges::cend(raw), limits, error, [&](auto& state) {
+				raw_der_decoder_type<std::remove_reference_t<decltype(state)>>::decode_implicit(
+					std::ranges::size(raw), value, state);
+			});
 	}
 };
 
@@ -226,16 +494,22 @@ struct der_decoder_base<der_decoder<DecodeState, Options, ParentContexts, Spec,
 	static void decode_explicit(Value& value,
 		DecodeState& state, length_type max_length)
 	{
-		decode_implicit(decode_length(
-			state, max_length, decoder_impl_type::length_decode_error_text),
-			value, state);
+		auto len = decode_length(
+			state, max_length, decoder_impl_type::length_decode_error_text);
+		if (failed(state))
+			return;
+
+		decode_implicit(len, value, state);
 	}
 
 	static void decode_implicit(length_type len, Value& value,
 		DecodeState& state)
 	{
 		decoder_impl_type::decode_implicit_impl(len, value, state);
-		try_validate_value<Options, ParentContexts, Spec>(value);
+		if (failed(state))
+			return;
+
+		try_validate_value<Options, ParentContexts, Spec>(value, state);
 	}
 
 	static length_type decode_length(DecodeState& state,
@@ -245,15 +519,20 @@ struct der_decoder_base<der_decoder<DecodeState, Options, ParentContexts, Spec,
 			::template merge_spec_names<ParentContexts, Spec>;
 		auto [tag, len] = decode_type_length_with_context<merged_specs>(state,
 			&max_length);
+		if (failed(state))
+			return {};
+
 		if (!can_decode(tag))
 		{
-			error_helper<merged_specs>
-				::throw_with_context(tag_error_text);
+			error_helper<merged_specs>::report(state,
+				decode_errc::unexpected_tag, tag_error_text);
+			return {};
 		}
 		if (len > max_length)
 		{
-			error_helper<merged_specs>
-				::throw_with_context("Length is too big and overruns buffer");
+			error_helper<merged_specs>::report(state, decode_errc::invalid_header,
+				"Length is too big and overruns buffer");
+			return {};
 		}
 		return len;
 	}
@@ -271,7 +550,7 @@ struct der_decoder<DecodeState, Options, ParentContexts, spec::integer<SpecOptio
 	static void decode_implicit_impl(length_type len, Value& value,
 		DecodeState& state)
 	{
-		value = Value{ state.begin, state.begin + len };
+		assign_range(value, state.begin, state.begin + len, state);
 		state.begin += len;
 	}
 };
@@ -329,6 +608,9 @@ struct der_decoder<DecodeState, Options, ParentContexts, spec::boolean<SpecOptio
 			merge_spec_names<ParentContexts, spec::boolean<SpecOptions>>;
 		auto result = decode_integer_with_context<std::uint8_t,
 			merged_specs>(len, state);
+		if (failed(state))
+			return;
+
 		if (result == 0xffu)
 		{
 			value = true;
@@ -339,8 +621,8 @@ struct der_decoder<DecodeState, Options, ParentContexts, spec::boolean<SpecOptio
 		}
 		else
 		{
-			error_helper<merged_specs>
-				::throw_with_context("Invalid BOOLEAN value");
+			error_helper<merged_specs>::report(state,
+				decode_errc::invalid_value, "Invalid BOOLEAN value");
 		}
 	}
 };
@@ -354,21 +636,22 @@ struct der_decoder<DecodeState, Options, ParentContexts, spec::null<SpecOptions>
 	static constexpr const char* length_decode_error_text = "Expected NULL";
 
 	static void decode_implicit_impl(length_type len, std::nullptr_t& value,
-		DecodeState&)
+		DecodeState& state)
 	{
 		if (len)
 		{
 			using merged_specs = typename Options::template
 				merge_spec_names<ParentContexts, spec::null<SpecOptions>>;
-			error_helper<merged_specs>
-				::throw_with_context("Invalid NULL length");
+			error_helper<merged_specs>::report(state,
+				decode_errc::invalid_value, "Invalid NULL length");
+			return;
 		}
 		value = nullptr;
 	}
 };
 
 template<typename DecodeState,
-	typename Options, typename ParentContexts, std::uint8_t Tag, spec::encoding Encoding,
+	typename Options, typename ParentContexts, std::uint32_t Tag, spec::encoding Encoding,
 	spec::cls Class, typename SpecOptions, typename Spec, typename Value>
 struct der_decoder<DecodeState, Options, ParentContexts,
 	spec::tagged_with_options<Tag, Encoding, Class, SpecOptions, Spec>, Value>
@@ -398,7 +681,7 @@ template<typename DecodeState, typename Options,
 struct der_decoder<DecodeState, Options, ParentContexts, spec::any<SpecOptions>, Value>
 {
 	[[nodiscard]]
-	static constexpr bool can_decode(std::uint8_t /* target_tag */) noexcept
+	static constexpr bool can_decode(tag_type /* target_tag */) noexcept
 	{
 		return true;
 	}
@@ -411,10 +694,14 @@ struct der_decoder<DecodeState, Options, ParentContexts, spec::any<SpecOptions>,
 		auto begin = state.begin;
 		auto [tag, len] = decode_type_length_with_context<merged_specs>(state,
 			&max_length);
+		if (failed(state))
+			return;
+
 		if (len > max_length)
 		{
-			error_helper<merged_specs>
-				::throw_with_context("Length is too big and overruns buffer");
+			error_helper<merged_specs>::report(state, decode_errc::invalid_header,
+				"Length is too big and overruns buffer");
+			return;
 		}
 
 		len += state.begin - begin;
@@ -426,10 +713,10 @@ struct der_decoder<DecodeState, Options, ParentContexts, spec::any<SpecOptions>,
 	static void decode_implicit(length_type len, Value& value,
 		DecodeState& state)
 	{
-		value = Value{ state.begin, state.begin + len };
+		assign_range(value, state.begin, state.begin + len, state);
 		state.begin += len;
 		try_validate_value<Options, ParentContexts,
-			spec::any<SpecOptions>>(value);
+			spec::any<SpecOptions>>(value, state);
 	}
 };
 
@@ -439,7 +726,7 @@ struct der_decoder<DecodeState, Options, ParentContexts,
 	spec::extension_marker<SpecOptions>, extension_sentinel>
 {
 	[[nodiscard]]
-	static constexpr bool can_decode(std::uint8_t /* target_tag */) noexcept
+	static constexpr bool can_decode(tag_type /* target_tag */) noexcept
 	{
 		return true;
 	}
@@ -454,10 +741,14 @@ struct der_decoder<DecodeState, Options, ParentContexts,
 			auto begin = state.begin;
 			auto [tag, len] = decode_type_length_with_context<merged_specs>(
 				state, &max_length);
+			if (failed(state))
+				return;
+
 			if (len > max_length)
 			{
-				error_helper<merged_specs>
-					::throw_with_context("Length is too big and overruns buffer");
+				error_helper<merged_specs>::report(state, decode_errc::invalid_header,
+					"Length is too big and overruns buffer");
+				return;
 			}
 
 			state.begin += len;
@@ -473,106 +764,142 @@ struct der_decoder<DecodeState, Options, ParentContexts,
 	}
 };
 
+//Dispatches CHOICE and SET elements by tag. Child decoders are called
+//directly from a chain of tag comparisons, which compilers lower into
+//a jump table or a binary search, and can inline hot alternatives.
 template<typename DecodeState,
 	typename Options, typename TypeByIndex, typename ParentContexts,
 	typename... Specs>
 struct unique_tags_decoder
 {
-public:
-	//TODO: limit array size by the max tag value from the underlying types
-	using child_decoder_list_type = std::array<
-		typename TypeByIndex::template child_decoder_type<DecodeState>,
-		(std::numeric_limits<tag_type>::max)()>;
-
 private:
-	static constexpr child_decoder_list_type collect_decoders() noexcept
+	template<typename Spec, std::size_t Index>
+	using nested_decoder_type = select_nested_der_decoder<DecodeState, Options,
+		ParentContexts, Spec, typename TypeByIndex::template type<Index>>;
+
+	template<typename Spec, std::size_t Index>
+	static constexpr std::size_t count_tags() noexcept
 	{
-		constexpr auto result = collect_decoders_impl(
-			std::index_sequence_for<Specs...>{});
-		static_assert(result.second, "Duplicate tags in unique tags spec");
-		return result.first;
+		if constexpr (spec_traits<Spec>::is_choice)
+		{
+			return std::tuple_size_v<std::remove_cvref_t<
+				decltype(nested_decoder_type<Spec, Index>::contained_tag_list)>>;
+		}
+		else
+		{
+			static_assert(!any_traits<Spec>::is_any,
+				"ANY inside unique tag spec is not supported");
+			return 1u;
+		}
 	}
 
 	template<std::size_t... Indexes>
-	static constexpr std::pair<child_decoder_list_type, bool> collect_decoders_impl(
-		std::index_sequence<Indexes...>) noexcept
+	static constexpr std::size_t count_all_tags(std::index_sequence<Indexes...>) noexcept
+	{
+		return (0u + ... + count_tags<Specs, Indexes>());
+	}
+
+	static constexpr std::size_t tag_count
+		= count_all_tags(std::index_sequence_for<Specs...>{});
+
+	using tag_list_type = std::array<tag_type, tag_count>;
+
+	static constexpr tag_list_type collect_tags() noexcept
 	{
-		std::pair<child_decoder_list_type, bool> result{ {}, true };
-		(..., add_decoders<Specs, Indexes>(result.first, result.second));
+		constexpr auto result = collect_tags_impl(std::index_sequence_for<Specs...>{});
+		static_assert(std::ranges::adjacent_find(result) == result.end(),
+			"Duplicate tags in unique tags spec");
+		return result;
+	}
+
+	template<std::size_t... Indexes>
+	static constexpr tag_list_type collect_tags_impl(std::index_sequence<Indexes...>) noexcept
+	{
+		tag_list_type result{};
+		auto it = result.begin();
+		(..., add_tags<Specs, Indexes>(it));
+		std::ranges::sort(result);
 		return result;
 	}
 
 	template<typename Spec, std::size_t Index>
-	static constexpr void add_decoders(child_decoder_list_type& decoders, bool& valid) noexcept
+	static constexpr void add_tags(typename tag_list_type::iterator& it) noexcept
 	{
-		using child_type = typename TypeByIndex::template type<Index>;
-		using nested_decoder_type = select_nested_der_decoder<DecodeState, Options,
-			ParentContexts, Spec, child_type>;
-		constexpr auto child_decoder = TypeByIndex::template create_child_decoder<
-			Options, DecodeState, nested_decoder_type, ParentContexts, Spec, Index>();
-		if constexpr (!spec_traits<Spec>::is_choice)
+		if constexpr (spec_traits<Spec>::is_choice)
 		{
-			constexpr bool is_any = any_traits<Spec>::is_any;
-			static_assert(!is_any, "ANY inside unique tag spec is not supported");
-			if constexpr (!is_any)
-			{
-				constexpr tag_type tag = Spec::tag();
-				if (decoders[tag])
-					valid = false;
-
-				decoders[tag] = child_decoder;
-			}
+			for (tag_type tag : nested_decoder_type<Spec, Index>::contained_tag_list)
+				*it++ = tag;
 		}
 		else
 		{
-			for (std::size_t i = 0;
-				i != std::tuple_size_v<decltype(nested_decoder_type::contained_tag_list)>; ++i)
-			{
-				tag_type tag = nested_decoder_type::contained_tag_list[i];
-				if (decoders[tag])
-					valid = false;
-
-				decoders[tag] = child_decoder;
-			}
+			*it++ = Spec::tag();
 		}
 	}
 
 public:
-	static constexpr child_decoder_list_type child_decoders{
-		collect_decoders() };
+	//All tags, which can be decoded, in the ascending order
+	static constexpr tag_list_type contained_tag_list{ collect_tags() };
 
 	[[nodiscard]]
 	static constexpr bool can_decode(tag_type target_tag) noexcept
 	{
-		return child_decoders[target_tag];
+		return can_decode_impl(target_tag, std::make_index_sequence<tag_count>{});
+	}
+
+	//Decodes the element contents with the child decoder, which matches the tag.
+	//Returns false if there is no such decoder.
+	template<typename... Args>
+	static bool decode_child(tag_type tag, length_type len, Args&... args)
+	{
+		return decode_child_impl(tag, len, std::index_sequence_for<Specs...>{}, args...);
+	}
+
+private:
+	template<std::size_t... Indexes>
+	static constexpr bool can_decode_impl(tag_type target_tag,
+		std::index_sequence<Indexes...>) noexcept
+	{
+		return (... || (target_tag == contained_tag_list[Indexes]));
+	}
+
+	template<typename Spec, std::size_t Index>
+	static constexpr bool matches(tag_type tag) noexcept
+	{
+		if constexpr (spec_traits<Spec>::is_choice)
+			return nested_decoder_type<Spec, Index>::can_decode(tag);
+		else
+			return tag == Spec::tag();
+	}
+
+	template<std::size_t... Indexes, typename... Args>
+	static bool decode_child_impl(tag_type tag, length_type len,
+		std::index_sequence<Indexes...>, Args&... args)
+	{
+		return (... || (matches<Specs, Indexes>(tag)
+			&& (TypeByIndex::template decode_child<Options, DecodeState,
+				nested_decoder_type<Specs, Indexes>, ParentContexts, Specs, Indexes>(
+					tag, len, args...), true)));
 	}
 };
 
 template<typename Variant>
 struct choice_type_by_index final
 {
-	template<typename DecodeState>
-	using child_decoder_type = void(*)(tag_type, length_type, Variant&,
-		DecodeState&);
-
 	template<typename Options, typename DecodeState, typename NestedDecoderType,
 		typename ParentContexts, typename Spec, std::size_t Index>
-	[[nodiscard]]
-	static constexpr child_decoder_type<DecodeState> create_child_decoder() noexcept
+	static void decode_child([[maybe_unused]] tag_type tag, length_type len,
+		Variant& value, DecodeState& state)
 	{
-		return []([[maybe_unused]] tag_type tag, length_type len,
-			Variant& value, DecodeState& state) {
-			if constexpr (spec_traits<Spec>::is_choice)
-			{
-				NestedDecoderType::decode_known_tag(
-					tag, len, value.template emplace<Index>(), state);
-			}
-			else
-			{
-				NestedDecoderType::decode_implicit(
-					len, value.template emplace<Index>(), state);
-			}
-		};
+		if constexpr (spec_traits<Spec>::is_choice)
+		{
+			NestedDecoderType::decode_known_tag(
+				tag, len, value.template emplace<Index>(), state);
+		}
+		else
+		{
+			NestedDecoderType::decode_implicit(
+				len, value.template emplace<Index>(), state);
+		}
 	}
 
 	template<std::size_t Index>
@@ -601,10 +928,14 @@ struct der_decoder<DecodeState, Options, ParentContexts,
 	{
 		auto [tag, len] = decode_type_length_with_context<this_parent_specs>(
 			state, &max_length);
+		if (failed(state))
+			return;
+
 		if (len > max_length)
 		{
-			error_helper<this_parent_specs>
-				::throw_with_context("Invalid CHOICE element length");
+			error_helper<this_parent_specs>::report(state,
+				decode_errc::invalid_header, "Invalid CHOICE element length");
+			return;
 		}
 		decode_known_tag(tag, len, value, state);
 	}
@@ -612,16 +943,18 @@ struct der_decoder<DecodeState, Options, ParentContexts,
 	static void decode_known_tag(tag_type tag, length_type len,
 		std::variant<Values...>& value, DecodeState& state)
 	{
-		auto child_decoder = base_type::child_decoders[tag];
-		if (!child_decoder)
+		if (!base_type::decode_child(tag, len, value, state))
 		{
-			error_helper<this_parent_specs>
-				::throw_with_context("Unable to decode CHOICE");
+			error_helper<this_parent_specs>::report(state,
+				decode_errc::unexpected_tag, "Unable to decode CHOICE");
+			return;
 		}
 
-		child_decoder(tag, len, value, state);
+		if (failed(state))
+			return;
+
 		try_validate_value<Options, ParentContexts,
-			spec::choice_with_options<SpecOptions, Specs...>>(value);
+			spec::choice_with_options<SpecOptions, Specs...>>(value, state);
 	}
 
 	template<typename Dummy>
@@ -631,41 +964,103 @@ struct der_decoder<DecodeState, Options, ParentContexts,
 			"CHOICE can not be decoded/tagged implicitly");
 	}
 
-private:
-	static constexpr std::size_t count_contained_tags() noexcept
+};
+
+//Returns the index of the registry entry for the OID field value
+//(decoded OID or raw OID contents), or oid_map::npos
+template<typename OidMap, typename OidValue>
+[[nodiscard]] std::size_t select_open_type(const OidValue& oid) noexcept
+{
+	if constexpr (OptionalType<OidValue>)
+		return oid ? select_open_type<OidMap>(*oid) : OidMap::npos;
+	else
+		return OidMap::find(oid);
+}
+
+template<typename DecodeState, typename Options, typename ParentContexts,
+	std::size_t OidFieldIndex, typename... Entries, typename FallbackSpec,
+	typename SpecOptions, typename... Values>
+struct der_decoder<DecodeState, Options, ParentContexts,
+	spec::open_type<OidFieldIndex, spec::open_type_registry<Entries...>,
+		FallbackSpec, SpecOptions>,
+	std::variant<Values...>>
+{
+	static_assert(sizeof...(Values) == sizeof...(Entries) + 1u,
+		"Variant must have the fallback alternative and one alternative"
+		" for each open type registry entry");
+
+	using spec_type = spec::open_type<OidFieldIndex,
+		spec::open_type_registry<Entries...>, FallbackSpec, SpecOptions>;
+	using this_parent_specs = typename Options::template merge_spec_names<
+		ParentContexts, spec_type>;
+	using oid_map_type = asn1::oid_map<Entries::oid...>;
+	using value_type = std::variant<Values...>;
+
+	template<std::size_t Index>
+	using alternative_decoder_type = select_nested_der_decoder<DecodeState, Options,
+		this_parent_specs,
+		std::tuple_element_t<Index, std::tuple<FallbackSpec, typename Entries::spec_type...>>,
+		std::variant_alternative_t<Index, value_type>>;
+
+	[[nodiscard]]
+	static constexpr bool can_decode(tag_type tag) noexcept
 	{
-		std::size_t result = 0;
-		for (auto decoder : base_type::child_decoders)
-		{
-			if (decoder)
-				++result;
-		}
-		return result;
+		return can_decode_impl(tag, std::index_sequence_for<Values...>{});
 	}
 
-	static constexpr auto create_contained_tag_list() noexcept
+	//Decodes the alternative for the selected registry entry
+	//(or the fallback alternative, if selected is oid_map_type::npos)
+	static void decode_selected(std::size_t selected, value_type& value,
+		DecodeState& state, length_type max_length)
 	{
-		constexpr auto tag_count = count_contained_tags();
-		std::array<tag_type, tag_count> result{};
-		std::size_t i = 0;
-		for (std::size_t decoder_index = 0;
-			decoder_index != base_type::child_decoders.size(); ++decoder_index)
-		{
-			if (base_type::child_decoders[decoder_index])
-				result[i++] = static_cast<tag_type>(decoder_index);
-		}
-		return result;
+		auto index = selected == oid_map_type::npos ? 0u : selected + 1u;
+		decode_alternative(index, value, state, max_length,
+			std::index_sequence_for<Values...>{});
+		if (failed(state))
+			return;
+
+		try_validate_value<Options, ParentContexts, spec_type>(value, state);
 	}
 
-public:
-	static constexpr auto contained_tag_list{ create_contained_tag_list() };
+	template<typename Dummy>
+	static void decode_explicit(Dummy&, DecodeState&, length_type)
+	{
+		static_assert(std::is_same_v<Dummy, sentinel>,
+			"Open type can only be decoded as a SEQUENCE field");
+	}
+
+	template<typename Dummy>
+	static void decode_implicit(length_type, Dummy&, DecodeState&)
+	{
+		static_assert(std::is_same_v<Dummy, sentinel>,
+			"Open type can not be decoded/tagged implicitly");
+	}
+
+private:
+	template<std::size_t... Indexes>
+	[[nodiscard]]
+	static constexpr bool can_decode_impl(tag_type tag,
+		std::index_sequence<Indexes...>) noexcept
+	{
+		return (... || alternative_decoder_type<Indexes>::can_decode(tag));
+	}
+
+	template<std::size_t... Indexes>
+	static void decode_alternative(std::size_t index, value_type& value,
+		DecodeState& state, length_type max_length, std::index_sequence<Indexes...>)
+	{
+		(void)(... || (index == Indexes
+			&& (alternative_decoder_type<Indexes>::decode_explicit(
+				value.template emplace<Indexes>(), state, max_length), true)));
+	}
 };
 
 template<typename DecodeState,
 	typename Options, typename ParentContexts, typename Spec, OptionalType Value>
 struct der_decoder<DecodeState, Options, ParentContexts,
 	spec::optional<Spec>, Value>
-	: der_decoder<DecodeState, Options, ParentContexts, Spec, typename ptr_traits<Value>::type>
+	: select_nested_der_decoder<DecodeState, Options, ParentContexts, Spec,
+		typename ptr_traits<Value>::type>
 {
 	using nested_decoder_type = select_nested_der_decoder<
 		DecodeState, Options, ParentContexts, Spec, typename ptr_traits<Value>::type>;
@@ -676,8 +1071,11 @@ struct der_decoder<DecodeState, Options, ParentContexts,
 		auto& nested_value = ptr_traits<Value>::make(value);
 		nested_decoder_type::decode_explicit(
 			nested_value, state, max_length);
+		if (failed(state))
+			return;
+
 		try_validate_value<Options, ParentContexts,
-			spec::optional<Spec>>(nested_value);
+			spec::optional<Spec>>(nested_value, state);
 	}
 
 	static void decode_implicit(length_type len, Value& value,
@@ -685,8 +1083,11 @@ struct der_decoder<DecodeState, Options, ParentContexts,
 	{
 		auto& nested_value = ptr_traits<Value>::make(value);
 		nested_decoder_type::decode_implicit(len, nested_value, state);
+		if (failed(state))
+			return;
+
 		try_validate_value<Options, ParentContexts,
-			spec::optional<Spec>>(nested_value);
+			spec::optional<Spec>>(nested_value, state);
 	}
 
 	static void decode_known_tag(tag_type tag, length_type len,
@@ -696,8 +1097,24 @@ struct der_decoder<DecodeState, Options, ParentContexts,
 		auto& nested_value = ptr_traits<Value>::make(value);
 		nested_decoder_type::decode_known_tag(tag, len,
 			nested_value, state);
+		if (failed(state))
+			return;
+
 		try_validate_value<Options, ParentContexts,
-			spec::optional<Spec>>(nested_value);
+			spec::optional<Spec>>(nested_value, state);
+	}
+	static void decode_selected(std::size_t selected, Value& value,
+		DecodeState& state, length_type max_length)
+		requires (open_type_traits<Spec>::is_open_type)
+	{
+		auto& nested_value = ptr_traits<Value>::make(value);
+		nested_decoder_type::decode_selected(selected,
+			nested_value, state, max_length);
+		if (failed(state))
+			return;
+
+		try_validate_value<Options, ParentContexts,
+			spec::optional<Spec>>(nested_value, state);
 	}
 };
 
@@ -706,7 +1123,7 @@ template<typename DecodeState,
 	typename ParentContexts, typename Spec, typename Value>
 struct der_decoder<DecodeState, Options, ParentContexts,
 	spec::optional_default<DefaultValueProvider, Spec>, Value>
-	: der_decoder<DecodeState, Options, ParentContexts, Spec, Value>
+	: select_nested_der_decoder<DecodeState, Options, ParentContexts, Spec, Value>
 {
 	using nested_decoder_type = select_nested_der_decoder<
 		DecodeState, Options, ParentContexts, Spec, Value>;
@@ -715,16 +1132,22 @@ struct der_decoder<DecodeState, Options, ParentContexts,
 		DecodeState& state, length_type max_length)
 	{
 		nested_decoder_type::decode_explicit(value, state, max_length);
+		if (failed(state))
+			return;
+
 		try_validate_value<Options, ParentContexts,
-			spec::optional_default<DefaultValueProvider, Spec>>(value);
+			spec::optional_default<DefaultValueProvider, Spec>>(value, state);
 	}
 	
 	static void decode_implicit(length_type len, Value& value,
 		DecodeState& state)
 	{
 		nested_decoder_type::decode_implicit(len, value, state);
+		if (failed(state))
+			return;
+
 		try_validate_value<Options, ParentContexts,
-			spec::optional_default<DefaultValueProvider, Spec>>(value);
+			spec::optional_default<DefaultValueProvider, Spec>>(value, state);
 	}
 
 	static void decode_known_tag(tag_type tag, length_type len,
@@ -733,8 +1156,11 @@ struct der_decoder<DecodeState, Options, ParentContexts,
 	{
 		nested_decoder_type::decode_known_tag(tag, len,
 			value, state);
+		if (failed(state))
+			return;
+
 		try_validate_value<Options, ParentContexts,
-			spec::optional_default<DefaultValueProvider, Spec>>(value);
+			spec::optional_default<DefaultValueProvider, Spec>>(value, state);
 	}
 };
 
@@ -757,17 +1183,21 @@ struct der_decoder<DecodeState, Options, ParentContexts,
 		static_assert(boost::pfr::tuple_size_v<Value> == sizeof...(Specs),
 			"Value structure must have the same amount of fields"
 			" as the number of nested SEQUENCE specifications");
-		if (!decode_field<0, sizeof...(Specs), Specs...>(len, value, state))
+		bool fully_consumed = decode_field<0, sizeof...(Specs), Specs...>(len, value, state);
+		if (failed(state))
+			return;
+
+		if (!fully_consumed)
 		{
-			error_helper<this_parent_spec>
-				::throw_with_context("SEQUENCE data is not fully consumed");
+			error_helper<this_parent_spec>::report(state,
+				decode_errc::unconsumed_data, "SEQUENCE data is not fully consumed");
 		}
 	}
 
 private:
 	template<std::size_t Index, std::size_t MaxIndex,
 		typename Spec, typename... RemainingSpecs>
-	static std::size_t decode_field(length_type len,
+	static bool decode_field(length_type len,
 		Value& value, DecodeState& state)
 	{
 		auto& field = boost::pfr::get<Index>(value);
@@ -784,8 +1214,9 @@ private:
 			}
 			else if constexpr (!optional_traits_type::is_optional)
 			{
-				error_helper<merged_specs>
-					::throw_with_context("Unable to decode SEQUENCE required member, no data left");
+				error_helper<merged_specs>::report(state, decode_errc::missing_element,
+					"Unable to decode SEQUENCE required member, no data left");
+				return false;
 			}
 			else if constexpr (optional_traits_type::has_default)
 			{
@@ -794,19 +1225,34 @@ private:
 		}
 		else
 		{
-			auto tag = static_cast<tag_type>(*state.begin);
-			if (nested_decoder_type::can_decode(tag))
+			if (nested_decoder_type::can_decode(peek_tag(state)))
 			{
 				auto begin = state.begin;
-				nested_decoder_type::decode_explicit(field, state, len);
+				if constexpr (open_type_traits<Spec>::is_open_type)
+				{
+					static_assert(Spec::oid_field_index < Index,
+						"Open type OID field must precede the open type");
+					nested_decoder_type::decode_selected(
+						select_open_type<typename nested_decoder_type::oid_map_type>(
+							boost::pfr::get<Spec::oid_field_index>(value)),
+						field, state, len);
+				}
+				else
+				{
+					nested_decoder_type::decode_explicit(field, state, len);
+				}
+				if (failed(state))
+					return false;
+
 				len -= state.begin - begin;
 			}
 			else
 			{
 				if constexpr (!optional_traits_type::is_optional)
 				{
-					error_helper<merged_specs>
-						::throw_with_context("Non-matching nested SEQUENCE type");
+					error_helper<merged_specs>::report(state, decode_errc::unexpected_tag,
+						"Non-matching nested SEQUENCE type");
+					return false;
 				}
 				else if constexpr (optional_traits_type::has_default)
 				{
@@ -822,6 +1268,138 @@ private:
 	}
 };
 
+//Calls func(begin, offset, length) for every SEQUENCE OF / SET OF element by skipping
+//their headers. offset is relative to the first element, length includes the header.
+//Stops at the first malformed header, which is reported when the elements are decoded.
+//Returns the length which was left unscanned.
+template<typename DecodeState, typename Func>
+length_type for_each_element(const DecodeState& state, length_type len, Func&& func)
+{
+	constexpr auto stop_scanning = [](auto& skip_state, decode_errc code, const auto&) {
+		skip_state.error.code = code;
+	};
+
+	nothrow_decode_state<decode_state<decltype(state.begin), decltype(state.end)>>
+		skip_state(state.begin, state.end);
+	length_type offset = 0;
+	while (len)
+	{
+		auto begin = skip_state.begin;
+		auto max_length = len;
+		auto [tag, element_len] = decode_type_length<decltype(skip_state),
+			stop_scanning>(skip_state, &max_length);
+		if (failed(skip_state))
+			break;
+
+		auto header_len = static_cast<length_type>(std::distance(begin, skip_state.begin));
+		if (element_len > len - header_len)
+			break;
+
+		func(begin, offset, header_len + element_len);
+		len -= header_len + element_len;
+		offset += header_len + element_len;
+		std::advance(skip_state.begin, element_len);
+	}
+	return len;
+}
+
+//Counts SEQUENCE OF / SET OF elements by skipping their headers
+template<typename DecodeState>
+[[nodiscard]] std::size_t count_elements(const DecodeState& state, length_type len)
+{
+	std::size_t count = 0;
+	for_each_element(state, len, [&count](const auto&, length_type, length_type) { ++count; });
+	return count;
+}
+
+//The least number of bytes a DER value of the Spec type takes (tag and length bytes
+//included). Bounds the number of elements a SEQUENCE OF / SET OF of a given length
+//may hold, so that the element headers alone can not make the decoder reserve
+//more elements than the contents can fit.
+template<typename Spec>
+struct min_encoded_length
+{
+	static constexpr length_type value = 2u;
+};
+
+template<typename Spec>
+constexpr length_type min_encoded_length_v = min_encoded_length<Spec>::value;
+
+//Absent OPTIONAL and DEFAULT fields and extension markers take no bytes
+template<typename Spec>
+constexpr length_type min_field_encoded_length_v = optional_traits<Spec>::is_optional
+	|| extension_traits<Spec>::is_extension_marker ? 0u : min_encoded_length_v<Spec>;
+
+//BOOLEAN, INTEGER, ENUMERATED, BIT STRING and OBJECT IDENTIFIER contents are never empty
+template<typename SpecOptions>
+struct min_encoded_length<spec::boolean<SpecOptions>>
+{
+	static constexpr length_type value = 3u;
+};
+
+template<typename SpecOptions>
+struct min_encoded_length<spec::integer<SpecOptions>>
+{
+	static constexpr length_type value = 3u;
+};
+
+template<typename SpecOptions>
+struct min_encoded_length<spec::enumerated<SpecOptions>>
+{
+	static constexpr length_type value = 3u;
+};
+
+template<typename SpecOptions>
+struct min_encoded_length<spec::bit_string<SpecOptions>>
+{
+	static constexpr length_type value = 3u;
+};
+
+template<typename SpecOptions>
+struct min_encoded_length<spec::object_identifier<SpecOptions>>
+{
+	static constexpr length_type value = 3u;
+};
+
+template<typename SpecOptions, typename... Specs>
+struct min_encoded_length<spec::sequence_with_options<SpecOptions, Specs...>>
+{
+	static constexpr length_type value = 2u
+		+ (length_type{} + ... + min_field_encoded_length_v<Specs>);
+};
+
+template<typename SpecOptions, typename... Specs>
+struct min_encoded_length<spec::set_with_options<SpecOptions, Specs...>>
+{
+	static constexpr length_type value = 2u
+		+ (length_type{} + ... + min_field_encoded_length_v<Specs>);
+};
+
+template<typename SpecOptions, typename... Specs>
+struct min_encoded_length<spec::choice_with_options<SpecOptions, Specs...>>
+{
+	static constexpr length_type value = (std::min)({ min_encoded_length_v<Specs>... });
+};
+
+template<std::uint32_t Tag, spec::encoding Encoding,
+	spec::cls Class, typename SpecOptions, typename NestedSpec>
+struct min_encoded_length<spec::tagged_with_options<Tag, Encoding, Class,
+	SpecOptions, NestedSpec>>
+{
+	static constexpr length_type value = (Encoding == spec::encoding::expl ? 2u : 0u)
+		+ min_encoded_length_v<NestedSpec>;
+};
+
+template<typename EncapsulatedSpec, typename SpecOptions>
+struct min_encoded_length<spec::octet_string_with<EncapsulatedSpec, SpecOptions>>
+{
+	static constexpr length_type value = 2u + min_encoded_length_v<EncapsulatedSpec>;
+};
+
+//Set on the threads which decode SEQUENCE OF / SET OF elements in parallel,
+//nested lists are decoded on these threads without spawning new ones
+inline thread_local bool in_parallel_decode = false;
+
 template<typename DecodeState,
 	typename Options, typename ParentContexts, template<typename, typename> typename SequenceOf,
 	typename Spec, typename SpecOptions, SequentialContainer Value>
@@ -835,25 +1413,224 @@ struct sequence_of_der_decoder
 	using merged_specs = typename Options::template
 		merge_spec_names<ParentContexts, Spec>;
 
+	//element_count is the number of elements if the headers have already been scanned
+	static void reserve_elements(length_type len, Value& value, DecodeState& state,
+		[[maybe_unused]] std::optional<std::size_t> element_count)
+	{
+		using reserve_option_type = typename SequenceOf<SpecOptions, Spec>
+			::template option_by_category<option_cat::reserve>;
+		if constexpr (!std::is_same_v<reserve_option_type, void>
+			&& requires { value.reserve(value.size()); })
+		{
+			using min_max_elements_option_type = typename SequenceOf<SpecOptions, Spec>
+				::template option_by_category<option_cat::min_max_elements>;
+			std::size_t elements = reserve_option_type::elems;
+			if constexpr (reserve_option_type::count_elements)
+			{
+				elements = element_count ? *element_count : count_elements(state, len);
+				//The headers are not validated yet
+				elements = (std::min)(elements, len / min_encoded_length_v<Spec>);
+			}
+			if constexpr (!std::is_same_v<min_max_elements_option_type, void>)
+				elements = (std::min)(elements, min_max_elements_option_type::max_elems);
+			value.reserve(value.size() + elements);
+		}
+	}
+
+	//Decodes a single element found by for_each_element, returns false
+	//if it fails to decode or does not consume exactly its length
+	template<typename Iterator>
+	[[nodiscard]] static bool decode_element(typename Value::value_type& element,
+		const DecodeState& state, Iterator begin, length_type len) noexcept
+	{
+		auto element_state = state;
+		element_state.begin = begin;
+#if defined(__cpp_exceptions) || defined(_CPPUNWIND)
+		try
+		{
+#endif //defined(__cpp_exceptions) || defined(_CPPUNWIND)
+			nested_decoder_type::decode_explicit(element, element_state, len);
+#if defined(__cpp_exceptions) || defined(_CPPUNWIND)
+		}
+		catch (...)
+		{
+			return false;
+		}
+#endif //defined(__cpp_exceptions) || defined(_CPPUNWIND)
+		return !failed(element_state)
+			&& std::distance(begin, element_state.begin) == static_cast<std::ptrdiff_t>(len);
+	}
+
+	struct parallel_decode_result
+	{
+		//Number of elements decoded and appended to the value
+		std::size_t decoded{};
+		//Number of elements, if their headers have been scanned
+		std::optional<std::size_t> element_count;
+		//The value has been resized to hold all elements, so reserving is not needed
+		bool resized{};
+	};
+
+	//See opts::parallel_decode. Appends the decoded elements to the value,
+	//state and len are advanced past them. Stops before the first element
+	//(in document order) which fails to decode: the serial loop then decodes it again
+	//and reports the error the same way the single-threaded decoding does.
+	static parallel_decode_result decode_parallel(length_type& len,
+		Value& value, DecodeState& state)
+	{
+		using parallel_option_type = typename SequenceOf<SpecOptions, Spec>
+			::template option_by_category<option_cat::parallel>;
+		if constexpr (!std::is_same_v<parallel_option_type, void>
+			&& std::is_copy_constructible_v<DecodeState>
+			&& requires { value.resize(value.size()); value[value.size()]; })
+		{
+			using min_max_elements_option_type = typename SequenceOf<SpecOptions, Spec>
+				::template option_by_category<option_cat::min_max_elements>;
+
+			//Every element takes at least two bytes
+			if (in_parallel_decode || state.memory_resource
+				|| len / 2u < parallel_option_type::min_elems)
+			{
+				return {};
+			}
+
+			std::size_t threads = parallel_option_type::max_threads;
+			if (!threads)
+				threads = std::thread::hardware_concurrency();
+			if (threads < 2u)
+				return {};
+
+			struct element_extent
+			{
+				decltype(state.begin) begin;
+				length_type offset;
+				length_type length;
+			};
+			std::vector<element_extent> elements;
+			if (for_each_element(state, len, [&elements](auto begin,
+				length_type offset, length_type length) {
+				elements.push_back({ begin, offset, length });
+			}))
+			{
+				//Malformed header, the serial loop reports it
+				return {};
+			}
+
+			const auto count = elements.size();
+			if (count < parallel_option_type::min_elems)
+				return { 0u, count };
+			if constexpr (!std::is_same_v<min_max_elements_option_type, void>)
+			{
+				if (count < min_max_elements_option_type::min_elems
+					|| count > min_max_elements_option_type::max_elems)
+				{
+					return { 0u, count };
+				}
+			}
+
+			threads = (std::min)(threads, count);
+			const auto chunk_size = (std::max)(count / (threads * 8u), std::size_t{ 1u });
+			const auto first = value.size();
+			value.resize(first + count);
+
+			std::atomic<std::size_t> next{};
+			std::atomic<std::size_t> failed_index{ count };
+			auto work = [&]() noexcept {
+				const auto was_in_parallel_decode = in_parallel_decode;
+				in_parallel_decode = true;
+				for (;;)
+				{
+					auto index = next.fetch_add(chunk_size, std::memory_order_relaxed);
+					const auto last = (std::min)(index + chunk_size, count);
+					for (; index < last; ++index)
+					{
+						//Elements after the failed one are dropped anyway
+						auto failed_at = failed_index.load(std::memory_order_relaxed);
+						if (index > failed_at)
+							break;
+
+						const auto& element = elements[index];
+						if (!decode_element(value[first + index], state,
+							element.begin, element.length))
+						{
+							while (index < failed_at && !failed_index.compare_exchange_weak(
+								failed_at, index, std::memory_order_relaxed)) {}
+							break;
+						}
+					}
+					if (index >= count)
+						break;
+				}
+				in_parallel_decode = was_in_parallel_decode;
+			};
+
+			std::vector<std::thread> workers;
+			workers.reserve(threads - 1u);
+#if defined(__cpp_exceptions) || defined(_CPPUNWIND)
+			try
+			{
+#endif //defined(__cpp_exceptions) || defined(_CPPUNWIND)
+				while (workers.size() != threads - 1u)
+					workers.emplace_back(work);
+#if defined(__cpp_exceptions) || defined(_CPPUNWIND)
+			}
+			catch (...)
+			{
+				//The calling thread decodes the elements the workers do not take
+			}
+#endif //defined(__cpp_exceptions) || defined(_CPPUNWIND)
+			work();
+			for (auto& worker : workers)
+				worker.join();
+
+			const auto decoded = failed_index.load(std::memory_order_relaxed);
+			value.resize(first + decoded);
+			if (decoded == count)
+			{
+				state.begin = elements.back().begin;
+				std::advance(state.begin, elements.back().length);
+				len = 0u;
+			}
+			else
+			{
+				state.begin = elements[decoded].begin;
+				len -= elements[decoded].offset;
+			}
+			return { decoded, count, true };
+		}
+		else
+		{
+			return {};
+		}
+	}
+
 	static void decode_implicit_impl(length_type len,
 		Value& value, DecodeState& state)
 	{
 		using min_max_elements_option_type = typename SequenceOf<SpecOptions, Spec>
 			::template option_by_category<option_cat::min_max_elements>;
-		[[maybe_unused]] std::size_t element_count = 0;
+		use_memory_resource(value, state);
+		const auto parallel_result = decode_parallel(len, value, state);
+		if (!parallel_result.resized)
+			reserve_elements(len, value, state, parallel_result.element_count);
+		[[maybe_unused]] std::size_t element_count = parallel_result.decoded;
 		while (len)
 		{
 			if constexpr (!std::is_same_v<min_max_elements_option_type, void>)
 			{
 				if (++element_count > min_max_elements_option_type::max_elems)
 				{
-					error_helper<merged_specs>
-						::throw_with_context("Too many elements");
+					error_helper<merged_specs>::report(state,
+						decode_errc::element_count, "Too many elements");
+					return;
 				}
 			}
 
 			auto begin = state.begin;
 			nested_decoder_type::decode_explicit(value.emplace_back(), state, len);
+			if (failed(state))
+				return;
+
 			len -= state.begin - begin;
 		}
 
@@ -863,8 +1640,8 @@ struct sequence_of_der_decoder
 			{
 				if (element_count < min_max_elements_option_type::min_elems)
 				{
-					error_helper<merged_specs>
-						::throw_with_context("Too few elements");
+					error_helper<merged_specs>::report(state,
+						decode_errc::element_count, "Too few elements");
 				}
 			}
 		}
@@ -893,84 +1670,129 @@ struct der_decoder<DecodeState, Options, ParentContexts,
 	static constexpr const char* length_decode_error_text = "Expected SET OF";
 };
 
-struct [[nodiscard]] marked_tags
+//Records the SEQUENCE OF / SET OF contents, the elements are decoded while iterating
+template<typename DecodeState,
+	typename Options, typename ParentContexts, template<typename, typename> typename SequenceOf,
+	typename Spec, typename SpecOptions, typename RangeType, typename Value>
+struct sequence_of_view_der_decoder
+	: der_decoder_base<der_decoder<DecodeState, Options,
+		ParentContexts, SequenceOf<SpecOptions, Spec>, sequence_of_view<RangeType, Value>>>
 {
-private:
-	using section_type = std::uint64_t;
-	static constexpr auto section_digits
-		= std::numeric_limits<std::uint64_t>::digits;
+	using view_type = sequence_of_view<RangeType, Value>;
+	using raw_iterator_type = typename view_type::raw_iterator_type;
 
-public:
-	[[nodiscard]]
-	bool mark(tag_type tag) noexcept
+	template<typename RawDecodeState>
+	using element_decoder_type = select_nested_der_decoder<RawDecodeState&, Options,
+		typename Options::template merge_spec_names<ParentContexts, SequenceOf<SpecOptions, Spec>>,
+		Spec, Value>;
+	using merged_specs = typename Options::template
+		merge_spec_names<ParentContexts, Spec>;
+
+	//min_max_elements is checked by counting the element headers
+	static void decode_implicit_impl(length_type len,
+		view_type& value, DecodeState& state)
 	{
-		auto& section = marked_[tag / section_digits];
-		auto bit = 1ull << (tag % section_digits);
-		if (section & bit)
-			return false;
+		using min_max_elements_option_type = typename SequenceOf<SpecOptions, Spec>
+			::template option_by_category<option_cat::min_max_elements>;
+		if constexpr (!std::is_same_v<min_max_elements_option_type, void>)
+		{
+			const auto element_count = count_elements(state, len);
+			if (element_count > min_max_elements_option_type::max_elems)
+			{
+				error_helper<merged_specs>::report(state,
+					decode_errc::element_count, "Too many elements");
+				return;
+			}
+			if (element_count < min_max_elements_option_type::min_elems)
+			{
+				error_helper<merged_specs>::report(state,
+					decode_errc::element_count, "Too few elements");
+				return;
+			}
+		}
 
-		section |= bit;
-		return true;
+		auto old_begin = state.begin;
+		std::advance(state.begin, len);
+		value = view_type(RangeType{ old_begin, state.begin }, &decode_element,
+			get_deferred_decode_limits(state));
+	}
+
+	static raw_iterator_type decode_element(const RangeType& raw,
+		raw_iterator_type begin, Value& value, const deferred_decode_limits& limits,
+		decode_error* error)
+	{
+		raw_iterator_type next = begin;
+		if (!deferred_decode<DecodeState>(std::ranges::cbegin(raw), begin,
+			std::ranges::cend(raw), limits, error, [&](auto& state) {
+				element_decoder_type<std::remove_reference_t<decltype(state)>>::decode_explicit(
+					value, state, static_cast<length_type>(std::distance(begin, state.end)));
+				next = state.begin;
+			}))
+		{
+			return std::ranges::cend(raw);
+		}
+		return next;
 	}
+};
 
-	[[nodiscard]]
-	constexpr bool is_marked(tag_type tag) const noexcept
-	{
-		auto section = marked_[tag / section_digits];
-		auto bit = 1ull << (tag % section_digits);
-		return static_cast<bool>(section & bit);
-	}
+template<typename DecodeState,
+	typename Options, typename ParentContexts,
+	typename SpecOptions, typename Spec, typename RangeType, typename Value>
+struct der_decoder<DecodeState, Options, ParentContexts,
+	spec::sequence_of_with_options<SpecOptions, Spec>, sequence_of_view<RangeType, Value>>
+	: sequence_of_view_der_decoder<DecodeState, Options, ParentContexts,
+		spec::sequence_of_with_options, Spec, SpecOptions, RangeType, Value>
+{
+	static constexpr const char* length_decode_error_text = "Expected SEQUENCE OF";
+};
 
-private:
-	std::array<section_type, std::numeric_limits<tag_type>::max()
-		/ section_digits> marked_{};
+template<typename DecodeState,
+	typename Options, typename ParentContexts,
+	typename SpecOptions, typename Spec, typename RangeType, typename Value>
+struct der_decoder<DecodeState, Options, ParentContexts,
+	spec::set_of_with_options<SpecOptions, Spec>, sequence_of_view<RangeType, Value>>
+	: sequence_of_view_der_decoder<DecodeState, Options, ParentContexts,
+		spec::set_of_with_options, Spec, SpecOptions, RangeType, Value>
+{
+	static constexpr const char* length_decode_error_text = "Expected SET OF";
 };
 
 template<typename Value>
 struct set_type_by_index final
 {
-	template<typename DecodeState>
-	using child_decoder_type = void(*)(tag_type, length_type,
-		marked_tags&, std::size_t&, Value&, DecodeState&);
+	//SET fields which have already been decoded
+	using decoded_fields_type = std::bitset<boost::pfr::tuple_size_v<Value>>;
 
 	template<typename Options, typename DecodeState, typename NestedDecoderType,
 		typename ParentContexts, typename Spec, std::size_t Index>
-	static constexpr child_decoder_type<DecodeState> create_child_decoder() noexcept
+	static void decode_child([[maybe_unused]] tag_type tag, length_type len,
+		decoded_fields_type& decoded_fields, [[maybe_unused]] std::size_t& required_count,
+		Value& value, DecodeState& state)
 	{
-		using merged_specs = typename Options::template
-			merge_spec_names<ParentContexts, Spec>;
-		return []([[maybe_unused]] tag_type tag, length_type len,
-			marked_tags& decoded_tags, [[maybe_unused]] std::size_t& required_count, Value& value,
-			DecodeState& state) {
-			if constexpr (!optional_traits<Spec>::is_optional)
-				++required_count;
-
-			if constexpr (spec_traits<Spec>::is_choice)
-			{
-				for (tag_type child_tag : NestedDecoderType::contained_tag_list)
-				{
-					if (!decoded_tags.mark(child_tag))
-					{
-						error_helper<merged_specs>
-							::throw_with_context("Encountered duplicate SET elements");
-					}
-				}
-
-				NestedDecoderType::decode_known_tag(
-					tag, len, boost::pfr::get<Index>(value), state);
-			}
-			else
-			{
-				if (!decoded_tags.mark(tag))
-				{
-					error_helper<merged_specs>
-						::throw_with_context("Encountered duplicate SET elements");
-				}
+		using merged_specs = typename Options::template
+			merge_spec_names<ParentContexts, Spec>;
+		if constexpr (!optional_traits<Spec>::is_optional)
+			++required_count;
 
-				NestedDecoderType::decode_implicit(
-					len, boost::pfr::get<Index>(value), state);
-			}
-		};
+		//For CHOICE, this also rejects different alternatives of the same field
+		if (decoded_fields.test(Index))
+		{
+			error_helper<merged_specs>::report(state,
+				decode_errc::duplicate_element, "Encountered duplicate SET elements");
+			return;
+		}
+		decoded_fields.set(Index);
+
+		if constexpr (spec_traits<Spec>::is_choice)
+		{
+			NestedDecoderType::decode_known_tag(
+				tag, len, boost::pfr::get<Index>(value), state);
+		}
+		else
+		{
+			NestedDecoderType::decode_implicit(
+				len, boost::pfr::get<Index>(value), state);
+		}
 	}
 
 	template<std::size_t Index>
@@ -1005,8 +1827,11 @@ struct der_decoder<DecodeState, Options, ParentContexts,
 		Value& value, DecodeState& state)
 	{
 		decode_implicit_impl(len, value, state);
+		if (failed(state))
+			return;
+
 		try_validate_value<Options, ParentContexts,
-			spec::set_with_options<SpecOptions, Specs...>>(value);
+			spec::set_with_options<SpecOptions, Specs...>>(value, state);
 	}
 
 	static void decode_implicit_impl(length_type len,
@@ -1016,28 +1841,33 @@ struct der_decoder<DecodeState, Options, ParentContexts,
 			"Value structure must have the same amount of fields"
 			" as the number of nested SET specifications");
 
-		marked_tags decoded_tags;
+		typename set_type_by_index<Value>::decoded_fields_type decoded_fields;
 		std::size_t decoded_required_count{};
 		while (len)
 		{
 			auto [tag, child_len] = decode_type_length_with_context<
 				this_parent_specs>(state, &len);
+			if (failed(state))
+				return;
 
 			if (child_len > len)
 			{
-				error_helper<this_parent_specs>
-					::throw_with_context("Invalid SET element length");
+				error_helper<this_parent_specs>::report(state,
+					decode_errc::invalid_header, "Invalid SET element length");
+				return;
 			}
 
-			auto child_decoder = base_type::child_decoders[tag];
-			if (!child_decoder)
+			if (!base_type::decode_child(tag, child_len, decoded_fields,
+				decoded_required_count, value, state))
 			{
-				error_helper<this_parent_specs>
-					::throw_with_context("Unable to decode SET element");
+				error_helper<this_parent_specs>::report(state,
+					decode_errc::unexpected_tag, "Unable to decode SET element");
+				return;
 			}
 
-			child_decoder(tag, child_len, decoded_tags,
-				decoded_required_count, value, state);
+			if (failed(state))
+				return;
+
 			len -= child_len;
 		}
 
@@ -1045,41 +1875,32 @@ struct der_decoder<DecodeState, Options, ParentContexts,
 			!optional_traits<Specs>::is_optional));
 		if (decoded_required_count != required_field_count)
 		{
-			error_helper<this_parent_specs>
-				::throw_with_context("Missing required SET elements");
+			error_helper<this_parent_specs>::report(state,
+				decode_errc::missing_element, "Missing required SET elements");
+			return;
 		}
 
-		initialize_defaults(value, decoded_tags,
+		initialize_defaults(value, decoded_fields,
 			std::index_sequence_for<Specs...>{});
 	}
 
 private:
 	template<std::size_t... Index>
-	static void initialize_defaults(Value& value, const marked_tags& decoded_tags,
+	static void initialize_defaults(Value& value,
+		const typename set_type_by_index<Value>::decoded_fields_type& decoded_fields,
 		std::index_sequence<Index...>)
 	{
-		(..., initialize_default<Specs, Index>(value, decoded_tags));
+		(..., initialize_default<Specs, Index>(value, decoded_fields));
 	}
 
 	template<typename Spec, std::size_t Index>
-	static void initialize_default(Value& value, const marked_tags& decoded_tags)
+	static void initialize_default(Value& value,
+		const typename set_type_by_index<Value>::decoded_fields_type& decoded_fields)
 	{
 		if constexpr (optional_traits<Spec>::has_default)
 		{
-			if constexpr (spec_traits<Spec>::is_choice)
-			{
-				using child_type = boost::pfr::tuple_element_t<Index, Value>;
-				using nested_decoder_type = select_nested_der_decoder<DecodeState, Options,
-					this_parent_specs, Spec, child_type>;
-				if (!decoded_tags.is_marked(nested_decoder_type::contained_tag_list[0]))
-					Spec::assign_default(boost::pfr::get<Index>(value));
-			}
-			else
-			{
-				static constexpr tag_type tag = Spec::tag();
-				if (!decoded_tags.is_marked(tag))
-					Spec::assign_default(boost::pfr::get<Index>(value));
-			}
+			if (!decoded_fields.test(Index))
+				Spec::assign_default(boost::pfr::get<Index>(value));
 		}
 	}
 };
@@ -1097,7 +1918,7 @@ struct der_decoder<DecodeState, Options, ParentContexts,
 	static void decode_implicit_impl(length_type len, Value& value,
 		DecodeState& state)
 	{
-		value = Value{ state.begin, state.begin + len };
+		assign_range(value, state.begin, state.begin + len, state);
 		state.begin += len;
 	}
 };
@@ -1123,10 +1944,13 @@ struct der_decoder<DecodeState, Options, ParentContexts,
 	{
 		auto begin = state.begin;
 		nested_decoder_type::decode_explicit(value, state, len);
+		if (failed(state))
+			return;
+
 		if (static_cast<length_type>(state.begin - begin) != len)
 		{
-			error_helper<merged_specs>
-				::throw_with_context("OCTET STRING encapsulated data is not fully consumed");
+			error_helper<merged_specs>::report(state, decode_errc::unconsumed_data,
+				"OCTET STRING encapsulated data is not fully consumed");
 		}
 	}
 };
@@ -1148,8 +1972,9 @@ struct der_decoder<DecodeState, Options, ParentContexts, spec::bit_string<SpecOp
 			merge_spec_names<ParentContexts, spec::bit_string<SpecOptions>>;
 		if (!len)
 		{
-			error_helper<merged_specs>
-				::throw_with_context("Empty BIT STRING value");
+			error_helper<merged_specs>::report(state,
+				decode_errc::invalid_value, "Empty BIT STRING value");
+			return;
 		}
 
 		std::uint8_t unused_bits = static_cast<std::uint8_t>(*state.begin++);
@@ -1164,13 +1989,14 @@ struct der_decoder<DecodeState, Options, ParentContexts, spec::bit_string<SpecOp
 			}
 			else
 			{
-				error_helper<merged_specs>
-					::throw_with_context("Too many BIT STRING unused bits");
+				error_helper<merged_specs>::report(state,
+					decode_errc::invalid_value, "Too many BIT STRING unused bits");
+				return;
 			}
 		}
 
 		value.bit_count -= unused_bits;
-		value.container = Container{ state.begin, state.begin + len };
+		assign_range(value.container, state.begin, state.begin + len, state);
 		state.begin += len;
 	}
 };
@@ -1182,7 +2008,7 @@ struct oid_decoder
 	static void decode_implicit_impl(length_type len, Container& value,
 		DecodeState& state)
 	{
-		value = Container{ state.begin, state.begin + len };
+		assign_range(value, state.begin, state.begin + len, state);
 		state.begin += len;
 	}
 };
@@ -1198,10 +2024,9 @@ struct oid_decoder<Options, DecodeState, ParentContexts, Spec,
 	{
 		using merged_specs = typename Options::template
 			merge_spec_names<ParentContexts, Spec>;
+		use_memory_resource(value.container, state);
 		value.container = decode_oid<Container, IsRelative, DecodeState,
-			([](const auto& message) {
-			error_helper<merged_specs>::throw_with_context(message);
-		})>(len, state);
+			report_with_context<merged_specs>>(len, state);
 	}
 };
 
@@ -1229,6 +2054,63 @@ struct der_decoder<DecodeState, Options, ParentContexts,
 	static constexpr const char* length_decode_error_text = "Expected RELATIVE-OID";
 };
 
+template<template<typename> typename StringSpec>
+struct string_charset {};
+template<>
+struct string_charset<spec::numeric_string>
+	: std::integral_constant<strings::charset, strings::charset::numeric> {};
+template<>
+struct string_charset<spec::printable_string>
+	: std::integral_constant<strings::charset, strings::charset::printable> {};
+template<>
+struct string_charset<spec::ia5_string>
+	: std::integral_constant<strings::charset, strings::charset::ia5> {};
+template<>
+struct string_charset<spec::visible_string>
+	: std::integral_constant<strings::charset, strings::charset::visible> {};
+template<>
+struct string_charset<spec::utf8_string>
+	: std::integral_constant<strings::charset, strings::charset::utf8> {};
+template<>
+struct string_charset<spec::bmp_string>
+	: std::integral_constant<strings::charset, strings::charset::bmp> {};
+template<>
+struct string_charset<spec::universal_string>
+	: std::integral_constant<strings::charset, strings::charset::universal> {};
+
+template<typename Options, template<typename> typename StringSpec>
+concept ValidatedString = Options::parse_options_type::validate_string_contents
+	&& requires { string_charset<StringSpec>::value; };
+
+//Validates the string contents while copying them to dst (if not null)
+template<typename Options, typename ParentContexts, template<typename> typename StringSpec,
+	typename SpecOptions, typename Char, typename DecodeState>
+void validate_copy_string(length_type len, Char* dst, DecodeState& state)
+{
+	auto begin = state.begin;
+	bool valid;
+	if constexpr (sizeof(Char) == 1u)
+	{
+		valid = strings::validate_copy<string_charset<StringSpec>::value>(begin,
+			static_cast<std::size_t>(len), reinterpret_cast<std::uint8_t*>(dst));
+	}
+	else
+	{
+		valid = strings::byteswap_copy<Char, true>(begin,
+			static_cast<std::size_t>(len / sizeof(Char)), dst);
+	}
+
+	if (!valid)
+	{
+		using merged_specs = typename Options::template
+			merge_spec_names<ParentContexts, StringSpec<SpecOptions>>;
+		error_helper<merged_specs>::report(state,
+			decode_errc::invalid_value, "Invalid string contents");
+		return;
+	}
+	state.begin = begin;
+}
+
 template<typename DecodeState,
 	typename Options, typename ParentContexts, template<typename> typename StringSpec,
 	typename SpecOptions, typename Char, typename Value>
@@ -1254,12 +2136,23 @@ struct string_decoder<DecodeState, Options, ParentContexts,
 				merge_spec_names<ParentContexts, StringSpec<SpecOptions>>;
 			if (len % sizeof(Char))
 			{
-				error_helper<merged_specs>
-					::throw_with_context("Invalid string length");
+				error_helper<merged_specs>::report(state,
+					decode_errc::invalid_value, "Invalid string length");
+				return;
 			}
 		}
 
-		value = Value{ state.begin, state.begin + len };
+		if constexpr (ValidatedString<Options, StringSpec>)
+		{
+			auto begin = state.begin;
+			validate_copy_string<Options, ParentContexts,
+				StringSpec, SpecOptions>(len, static_cast<Char*>(nullptr), state);
+			if (failed(state))
+				return;
+			state.begin = begin;
+		}
+
+		assign_range(value, state.begin, state.begin + len, state);
 		state.begin += len;
 	}
 };
@@ -1275,6 +2168,88 @@ struct string_decoder<DecodeState, Options, ParentContexts, StringSpec, SpecOpti
 {
 };
 
+template<template<typename> typename StringSpec>
+struct is_ascii_string : std::false_type {};
+template<>
+struct is_ascii_string<spec::numeric_string> : std::true_type {};
+template<>
+struct is_ascii_string<spec::printable_string> : std::true_type {};
+template<>
+struct is_ascii_string<spec::ia5_string> : std::true_type {};
+template<>
+struct is_ascii_string<spec::visible_string> : std::true_type {};
+
+template<template<typename> typename StringSpec>
+struct is_transcoded_string : std::false_type {};
+template<>
+struct is_transcoded_string<spec::teletex_string> : std::true_type {};
+template<>
+struct is_transcoded_string<spec::bmp_string> : std::true_type {};
+template<>
+struct is_transcoded_string<spec::universal_string> : std::true_type {};
+
+//BMPString and UniversalString can be decoded as UTF-8 std::string or std::u8string.
+//TeletexString can be decoded as UTF-8 std::u8string
+//(std::string keeps the original TeletexString bytes).
+template<template<typename> typename StringSpec, typename Char, typename OtherChar>
+concept Utf8TranscodedString = is_transcoded_string<StringSpec>::value
+	&& (std::is_same_v<OtherChar, char8_t>
+		|| (std::is_same_v<OtherChar, char> && sizeof(Char) > 1u));
+
+template<typename DecodeState,
+	typename Options, typename ParentContexts, template<typename> typename StringSpec,
+	typename SpecOptions, typename Char, typename OtherChar,
+	typename Traits, typename Allocator>
+	requires Utf8TranscodedString<StringSpec, Char, OtherChar>
+struct string_decoder<DecodeState, Options, ParentContexts, StringSpec, SpecOptions, Char,
+	std::basic_string<OtherChar, Traits, Allocator>>
+	: der_decoder_base<der_decoder<DecodeState, Options, ParentContexts,
+		StringSpec<SpecOptions>, std::basic_string<OtherChar, Traits, Allocator>>>
+{
+	static void decode_implicit_impl(length_type len,
+		std::basic_string<OtherChar, Traits, Allocator>& value,
+		DecodeState& state)
+	{
+		using merged_specs = typename Options::template
+			merge_spec_names<ParentContexts, StringSpec<SpecOptions>>;
+		if constexpr (sizeof(Char) > 1u)
+		{
+			if (len % sizeof(Char))
+			{
+				error_helper<merged_specs>::report(state,
+					decode_errc::invalid_value, "Invalid string length");
+				return;
+			}
+		}
+
+		//Validated BMPString must not contain surrogates
+		constexpr bool allow_surrogate_pairs
+			= !Options::parse_options_type::validate_string_contents;
+		use_memory_resource(value, state);
+		auto begin = state.begin;
+		if (!strings::transcode_to_utf8<Char, allow_surrogate_pairs>(begin,
+			static_cast<std::size_t>(len), value))
+		{
+			error_helper<merged_specs>::report(state,
+				decode_errc::invalid_value, "Invalid string contents");
+			return;
+		}
+		state.begin = begin;
+	}
+};
+
+//Allow ASCII subset strings to be decoded as std::u8string
+template<typename DecodeState,
+	typename Options, typename ParentContexts, template<typename> typename StringSpec,
+	typename SpecOptions, typename Traits, typename Allocator>
+	requires (is_ascii_string<StringSpec>::value)
+struct string_decoder<DecodeState, Options, ParentContexts, StringSpec, SpecOptions, char,
+	std::basic_string<char8_t, Traits, Allocator>>
+	: string_decoder<DecodeState, Options, ParentContexts, StringSpec, SpecOptions, char8_t,
+		std::basic_string<char8_t, Traits, Allocator>>
+{
+};
+
 template<typename DecodeState,
 	typename Options, typename ParentContexts, template<typename> typename StringSpec,
 	typename SpecOptions, typename Char, typename Traits, typename Allocator>
@@ -1293,34 +2268,28 @@ struct string_decoder<DecodeState, Options, ParentContexts, StringSpec, SpecOpti
 				merge_spec_names<ParentContexts, StringSpec<SpecOptions>>;
 			if (len % sizeof(Char))
 			{
-				error_helper<merged_specs>
-					::throw_with_context("Invalid string length");
+				error_helper<merged_specs>::report(state,
+					decode_errc::invalid_value, "Invalid string length");
+				return;
 			}
 		}
 
-		value.resize(static_cast<std::size_t>(len / sizeof(Char)));
+		use_memory_resource(value, state);
+		resize_for_overwrite(value, static_cast<std::size_t>(len / sizeof(Char)));
 		auto ptr = value.data();
-		if constexpr (sizeof(Char) == 1u)
+		if constexpr (ValidatedString<Options, StringSpec>)
 		{
-			while (len--)
-			{
-				*ptr++ = static_cast<Char>(*state.begin++);
-			}
+			validate_copy_string<Options, ParentContexts, StringSpec, SpecOptions>(
+				len, ptr, state);
+		}
+		else if constexpr (sizeof(Char) == 1u)
+		{
+			copy_bytes(state.begin, static_cast<std::size_t>(len), ptr);
 		}
 		else
 		{
-			while (len)
-			{
-				std::make_unsigned_t<Char> char_value{};
-				for (std::size_t i = 0; i != sizeof(Char); ++i)
-				{
-					if constexpr (sizeof(Char) > 1u)
-						char_value <<= 8u;
-					char_value |= static_cast<decltype(char_value)>(*state.begin++);
-				}
-				*ptr++ = static_cast<Char>(char_value);
-				len -= sizeof(Char);
-			}
+			(void)strings::byteswap_copy<Char, false>(state.begin,
+				static_cast<std::size_t>(len / sizeof(Char)), ptr);
 		}
 	}
 };
@@ -1462,12 +2431,21 @@ template<typename Spec, std::size_t YearSize,
 	typename DateTime, typename State>
 void parse_date_time(DateTime& value, State& state)
 {
-	string_to_integer<YearSize, Spec>(value.year, state);
-	string_to_integer<2u, Spec>(value.month, state);
-	string_to_integer<2u, Spec>(value.day, state);
-	string_to_integer<2u, Spec>(value.hour, state);
-	string_to_integer<2u, Spec>(value.minute, state);
-	string_to_integer<2u, Spec>(value.second, state);
+	//YYMMDDhhmmss or YYYYMMDDhhmmss
+	auto pairs = parse_digit_pairs<YearSize + 10u, Spec>(state);
+	if (failed(state))
+		return;
+
+	constexpr std::size_t year_pairs = YearSize / 2u;
+	if constexpr (year_pairs == 2u)
+		value.year = static_cast<std::uint16_t>(pairs[0] * 100u + pairs[1]);
+	else
+		value.year = pairs[0];
+	value.month = pairs[year_pairs];
+	value.day = pairs[year_pairs + 1u];
+	value.hour = pairs[year_pairs + 2u];
+	value.minute = pairs[year_pairs + 3u];
+	value.second = pairs[year_pairs + 4u];
 }
 
 template<typename Spec, typename State, typename DateTime>
@@ -1476,58 +2454,130 @@ void validate_suffix_and_date_time(std::uint16_t full_year,
 {
 	if (static_cast<char>(*state.begin++) != 'Z')
 	{
-		error_helper<Spec>
-			::throw_with_context("Datetime lacks 'Z' postfix");
+		error_helper<Spec>::report(state,
+			decode_errc::invalid_value, "Datetime lacks 'Z' postfix");
+		return;
 	}
 
-	if (value.month < 1 || value.month > 12)
-	{
-		error_helper<Spec>
-			::throw_with_context("Invalid datetime month value");
-	}
+	if (const char* error = check_date_time(full_year, value))
+		error_helper<Spec>::report(state, decode_errc::invalid_value, error);
+}
 
-	if (value.hour > 23)
+//Returns the number of the seconds fraction digits
+template<typename Spec, typename State>
+std::size_t decode_generalized_time(length_type len, generalized_time& value,
+	State& state)
+{
+	if (len < 15u || len > 35u)
 	{
-		error_helper<Spec>
-			::throw_with_context("Invalid datetime hour value");
+		error_helper<Spec>::report(state,
+			decode_errc::invalid_value, "Invalid GeneralizedTime length");
+		return 0u;
 	}
 
-	if (value.minute > 59)
-	{
-		error_helper<Spec>
-			::throw_with_context("Invalid datetime minute value");
-	}
+	parse_date_time<Spec, 4u>(value, state);
+	if (failed(state))
+		return 0u;
 
-	if (value.second > 59)
+	len -= 14u;
+	std::size_t fraction_digits = 0u;
+	value.seconds_fraction = 0u;
+	value.seconds_fraction_digits = 0u;
+	if (static_cast<char>(*state.begin) == '.')
 	{
-		error_helper<Spec>
-			::throw_with_context("Invalid datetime second value");
+		++state.begin;
+		if (len < 3u) //'.' + at least one fraction digit + 'Z' suffix
+		{
+			error_helper<Spec>::report(state, decode_errc::invalid_value,
+				"Absent GeneralizedTime seconds fraction value");
+			return 0u;
+		}
+
+		//At most 19 digits, which always fit std::uint64_t
+		fraction_digits = len - 2u;
+		std::uint8_t digit = 0u;
+		for (std::size_t i = 0; i != fraction_digits; ++i)
+		{
+			digit = static_cast<std::uint8_t>(
+				static_cast<std::uint8_t>(*state.begin++) - '0');
+			if (digit > 9u)
+			{
+				error_helper<Spec>::report(state, decode_errc::invalid_value,
+					"Invalid GeneralizedTime seconds fraction value");
+				return 0u;
+			}
+			value.seconds_fraction = value.seconds_fraction * 10u + digit;
+		}
+
+		if (!digit)
+		{
+			error_helper<Spec>::report(state, decode_errc::invalid_value,
+				"GeneralizedTime seconds fraction value has trailing zeros");
+			return 0u;
+		}
 	}
 
-	if (value.day < 1)
+	value.seconds_fraction_digits = static_cast<std::uint8_t>(fraction_digits);
+	validate_suffix_and_date_time<Spec>(value.year, value, state);
+	return fraction_digits;
+}
+
+//Number of decimal digits of the Duration ticks (3 for milliseconds),
+//or -1 if the duration period is not 1/10^N seconds
+template<typename Duration>
+[[nodiscard]] consteval int decimal_duration_digits() noexcept
+{
+	if constexpr (Duration::period::num != 1)
 	{
-		error_helper<Spec>
-			::throw_with_context("Invalid datetime day value");
+		return -1;
 	}
-	
-	if (value.day > days_in_month[value.month])
+	else
 	{
-		if (value.day == 29u && value.month == 2u)
+		int digits = 0;
+		for (auto den = Duration::period::den; den != 1; den /= 10)
 		{
-			if (!full_year)
-				return;
-
-			bool is_leap_year = (full_year % 4u == 0u
-				&& full_year % 100u != 0u) || (full_year % 400u == 0u);
-			if (is_leap_year)
-				return;
+			if (den % 10 || ++digits > 18)
+				return -1;
 		}
+		return digits;
+	}
+}
+
+template<typename Spec, typename DateTime, typename Duration, typename State>
+void date_time_to_sys_time(std::uint16_t full_year, const DateTime& value,
+	std::uint64_t fraction, std::size_t fraction_digits,
+	std::chrono::sys_time<Duration>& result, State& state)
+{
+	using namespace std::chrono;
+
+	auto days = sys_days{ year{ full_year } / month{ value.month } / day{ value.day } };
+	auto since_epoch = days.time_since_epoch() + hours{ value.hour }
+		+ minutes{ value.minute } + seconds{ value.second };
 
-		error_helper<Spec>
-			::throw_with_context("Invalid datetime day value");
+	//The whole second (including its fraction) must be representable
+	constexpr auto min_seconds = ceil<seconds>((Duration::min)());
+	constexpr auto max_seconds = floor<seconds>((Duration::max)()) - seconds{ 1 };
+	if (since_epoch < min_seconds || since_epoch > max_seconds)
+	{
+		error_helper<Spec>::report(state, decode_errc::invalid_value,
+			"Datetime value is out of range");
+		return;
 	}
+
+	//Fraction digits which do not fit the Duration precision are truncated
+	constexpr auto precision = static_cast<std::size_t>(decimal_duration_digits<Duration>());
+	for (; fraction_digits > precision; --fraction_digits)
+		fraction /= 10u;
+	for (; fraction_digits != precision; ++fraction_digits)
+		fraction *= 10u;
+
+	result = sys_time<Duration>{ duration_cast<Duration>(since_epoch)
+		+ Duration{ static_cast<typename Duration::rep>(fraction) } };
 }
 
+template<typename Duration>
+concept DecimalDuration = decimal_duration_digits<Duration>() >= 0;
+
 template<typename DecodeState,
 	typename Options, typename ParentContexts, typename SpecOptions>
 struct der_decoder<DecodeState, Options, ParentContexts, spec::generalized_time<SpecOptions>,
@@ -1543,46 +2593,35 @@ struct der_decoder<DecodeState, Options, ParentContexts, spec::generalized_time<
 	static void decode_implicit_impl(length_type len, generalized_time& value,
 		DecodeState& state)
 	{
-		if (len < 15u || len > 35u)
-		{
-			error_helper<this_parent_specs>
-				::throw_with_context("Invalid GeneralizedTime length");
-		}
-
-		auto begin = state.begin;
-		parse_date_time<this_parent_specs, 4u>(value, state);
-		if (static_cast<char>(*state.begin) == '.')
-		{
-			++state.begin;
-			len -= state.begin - begin;
-			if (len < 2) //at least one fraction digit + 'Z' suffix
-			{
-				error_helper<this_parent_specs>
-					::throw_with_context("Absent GeneralizedTime seconds fraction value");
-			}
-			--len;
+		[[maybe_unused]] auto fraction_digits
+			= decode_generalized_time<this_parent_specs>(len, value, state);
+	}
+};
 
-			std::array<char, 20u> chars;
-			for (length_type i = 0; i != len; ++i)
-				chars[i] = static_cast<char>(*state.begin++);
+//GeneralizedTime to std::chrono::sys_time with a 1/10^N seconds precision
+template<typename DecodeState,
+	typename Options, typename ParentContexts, typename SpecOptions, DecimalDuration Duration>
+struct der_decoder<DecodeState, Options, ParentContexts, spec::generalized_time<SpecOptions>,
+	std::chrono::sys_time<Duration>>
+	: der_decoder_base<der_decoder<DecodeState, Options, ParentContexts,
+		spec::generalized_time<SpecOptions>, std::chrono::sys_time<Duration>>>
+{
+	using this_parent_specs = typename Options::template merge_spec_names<
+		ParentContexts, spec::generalized_time<SpecOptions>>;
 
-			if (chars[len - 1] == '0')
-			{
-				error_helper<this_parent_specs>
-					::throw_with_context(
-						"GeneralizedTime seconds fraction value has trailing zeros");
-			}
+	static constexpr const char* length_decode_error_text = "Expected GeneralizedTime";
 
-			auto rc = std::from_chars(chars.data(),
-				chars.data() + len, value.seconds_fraction);
-			if (rc.ec != std::errc{} || rc.ptr != chars.data() + len)
-			{
-				error_helper<this_parent_specs>
-					::throw_with_context("Invalid GeneralizedTime seconds fraction value");
-			}
-		}
+	static void decode_implicit_impl(length_type len, std::chrono::sys_time<Duration>& value,
+		DecodeState& state)
+	{
+		generalized_time date_time;
+		auto fraction_digits = decode_generalized_time<this_parent_specs>(
+			len, date_time, state);
+		if (failed(state))
+			return;
 
-		validate_suffix_and_date_time<this_parent_specs>(value.year, value, state);
+		date_time_to_sys_time<this_parent_specs>(date_time.year, date_time,
+			date_time.seconds_fraction, fraction_digits, value, state);
 	}
 };
 
@@ -1602,27 +2641,50 @@ struct der_decoder<DecodeState, Options, ParentContexts, spec::utc_time<SpecOpti
 	{
 		if (len != 13u)
 		{
-			error_helper<this_parent_specs>
-				::throw_with_context("Invalid UTCTime length");
+			error_helper<this_parent_specs>::report(state,
+				decode_errc::invalid_value, "Invalid UTCTime length");
+			return;
 		}
 
 		parse_date_time<this_parent_specs, 2u>(value, state);
+		if (failed(state))
+			return;
 
-		using zero_year_option_type = typename spec::utc_time<SpecOptions>
-			::template option_by_category<option_cat::zero_year>;
-		if constexpr (!std::is_same_v<zero_year_option_type, void>)
-		{
-			std::uint16_t full_year = value.year <= 50u
-				? value.year + zero_year_option_type::value
-				: value.year + zero_year_option_type::value - 100u;
-			validate_suffix_and_date_time<
-				this_parent_specs>(full_year, value, state);
-		}
-		else
-		{
-			validate_suffix_and_date_time<
-				this_parent_specs>(0u, value, state);
-		}
+		validate_suffix_and_date_time<this_parent_specs>(
+			utc_time_full_year<SpecOptions>(value.year), value, state);
+	}
+};
+
+//UTCTime to std::chrono::sys_time, the century is taken from the zero_year option
+template<typename DecodeState,
+	typename Options, typename ParentContexts, typename SpecOptions, DecimalDuration Duration>
+struct der_decoder<DecodeState, Options, ParentContexts, spec::utc_time<SpecOptions>,
+	std::chrono::sys_time<Duration>>
+	: der_decoder_base<der_decoder<DecodeState, Options, ParentContexts,
+		spec::utc_time<SpecOptions>, std::chrono::sys_time<Duration>>>
+{
+	static_assert(!std::is_same_v<typename spec::utc_time<SpecOptions>
+		::template option_by_category<option_cat::zero_year>, void>,
+		"UTCTime requires the zero_year option to be decoded to std::chrono::sys_time");
+
+	using this_parent_specs = typename Options::template merge_spec_names<
+		ParentContexts, spec::utc_time<SpecOptions>>;
+	using utc_time_decoder_type = der_decoder<DecodeState, Options, ParentContexts,
+		spec::utc_time<SpecOptions>, utc_time>;
+
+	static constexpr const char* length_decode_error_text = "Expected UTCTime";
+
+	static void decode_implicit_impl(length_type len, std::chrono::sys_time<Duration>& value,
+		DecodeState& state)
+	{
+		utc_time date_time;
+		utc_time_decoder_type::decode_implicit_impl(len, date_time, state);
+		if (failed(state))
+			return;
+
+		date_time_to_sys_time<this_parent_specs>(
+			utc_time_full_year<SpecOptions>(date_time.year),
+			date_time, 0u, 0u, value, state);
 	}
 };
 
@@ -1669,8 +2731,9 @@ struct der_decoder<DecodeState, Options, ParentContexts, RecursiveWrapper, Value
 		{
 			if (!state.max_recursion_depth)
 			{
-				error_helper<merge_spec_names<first_spec_name, spec_type>>
-					::throw_with_context("Too deep recursion");
+				error_helper<merge_spec_names<first_spec_name, spec_type>>::report(state,
+					decode_errc::recursion_depth, "Too deep recursion");
+				return;
 			}
 			--state.max_recursion_depth;
 		}
@@ -1720,6 +2783,27 @@ BufferIterator decode(BufferIterator begin, BufferIteratorEnd end, T& result)
 	return decode<Spec, decode_options<>>(begin, end, result);
 }
 
+//Decoding with validated_extent_decode_state: the top-level element is validated
+//against the buffer size, nested elements against their parents.
+template<typename Spec, typename DecodeOptions,
+	detail::ValidatedExtentDecodeState DecodeState, typename T>
+	requires (!detail::NothrowDecodeState<DecodeState>)
+typename DecodeState::iterator_type decode(DecodeState& state, T& result)
+{
+	using decoder_type = detail::der::select_nested_der_decoder<decltype(state),
+		DecodeOptions, asn1::detail::parent_context_list<>, Spec, T>;
+
+	decoder_type::decode_explicit(result, state, std::distance(state.begin, state.end));
+	return state.begin;
+}
+
+template<typename Spec, detail::ValidatedExtentDecodeState DecodeState, typename T>
+	requires (!detail::NothrowDecodeState<DecodeState>)
+typename DecodeState::iterator_type decode(DecodeState& state, T& result)
+{
+	return decode<Spec, decode_options<>>(state, result);
+}
+
 template<typename Spec, typename DecodeOptions,
 	std::forward_iterator BufferIterator,
 	std::sentinel_for<BufferIterator> BufferIteratorEnd, typename T>
@@ -1772,7 +2856,7 @@ template<typename T, typename Spec, typename DecodeOptions,
 	if (state.end != decode<Spec, DecodeOptions>(state, result))
 	{
 		throw parse_error("Not all data was consumed by the parser",
-			parse_error::context_type{});
+			{}, detail::error_offset(state));
 	}
 	return result;
 }
@@ -1810,7 +2894,7 @@ template<typename T, typename Spec, typename DecodeOptions,
 	if (state.end != decode<Spec, DecodeOptions>(state, result))
 	{
 		throw parse_error("Not all data was consumed by the parser",
-			parse_error::context_type{});
+			{}, detail::error_offset(state));
 	}
 	return result;
 }
@@ -1842,4 +2926,124 @@ template<typename T, typename Spec, std::forward_iterator BufferIterator,
 {
 	return decode<T, Spec, decode_options<>>(max_recursion_depth, begin, end);
 }
+
+//Exception-free decoding. Errors are returned in decode_result instead of
+//throwing parse_error, validators may return false to report an error.
+template<typename Spec, typename DecodeOptions,
+	detail::NothrowDecodeState DecodeState, typename T>
+decode_result<typename DecodeState::iterator_type> try_decode(
+	DecodeState& state, T& result)
+{
+	using decoder_type = detail::der::select_nested_der_decoder<decltype(state),
+		DecodeOptions, asn1::detail::parent_context_list<>, Spec, T>;
+
+	decoder_type::decode_explicit(result, state, std::distance(state.begin, state.end));
+	if (detail::failed(state))
+		return state.error;
+	return state.begin;
+}
+
+template<typename Spec, detail::NothrowDecodeState DecodeState, typename T>
+decode_result<typename DecodeState::iterator_type> try_decode(
+	DecodeState& state, T& result)
+{
+	return try_decode<Spec, decode_options<>>(state, result);
+}
+
+template<typename Spec, typename DecodeOptions,
+	std::forward_iterator BufferIterator,
+	std::sentinel_for<BufferIterator> BufferIteratorEnd, typename T>
+decode_result<BufferIterator> try_decode(BufferIterator begin, BufferIteratorEnd end,
+	T& result)
+{
+	nothrow_decode_state<decode_state<BufferIterator, BufferIteratorEnd>> state(begin, end);
+	return try_decode<Spec, DecodeOptions>(state, result);
+}
+
+template<typename Spec, std::forward_iterator BufferIterator,
+	std::sentinel_for<BufferIterator> BufferIteratorEnd, typename T>
+decode_result<BufferIterator> try_decode(BufferIterator begin, BufferIteratorEnd end,
+	T& result)
+{
+	return try_decode<Spec, decode_options<>>(begin, end, result);
+}
+
+template<typename Spec, typename DecodeOptions,
+	std::forward_iterator BufferIterator,
+	std::sentinel_for<BufferIterator> BufferIteratorEnd, typename T>
+decode_result<BufferIterator> try_decode(std::size_t max_recursion_depth,
+	BufferIterator begin, BufferIteratorEnd end, T& result)
+{
+	nothrow_decode_state<decode_state_with_recursion_depth_limit<
+		BufferIterator, BufferIteratorEnd>> state(begin, end);
+	state.max_recursion_depth = max_recursion_depth;
+	return try_decode<Spec, DecodeOptions>(state, result);
+}
+
+template<typename Spec, std::forward_iterator BufferIterator,
+	std::sentinel_for<BufferIterator> BufferIteratorEnd, typename T>
+decode_result<BufferIterator> try_decode(std::size_t max_recursion_depth,
+	BufferIterator begin, BufferIteratorEnd end, T& result)
+{
+	return try_decode<Spec, decode_options<>>(
+		max_recursion_depth, begin, end, result);
+}
+
+} //namespace asn1::der
+
+namespace asn1::detail::der
+{
+template<typename T, typename Spec, typename DecodeOptions, typename DecodeState>
+[[nodiscard]] decode_result<T> try_decode_value(DecodeState& state)
+{
+	T result;
+	if (auto decoded = asn1::der::try_decode<Spec, DecodeOptions>(state, result); !decoded)
+		return decoded.error();
+
+	if (state.begin != state.end)
+	{
+		return decode_error{ decode_errc::unconsumed_data,
+			"Not all data was consumed by the parser", detail::error_offset(state), {} };
+	}
+	return result;
+}
+} //namespace asn1::detail::der
+
+namespace asn1::der
+{
+template<typename T, typename Spec, typename DecodeOptions,
+	std::forward_iterator BufferIterator,
+	std::sentinel_for<BufferIterator> BufferIteratorEnd>
+[[nodiscard]] decode_result<T> try_decode(BufferIterator begin, BufferIteratorEnd end)
+{
+	nothrow_decode_state<decode_state<BufferIterator, BufferIteratorEnd>> state(begin, end);
+	return detail::der::try_decode_value<T, Spec, DecodeOptions>(state);
+}
+
+template<typename T, typename Spec, std::forward_iterator BufferIterator,
+	std::sentinel_for<BufferIterator> BufferIteratorEnd>
+[[nodiscard]] decode_result<T> try_decode(BufferIterator begin, BufferIteratorEnd end)
+{
+	return try_decode<T, Spec, decode_options<>>(begin, end);
+}
+
+template<typename T, typename Spec, typename DecodeOptions,
+	std::forward_iterator BufferIterator,
+	std::sentinel_for<BufferIterator> BufferIteratorEnd>
+[[nodiscard]] decode_result<T> try_decode(std::size_t max_recursion_depth,
+	BufferIterator begin, BufferIteratorEnd end)
+{
+	nothrow_decode_state<decode_state_with_recursion_depth_limit<
+		BufferIterator, BufferIteratorEnd>> state(begin, end);
+	state.max_recursion_depth = max_recursion_depth;
+	return detail::der::try_decode_value<T, Spec, DecodeOptions>(state);
+}
+
+template<typename T, typename Spec, std::forward_iterator BufferIterator,
+	std::sentinel_for<BufferIterator> BufferIteratorEnd>
+[[nodiscard]] decode_result<T> try_decode(std::size_t max_recursion_depth,
+	BufferIterator begin, BufferIteratorEnd end)
+{
+	return try_decode<T, Spec, decode_options<>>(max_recursion_depth, begin, end);
+}
 } //namespace asn1::der
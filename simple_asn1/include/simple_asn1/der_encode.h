@@ -0,0 +1,1385 @@
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <optional>
+#include <ranges>
+#include <span>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include <boost/pfr/core.hpp>
+
+#include "simple_asn1/decode.h"
+#include "simple_asn1/encode.h"
+#include "simple_asn1/spec.h"
+#include "simple_asn1/types.h"
+
+namespace asn1::detail::der
+{
+template<typename Spec, typename Value>
+struct der_encoder
+{
+	static constexpr length_type fixed_length() noexcept
+	{
+		static_assert(std::is_same_v<Value, void>,
+			"Unsupported spec or corresponding value type");
+		return variable_length;
+	}
+
+	template<typename Lengths>
+	static constexpr length_type encoded_length(const Value&, Lengths&)
+	{
+		static_assert(std::is_same_v<Value, void>,
+			"Unsupported spec or corresponding value type");
+		return variable_length;
+	}
+
+	template<typename EncodeState>
+	static constexpr void encode(const Value&, EncodeState&)
+	{
+		static_assert(std::is_same_v<Value, void>,
+			"Unsupported spec or corresponding value type");
+	}
+};
+
+template<typename Spec, typename Value>
+struct select_nested_der_encoder : der_encoder<Spec, Value> {};
+
+//Content lengths of variable length values, which are calculated once by the
+//encoded_length() pre-pass (in the encoding order) and consumed by encode()
+//when writing the headers. This keeps encoding linear in the value size.
+class encoded_lengths
+{
+public:
+	[[nodiscard]] std::size_t reserve()
+	{
+		lengths_.emplace_back();
+		return lengths_.size() - 1u;
+	}
+
+	void set(std::size_t slot, length_type length) noexcept
+	{
+		lengths_[slot] = length;
+	}
+
+	[[nodiscard]] const length_type* data() const noexcept
+	{
+		return lengths_.data();
+	}
+
+private:
+	std::vector<length_type> lengths_;
+};
+
+//Used when only the total encoded length is needed
+struct discarded_lengths
+{
+	[[nodiscard]] static constexpr std::size_t reserve() noexcept
+	{
+		return 0u;
+	}
+
+	static constexpr void set(std::size_t, length_type) noexcept
+	{
+	}
+};
+
+template<typename OutputIterator>
+struct [[nodiscard]] encode_state_with_lengths : encode_state<OutputIterator>
+{
+	encode_state_with_lengths(OutputIterator out, const length_type* next_length)
+		noexcept(std::is_nothrow_copy_constructible_v<OutputIterator>)
+		: encode_state<OutputIterator>(out)
+		, next_length(next_length)
+	{
+	}
+
+	const length_type* next_length;
+};
+
+//Leaf encoders calculate the content length from the value only
+template<typename Encoder, typename Value, typename Lengths>
+[[nodiscard]] length_type content_length_of(const Value& value, Lengths& lengths)
+{
+	if constexpr (requires { Encoder::content_length(value, lengths); })
+		return Encoder::content_length(value, lengths);
+	else
+		return Encoder::content_length(value);
+}
+
+template<typename Encoder>
+[[nodiscard]] constexpr length_type fixed_content_length_of() noexcept
+{
+	if constexpr (requires { Encoder::fixed_content_length(); })
+		return Encoder::fixed_content_length();
+	else
+		return variable_length;
+}
+
+[[nodiscard]]
+constexpr length_type sum_fixed_lengths(std::initializer_list<length_type> lengths) noexcept
+{
+	length_type result = 0;
+	for (auto length : lengths)
+	{
+		if (length == variable_length)
+			return variable_length;
+		result += length;
+	}
+	return result;
+}
+
+template<typename Wrapper>
+[[nodiscard]] constexpr const auto& wrapped_value(const Wrapper& wrapper) noexcept
+{
+	return wrapper.value;
+}
+
+//Decodes the lazy value if it has not been accessed yet
+template<typename RangeType, typename Value>
+[[nodiscard]] const Value& wrapped_value(const lazy<RangeType, Value>& wrapper)
+{
+	return wrapper.get();
+}
+
+//Encodes the value stored in with_iterators, with_pointers, with_raw_data or lazy
+template<typename Spec, typename Wrapper>
+struct wrapped_value_der_encoder
+{
+	using nested_encoder_type = select_nested_der_encoder<Spec, std::remove_cvref_t<
+		decltype(wrapped_value(std::declval<const Wrapper&>()))>>;
+
+	[[nodiscard]]
+	static constexpr length_type fixed_length() noexcept
+	{
+		return nested_encoder_type::fixed_length();
+	}
+
+	[[nodiscard]]
+	static constexpr length_type fixed_content_length() noexcept
+	{
+		return fixed_content_length_of<nested_encoder_type>();
+	}
+
+	template<typename Lengths>
+	static length_type encoded_length(const Wrapper& value, Lengths& lengths)
+	{
+		return nested_encoder_type::encoded_length(wrapped_value(value), lengths);
+	}
+
+	template<typename EncodeState>
+	static void encode(const Wrapper& value, EncodeState& state)
+	{
+		nested_encoder_type::encode(wrapped_value(value), state);
+	}
+
+	template<typename Lengths>
+	static length_type content_length(const Wrapper& value, Lengths& lengths)
+	{
+		return content_length_of<nested_encoder_type>(wrapped_value(value), lengths);
+	}
+
+	template<typename EncodeState>
+	static void encode_content(const Wrapper& value, EncodeState& state)
+	{
+		nested_encoder_type::encode_content(wrapped_value(value), state);
+	}
+};
+
+template<typename Spec, typename Iterator, typename Value>
+struct select_nested_der_encoder<Spec, with_iterators<Iterator, Value>>
+	: wrapped_value_der_encoder<Spec, with_iterators<Iterator, Value>> {};
+
+template<typename Spec, typename ByteType, typename Value>
+struct select_nested_der_encoder<Spec, with_pointers<ByteType, Value>>
+	: wrapped_value_der_encoder<Spec, with_pointers<ByteType, Value>> {};
+
+template<typename Spec, typename RangeType, typename Value>
+struct select_nested_der_encoder<Spec, with_raw_data<RangeType, Value>>
+	: wrapped_value_der_encoder<Spec, with_raw_data<RangeType, Value>> {};
+
+template<typename Spec, typename RangeType, typename Value>
+struct select_nested_der_encoder<Spec, lazy<RangeType, Value>>
+	: wrapped_value_der_encoder<Spec, lazy<RangeType, Value>> {};
+
+template<typename Encoder>
+struct der_encoder_base final {};
+
+template<typename Spec, typename Value>
+struct der_encoder_base<der_encoder<Spec, Value>>
+{
+	using encoder_impl_type = der_encoder<Spec, Value>;
+
+	[[nodiscard]]
+	static constexpr length_type fixed_length() noexcept
+	{
+		constexpr auto content_length = fixed_content_length_of<encoder_impl_type>();
+		if constexpr (content_length == variable_length)
+			return variable_length;
+		else
+			return header_length(Spec::tag(), content_length) + content_length;
+	}
+
+	//content_length() also validates the value, so it is called for fixed length values too
+	template<typename Lengths>
+	static length_type encoded_length(const Value& value, Lengths& lengths)
+	{
+		if constexpr (fixed_length() != variable_length)
+		{
+			(void)content_length_of<encoder_impl_type>(value, lengths);
+			return fixed_length();
+		}
+		else
+		{
+			auto slot = lengths.reserve();
+			auto length = content_length_of<encoder_impl_type>(value, lengths);
+			lengths.set(slot, length);
+			return header_length(Spec::tag(), length) + length;
+		}
+	}
+
+	//Variable content lengths are taken from the encoded_length() pre-pass
+	template<typename EncodeState>
+	static void encode(const Value& value, EncodeState& state)
+	{
+		if constexpr (fixed_length() != variable_length)
+			write_header(state, Spec::tag(), fixed_content_length_of<encoder_impl_type>());
+		else
+			write_header(state, Spec::tag(), *state.next_length++);
+		encoder_impl_type::encode_content(value, state);
+	}
+};
+
+//Raw byte range (non-decoded integer, OCTET STRING, string bytes, OID bytes)
+template<typename Spec, ByteRange Value>
+struct raw_der_encoder
+	: der_encoder_base<der_encoder<Spec, Value>>
+{
+	static length_type content_length(const Value& value)
+	{
+		return static_cast<length_type>(std::ranges::size(value));
+	}
+
+	template<typename EncodeState>
+	static void encode_content(const Value& value, EncodeState& state)
+	{
+		write_bytes(state, value);
+	}
+};
+
+template<std::integral T>
+[[nodiscard]] constexpr length_type integer_length(T value) noexcept
+{
+	using unsigned_type = std::make_unsigned_t<T>;
+	constexpr auto digits = std::numeric_limits<std::uint8_t>::digits;
+	auto unsigned_value = static_cast<unsigned_type>(value);
+	length_type length = sizeof(T);
+	while (length > 1u)
+	{
+		auto top_byte = static_cast<std::uint8_t>(
+			unsigned_value >> ((length - 1u) * digits));
+		bool next_bit_set = ((unsigned_value >> ((length - 1u) * digits - 1u)) & 1u) != 0u;
+		if constexpr (std::is_signed_v<T>)
+		{
+			if (top_byte == 0xffu && next_bit_set)
+			{
+				--length;
+				continue;
+			}
+		}
+
+		if (top_byte == 0u && !next_bit_set)
+			--length;
+		else
+			break;
+	}
+	return length;
+}
+
+template<typename EncodeState, std::integral T>
+void write_integer(EncodeState& state, T value, length_type length)
+{
+	auto unsigned_value = static_cast<std::make_unsigned_t<T>>(value);
+	while (length--)
+	{
+		write_byte(state, static_cast<std::uint8_t>(unsigned_value
+			>> (length * std::numeric_limits<std::uint8_t>::digits)));
+	}
+}
+
+//Non-decoded integer
+template<typename SpecOptions, ByteRange Value>
+struct der_encoder<spec::integer<SpecOptions>, Value>
+	: raw_der_encoder<spec::integer<SpecOptions>, Value> {};
+
+//Decoded integer
+template<typename SpecOptions, std::signed_integral Value>
+struct der_encoder<spec::integer<SpecOptions>, Value>
+	: der_encoder_base<der_encoder<spec::integer<SpecOptions>, Value>>
+{
+	static length_type content_length(Value value) noexcept
+	{
+		return integer_length(value);
+	}
+
+	template<typename EncodeState>
+	static void encode_content(Value value, EncodeState& state)
+	{
+		write_integer(state, value, integer_length(value));
+	}
+};
+
+template<typename SpecOptions, Enumerated Value>
+struct der_encoder<spec::enumerated<SpecOptions>, Value>
+	: der_encoder_base<der_encoder<spec::enumerated<SpecOptions>, Value>>
+{
+	using base_enum_type = typename std::conditional_t<std::is_enum_v<Value>,
+		std::underlying_type<Value>, std::type_identity<Value>>::type;
+
+	static length_type content_length(Value value) noexcept
+	{
+		return integer_length(static_cast<base_enum_type>(value));
+	}
+
+	template<typename EncodeState>
+	static void encode_content(Value value, EncodeState& state)
+	{
+		auto integral_value = static_cast<base_enum_type>(value);
+		write_integer(state, integral_value, integer_length(integral_value));
+	}
+};
+
+template<typename SpecOptions>
+struct der_encoder<spec::boolean<SpecOptions>, bool>
+	: der_encoder_base<der_encoder<spec::boolean<SpecOptions>, bool>>
+{
+	static constexpr length_type fixed_content_length() noexcept
+	{
+		return 1u;
+	}
+
+	static constexpr length_type content_length(bool) noexcept
+	{
+		return 1u;
+	}
+
+	template<typename EncodeState>
+	static void encode_content(bool value, EncodeState& state)
+	{
+		write_byte(state, value ? 0xffu : 0x00u);
+	}
+};
+
+template<typename SpecOptions>
+struct der_encoder<spec::null<SpecOptions>, std::nullptr_t>
+	: der_encoder_base<der_encoder<spec::null<SpecOptions>, std::nullptr_t>>
+{
+	static constexpr length_type fixed_content_length() noexcept
+	{
+		return 0u;
+	}
+
+	static constexpr length_type content_length(std::nullptr_t) noexcept
+	{
+		return 0u;
+	}
+
+	template<typename EncodeState>
+	static void encode_content(std::nullptr_t, EncodeState&) noexcept
+	{
+	}
+};
+
+template<std::uint32_t Tag, spec::encoding Encoding,
+	spec::cls Class, typename SpecOptions, typename Spec, typename Value>
+struct der_encoder<spec::tagged_with_options<Tag, Encoding, Class, SpecOptions, Spec>, Value>
+	: der_encoder_base<der_encoder<
+		spec::tagged_with_options<Tag, Encoding, Class, SpecOptions, Spec>, Value>>
+{
+	using nested_encoder_type = select_nested_der_encoder<Spec, Value>;
+
+	static constexpr length_type fixed_content_length() noexcept
+	{
+		if constexpr (Encoding == spec::encoding::expl)
+			return nested_encoder_type::fixed_length();
+		else
+			return fixed_content_length_of<nested_encoder_type>();
+	}
+
+	template<typename Lengths>
+	static length_type content_length(const Value& value, Lengths& lengths)
+	{
+		if constexpr (Encoding == spec::encoding::expl)
+			return nested_encoder_type::encoded_length(value, lengths);
+		else
+			return content_length_of<nested_encoder_type>(value, lengths);
+	}
+
+	template<typename EncodeState>
+	static void encode_content(const Value& value, EncodeState& state)
+	{
+		if constexpr (Encoding == spec::encoding::expl)
+			nested_encoder_type::encode(value, state);
+		else
+			nested_encoder_type::encode_content(value, state);
+	}
+};
+
+template<typename SpecOptions, ByteRange Value>
+struct der_encoder<spec::any<SpecOptions>, Value>
+{
+	[[nodiscard]]
+	static constexpr length_type fixed_length() noexcept
+	{
+		return variable_length;
+	}
+
+	template<typename Lengths>
+	static length_type encoded_length(const Value& value, Lengths&)
+	{
+		return static_cast<length_type>(std::ranges::size(value));
+	}
+
+	template<typename EncodeState>
+	static void encode(const Value& value, EncodeState& state)
+	{
+		write_bytes(state, value);
+	}
+};
+
+template<typename SpecOptions>
+struct der_encoder<spec::extension_marker<SpecOptions>, extension_sentinel>
+{
+	[[nodiscard]]
+	static constexpr length_type fixed_length() noexcept
+	{
+		return 0u;
+	}
+
+	template<typename Lengths>
+	static constexpr length_type encoded_length(const extension_sentinel&, Lengths&) noexcept
+	{
+		return 0u;
+	}
+
+	template<typename EncodeState>
+	static void encode(const extension_sentinel&, EncodeState&) noexcept
+	{
+	}
+};
+
+template<typename SpecOptions, typename... Specs, typename... Values>
+struct der_encoder<spec::choice_with_options<SpecOptions, Specs...>,
+	std::variant<Values...>>
+{
+	static_assert(sizeof...(Specs) == sizeof...(Values),
+		"Variant must have the same amount of alternatives"
+		" as the number of nested CHOICE specifications");
+
+	using value_type = std::variant<Values...>;
+
+	template<std::size_t Index>
+	using alternative_encoder_type = select_nested_der_encoder<
+		std::tuple_element_t<Index, std::tuple<Specs...>>,
+		std::variant_alternative_t<Index, value_type>>;
+
+	[[nodiscard]]
+	static constexpr length_type fixed_length() noexcept
+	{
+		return variable_length;
+	}
+
+	template<typename Lengths>
+	static length_type encoded_length(const value_type& value, Lengths& lengths)
+	{
+		if (value.valueless_by_exception())
+			throw_encode_error("CHOICE value is empty");
+
+		return encoded_length_impl(value, lengths, std::index_sequence_for<Specs...>{});
+	}
+
+	template<typename EncodeState>
+	static void encode(const value_type& value, EncodeState& state)
+	{
+		if (value.valueless_by_exception())
+			throw_encode_error("CHOICE value is empty");
+
+		encode_impl(value, state, std::index_sequence_for<Specs...>{});
+	}
+
+private:
+	template<typename Lengths, std::size_t... Indexes>
+	static length_type encoded_length_impl(const value_type& value, Lengths& lengths,
+		std::index_sequence<Indexes...>)
+	{
+		length_type result{};
+		(void)(... || (value.index() == Indexes
+			&& ((result = alternative_encoder_type<Indexes>::encoded_length(
+				*std::get_if<Indexes>(&value), lengths)), true)));
+		return result;
+	}
+
+	template<typename EncodeState, std::size_t... Indexes>
+	static void encode_impl(const value_type& value, EncodeState& state,
+		std::index_sequence<Indexes...>)
+	{
+		(void)(... || (value.index() == Indexes
+			&& (alternative_encoder_type<Indexes>::encode(
+				*std::get_if<Indexes>(&value), state), true)));
+	}
+};
+
+//The alternative is encoded according to the variant index,
+//the OID field is not checked
+template<std::size_t OidFieldIndex, typename... Entries, typename FallbackSpec,
+	typename SpecOptions, typename... Values>
+struct der_encoder<spec::open_type<OidFieldIndex, spec::open_type_registry<Entries...>,
+	FallbackSpec, SpecOptions>, std::variant<Values...>>
+	: der_encoder<spec::choice<FallbackSpec, typename Entries::spec_type...>,
+		std::variant<Values...>>
+{
+};
+
+template<typename Spec, OptionalType Value>
+struct der_encoder<spec::optional<Spec>, Value>
+{
+	using nested_encoder_type = select_nested_der_encoder<
+		Spec, typename ptr_traits<Value>::type>;
+
+	[[nodiscard]]
+	static constexpr length_type fixed_length() noexcept
+	{
+		return variable_length;
+	}
+
+	template<typename Lengths>
+	static length_type encoded_length(const Value& value, Lengths& lengths)
+	{
+		return value ? nested_encoder_type::encoded_length(*value, lengths) : 0u;
+	}
+
+	template<typename EncodeState>
+	static void encode(const Value& value, EncodeState& state)
+	{
+		if (value)
+			nested_encoder_type::encode(*value, state);
+	}
+};
+
+template<typename DefaultValueProvider, typename Spec, typename Value>
+struct der_encoder<spec::optional_default<DefaultValueProvider, Spec>, Value>
+{
+	using nested_encoder_type = select_nested_der_encoder<Spec, Value>;
+
+	[[nodiscard]]
+	static constexpr length_type fixed_length() noexcept
+	{
+		return variable_length;
+	}
+
+	//DER requires values equal to the DEFAULT ones to be omitted
+	[[nodiscard]]
+	static bool is_default(const Value& value)
+	{
+		static_assert(std::equality_comparable<Value>,
+			"Values with DEFAULT must be equality comparable to be encoded");
+		Value default_value{};
+		spec::optional_default<DefaultValueProvider, Spec>::assign_default(default_value);
+		return value == default_value;
+	}
+
+	template<typename Lengths>
+	static length_type encoded_length(const Value& value, Lengths& lengths)
+	{
+		return is_default(value) ? 0u : nested_encoder_type::encoded_length(value, lengths);
+	}
+
+	template<typename EncodeState>
+	static void encode(const Value& value, EncodeState& state)
+	{
+		if (!is_default(value))
+			nested_encoder_type::encode(value, state);
+	}
+};
+
+template<typename SpecOptions, typename... Specs, SequenceType Value>
+struct der_encoder<spec::sequence_with_options<SpecOptions, Specs...>, Value>
+	: der_encoder_base<der_encoder<spec::sequence_with_options<SpecOptions, Specs...>, Value>>
+{
+	static_assert(boost::pfr::tuple_size_v<Value> == sizeof...(Specs),
+		"Value structure must have the same amount of fields"
+		" as the number of nested SEQUENCE specifications");
+
+	template<std::size_t Index>
+	using field_encoder_type = select_nested_der_encoder<
+		std::tuple_element_t<Index, std::tuple<Specs...>>,
+		boost::pfr::tuple_element_t<Index, Value>>;
+
+	static constexpr length_type fixed_content_length() noexcept
+	{
+		return fixed_content_length_impl(std::index_sequence_for<Specs...>{});
+	}
+
+	template<typename Lengths>
+	static length_type content_length(const Value& value, Lengths& lengths)
+	{
+		return content_length_impl(value, lengths, std::index_sequence_for<Specs...>{});
+	}
+
+	template<typename EncodeState>
+	static void encode_content(const Value& value, EncodeState& state)
+	{
+		encode_content_impl(value, state, std::index_sequence_for<Specs...>{});
+	}
+
+private:
+	template<std::size_t... Indexes>
+	static constexpr length_type fixed_content_length_impl(
+		std::index_sequence<Indexes...>) noexcept
+	{
+		return sum_fixed_lengths({ field_encoder_type<Indexes>::fixed_length()... });
+	}
+
+	template<typename Lengths, std::size_t... Indexes>
+	static length_type content_length_impl(const Value& value, Lengths& lengths,
+		std::index_sequence<Indexes...>)
+	{
+		return (length_type{} + ... + field_encoder_type<Indexes>::encoded_length(
+			boost::pfr::get<Indexes>(value), lengths));
+	}
+
+	template<typename EncodeState, std::size_t... Indexes>
+	static void encode_content_impl(const Value& value, EncodeState& state,
+		std::index_sequence<Indexes...>)
+	{
+		(..., field_encoder_type<Indexes>::encode(boost::pfr::get<Indexes>(value), state));
+	}
+};
+
+//SET OF elements must be written sorted by their encodings (X.690, 11.6).
+//To do this, the encoded length of each element is recorded by the pre-pass
+//before the lengths of its nested values. The elements are then encoded
+//into a scratch buffer in the container order, and written sorted.
+template<template<typename, typename> typename SequenceOf,
+	typename Spec, typename SpecOptions, typename Value>
+struct sequence_of_der_encoder
+	: der_encoder_base<der_encoder<SequenceOf<SpecOptions, Spec>, Value>>
+{
+	using nested_encoder_type = select_nested_der_encoder<Spec, typename Value::value_type>;
+
+	static constexpr bool sort_elements = std::is_same_v<SequenceOf<SpecOptions, Spec>,
+		spec::set_of_with_options<SpecOptions, Spec>>;
+
+	template<typename Lengths>
+	static length_type content_length(const Value& value, Lengths& lengths)
+	{
+		using min_max_elements_option_type = typename SequenceOf<SpecOptions, Spec>
+			::template option_by_category<option_cat::min_max_elements>;
+		[[maybe_unused]] std::size_t element_count = 0;
+		length_type result = 0;
+		for (const auto& element : value)
+		{
+			if constexpr (sort_elements)
+			{
+				auto slot = lengths.reserve();
+				auto length = nested_encoder_type::encoded_length(element, lengths);
+				lengths.set(slot, length);
+				result += length;
+			}
+			else
+			{
+				result += nested_encoder_type::encoded_length(element, lengths);
+			}
+			++element_count;
+		}
+
+		if constexpr (!std::is_same_v<min_max_elements_option_type, void>)
+		{
+			if (element_count > min_max_elements_option_type::max_elems)
+				throw_encode_error("Too many elements");
+			if (element_count < min_max_elements_option_type::min_elems)
+				throw_encode_error("Too few elements");
+		}
+		return result;
+	}
+
+	template<typename EncodeState>
+	static void encode_content(const Value& value, EncodeState& state)
+	{
+		if constexpr (sort_elements)
+		{
+			encode_sorted_content(value, state);
+		}
+		else
+		{
+			for (const auto& element : value)
+				nested_encoder_type::encode(element, state);
+		}
+	}
+
+private:
+	struct element_bytes
+	{
+		length_type offset;
+		length_type length;
+	};
+
+	template<typename EncodeState>
+	static void encode_sorted_content(const Value& value, EncodeState& state)
+	{
+		std::vector<std::uint8_t> buffer;
+		std::vector<element_bytes> elements;
+		for (const auto& element : value)
+		{
+			const auto& bytes = elements.emplace_back(
+				element_bytes{ buffer.size(), *state.next_length++ });
+			buffer.resize(bytes.offset + bytes.length);
+			encode_state_with_lengths element_state(buffer.data() + bytes.offset,
+				state.next_length);
+			nested_encoder_type::encode(element, element_state);
+			state.next_length = element_state.next_length;
+		}
+
+		auto element_span = [&buffer](const element_bytes& bytes) {
+			return std::span<const std::uint8_t>(buffer.data() + bytes.offset, bytes.length);
+		};
+		std::sort(elements.begin(), elements.end(),
+			[&element_span](const element_bytes& l, const element_bytes& r) {
+				return std::ranges::lexicographical_compare(element_span(l), element_span(r));
+			});
+		for (const auto& bytes : elements)
+			write_bytes(state, element_span(bytes));
+	}
+};
+
+template<typename SpecOptions, typename Spec, std::ranges::forward_range Value>
+struct der_encoder<spec::sequence_of_with_options<SpecOptions, Spec>, Value>
+	: sequence_of_der_encoder<spec::sequence_of_with_options, Spec, SpecOptions, Value> {};
+
+template<typename SpecOptions, typename Spec, std::ranges::forward_range Value>
+struct der_encoder<spec::set_of_with_options<SpecOptions, Spec>, Value>
+	: sequence_of_der_encoder<spec::set_of_with_options, Spec, SpecOptions, Value> {};
+
+//sequence_of_view is an input range, but every begin() call
+//decodes the elements again, so it can be iterated once per pass
+template<typename SpecOptions, typename Spec, typename RangeType, typename Value>
+struct der_encoder<spec::sequence_of_with_options<SpecOptions, Spec>,
+	sequence_of_view<RangeType, Value>>
+	: sequence_of_der_encoder<spec::sequence_of_with_options, Spec, SpecOptions,
+		sequence_of_view<RangeType, Value>> {};
+
+template<typename SpecOptions, typename Spec, typename RangeType, typename Value>
+struct der_encoder<spec::set_of_with_options<SpecOptions, Spec>,
+	sequence_of_view<RangeType, Value>>
+	: sequence_of_der_encoder<spec::set_of_with_options, Spec, SpecOptions,
+		sequence_of_view<RangeType, Value>> {};
+
+//The key which is used to sort SET elements in the DER canonical order
+//(by tag class, then by tag number).
+//For untagged CHOICE, the smallest key of its alternatives is used.
+template<typename Spec>
+struct canonical_tag
+{
+	static constexpr std::uint32_t value = ((Spec::tag() & 0xc0u) << 18u)
+		| tag_number(Spec::tag());
+};
+
+template<typename SpecOptions, typename... Specs>
+struct canonical_tag<spec::choice_with_options<SpecOptions, Specs...>>
+{
+	static constexpr std::uint32_t value = (std::min)({ canonical_tag<Specs>::value... });
+};
+
+template<typename Spec>
+struct canonical_tag<spec::optional<Spec>> : canonical_tag<Spec> {};
+
+template<typename DefaultValueProvider, typename Spec>
+struct canonical_tag<spec::optional_default<DefaultValueProvider, Spec>>
+	: canonical_tag<Spec> {};
+
+//Fields are both measured and written in the canonical order,
+//so that the recorded content lengths are consumed in the same order
+template<typename SpecOptions, typename... Specs, SequenceType Value>
+struct der_encoder<spec::set_with_options<SpecOptions, Specs...>, Value>
+	: der_encoder_base<der_encoder<spec::set_with_options<SpecOptions, Specs...>, Value>>
+{
+	using sequence_encoder_type = der_encoder<
+		spec::sequence_with_options<SpecOptions, Specs...>, Value>;
+
+	template<std::size_t Index>
+	using field_encoder_type = typename sequence_encoder_type::template field_encoder_type<Index>;
+
+	static constexpr length_type fixed_content_length() noexcept
+	{
+		return sequence_encoder_type::fixed_content_length();
+	}
+
+	template<typename Lengths>
+	static length_type content_length(const Value& value, Lengths& lengths)
+	{
+		return content_length_impl(value, lengths,
+			sorted_indexes(std::index_sequence_for<Specs...>{}));
+	}
+
+	template<typename EncodeState>
+	static void encode_content(const Value& value, EncodeState& state)
+	{
+		encode_content_impl(value, state, sorted_indexes(std::index_sequence_for<Specs...>{}));
+	}
+
+private:
+	static constexpr auto create_encoding_order() noexcept
+	{
+		std::array<std::size_t, sizeof...(Specs)> order{};
+		std::array<std::uint32_t, sizeof...(Specs)> tags{ canonical_tag<Specs>::value... };
+		for (std::size_t i = 0; i != order.size(); ++i)
+			order[i] = i;
+		std::sort(order.begin(), order.end(), [&tags](std::size_t l, std::size_t r) {
+			return tags[l] < tags[r];
+		});
+		return order;
+	}
+
+	static constexpr auto encoding_order{ create_encoding_order() };
+
+	template<std::size_t... Indexes>
+	static constexpr auto sorted_indexes(std::index_sequence<Indexes...>) noexcept
+	{
+		return std::index_sequence<encoding_order[Indexes]...>{};
+	}
+
+	template<typename Lengths, std::size_t... Indexes>
+	static length_type content_length_impl(const Value& value, Lengths& lengths,
+		std::index_sequence<Indexes...>)
+	{
+		return (length_type{} + ... + field_encoder_type<Indexes>::encoded_length(
+			boost::pfr::get<Indexes>(value), lengths));
+	}
+
+	template<typename EncodeState, std::size_t... Indexes>
+	static void encode_content_impl(const Value& value, EncodeState& state,
+		std::index_sequence<Indexes...>)
+	{
+		(..., field_encoder_type<Indexes>::encode(boost::pfr::get<Indexes>(value), state));
+	}
+};
+
+template<typename SpecOptions, ByteRange Value>
+struct der_encoder<spec::octet_string<SpecOptions>, Value>
+	: raw_der_encoder<spec::octet_string<SpecOptions>, Value> {};
+
+template<typename EncapsulatedSpec, typename SpecOptions, typename Value>
+struct der_encoder<spec::octet_string_with<EncapsulatedSpec, SpecOptions>, Value>
+	: der_encoder_base<der_encoder<spec::octet_string_with<EncapsulatedSpec, SpecOptions>, Value>>
+{
+	using nested_encoder_type = select_nested_der_encoder<EncapsulatedSpec, Value>;
+
+	static constexpr length_type fixed_content_length() noexcept
+	{
+		return nested_encoder_type::fixed_length();
+	}
+
+	template<typename Lengths>
+	static length_type content_length(const Value& value, Lengths& lengths)
+	{
+		return nested_encoder_type::encoded_length(value, lengths);
+	}
+
+	template<typename EncodeState>
+	static void encode_content(const Value& value, EncodeState& state)
+	{
+		nested_encoder_type::encode(value, state);
+	}
+};
+
+template<typename SpecOptions, ByteRange Container>
+struct der_encoder<spec::bit_string<SpecOptions>, bit_string<Container>>
+	: der_encoder_base<der_encoder<spec::bit_string<SpecOptions>, bit_string<Container>>>
+{
+	static length_type content_length(const bit_string<Container>& value)
+	{
+		auto total_bits = static_cast<std::size_t>(std::ranges::size(value.container))
+			* std::numeric_limits<std::uint8_t>::digits;
+		if (value.bit_count > total_bits
+			|| total_bits - value.bit_count >= std::numeric_limits<std::uint8_t>::digits)
+		{
+			throw_encode_error("Invalid BIT STRING bit count");
+		}
+		return 1u + static_cast<length_type>(std::ranges::size(value.container));
+	}
+
+	template<typename EncodeState>
+	static void encode_content(const bit_string<Container>& value, EncodeState& state)
+	{
+		auto total_bits = static_cast<std::size_t>(std::ranges::size(value.container))
+			* std::numeric_limits<std::uint8_t>::digits;
+		write_byte(state, static_cast<std::uint8_t>(total_bits - value.bit_count));
+		write_bytes(state, value.container);
+	}
+};
+
+template<typename Spec, typename Container, bool IsRelative>
+struct oid_der_encoder : raw_der_encoder<Spec, Container> {};
+
+template<typename Spec, typename Container, bool IsRelative>
+struct oid_der_encoder<Spec, decoded_object_identifier<Container>, IsRelative>
+	: der_encoder_base<der_encoder<Spec, decoded_object_identifier<Container>>>
+{
+	static length_type content_length(const decoded_object_identifier<Container>& value)
+	{
+		length_type result = 0;
+		for_each_component(value, [&result](std::uint64_t component) {
+			result += base128_length(component);
+		});
+		return result;
+	}
+
+	template<typename EncodeState>
+	static void encode_content(const decoded_object_identifier<Container>& value,
+		EncodeState& state)
+	{
+		for_each_component(value, [&state](std::uint64_t component) {
+			write_base128(state, component);
+		});
+	}
+
+private:
+	template<typename Func>
+	static void for_each_component(const decoded_object_identifier<Container>& value,
+		const Func& func)
+	{
+		auto it = std::ranges::begin(value.container);
+		auto end = std::ranges::end(value.container);
+		if constexpr (!IsRelative)
+		{
+			if (it == end)
+				throw_encode_error("Too few OID components");
+
+			auto first = static_cast<std::uint64_t>(*it++);
+			if (it == end)
+				throw_encode_error("Too few OID components");
+
+			auto second = static_cast<std::uint64_t>(*it++);
+			if (first > 2u || (first < 2u && second >= 40u))
+				throw_encode_error("Invalid first OID components");
+
+			func(first * 40u + second);
+		}
+		else
+		{
+			if (it == end)
+				throw_encode_error("Too few RELATIVE-OID components");
+		}
+
+		for (; it != end; ++it)
+			func(static_cast<std::uint64_t>(*it));
+	}
+};
+
+template<typename SpecOptions, typename Container>
+struct der_encoder<spec::object_identifier<SpecOptions>, Container>
+	: oid_der_encoder<spec::object_identifier<SpecOptions>, Container, false> {};
+
+template<typename SpecOptions, typename Container>
+struct der_encoder<spec::relative_oid<SpecOptions>, Container>
+	: oid_der_encoder<spec::relative_oid<SpecOptions>, Container, true> {};
+
+template<template<typename> typename StringSpec,
+	typename SpecOptions, typename Char, typename Value>
+struct string_der_encoder
+{
+	static_assert(std::is_same_v<Value, void>, "Invalid string encoder arguments");
+};
+
+template<template<typename> typename StringSpec,
+	typename SpecOptions, typename Char, ByteRange Value>
+struct string_der_encoder<StringSpec, SpecOptions, Char, Value>
+	: der_encoder_base<der_encoder<StringSpec<SpecOptions>, Value>>
+{
+	static length_type content_length(const Value& value)
+	{
+		auto length = static_cast<length_type>(std::ranges::size(value));
+		if constexpr (sizeof(Char) > 1u)
+		{
+			if (length % sizeof(Char))
+				throw_encode_error("Invalid string length");
+		}
+		return length;
+	}
+
+	template<typename EncodeState>
+	static void encode_content(const Value& value, EncodeState& state)
+	{
+		write_bytes(state, value);
+	}
+};
+
+template<template<typename> typename StringSpec,
+	typename SpecOptions, typename Char, typename OtherChar,
+	typename Traits, typename Allocator>
+struct string_der_encoder<StringSpec, SpecOptions, Char,
+	std::basic_string<OtherChar, Traits, Allocator>>
+	: der_encoder<sentinel, std::basic_string<OtherChar, Traits, Allocator>>
+{
+};
+
+template<template<typename> typename StringSpec,
+	typename SpecOptions, typename Char, typename Traits, typename Allocator>
+struct string_der_encoder<StringSpec, SpecOptions, Char,
+	std::basic_string<Char, Traits, Allocator>>
+	: der_encoder_base<der_encoder<StringSpec<SpecOptions>,
+		std::basic_string<Char, Traits, Allocator>>>
+{
+	static length_type content_length(const std::basic_string<Char, Traits, Allocator>& value)
+	{
+		return static_cast<length_type>(value.size() * sizeof(Char));
+	}
+
+	template<typename EncodeState>
+	static void encode_content(const std::basic_string<Char, Traits, Allocator>& value,
+		EncodeState& state)
+	{
+		if constexpr (sizeof(Char) == 1u)
+		{
+			write_bytes(state, value);
+		}
+		else
+		{
+			for (Char ch : value)
+			{
+				auto char_value = static_cast<std::make_unsigned_t<Char>>(ch);
+				for (std::size_t i = sizeof(Char); i != 0; --i)
+				{
+					write_byte(state, static_cast<std::uint8_t>(char_value
+						>> ((i - 1u) * std::numeric_limits<std::uint8_t>::digits)));
+				}
+			}
+		}
+	}
+};
+
+//Allow UTF-8 string to be encoded from both std::u8string and std::string
+template<typename SpecOptions, typename Traits, typename Allocator>
+struct string_der_encoder<spec::utf8_string, SpecOptions, char8_t,
+	std::basic_string<char, Traits, Allocator>>
+	: string_der_encoder<spec::utf8_string, SpecOptions, char,
+		std::basic_string<char, Traits, Allocator>>
+{
+};
+
+template<typename SpecOptions, typename Value>
+struct der_encoder<spec::numeric_string<SpecOptions>, Value>
+	: string_der_encoder<spec::numeric_string, SpecOptions, char, Value> {};
+
+template<typename SpecOptions, typename Value>
+struct der_encoder<spec::printable_string<SpecOptions>, Value>
+	: string_der_encoder<spec::printable_string, SpecOptions, char, Value> {};
+
+template<typename SpecOptions, typename Value>
+struct der_encoder<spec::ia5_string<SpecOptions>, Value>
+	: string_der_encoder<spec::ia5_string, SpecOptions, char, Value> {};
+
+template<typename SpecOptions, typename Value>
+struct der_encoder<spec::teletex_string<SpecOptions>, Value>
+	: string_der_encoder<spec::teletex_string, SpecOptions, char, Value> {};
+
+template<typename SpecOptions, typename Value>
+struct der_encoder<spec::videotex_string<SpecOptions>, Value>
+	: string_der_encoder<spec::videotex_string, SpecOptions, char, Value> {};
+
+template<typename SpecOptions, typename Value>
+struct der_encoder<spec::visible_string<SpecOptions>, Value>
+	: string_der_encoder<spec::visible_string, SpecOptions, char, Value> {};
+
+template<typename SpecOptions, typename Value>
+struct der_encoder<spec::graphic_string<SpecOptions>, Value>
+	: string_der_encoder<spec::graphic_string, SpecOptions, char, Value> {};
+
+template<typename SpecOptions, typename Value>
+struct der_encoder<spec::general_string<SpecOptions>, Value>
+	: string_der_encoder<spec::general_string, SpecOptions, char, Value> {};
+
+template<typename SpecOptions, typename Value>
+struct der_encoder<spec::object_descriptor<SpecOptions>, Value>
+	: string_der_encoder<spec::object_descriptor, SpecOptions, char, Value> {};
+
+template<typename SpecOptions, typename Value>
+struct der_encoder<spec::universal_string<SpecOptions>, Value>
+	: string_der_encoder<spec::universal_string, SpecOptions, char32_t, Value> {};
+
+template<typename SpecOptions, typename Value>
+struct der_encoder<spec::bmp_string<SpecOptions>, Value>
+	: string_der_encoder<spec::bmp_string, SpecOptions, char16_t, Value> {};
+
+template<typename SpecOptions, typename Value>
+struct der_encoder<spec::utf8_string<SpecOptions>, Value>
+	: string_der_encoder<spec::utf8_string, SpecOptions, char8_t, Value> {};
+
+template<std::size_t Digits, typename EncodeState, std::unsigned_integral T>
+void write_decimal(EncodeState& state, T value)
+{
+	std::array<std::uint8_t, Digits> digits;
+	for (std::size_t i = Digits; i != 0; --i)
+	{
+		digits[i - 1u] = static_cast<std::uint8_t>('0' + value % 10u);
+		value /= 10u;
+	}
+	for (auto digit : digits)
+		write_byte(state, digit);
+}
+
+template<typename EncodeState, typename DateTime>
+void write_date_time(EncodeState& state, const DateTime& value)
+{
+	write_decimal<2u>(state, value.month);
+	write_decimal<2u>(state, value.day);
+	write_decimal<2u>(state, value.hour);
+	write_decimal<2u>(state, value.minute);
+	write_decimal<2u>(state, value.second);
+}
+
+[[nodiscard]]
+constexpr length_type decimal_length(std::uint64_t value) noexcept
+{
+	length_type result = 1u;
+	while (value >= 10u)
+	{
+		++result;
+		value /= 10u;
+	}
+	return result;
+}
+
+template<typename SpecOptions>
+struct der_encoder<spec::utc_time<SpecOptions>, utc_time>
+	: der_encoder_base<der_encoder<spec::utc_time<SpecOptions>, utc_time>>
+{
+	static constexpr length_type fixed_content_length() noexcept
+	{
+		return 13u;
+	}
+
+	static length_type content_length(const utc_time& value)
+	{
+		if (value.year > 99u)
+			throw_encode_error("Invalid UTCTime year value");
+		if (const char* error = check_date_time(utc_time_full_year<SpecOptions>(value.year), value))
+			throw_encode_error(error);
+		return 13u;
+	}
+
+	template<typename EncodeState>
+	static void encode_content(const utc_time& value, EncodeState& state)
+	{
+		write_decimal<2u>(state, value.year);
+		write_date_time(state, value);
+		write_byte(state, 'Z');
+	}
+};
+
+//Seconds fraction is written with seconds_fraction_digits digits
+//(zero-padded on the left), as parsed by the decoder
+template<typename SpecOptions>
+struct der_encoder<spec::generalized_time<SpecOptions>, generalized_time>
+	: der_encoder_base<der_encoder<spec::generalized_time<SpecOptions>, generalized_time>>
+{
+	//At most 19 digits, which always fit std::uint64_t
+	static constexpr length_type max_fraction_digits = 19u;
+
+	[[nodiscard]]
+	static length_type fraction_digits(const generalized_time& value)
+	{
+		if (!value.seconds_fraction)
+			return 0u;
+
+		auto significant_digits = decimal_length(value.seconds_fraction);
+		if (significant_digits > max_fraction_digits)
+			throw_encode_error("Invalid GeneralizedTime seconds fraction value");
+		if (!value.seconds_fraction_digits)
+			return significant_digits;
+
+		if (value.seconds_fraction_digits < significant_digits
+			|| value.seconds_fraction_digits > max_fraction_digits)
+		{
+			throw_encode_error("Invalid GeneralizedTime seconds fraction digit count");
+		}
+		return value.seconds_fraction_digits;
+	}
+
+	static length_type content_length(const generalized_time& value)
+	{
+		if (value.year > 9999u)
+			throw_encode_error("Invalid GeneralizedTime year value");
+		if (const char* error = check_date_time(value.year, value))
+			throw_encode_error(error);
+		if (value.seconds_fraction % 10u == 0u && value.seconds_fraction)
+			throw_encode_error("GeneralizedTime seconds fraction value has trailing zeros");
+
+		length_type result = 15u;
+		if (auto digits = fraction_digits(value))
+			result += 1u + digits;
+		return result;
+	}
+
+	template<typename EncodeState>
+	static void encode_content(const generalized_time& value, EncodeState& state)
+	{
+		write_decimal<4u>(state, value.year);
+		write_date_time(state, value);
+		if (auto length = fraction_digits(value))
+		{
+			write_byte(state, '.');
+			auto fraction = value.seconds_fraction;
+			std::array<std::uint8_t, max_fraction_digits> digits;
+			for (length_type i = length; i != 0; --i)
+			{
+				digits[i - 1u] = static_cast<std::uint8_t>('0' + fraction % 10u);
+				fraction /= 10u;
+			}
+			for (length_type i = 0; i != length; ++i)
+				write_byte(state, digits[i]);
+		}
+		write_byte(state, 'Z');
+	}
+};
+
+template<RecursiveSpec RecursiveWrapper, typename Value>
+struct der_encoder<RecursiveWrapper, Value>
+{
+	using spec_type = typename RecursiveWrapper::type;
+	using encoder_impl_type = select_nested_der_encoder<spec_type,
+		typename ptr_traits<Value>::type>;
+
+	[[nodiscard]]
+	static constexpr length_type fixed_length() noexcept
+	{
+		return variable_length;
+	}
+
+	static const auto& get_value(const Value& value)
+	{
+		if constexpr (ptr_traits<Value>::is_optional_type)
+		{
+			if (!value)
+				throw_encode_error("Empty recursive value");
+			return *value;
+		}
+		else
+		{
+			return value;
+		}
+	}
+
+	template<typename Lengths>
+	static length_type encoded_length(const Value& value, Lengths& lengths)
+	{
+		return encoder_impl_type::encoded_length(get_value(value), lengths);
+	}
+
+	template<typename EncodeState>
+	static void encode(const Value& value, EncodeState& state)
+	{
+		encoder_impl_type::encode(get_value(value), state);
+	}
+
+	template<typename Lengths>
+	static length_type content_length(const Value& value, Lengths& lengths)
+	{
+		return content_length_of<encoder_impl_type>(get_value(value), lengths);
+	}
+
+	template<typename EncodeState>
+	static void encode_content(const Value& value, EncodeState& state)
+	{
+		encoder_impl_type::encode_content(get_value(value), state);
+	}
+};
+
+template<typename Spec, typename T, typename OutputIterator>
+OutputIterator encode_with_lengths(const T& value,
+	const encoded_lengths& lengths, OutputIterator out)
+{
+	encode_state_with_lengths state(out, lengths.data());
+	select_nested_der_encoder<Spec, T>::encode(value, state);
+	return state.out;
+}
+} //namespace asn1::detail::der
+
+namespace asn1::der
+{
+template<typename Spec, typename T>
+[[nodiscard]] consteval std::optional<std::size_t> fixed_encoded_size() noexcept
+{
+	constexpr auto length = detail::der::select_nested_der_encoder<Spec, T>::fixed_length();
+	if constexpr (length == detail::variable_length)
+		return std::nullopt;
+	else
+		return length;
+}
+
+template<typename Spec, typename T>
+[[nodiscard]] std::size_t encoded_size(const T& value)
+{
+	detail::der::discarded_lengths lengths;
+	return detail::der::select_nested_der_encoder<Spec, T>::encoded_length(value, lengths);
+}
+
+//The value is validated before anything is written
+template<typename Spec, std::input_or_output_iterator OutputIterator, typename T>
+OutputIterator encode(encode_state<OutputIterator>& state, const T& value)
+{
+	detail::der::encoded_lengths lengths;
+	(void)detail::der::select_nested_der_encoder<Spec, T>::encoded_length(value, lengths);
+	state.out = detail::der::encode_with_lengths<Spec>(value, lengths, state.out);
+	return state.out;
+}
+
+template<typename Spec, typename T, std::input_or_output_iterator OutputIterator>
+OutputIterator encode(const T& value, OutputIterator out)
+{
+	encode_state state(out);
+	return encode<Spec>(state, value);
+}
+
+//Appends the encoded value to the vector, which is resized only once.
+//The values are validated before resizing, and the vector is restored
+//to its original size if encoding fails anyway.
+template<typename Spec, typename T, typename ByteType, typename Allocator>
+void encode(const T& value, std::vector<ByteType, Allocator>& out)
+{
+	detail::der::encoded_lengths lengths;
+	auto size = detail::der::select_nested_der_encoder<Spec, T>::encoded_length(value, lengths);
+	auto offset = out.size();
+	out.resize(offset + size);
+	try
+	{
+		(void)detail::der::encode_with_lengths<Spec>(value, lengths, out.data() + offset);
+	}
+	catch (...)
+	{
+		out.resize(offset);
+		throw;
+	}
+}
+
+template<typename Spec, typename ByteType = std::uint8_t, typename T>
+[[nodiscard]] std::vector<ByteType> encode(const T& value)
+{
+	std::vector<ByteType> result;
+	encode<Spec>(value, result);
+	return result;
+}
+} //namespace asn1::der
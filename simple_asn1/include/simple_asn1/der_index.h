@@ -0,0 +1,156 @@
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <cstddef>
+#include <iterator>
+#include <limits>
+#include <ranges>
+#include <vector>
+
+#include "simple_asn1/decode.h"
+#include "simple_asn1/der_decode.h"
+#include "simple_asn1/types.h"
+
+namespace asn1::der
+{
+//Flat TLV tree node. Nodes are stored in the document order,
+//so children of a node always follow their parent.
+struct [[nodiscard]] index_node
+{
+	static constexpr std::size_t npos = (std::numeric_limits<std::size_t>::max)();
+
+	tag_type tag{};
+	//Offset of the first tag byte from the beginning of the buffer
+	std::size_t header_offset{};
+	//Offset of the first content byte from the beginning of the buffer
+	std::size_t content_offset{};
+	std::size_t length{};
+	std::size_t parent = npos;
+	std::size_t first_child = npos;
+	std::size_t next_sibling = npos;
+
+	[[nodiscard]]
+	constexpr bool is_constructed() const noexcept
+	{
+		return (tag & 0x20u) != 0u;
+	}
+
+	[[nodiscard]]
+	constexpr std::size_t end_offset() const noexcept
+	{
+		return content_offset + length;
+	}
+
+	[[nodiscard]]
+	friend bool operator==(const index_node&, const index_node&) noexcept = default;
+};
+
+using index_type = std::vector<index_node>;
+
+//Walks the buffer once and builds the flat TLV tree of all elements.
+//Constructed elements (with the 0x20 tag bit set) are indexed recursively,
+//contents of primitive elements are skipped. The buffer may contain several
+//top-level elements. The index is written to the "index" vector, which is cleared first,
+//so that its memory can be reused. Throws parse_error on invalid headers.
+template<std::forward_iterator BufferIterator,
+	std::sentinel_for<BufferIterator> BufferIteratorEnd>
+void build_index(BufferIterator begin, BufferIteratorEnd end, index_type& index)
+{
+	index.clear();
+
+	decode_state state(begin, end);
+	std::size_t offset = 0;
+	std::size_t parent = index_node::npos;
+	std::size_t previous_sibling = index_node::npos;
+	while (true)
+	{
+		while (parent != index_node::npos && offset == index[parent].end_offset())
+		{
+			previous_sibling = parent;
+			parent = index[parent].parent;
+		}
+
+		//The extent of the top level is not known in advance (this would require an extra
+		//pass over non-random-access buffers), so its end is detected by the buffer end
+		if (state.begin == state.end)
+		{
+			if (parent == index_node::npos)
+				break;
+
+			detail::error_helper<detail::parent_context_list<>>::report(state,
+				decode_errc::invalid_header, "Length is too big and overruns buffer");
+		}
+
+		auto header_begin = state.begin;
+		std::size_t max_length = parent == index_node::npos
+			? 0u : index[parent].end_offset() - offset;
+		auto [tag, length] = detail::der::decode_type_length_with_context<
+			detail::parent_context_list<>>(state,
+				parent == index_node::npos ? nullptr : &max_length);
+		const auto content_offset = offset
+			+ static_cast<std::size_t>(std::distance(header_begin, state.begin));
+		if (parent != index_node::npos
+			&& length > index[parent].end_offset() - content_offset)
+		{
+			detail::error_helper<detail::parent_context_list<>>::report(state,
+				decode_errc::invalid_header, "Length is too big and overruns buffer");
+		}
+
+		const auto node_index = index.size();
+		auto& node = index.emplace_back();
+		node.tag = tag;
+		node.header_offset = offset;
+		node.content_offset = content_offset;
+		node.length = length;
+		node.parent = parent;
+
+		if (previous_sibling != index_node::npos)
+			index[previous_sibling].next_sibling = node_index;
+		else if (parent != index_node::npos)
+			index[parent].first_child = node_index;
+
+		offset = node.content_offset;
+		if (node.is_constructed())
+		{
+			parent = node_index;
+			previous_sibling = index_node::npos;
+		}
+		else
+		{
+			if (std::ranges::advance(state.begin,
+				static_cast<std::iter_difference_t<BufferIterator>>(length), state.end))
+			{
+				detail::error_helper<detail::parent_context_list<>>::report(state,
+					decode_errc::invalid_header, "Length is too big and overruns buffer");
+			}
+			offset += length;
+			previous_sibling = node_index;
+		}
+	}
+}
+
+template<std::forward_iterator BufferIterator,
+	std::sentinel_for<BufferIterator> BufferIteratorEnd>
+[[nodiscard]] index_type build_index(BufferIterator begin, BufferIteratorEnd end)
+{
+	index_type index;
+	build_index(begin, end, index);
+	return index;
+}
+
+//Decodes the element described by the index node (header included)
+template<typename Spec, typename DecodeOptions,
+	std::forward_iterator BufferIterator, typename T>
+BufferIterator decode(BufferIterator begin, const index_node& node, T& result)
+{
+	return decode<Spec, DecodeOptions>(std::next(begin, node.header_offset),
+		std::next(begin, node.end_offset()), result);
+}
+
+template<typename Spec, std::forward_iterator BufferIterator, typename T>
+BufferIterator decode(BufferIterator begin, const index_node& node, T& result)
+{
+	return decode<Spec, decode_options<>>(begin, node, result);
+}
+} //namespace asn1::der
@@ -0,0 +1,837 @@
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include <boost/pfr/core.hpp>
+
+#include "simple_asn1/decode.h"
+#include "simple_asn1/der_decode.h"
+#include "simple_asn1/spec.h"
+#include "simple_asn1/types.h"
+
+namespace asn1::detail::der
+{
+//Decodes a part of the stream, origin_offset is the stream offset of the part
+template<typename ByteType>
+struct [[nodiscard]] stream_decode_state : decode_state<const ByteType*>
+{
+	stream_decode_state(const ByteType* begin, const ByteType* end,
+		std::size_t origin_offset) noexcept
+		: decode_state<const ByteType*>(begin, end)
+		, origin_offset(origin_offset)
+	{
+	}
+
+	std::size_t origin_offset;
+};
+
+template<typename ByteType>
+struct stream_frame;
+
+template<typename ByteType>
+struct stream_action;
+
+template<typename ByteType>
+struct stream_frame_handlers
+{
+	//Called for each header of the nested element,
+	//offset is the stream offset of the header
+	stream_action<ByteType> (*on_child)(stream_frame<ByteType>& frame,
+		tag_type tag, std::size_t offset);
+	//Called when all contents of the element were consumed,
+	//offset is the stream offset of the element end
+	void (*on_end)(stream_frame<ByteType>& frame, std::size_t offset);
+	void (*report)(decode_errc code, const char* message, std::size_t offset);
+};
+
+//Constructed element which is being decoded
+template<typename ByteType>
+struct stream_frame
+{
+	const stream_frame_handlers<ByteType>* handlers{};
+	void* value{};
+	length_type remaining{};
+	//Next SEQUENCE field index or SEQUENCE OF element count
+	std::size_t index{};
+};
+
+//Describes what to do with the contents of the nested element.
+//Constructed elements set handlers, leaf elements set leaf_decoder,
+//the element and the rest of the parent element contents are skipped
+//if none is set.
+template<typename ByteType>
+struct stream_action
+{
+	using leaf_decoder_type = void (*)(const ByteType* begin,
+		const ByteType* end, void* value, std::size_t offset);
+
+	const stream_frame_handlers<ByteType>* handlers{};
+	leaf_decoder_type leaf_decoder{};
+	void* value{};
+};
+
+template<typename Specs, typename ByteType>
+void stream_report(decode_errc code, const char* message, std::size_t offset)
+{
+	stream_decode_state<ByteType> state(nullptr, nullptr, offset);
+	error_helper<Specs>::report(state, code, message);
+}
+
+template<typename Value>
+struct is_value_wrapper : std::false_type {};
+template<typename Iterator, typename Value>
+struct is_value_wrapper<with_iterators<Iterator, Value>> : std::true_type {};
+template<typename ByteType, typename Value>
+struct is_value_wrapper<with_pointers<ByteType, Value>> : std::true_type {};
+template<typename RangeType, typename Value>
+struct is_value_wrapper<with_raw_data<RangeType, Value>> : std::true_type {};
+template<typename RangeType, typename Value>
+struct is_value_wrapper<lazy<RangeType, Value>> : std::true_type {};
+template<typename RangeType, typename Value>
+struct is_value_wrapper<sequence_of_view<RangeType, Value>> : std::true_type {};
+
+template<typename Value>
+concept StreamValue = !is_value_wrapper<Value>::value;
+
+//Leaf elements are buffered completely and decoded with the regular der_decoder
+template<typename ByteType, typename Options,
+	typename ParentContexts, typename Spec, typename Value>
+struct leaf_stream_node
+{
+	using decoder_type = select_nested_der_decoder<stream_decode_state<ByteType>&,
+		Options, ParentContexts, Spec, Value>;
+
+	[[nodiscard]]
+	static constexpr bool can_decode(tag_type tag)
+	{
+		return decoder_type::can_decode(tag);
+	}
+
+	[[nodiscard]]
+	static stream_action<ByteType> make_action(Value& value, tag_type, std::size_t)
+	{
+		return { nullptr, &decode_leaf, &value };
+	}
+
+	static void decode_leaf(const ByteType* begin, const ByteType* end,
+		void* value, std::size_t offset)
+	{
+		stream_decode_state<ByteType> state(begin, end, offset);
+		decoder_type::decode_explicit(*static_cast<Value*>(value), state,
+			static_cast<length_type>(end - begin));
+	}
+};
+
+template<typename ByteType, typename Options,
+	typename ParentContexts, typename Spec, typename Value>
+struct stream_node : leaf_stream_node<ByteType, Options, ParentContexts, Spec, Value> {};
+
+template<typename Spec>
+concept WithoutValidator = std::is_same_v<option_by_cat<Spec, option_cat::validator>, void>;
+
+template<typename ByteType, typename Options,
+	typename ParentContexts, typename Spec, typename Value>
+struct constructed_stream_node
+{
+	using decoder_type = select_nested_der_decoder<stream_decode_state<ByteType>&,
+		Options, ParentContexts, Spec, Value>;
+	using merged_specs = typename Options::template merge_spec_names<ParentContexts, Spec>;
+
+	[[nodiscard]]
+	static constexpr bool can_decode(tag_type tag)
+	{
+		return decoder_type::can_decode(tag);
+	}
+
+	static void report(decode_errc code, const char* message, std::size_t offset)
+	{
+		stream_report<merged_specs, ByteType>(code, message, offset);
+	}
+
+	static void validate(const Value& value, std::size_t offset)
+	{
+		stream_decode_state<ByteType> state(nullptr, nullptr, offset);
+		try_validate_value<Options, ParentContexts, Spec>(value, state);
+	}
+
+	template<typename Node>
+	[[nodiscard]]
+	static stream_action<ByteType> make_constructed_action(Value& value,
+		tag_type tag, std::size_t offset)
+	{
+		if (!can_decode(tag))
+			report(decode_errc::unexpected_tag, decoder_type::length_decode_error_text, offset);
+
+		return { &Node::handlers, nullptr, &value };
+	}
+};
+
+template<typename ByteType, typename Options, typename ParentContexts,
+	typename SpecOptions, typename... Specs, StreamValue Value>
+	requires SequenceType<Value>
+struct stream_node<ByteType, Options, ParentContexts,
+	spec::sequence_with_options<SpecOptions, Specs...>, Value>
+	: constructed_stream_node<ByteType, Options, ParentContexts,
+		spec::sequence_with_options<SpecOptions, Specs...>, Value>
+{
+	using base_type = constructed_stream_node<ByteType, Options, ParentContexts,
+		spec::sequence_with_options<SpecOptions, Specs...>, Value>;
+	using this_parent_spec = typename base_type::merged_specs;
+
+	static_assert(boost::pfr::tuple_size_v<Value> == sizeof...(Specs),
+		"Value structure must have the same amount of fields"
+		" as the number of nested SEQUENCE specifications");
+
+	[[nodiscard]]
+	static stream_action<ByteType> make_action(Value& value,
+		tag_type tag, std::size_t offset)
+	{
+		return base_type::template make_constructed_action<stream_node>(value, tag, offset);
+	}
+
+	static stream_action<ByteType> on_child(stream_frame<ByteType>& frame,
+		tag_type tag, std::size_t offset)
+	{
+		stream_action<ByteType> action;
+		auto& value = *static_cast<Value*>(frame.value);
+		bool matched = [&]<std::size_t... Indexes>(std::index_sequence<Indexes...>) {
+			return (... || (frame.index <= Indexes
+				&& try_field<Indexes>(frame, value, tag, offset, action)));
+		}(std::index_sequence_for<Specs...>{});
+
+		if (!matched)
+		{
+			base_type::report(decode_errc::unconsumed_data,
+				"SEQUENCE data is not fully consumed", offset);
+		}
+		return action;
+	}
+
+	static void on_end(stream_frame<ByteType>& frame, std::size_t offset)
+	{
+		auto& value = *static_cast<Value*>(frame.value);
+		[&]<std::size_t... Indexes>(std::index_sequence<Indexes...>) {
+			(..., finish_field<Indexes>(frame, value, offset));
+		}(std::index_sequence_for<Specs...>{});
+		base_type::validate(value, offset);
+	}
+
+	static constexpr stream_frame_handlers<ByteType> handlers{
+		&on_child, &on_end, &base_type::report };
+
+private:
+	template<std::size_t Index>
+	using field_spec = std::tuple_element_t<Index, std::tuple<Specs...>>;
+
+	template<std::size_t Index>
+	static bool try_field(stream_frame<ByteType>& frame, Value& value,
+		tag_type tag, std::size_t offset, stream_action<ByteType>& action)
+	{
+		using spec_type = field_spec<Index>;
+		using optional_traits_type = optional_traits<spec_type>;
+		if constexpr (extension_traits<spec_type>::is_extension_marker)
+		{
+			frame.index = sizeof...(Specs);
+			action = {};
+			return true;
+		}
+		else
+		{
+			auto& field = boost::pfr::get<Index>(value);
+			using nested_node_type = stream_node<ByteType, Options, this_parent_spec,
+				spec_type, std::remove_cvref_t<decltype(field)>>;
+			if (nested_node_type::can_decode(tag))
+			{
+				frame.index = Index + 1;
+				action = nested_node_type::make_action(field, tag, offset);
+				return true;
+			}
+
+			if constexpr (!optional_traits_type::is_optional)
+			{
+				stream_report<typename Options::template merge_spec_names<
+					this_parent_spec, spec_type>, ByteType>(decode_errc::unexpected_tag,
+					"Non-matching nested SEQUENCE type", offset);
+			}
+			else if constexpr (optional_traits_type::has_default)
+			{
+				spec_type::assign_default(field);
+			}
+			return false;
+		}
+	}
+
+	template<std::size_t Index>
+	static void finish_field(const stream_frame<ByteType>& frame,
+		Value& value, std::size_t offset)
+	{
+		using spec_type = field_spec<Index>;
+		using optional_traits_type = optional_traits<spec_type>;
+		if (Index < frame.index)
+			return;
+
+		if constexpr (extension_traits<spec_type>::is_extension_marker)
+		{
+		}
+		else if constexpr (!optional_traits_type::is_optional)
+		{
+			stream_report<typename Options::template merge_spec_names<
+				this_parent_spec, spec_type>, ByteType>(decode_errc::missing_element,
+				"Unable to decode SEQUENCE required member, no data left", offset);
+		}
+		else if constexpr (optional_traits_type::has_default)
+		{
+			spec_type::assign_default(boost::pfr::get<Index>(value));
+		}
+	}
+};
+
+template<typename ByteType, typename Options, typename ParentContexts,
+	template<typename, typename> typename SequenceOf,
+	typename Spec, typename SpecOptions, typename Value, typename Node>
+struct sequence_of_stream_node
+	: constructed_stream_node<ByteType, Options, ParentContexts,
+		SequenceOf<SpecOptions, Spec>, Value>
+{
+	using base_type = constructed_stream_node<ByteType, Options, ParentContexts,
+		SequenceOf<SpecOptions, Spec>, Value>;
+	using element_node_type = stream_node<ByteType, Options,
+		typename base_type::merged_specs, Spec, typename Value::value_type>;
+	using merged_specs = typename Options::template
+		merge_spec_names<ParentContexts, Spec>;
+	using min_max_elements_option_type = typename SequenceOf<SpecOptions, Spec>
+		::template option_by_category<option_cat::min_max_elements>;
+
+	[[nodiscard]]
+	static stream_action<ByteType> make_action(Value& value,
+		tag_type tag, std::size_t offset)
+	{
+		return base_type::template make_constructed_action<Node>(value, tag, offset);
+	}
+
+	static stream_action<ByteType> on_child(stream_frame<ByteType>& frame,
+		tag_type tag, std::size_t offset)
+	{
+		++frame.index;
+		if constexpr (!std::is_same_v<min_max_elements_option_type, void>)
+		{
+			if (frame.index > min_max_elements_option_type::max_elems)
+			{
+				stream_report<merged_specs, ByteType>(
+					decode_errc::element_count, "Too many elements", offset);
+			}
+		}
+
+		auto& value = *static_cast<Value*>(frame.value);
+		return element_node_type::make_action(value.emplace_back(), tag, offset);
+	}
+
+	static void on_end(stream_frame<ByteType>& frame, std::size_t offset)
+	{
+		if constexpr (!std::is_same_v<min_max_elements_option_type, void>)
+		{
+			if constexpr (min_max_elements_option_type::min_elems)
+			{
+				if (frame.index < min_max_elements_option_type::min_elems)
+				{
+					stream_report<merged_specs, ByteType>(
+						decode_errc::element_count, "Too few elements", offset);
+				}
+			}
+		}
+
+		base_type::validate(*static_cast<Value*>(frame.value), offset);
+	}
+};
+
+template<typename ByteType, typename Options, typename ParentContexts,
+	typename SpecOptions, typename Spec, StreamValue Value>
+	requires SequentialContainer<Value>
+struct stream_node<ByteType, Options, ParentContexts,
+	spec::sequence_of_with_options<SpecOptions, Spec>, Value>
+	: sequence_of_stream_node<ByteType, Options, ParentContexts,
+		spec::sequence_of_with_options, Spec, SpecOptions, Value, stream_node<ByteType,
+			Options, ParentContexts, spec::sequence_of_with_options<SpecOptions, Spec>, Value>>
+{
+	static constexpr stream_frame_handlers<ByteType> handlers{
+		&stream_node::on_child, &stream_node::on_end, &stream_node::report };
+};
+
+template<typename ByteType, typename Options, typename ParentContexts,
+	typename SpecOptions, typename Spec, StreamValue Value>
+	requires SequentialContainer<Value>
+struct stream_node<ByteType, Options, ParentContexts,
+	spec::set_of_with_options<SpecOptions, Spec>, Value>
+	: sequence_of_stream_node<ByteType, Options, ParentContexts,
+		spec::set_of_with_options, Spec, SpecOptions, Value, stream_node<ByteType,
+			Options, ParentContexts, spec::set_of_with_options<SpecOptions, Spec>, Value>>
+{
+	static constexpr stream_frame_handlers<ByteType> handlers{
+		&stream_node::on_child, &stream_node::on_end, &stream_node::report };
+};
+
+template<typename ByteType, typename Options, typename ParentContexts,
+	std::uint32_t Tag, spec::cls Class, typename SpecOptions, typename Spec, StreamValue Value>
+struct stream_node<ByteType, Options, ParentContexts,
+	spec::tagged_with_options<Tag, spec::encoding::expl, Class, SpecOptions, Spec>, Value>
+	: constructed_stream_node<ByteType, Options, ParentContexts,
+		spec::tagged_with_options<Tag, spec::encoding::expl, Class, SpecOptions, Spec>, Value>
+{
+	using base_type = constructed_stream_node<ByteType, Options, ParentContexts,
+		spec::tagged_with_options<Tag, spec::encoding::expl, Class, SpecOptions, Spec>, Value>;
+	using nested_node_type = stream_node<ByteType, Options,
+		typename base_type::merged_specs, Spec, Value>;
+
+	[[nodiscard]]
+	static stream_action<ByteType> make_action(Value& value,
+		tag_type tag, std::size_t offset)
+	{
+		return base_type::template make_constructed_action<stream_node>(value, tag, offset);
+	}
+
+	static stream_action<ByteType> on_child(stream_frame<ByteType>& frame,
+		tag_type tag, std::size_t offset)
+	{
+		if (frame.index)
+		{
+			base_type::report(decode_errc::unconsumed_data,
+				"Tagged data is not fully consumed", offset);
+		}
+
+		frame.index = 1;
+		return nested_node_type::make_action(*static_cast<Value*>(frame.value), tag, offset);
+	}
+
+	static void on_end(stream_frame<ByteType>& frame, std::size_t offset)
+	{
+		if (!frame.index)
+			base_type::report(decode_errc::invalid_header, "No tag and length", offset);
+
+		base_type::validate(*static_cast<Value*>(frame.value), offset);
+	}
+
+	static constexpr stream_frame_handlers<ByteType> handlers{
+		&on_child, &on_end, &base_type::report };
+};
+
+//Implicitly tagged SEQUENCE, SEQUENCE OF and SET OF are decoded header by header
+template<typename ByteType, typename Options, typename ParentContexts,
+	std::uint32_t Tag, spec::cls Class, typename SpecOptions, typename Spec, StreamValue Value>
+	requires WithoutValidator<spec::tagged_with_options<Tag,
+		spec::encoding::impl, Class, SpecOptions, Spec>>
+struct stream_node<ByteType, Options, ParentContexts,
+	spec::tagged_with_options<Tag, spec::encoding::impl, Class, SpecOptions, Spec>, Value>
+	: leaf_stream_node<ByteType, Options, ParentContexts,
+		spec::tagged_with_options<Tag, spec::encoding::impl, Class, SpecOptions, Spec>, Value>
+{
+	using base_type = leaf_stream_node<ByteType, Options, ParentContexts,
+		spec::tagged_with_options<Tag, spec::encoding::impl, Class, SpecOptions, Spec>, Value>;
+	using merged_specs = typename Options::template merge_spec_names<ParentContexts,
+		spec::tagged_with_options<Tag, spec::encoding::impl, Class, SpecOptions, Spec>>;
+	using nested_node_type = stream_node<ByteType, Options, merged_specs, Spec, Value>;
+
+	[[nodiscard]]
+	static stream_action<ByteType> make_action(Value& value,
+		tag_type tag, std::size_t offset)
+	{
+		if constexpr (requires { nested_node_type::handlers; })
+		{
+			if (!base_type::can_decode(tag))
+			{
+				stream_report<merged_specs, ByteType>(decode_errc::unexpected_tag,
+					base_type::decoder_type::length_decode_error_text, offset);
+			}
+			return { &nested_node_type::handlers, nullptr, &value };
+		}
+		else
+		{
+			return base_type::make_action(value, tag, offset);
+		}
+	}
+};
+
+template<typename ByteType, typename Options, typename ParentContexts,
+	typename SpecOptions, typename... Specs, typename... Values>
+	requires WithoutValidator<spec::choice_with_options<SpecOptions, Specs...>>
+struct stream_node<ByteType, Options, ParentContexts,
+	spec::choice_with_options<SpecOptions, Specs...>, std::variant<Values...>>
+	: leaf_stream_node<ByteType, Options, ParentContexts,
+		spec::choice_with_options<SpecOptions, Specs...>, std::variant<Values...>>
+{
+	using this_parent_specs = typename Options::template merge_spec_names<
+		ParentContexts, spec::choice_with_options<SpecOptions, Specs...>>;
+
+	[[nodiscard]]
+	static stream_action<ByteType> make_action(std::variant<Values...>& value,
+		tag_type tag, std::size_t offset)
+	{
+		stream_action<ByteType> action;
+		bool matched = [&]<std::size_t... Indexes>(std::index_sequence<Indexes...>) {
+			return (... || try_alternative<Indexes>(value, tag, offset, action));
+		}(std::index_sequence_for<Specs...>{});
+
+		if (!matched)
+		{
+			stream_report<this_parent_specs, ByteType>(
+				decode_errc::unexpected_tag, "Unable to decode CHOICE", offset);
+		}
+		return action;
+	}
+
+private:
+	template<std::size_t Index>
+	static bool try_alternative(std::variant<Values...>& value,
+		tag_type tag, std::size_t offset, stream_action<ByteType>& action)
+	{
+		using alternative_node_type = stream_node<ByteType, Options, this_parent_specs,
+			std::tuple_element_t<Index, std::tuple<Specs...>>,
+			std::variant_alternative_t<Index, std::variant<Values...>>>;
+		if (!alternative_node_type::can_decode(tag))
+			return false;
+
+		action = alternative_node_type::make_action(
+			value.template emplace<Index>(), tag, offset);
+		return true;
+	}
+};
+
+template<typename ByteType, typename Options,
+	typename ParentContexts, typename Spec, OptionalType Value>
+struct stream_node<ByteType, Options, ParentContexts, spec::optional<Spec>, Value>
+{
+	using nested_node_type = stream_node<ByteType, Options, ParentContexts,
+		Spec, typename ptr_traits<Value>::type>;
+
+	[[nodiscard]]
+	static constexpr bool can_decode(tag_type tag)
+	{
+		return nested_node_type::can_decode(tag);
+	}
+
+	[[nodiscard]]
+	static stream_action<ByteType> make_action(Value& value,
+		tag_type tag, std::size_t offset)
+	{
+		return nested_node_type::make_action(ptr_traits<Value>::make(value), tag, offset);
+	}
+};
+
+template<typename ByteType, typename Options, typename ParentContexts,
+	typename DefaultValueProvider, typename Spec, typename Value>
+struct stream_node<ByteType, Options, ParentContexts,
+	spec::optional_default<DefaultValueProvider, Spec>, Value>
+	: stream_node<ByteType, Options, ParentContexts, Spec, Value>
+{
+};
+
+//Accepts exactly one top-level element
+template<typename ByteType, typename Options, typename Spec, typename Value>
+struct root_stream_node
+{
+	using node_type = stream_node<ByteType, Options, parent_context_list<>, Spec, Value>;
+
+	static stream_action<ByteType> on_child(stream_frame<ByteType>& frame,
+		tag_type tag, std::size_t offset)
+	{
+		if (frame.index)
+		{
+			report(decode_errc::unconsumed_data,
+				"Not all data was consumed by the parser", offset);
+		}
+
+		frame.index = 1;
+		return node_type::make_action(*static_cast<Value*>(frame.value), tag, offset);
+	}
+
+	static void on_end(stream_frame<ByteType>&, std::size_t)
+	{
+	}
+
+	static void report(decode_errc code, const char* message, std::size_t offset)
+	{
+		stream_report<parent_context_list<>, ByteType>(code, message, offset);
+	}
+
+	static constexpr stream_frame_handlers<ByteType> handlers{
+		&on_child, &on_end, &report };
+};
+
+//Returns the full header length, if it can be determined from the available bytes,
+//or the minimal header length otherwise
+[[nodiscard]]
+constexpr length_type stream_header_length(const auto* data, length_type size) noexcept
+{
+	//Tag numbers up to max_tag_number take at most 4 bytes
+	constexpr length_type max_tag_length = 5u;
+
+	if (!size)
+		return 2u;
+
+	length_type tag_length = 1u;
+	if (is_high_tag_number(static_cast<std::uint8_t>(data[0])))
+	{
+		//The last tag number byte has the highest bit cleared. Malformed tags are
+		//cut at the max length, so that decode_type_length reports the error.
+		do
+		{
+			if (tag_length == size)
+				return tag_length + 2u;
+		}
+		while ((static_cast<std::uint8_t>(data[tag_length++]) & 0x80u)
+			&& tag_length != max_tag_length);
+	}
+
+	if (tag_length == size)
+		return tag_length + 1u;
+
+	auto length = static_cast<std::uint8_t>(data[tag_length]);
+	if (length > 0x80u && length != 0xffu)
+		return tag_length + 1u + (length & 0x7fu);
+	return tag_length + 1u;
+}
+} //namespace asn1::detail::der
+
+namespace asn1::der
+{
+enum class stream_status : std::uint8_t
+{
+	need_more_data,
+	done
+};
+
+struct [[nodiscard]] stream_result
+{
+	stream_status status{};
+	//At least this amount of bytes is required to make progress
+	//(only for stream_status::need_more_data)
+	std::size_t bytes_needed{};
+};
+
+//Push-style decoder for the data which arrives in chunks.
+//SEQUENCE, SEQUENCE OF, SET OF, CHOICE and tagged elements are decoded
+//header by header, all other elements are buffered and decoded
+//with the regular decoders, so the buffer size is bounded by the
+//largest of such elements. Values must not refer to the source data
+//(use owning types, like std::vector, instead of std::span or with_pointers).
+//Throws parse_error on errors, the decoder must not be used after that.
+template<typename Spec, typename T,
+	typename DecodeOptions = decode_options<>, typename ByteType = std::uint8_t>
+class [[nodiscard]] stream_decoder
+{
+public:
+	stream_decoder()
+	{
+		frames_.push_back({ &root_node_type::handlers, &value_,
+			(std::numeric_limits<length_type>::max)(), 0u });
+	}
+
+	stream_decoder(const stream_decoder&) = delete;
+	stream_decoder& operator=(const stream_decoder&) = delete;
+
+	stream_result feed(std::span<const ByteType> chunk)
+	{
+		const ByteType* data = chunk.data();
+		const ByteType* const end = data + chunk.size();
+		chunk_begin_ = data;
+		while (true)
+		{
+			if (mode_ == mode::leaf)
+			{
+				auto count = take(data, end);
+				buffer_.insert(buffer_.end(), data, data + count);
+				data += count;
+				if (pending_)
+					return need_more_data(pending_, data);
+
+				leaf_.leaf_decoder(buffer_.data(), buffer_.data() + buffer_.size(),
+					leaf_.value, stream_offset(data) - buffer_.size());
+				buffer_.clear();
+				mode_ = mode::header;
+			}
+			else if (mode_ == mode::skip)
+			{
+				data += take(data, end);
+				if (pending_)
+					return need_more_data(pending_, data);
+
+				mode_ = mode::header;
+			}
+
+			auto& frame = frames_.back();
+			if (frames_.size() > 1u && !frame.remaining)
+			{
+				frame.handlers->on_end(frame, stream_offset(data));
+				frames_.pop_back();
+				continue;
+			}
+
+			if (is_done())
+			{
+				if (data != end)
+				{
+					frame.handlers->report(decode_errc::unconsumed_data,
+						"Not all data was consumed by the parser", stream_offset(data));
+				}
+				offset_ = stream_offset(data);
+				return { stream_status::done, 0u };
+			}
+
+			if (!decode_header(data, end))
+			{
+				return need_more_data(
+					detail::der::stream_header_length(buffer_.data(), buffer_.size())
+						- buffer_.size(), data);
+			}
+		}
+	}
+
+	[[nodiscard]]
+	bool is_done() const noexcept
+	{
+		return frames_.size() == 1u && frames_.front().index && mode_ == mode::header;
+	}
+
+	[[nodiscard]]
+	T& value() noexcept
+	{
+		return value_;
+	}
+
+	[[nodiscard]]
+	const T& value() const noexcept
+	{
+		return value_;
+	}
+
+	//Amount of bytes of the incomplete header or leaf element
+	//which are currently buffered
+	[[nodiscard]]
+	std::size_t buffered_size() const noexcept
+	{
+		return buffer_.size();
+	}
+
+private:
+	using root_node_type = detail::der::root_stream_node<ByteType, DecodeOptions, Spec, T>;
+	using length_type = detail::length_type;
+
+	enum class mode : std::uint8_t
+	{
+		header,
+		leaf,
+		skip
+	};
+
+private:
+	//Offset of the data byte from the start of the stream
+	[[nodiscard]]
+	std::size_t stream_offset(const ByteType* data) const noexcept
+	{
+		return offset_ + static_cast<std::size_t>(data - chunk_begin_);
+	}
+
+	stream_result need_more_data(std::size_t bytes_needed, const ByteType* data) noexcept
+	{
+		offset_ = stream_offset(data);
+		return { stream_status::need_more_data, bytes_needed };
+	}
+
+	length_type take(const ByteType* data, const ByteType* end) noexcept
+	{
+		auto count = (std::min)(pending_, static_cast<length_type>(end - data));
+		pending_ -= count;
+		return count;
+	}
+
+	//Returns false if more data is required to decode the header
+	bool decode_header(const ByteType*& data, const ByteType* end)
+	{
+		const ByteType* header = data;
+		auto header_length = detail::der::stream_header_length(header,
+			static_cast<length_type>(end - data));
+		if (!buffer_.empty() || static_cast<length_type>(end - data) < header_length)
+		{
+			while (buffer_.size() < (header_length
+				= detail::der::stream_header_length(buffer_.data(), buffer_.size())))
+			{
+				if (data == end)
+					return false;
+				buffer_.push_back(*data++);
+			}
+			header = buffer_.data();
+		}
+		else
+		{
+			data += header_length;
+		}
+
+		auto& frame = frames_.back();
+		const auto header_offset = stream_offset(data) - header_length;
+		detail::der::stream_decode_state<ByteType> state(header,
+			header + header_length, header_offset);
+		auto [tag, length] = detail::der::decode_type_length_with_context<
+			detail::parent_context_list<>>(state);
+		if (header_length > frame.remaining || length > frame.remaining - header_length)
+		{
+			frame.handlers->report(decode_errc::invalid_header,
+				"Length is too big and overruns buffer", header_offset);
+		}
+		frame.remaining -= header_length + length;
+
+		auto action = frame.handlers->on_child(frame, tag, header_offset);
+		if (action.handlers)
+		{
+			buffer_.clear();
+			frames_.push_back({ action.handlers, action.value, length, 0u });
+		}
+		else if (action.leaf_decoder)
+		{
+			if (buffer_.empty() && static_cast<length_type>(end - data) >= length)
+			{
+				//Whole element is available in the chunk
+				action.leaf_decoder(data - header_length, data + length,
+					action.value, header_offset);
+				data += length;
+			}
+			else
+			{
+				if (buffer_.empty())
+					buffer_.assign(data - header_length, data);
+				leaf_ = action;
+				pending_ = length;
+				mode_ = mode::leaf;
+			}
+		}
+		else
+		{
+			buffer_.clear();
+			pending_ = length + frame.remaining;
+			frame.remaining = 0u;
+			mode_ = mode::skip;
+		}
+		return true;
+	}
+
+private:
+	T value_{};
+	std::vector<detail::der::stream_frame<ByteType>> frames_;
+	std::vector<ByteType> buffer_;
+	detail::der::stream_action<ByteType> leaf_{};
+	length_type pending_{};
+	//Stream offset of the first byte of the chunk being decoded
+	std::size_t offset_{};
+	const ByteType* chunk_begin_{};
+	mode mode_ = mode::header;
+};
+} //namespace asn1::der
@@ -0,0 +1,188 @@
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <ranges>
+#include <stdexcept>
+#include <type_traits>
+
+#include "simple_asn1/spec.h"
+
+namespace asn1
+{
+class encode_error : public std::runtime_error
+{
+public:
+	using std::runtime_error::runtime_error;
+};
+
+namespace detail
+{
+template<typename OutputIterator>
+struct output_byte_type
+{
+	using type = std::uint8_t;
+};
+
+template<typename OutputIterator>
+	requires (!std::is_void_v<typename std::iterator_traits<OutputIterator>::value_type>)
+struct output_byte_type<OutputIterator>
+{
+	using type = typename std::iterator_traits<OutputIterator>::value_type;
+};
+
+template<typename OutputIterator>
+	requires (std::is_void_v<typename std::iterator_traits<OutputIterator>::value_type>
+		&& requires { typename OutputIterator::container_type::value_type; })
+struct output_byte_type<OutputIterator>
+{
+	using type = typename OutputIterator::container_type::value_type;
+};
+} //namespace detail
+
+template<std::input_or_output_iterator OutputIterator>
+struct [[nodiscard]] encode_state
+{
+	using iterator_type = OutputIterator;
+	using byte_type = typename detail::output_byte_type<OutputIterator>::type;
+
+	explicit encode_state(OutputIterator out)
+		noexcept(std::is_nothrow_copy_constructible_v<OutputIterator>)
+		: out(out)
+	{
+	}
+
+	OutputIterator out;
+};
+
+template<typename OutputIterator>
+encode_state(OutputIterator) -> encode_state<OutputIterator>;
+
+namespace detail
+{
+using length_type = std::size_t;
+
+//Returned by fixed_length() of encoders, which can not
+//calculate the encoded length at compile time
+constexpr length_type variable_length = (std::numeric_limits<length_type>::max)();
+
+template<typename Value>
+concept ByteRange = std::ranges::sized_range<const Value>
+	&& sizeof(std::ranges::range_value_t<const Value>) == sizeof(std::uint8_t);
+
+[[noreturn]] inline void throw_encode_error(const char* message)
+{
+	throw encode_error(message);
+}
+
+[[nodiscard]]
+constexpr length_type length_of_length(length_type length) noexcept
+{
+	if (length < 0x80u)
+		return 1u;
+
+	length_type result = 1u;
+	while (length)
+	{
+		++result;
+		length >>= 8u;
+	}
+	return result;
+}
+
+[[nodiscard]]
+constexpr length_type base128_length(std::uint64_t value) noexcept
+{
+	length_type result = 1u;
+	while (value > 127u)
+	{
+		++result;
+		value >>= 7u;
+	}
+	return result;
+}
+
+[[nodiscard]]
+constexpr length_type tag_length(tag_type tag) noexcept
+{
+	if (!is_high_tag_number(tag))
+		return 1u;
+
+	return 1u + base128_length(tag_number(tag));
+}
+
+[[nodiscard]]
+constexpr length_type header_length(tag_type tag, length_type content_length) noexcept
+{
+	return tag_length(tag) + length_of_length(content_length);
+}
+
+template<typename EncodeState>
+void write_byte(EncodeState& state, std::uint8_t value)
+{
+	*state.out = static_cast<typename EncodeState::byte_type>(value);
+	++state.out;
+}
+
+template<typename EncodeState, typename Range>
+void write_bytes(EncodeState& state, const Range& range)
+{
+	using byte_type = typename EncodeState::byte_type;
+	using range_value_type = std::ranges::range_value_t<const Range>;
+	if constexpr (std::is_same_v<std::remove_cv_t<range_value_type>, byte_type>)
+	{
+		state.out = std::ranges::copy(range, state.out).out;
+	}
+	else
+	{
+		for (const auto& value : range)
+			write_byte(state, static_cast<std::uint8_t>(value));
+	}
+}
+
+template<typename EncodeState>
+void write_length(EncodeState& state, length_type length)
+{
+	if (length < 0x80u)
+	{
+		write_byte(state, static_cast<std::uint8_t>(length));
+		return;
+	}
+
+	auto size = length_of_length(length) - 1u;
+	write_byte(state, static_cast<std::uint8_t>(0x80u | size));
+	while (size--)
+	{
+		write_byte(state, static_cast<std::uint8_t>(
+			length >> (size * std::numeric_limits<std::uint8_t>::digits)));
+	}
+}
+
+template<typename EncodeState>
+void write_base128(EncodeState& state, std::uint64_t value)
+{
+	auto size = base128_length(value);
+	while (--size)
+	{
+		write_byte(state, static_cast<std::uint8_t>(
+			0x80u | ((value >> (size * 7u)) & 0x7fu)));
+	}
+	write_byte(state, static_cast<std::uint8_t>(value & 0x7fu));
+}
+
+template<typename EncodeState>
+void write_header(EncodeState& state, tag_type tag, length_type length)
+{
+	write_byte(state, static_cast<std::uint8_t>(tag));
+	if (is_high_tag_number(tag))
+		write_base128(state, tag_number(tag));
+	write_length(state, length);
+}
+} //namespace detail
+} //namespace asn1
@@ -0,0 +1,360 @@
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <ranges>
+
+#include "simple_asn1/types.h"
+
+namespace asn1
+{
+namespace detail::oid_map
+{
+[[nodiscard]] constexpr std::size_t base128_length(std::uint64_t value) noexcept
+{
+	std::size_t result = 1;
+	while (value > 127u)
+	{
+		++result;
+		value >>= 7u;
+	}
+	return result;
+}
+
+[[nodiscard]] constexpr std::uint8_t* write_base128(std::uint64_t value,
+	std::uint8_t* dst) noexcept
+{
+	auto length = base128_length(value);
+	auto end = dst + length;
+	std::uint8_t mask = 0u;
+	while (length--)
+	{
+		dst[length] = static_cast<std::uint8_t>(value & 0x7fu) | mask;
+		value >>= 7u;
+		mask = 0x80u;
+	}
+	return end;
+}
+
+//Calls func for each base128 value of the OBJECT IDENTIFIER contents
+//(the first two components are combined).
+//Returns false without calling func if the OID has less than two components,
+//or if the first two components can not be combined unambiguously
+//(the first one must be 0, 1 or 2, the second one must be less than 40
+//unless the first one is 2), so that e.g. { 1, 40 } does not match { 2, 0 }.
+template<typename Components, typename Func>
+constexpr bool for_each_encoded_component(const Components& components, Func&& func)
+{
+	auto it = std::ranges::begin(components);
+	auto end = std::ranges::end(components);
+	if (it == end)
+		return false;
+
+	auto first = static_cast<std::uint64_t>(*it++);
+	if (it == end)
+		return false;
+
+	auto second = static_cast<std::uint64_t>(*it++);
+	if (first > 2u || (first < 2u && second >= 40u))
+		return false;
+
+	func(first * 40u + second);
+	for (; it != end; ++it)
+		func(static_cast<std::uint64_t>(*it));
+	return true;
+}
+
+template<typename Components>
+[[nodiscard]] constexpr std::size_t encoded_length(const Components& components) noexcept
+{
+	std::size_t result = 0;
+	for_each_encoded_component(components, [&result](std::uint64_t value) {
+		result += base128_length(value);
+	});
+	return result;
+}
+
+template<typename Components>
+constexpr std::uint8_t* encode(const Components& components, std::uint8_t* dst) noexcept
+{
+	for_each_encoded_component(components, [&dst](std::uint64_t value) {
+		dst = write_base128(value, dst);
+	});
+	return dst;
+}
+
+//Seeded FNV-1a
+template<typename ByteType>
+[[nodiscard]] constexpr std::uint64_t hash(std::uint32_t seed,
+	const ByteType* data, std::size_t size) noexcept
+{
+	std::uint64_t result = 0xcbf29ce484222325ull ^ (seed * 0x9e3779b97f4a7c15ull);
+	for (std::size_t i = 0; i != size; ++i)
+	{
+		result ^= static_cast<std::uint8_t>(data[i]);
+		result *= 0x100000001b3ull;
+	}
+	return result ^ (result >> 29u);
+}
+
+//Concatenated DER contents of the OIDs
+template<std::size_t Size, std::size_t TotalLength>
+struct encoded_oids
+{
+	std::array<std::size_t, Size> lengths{};
+	std::array<std::size_t, Size> offsets{};
+	std::array<std::uint8_t, TotalLength> bytes{};
+
+	template<typename ByteType>
+	[[nodiscard]] constexpr bool equals(std::size_t index,
+		const ByteType* data, std::size_t length) const noexcept
+	{
+		if (lengths[index] != length)
+			return false;
+
+		for (std::size_t i = 0; i != length; ++i)
+		{
+			if (static_cast<std::uint8_t>(data[i]) != bytes[offsets[index] + i])
+				return false;
+		}
+		return true;
+	}
+
+	[[nodiscard]] constexpr std::uint64_t hash(std::uint32_t seed,
+		std::size_t index) const noexcept
+	{
+		return oid_map::hash(seed, bytes.data() + offsets[index], lengths[index]);
+	}
+
+	[[nodiscard]] constexpr bool has_duplicates() const noexcept
+	{
+		for (std::size_t i = 0; i != Size; ++i)
+		{
+			for (std::size_t j = i + 1u; j != Size; ++j)
+			{
+				if (equals(i, bytes.data() + offsets[j], lengths[j]))
+					return true;
+			}
+		}
+		return false;
+	}
+};
+
+template<auto... Oids>
+[[nodiscard]] consteval auto encode_oids() noexcept
+{
+	encoded_oids<sizeof...(Oids), (... + encoded_length(Oids))> result{
+		.lengths{ encoded_length(Oids)... } };
+	std::size_t offset = 0;
+	for (std::size_t i = 0; i != sizeof...(Oids); ++i)
+	{
+		result.offsets[i] = offset;
+		offset += result.lengths[i];
+	}
+
+	auto ptr = result.bytes.data();
+	(..., (ptr = encode(Oids, ptr)));
+	return result;
+}
+
+//Hash and displace: the hash selects a bucket and the first slot to probe,
+//the bucket displacement is chosen at compile time, so that all keys get unique slots
+template<std::size_t Size>
+struct hash_table
+{
+	static constexpr std::size_t bucket_count
+		= (std::max)(std::bit_ceil(Size), std::size_t{ 2u });
+	static constexpr std::size_t slot_count = bucket_count * 2u;
+	static constexpr std::uint16_t empty_slot = static_cast<std::uint16_t>(Size);
+
+	std::uint32_t seed{};
+	std::array<std::uint16_t, bucket_count> displacements{};
+	std::array<std::uint16_t, slot_count> slots{};
+	bool valid{};
+
+	[[nodiscard]] static constexpr std::size_t bucket(std::uint64_t hash) noexcept
+	{
+		return static_cast<std::size_t>((hash * 0x9e3779b97f4a7c15ull)
+			>> (64u - std::countr_zero(bucket_count)));
+	}
+
+	[[nodiscard]] static constexpr std::size_t slot(std::uint64_t hash,
+		std::uint16_t displacement) noexcept
+	{
+		//Odd step visits all slots
+		auto start = static_cast<std::uint32_t>(hash >> 32u);
+		auto step = static_cast<std::uint32_t>(hash) | 1u;
+		return (start + displacement * step) & (slot_count - 1u);
+	}
+
+	[[nodiscard]] constexpr std::size_t find(std::uint64_t hash) const noexcept
+	{
+		return slots[slot(hash, displacements[bucket(hash)])];
+	}
+};
+
+template<std::size_t Size, typename EncodedOids>
+[[nodiscard]] constexpr hash_table<Size> try_build_hash_table(
+	const EncodedOids& oids, std::uint32_t seed) noexcept
+{
+	using table_type = hash_table<Size>;
+	table_type result{ .seed = seed };
+	result.slots.fill(table_type::empty_slot);
+
+	//Keys sorted by bucket
+	std::array<std::uint64_t, Size> hashes{};
+	std::array<std::size_t, table_type::bucket_count + 1u> bucket_begin{};
+	for (std::size_t i = 0; i != Size; ++i)
+	{
+		hashes[i] = oids.hash(seed, i);
+		++bucket_begin[table_type::bucket(hashes[i]) + 1u];
+	}
+	for (std::size_t b = 0; b != table_type::bucket_count; ++b)
+		bucket_begin[b + 1u] += bucket_begin[b];
+
+	std::array<std::uint16_t, Size> keys{};
+	auto next = bucket_begin;
+	for (std::size_t i = 0; i != Size; ++i)
+		keys[next[table_type::bucket(hashes[i])]++] = static_cast<std::uint16_t>(i);
+
+	//Largest buckets are placed first
+	for (std::size_t bucket_size = Size; bucket_size; --bucket_size)
+	{
+		for (std::size_t b = 0; b != table_type::bucket_count; ++b)
+		{
+			auto first = bucket_begin[b];
+			auto last = bucket_begin[b + 1u];
+			if (last - first != bucket_size)
+				continue;
+
+			bool placed = false;
+			for (std::size_t d = 0; d != table_type::slot_count && !placed; ++d)
+			{
+				auto displacement = static_cast<std::uint16_t>(d);
+				auto key = first;
+				for (; key != last; ++key)
+				{
+					auto& target = result.slots[
+						table_type::slot(hashes[keys[key]], displacement)];
+					if (target != table_type::empty_slot)
+						break;
+					target = keys[key];
+				}
+
+				placed = key == last;
+				if (placed)
+				{
+					result.displacements[b] = displacement;
+				}
+				else
+				{
+					while (key-- != first)
+						result.slots[table_type::slot(hashes[keys[key]], displacement)]
+							= table_type::empty_slot;
+				}
+			}
+
+			if (!placed)
+				return result;
+		}
+	}
+
+	result.valid = true;
+	return result;
+}
+
+template<std::size_t Size, typename EncodedOids>
+[[nodiscard]] consteval hash_table<Size> build_hash_table(const EncodedOids& oids) noexcept
+{
+	for (std::uint32_t seed = 0; seed != 256u; ++seed)
+	{
+		auto result = try_build_hash_table<Size>(oids, seed);
+		if (result.valid)
+			return result;
+	}
+	return {};
+}
+} //namespace detail::oid_map
+
+//Maps OBJECT IDENTIFIERs to their indexes in the Oids list.
+//Oids are OID component arrays (like std::array<std::uint32_t, N>), which
+//are encoded and placed to a perfect hash table at compile time.
+//An OID is looked up either by its raw DER contents (an OID decoded to std::span),
+//or by its decoded components. Each lookup costs one hash calculation
+//and one comparison, no base128 decoding or memory allocations are performed.
+template<auto... Oids>
+class oid_map
+{
+public:
+	static constexpr std::size_t npos = (std::numeric_limits<std::size_t>::max)();
+	static constexpr std::size_t size = sizeof...(Oids);
+
+	static_assert(size > 0u, "OID map must not be empty");
+	static_assert(size < (std::numeric_limits<std::uint16_t>::max)(), "Too many OIDs");
+	static_assert((... && (detail::oid_map::encoded_length(Oids) != 0u)),
+		"OIDs must have at least two components and valid first two components");
+
+	//Returns the index of the OID with the raw DER contents, or npos
+	template<std::ranges::contiguous_range Range>
+		requires (sizeof(std::ranges::range_value_t<Range>) == 1u)
+	[[nodiscard]] static constexpr std::size_t find(const Range& contents) noexcept
+	{
+		return find_encoded(std::ranges::data(contents),
+			static_cast<std::size_t>(std::ranges::size(contents)));
+	}
+
+	//Returns the index of the decoded OID, or npos
+	template<typename Container>
+	[[nodiscard]] static constexpr std::size_t find(
+		const decoded_object_identifier<Container>& oid) noexcept
+	{
+		return find_components(oid.container);
+	}
+
+	template<auto Oid>
+	[[nodiscard]] static consteval std::size_t index_of() noexcept
+	{
+		constexpr auto index = find_components(Oid);
+		static_assert(index != npos, "OID is not in the OID map");
+		return index;
+	}
+
+private:
+	static constexpr auto oids = detail::oid_map::encode_oids<Oids...>();
+	static_assert(!oids.has_duplicates(), "Duplicate OIDs in the OID map");
+	static constexpr std::size_t max_length = (std::ranges::max)(oids.lengths);
+
+	static constexpr auto table = detail::oid_map::build_hash_table<size>(oids);
+	static_assert(table.valid, "Unable to build the OID hash table");
+
+	template<typename ByteType>
+	[[nodiscard]] static constexpr std::size_t find_encoded(const ByteType* data,
+		std::size_t length) noexcept
+	{
+		auto index = table.find(detail::oid_map::hash(table.seed, data, length));
+		if (index != table.empty_slot && oids.equals(index, data, length))
+			return index;
+		return npos;
+	}
+
+	template<typename Components>
+	[[nodiscard]] static constexpr std::size_t find_components(
+		const Components& components) noexcept
+	{
+		auto length = detail::oid_map::encoded_length(components);
+		if (!length || length > max_length)
+			return npos;
+
+		std::array<std::uint8_t, max_length> buffer{};
+		detail::oid_map::encode(components, buffer.data());
+		return find_encoded(buffer.data(), length);
+	}
+};
+} //namespace asn1
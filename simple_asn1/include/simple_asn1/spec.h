@@ -54,6 +54,8 @@ enum class option_cat
 	zero_year,
 	validator,
 	min_max_elements,
+	reserve,
+	parallel,
 	max
 };
 
@@ -112,6 +114,39 @@ struct min_max_elements final : detail::option_base<detail::option_cat::min_max_
 	static constexpr std::size_t max_elems{ Max };
 };
 
+//Reserves the container capacity for SEQUENCE OF / SET OF elements
+//before decoding them (if the container supports reserve()).
+//Reserves the fixed number of elements
+template<std::size_t Elements>
+struct reserve_hint final : detail::option_base<detail::option_cat::reserve>
+{
+	static_assert(Elements > 0u);
+	static constexpr bool count_elements = false;
+	static constexpr std::size_t elems{ Elements };
+};
+
+//Counts the elements by skipping their headers first and reserves the exact number of them
+struct count_and_reserve final : detail::option_base<detail::option_cat::reserve>
+{
+	static constexpr bool count_elements = true;
+	static constexpr std::size_t elems{};
+};
+
+//Decodes SEQUENCE OF / SET OF elements on multiple threads. The element boundaries
+//are found by skipping their headers first, then the elements are decoded into
+//the pre-sized container (which must support resize()) on up to MaxThreads threads
+//(std::thread::hardware_concurrency() if zero). Lists with less than MinElements
+//elements, lists nested into an element being decoded in parallel, and decode states
+//with a memory resource are decoded on the calling thread. The result and the reported
+//error are the same as the ones of the single-threaded decoding.
+template<std::size_t MinElements = 1024u, std::size_t MaxThreads = 0u>
+struct parallel_decode final : detail::option_base<detail::option_cat::parallel>
+{
+	static_assert(MinElements > 0u);
+	static constexpr std::size_t min_elems{ MinElements };
+	static constexpr std::size_t max_threads{ MaxThreads };
+};
+
 template<auto Validator>
 using validator_func = validator<decltype(Validator)>;
 
@@ -243,6 +278,12 @@ struct extension_traits
 {
 	static constexpr bool is_extension_marker = false;
 };
+
+template<typename Spec>
+struct open_type_traits
+{
+	static constexpr bool is_open_type = false;
+};
 } //namespace detail
 
 namespace spec
@@ -303,6 +344,8 @@ struct sequence_of_with_options
 	: detail::options_parser<
 		detail::optional_options<detail::option_cat::name,
 			detail::option_cat::min_max_elements,
+			detail::option_cat::reserve,
+			detail::option_cat::parallel,
 			detail::option_cat::validator>, Options>
 	, detail::spec_tag<0x30u>
 	, detail::spec_type<"SEQUENCE OF"> {};
@@ -313,6 +356,8 @@ struct set_of_with_options
 	: detail::options_parser<
 		detail::optional_options<detail::option_cat::name,
 			detail::option_cat::min_max_elements,
+			detail::option_cat::reserve,
+			detail::option_cat::parallel,
 			detail::option_cat::validator>, Options>
 	, detail::spec_tag<0x31u>
 	, detail::spec_type<"SET OF"> {};
@@ -326,6 +371,31 @@ struct choice_with_options
 template<typename... Specs>
 using choice = choice_with_options<opts::options<>, Specs...>;
 
+//Open type registry entry: Spec is used to decode the open type value
+//if the OID field contains Oid (an OID component array, like std::array<std::uint32_t, N>)
+template<auto Oid, typename Spec>
+struct open_type_entry
+{
+	static constexpr auto oid = Oid;
+	using spec_type = Spec;
+};
+
+template<typename... Entries>
+struct open_type_registry {};
+
+//Open type (ANY DEFINED BY): the spec of the element is selected by the OID
+//in the SEQUENCE field with the OidFieldIndex index, which must precede the open type.
+//The value is std::variant. The first alternative is decoded with FallbackSpec
+//if the OID is not in the Registry, other alternatives correspond to the Registry entries.
+template<std::size_t OidFieldIndex, typename Registry,
+	typename FallbackSpec = any<>, typename Options = opts::options<>>
+struct open_type
+	: detail::default_options_parser<Options>
+	, detail::spec_type<"ANY DEFINED BY">
+{
+	static constexpr std::size_t oid_field_index = OidFieldIndex;
+};
+
 template<typename Options, typename Spec, typename... Specs>
 struct set_with_options
 	: detail::default_options_parser<Options>
@@ -464,19 +534,19 @@ enum class encoding : std::uint8_t
 	expl = 0x20u
 };
 
-template<std::uint8_t Tag, encoding Encoding,
+template<std::uint32_t Tag, encoding Encoding,
 	cls Class, typename Options, typename NestedSpec>
 struct tagged_with_options
 	: detail::default_options_parser<Options>
 	, detail::spec_type<"TAGGED">
 {
 private:
-	static_assert(Tag <= 0x1fu);
+	static_assert(Tag <= detail::max_tag_number, "Tag number is too large");
 
 public:
 	[[nodiscard]] static constexpr tag_type tag() noexcept
 	{
-		tag_type result = Tag | static_cast<std::uint8_t>(Class);
+		tag_type result = detail::make_tag(Tag, static_cast<std::uint8_t>(Class));
 		if constexpr (Encoding == encoding::expl)
 		{
 			result |= 0x20u;
@@ -495,7 +565,7 @@ public:
 	}
 };
 
-template<std::uint8_t Tag, encoding Encoding,
+template<std::uint32_t Tag, encoding Encoding,
 	cls Class, typename Field>
 using tagged = tagged_with_options<
 	Tag, Encoding, Class, opts::options<>, Field>;
@@ -554,6 +624,29 @@ struct spec_traits<spec::any<Options>> final
 	static constexpr bool is_choice = false;
 };
 
+template<std::size_t OidFieldIndex, typename Registry,
+	typename FallbackSpec, typename Options>
+struct spec_traits<spec::open_type<OidFieldIndex, Registry, FallbackSpec, Options>> final
+{
+	static constexpr bool is_constructed = false;
+	static constexpr bool is_choice = false;
+};
+
+template<std::size_t OidFieldIndex, typename Registry,
+	typename FallbackSpec, typename Options>
+struct open_type_traits<spec::open_type<OidFieldIndex, Registry, FallbackSpec, Options>> final
+{
+	static constexpr bool is_open_type = true;
+};
+
+template<std::size_t OidFieldIndex, typename Registry,
+	typename FallbackSpec, typename Options>
+struct open_type_traits<spec::optional<
+	spec::open_type<OidFieldIndex, Registry, FallbackSpec, Options>>> final
+{
+	static constexpr bool is_open_type = true;
+};
+
 template<typename Spec>
 struct optional_traits<spec::optional<Spec>> final
 {
@@ -0,0 +1,348 @@
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <vector>
+
+#include "simple_asn1/string_validation.h"
+
+namespace asn1::detail::strings
+{
+inline constexpr std::size_t invalid_utf8_length = (std::numeric_limits<std::size_t>::max)();
+
+[[nodiscard]] constexpr std::size_t utf8_length(char32_t code_point) noexcept
+{
+	if (code_point < 0x80u)
+		return 1u;
+	if (code_point < 0x800u)
+		return 2u;
+	if (code_point < 0x10000u)
+		return 3u;
+	return 4u;
+}
+
+inline std::uint8_t* write_utf8(char32_t code_point, std::uint8_t* dst) noexcept
+{
+	if (code_point < 0x80u)
+	{
+		*dst++ = static_cast<std::uint8_t>(code_point);
+	}
+	else if (code_point < 0x800u)
+	{
+		*dst++ = static_cast<std::uint8_t>(0xc0u | (code_point >> 6u));
+		*dst++ = static_cast<std::uint8_t>(0x80u | (code_point & 0x3fu));
+	}
+	else if (code_point < 0x10000u)
+	{
+		*dst++ = static_cast<std::uint8_t>(0xe0u | (code_point >> 12u));
+		*dst++ = static_cast<std::uint8_t>(0x80u | ((code_point >> 6u) & 0x3fu));
+		*dst++ = static_cast<std::uint8_t>(0x80u | (code_point & 0x3fu));
+	}
+	else
+	{
+		*dst++ = static_cast<std::uint8_t>(0xf0u | (code_point >> 18u));
+		*dst++ = static_cast<std::uint8_t>(0x80u | ((code_point >> 12u) & 0x3fu));
+		*dst++ = static_cast<std::uint8_t>(0x80u | ((code_point >> 6u) & 0x3fu));
+		*dst++ = static_cast<std::uint8_t>(0x80u | (code_point & 0x3fu));
+	}
+	return dst;
+}
+
+template<typename Char>
+[[nodiscard]] constexpr char32_t load_big_endian(const std::uint8_t* src) noexcept
+{
+	char32_t result{};
+	for (std::size_t i = 0; i != sizeof(Char); ++i)
+		result = (result << 8u) | src[i];
+	return result;
+}
+
+[[nodiscard]] constexpr bool is_high_surrogate(char32_t value) noexcept
+{
+	return (value & 0xfc00u) == 0xd800u;
+}
+
+[[nodiscard]] constexpr bool is_low_surrogate(char32_t value) noexcept
+{
+	return (value & 0xfc00u) == 0xdc00u;
+}
+
+inline constexpr char32_t invalid_code_point = 0xffffffffu;
+
+//Returns the code point at src[index] and advances index.
+//BMPString surrogate pairs are combined if AllowSurrogatePairs is true.
+//Returns invalid_code_point for unpaired surrogates and invalid code points.
+template<typename Char, bool AllowSurrogatePairs>
+[[nodiscard]] constexpr char32_t next_code_point(const std::uint8_t* src,
+	std::size_t count, std::size_t& index) noexcept
+{
+	auto value = load_big_endian<Char>(src + index++ * sizeof(Char));
+	if constexpr (sizeof(Char) == 2u)
+	{
+		if ((value & 0xf800u) != 0xd800u)
+			return value;
+
+		if constexpr (AllowSurrogatePairs)
+		{
+			if (is_high_surrogate(value) && index != count)
+			{
+				auto low = load_big_endian<Char>(src + index * sizeof(Char));
+				if (is_low_surrogate(low))
+				{
+					++index;
+					return 0x10000u + ((value - 0xd800u) << 10u) + (low - 0xdc00u);
+				}
+			}
+		}
+		return invalid_code_point;
+	}
+	else
+	{
+		return is_valid_code_unit(value) ? value : invalid_code_point;
+	}
+}
+
+//T.61 (TeletexString) to Unicode. 0xc1-0xcf are non-spacing diacritical marks,
+//which precede the base character in T.61 and are mapped to combining characters.
+//Unassigned codes are mapped to U+FFFD.
+inline constexpr std::array<char16_t, 128> t61_upper_half{
+	//0x80-0x9f: C1 control characters
+	0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87,
+	0x88, 0x89, 0x8a, 0x8b, 0x8c, 0x8d, 0x8e, 0x8f,
+	0x90, 0x91, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97,
+	0x98, 0x99, 0x9a, 0x9b, 0x9c, 0x9d, 0x9e, 0x9f,
+	//0xa0-0xbf
+	0xa0, 0xa1, 0xa2, 0xa3, 0x24, 0xa5, 0x23, 0xa7,
+	0xa4, 0xfffd, 0xfffd, 0xab, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xb0, 0xb1, 0xb2, 0xb3, 0xd7, 0xb5, 0xb6, 0xb7,
+	0xf7, 0xfffd, 0xfffd, 0xbb, 0xbc, 0xbd, 0xbe, 0xbf,
+	//0xc0-0xcf: diacritical marks
+	0xfffd, 0x300, 0x301, 0x302, 0x303, 0x304, 0x306, 0x307,
+	0x308, 0xfffd, 0x30a, 0x327, 0x332, 0x30b, 0x328, 0x30c,
+	//0xd0-0xdf
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
+	//0xe0-0xff
+	0x2126, 0xc6, 0xd0, 0xaa, 0x126, 0xfffd, 0x132, 0x13f,
+	0x141, 0xd8, 0x152, 0xba, 0xde, 0x166, 0x14a, 0x149,
+	0x138, 0xe6, 0x111, 0xf0, 0x127, 0x131, 0x133, 0x140,
+	0x142, 0xf8, 0x153, 0xdf, 0xfe, 0x167, 0x14b, 0xfffd
+};
+
+[[nodiscard]] constexpr bool is_t61_diacritic(std::uint8_t value) noexcept
+{
+	return value >= 0xc1u && value <= 0xcfu && value != 0xc9u;
+}
+
+[[nodiscard]] constexpr char32_t t61_to_unicode(std::uint8_t value) noexcept
+{
+	return value < 0x80u ? value : t61_upper_half[value - 0x80u];
+}
+
+#ifdef SIMPLE_ASN1_SIMD_X86
+//Loads 8 big-endian code units as native 16-bit values
+[[nodiscard]] inline __m128i load_bmp_sse2(const std::uint8_t* src) noexcept
+{
+	auto v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src));
+	return _mm_or_si128(_mm_slli_epi16(v, 8), _mm_srli_epi16(v, 8));
+}
+
+[[nodiscard]] inline bool is_ascii_bmp_sse2(__m128i v) noexcept
+{
+	return _mm_movemask_epi8(_mm_cmpeq_epi16(
+		_mm_and_si128(v, _mm_set1_epi16(static_cast<short>(0xff80))),
+		_mm_setzero_si128())) == 0xffff;
+}
+
+//Loads 4 big-endian code units as native 32-bit values
+[[nodiscard]] inline __m128i load_universal_sse2(const std::uint8_t* src) noexcept
+{
+	auto v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src));
+	v = _mm_shufflehi_epi16(_mm_shufflelo_epi16(v, 0xb1), 0xb1);
+	return _mm_or_si128(_mm_slli_epi16(v, 8), _mm_srli_epi16(v, 8));
+}
+
+[[nodiscard]] inline bool is_ascii_universal_sse2(__m128i v) noexcept
+{
+	return _mm_movemask_epi8(_mm_cmpeq_epi32(
+		_mm_and_si128(v, _mm_set1_epi32(static_cast<int>(0xffffff80u))),
+		_mm_setzero_si128())) == 0xffff;
+}
+#endif //SIMPLE_ASN1_SIMD_X86
+
+//Returns the UTF-8 length of count BMPString (char16_t) or UniversalString (char32_t)
+//code units, or invalid_utf8_length if they can not be transcoded
+template<typename Char, bool AllowSurrogatePairs>
+[[nodiscard]] std::size_t utf8_length(const std::uint8_t* src, std::size_t count) noexcept
+{
+	std::size_t result = 0;
+	std::size_t index = 0;
+	while (index != count)
+	{
+#ifdef SIMPLE_ASN1_SIMD_X86
+		constexpr std::size_t width = sizeof(__m128i) / sizeof(Char);
+		if (count - index >= width)
+		{
+			const auto* block = src + index * sizeof(Char);
+			bool is_ascii;
+			if constexpr (sizeof(Char) == 2u)
+				is_ascii = is_ascii_bmp_sse2(load_bmp_sse2(block));
+			else
+				is_ascii = is_ascii_universal_sse2(load_universal_sse2(block));
+
+			if (is_ascii)
+			{
+				result += width;
+				index += width;
+				continue;
+			}
+		}
+#endif //SIMPLE_ASN1_SIMD_X86
+
+		auto code_point = next_code_point<Char, AllowSurrogatePairs>(src, count, index);
+		if (code_point == invalid_code_point)
+			return invalid_utf8_length;
+		result += utf8_length(code_point);
+	}
+	return result;
+}
+
+//Transcodes count code units, which were checked by utf8_length(), to UTF-8
+template<typename Char, bool AllowSurrogatePairs>
+void to_utf8(const std::uint8_t* src, std::size_t count, std::uint8_t* dst) noexcept
+{
+	std::size_t index = 0;
+	while (index != count)
+	{
+#ifdef SIMPLE_ASN1_SIMD_X86
+		constexpr std::size_t width = sizeof(__m128i) / sizeof(Char);
+		if (count - index >= width)
+		{
+			const auto* block = src + index * sizeof(Char);
+			if constexpr (sizeof(Char) == 2u)
+			{
+				auto v = load_bmp_sse2(block);
+				if (is_ascii_bmp_sse2(v))
+				{
+					_mm_storel_epi64(reinterpret_cast<__m128i*>(dst), _mm_packus_epi16(v, v));
+					dst += width;
+					index += width;
+					continue;
+				}
+			}
+			else
+			{
+				auto v = load_universal_sse2(block);
+				if (is_ascii_universal_sse2(v))
+				{
+					v = _mm_packs_epi32(v, v);
+					auto packed = _mm_cvtsi128_si32(_mm_packus_epi16(v, v));
+					for (std::size_t i = 0; i != width; ++i)
+						*dst++ = static_cast<std::uint8_t>(packed >> (i * 8u));
+					index += width;
+					continue;
+				}
+			}
+		}
+#endif //SIMPLE_ASN1_SIMD_X86
+
+		dst = write_utf8(next_code_point<Char, AllowSurrogatePairs>(src, count, index), dst);
+	}
+}
+
+//Returns the UTF-8 length of the TeletexString
+[[nodiscard]] inline std::size_t t61_utf8_length(const std::uint8_t* src,
+	std::size_t count) noexcept
+{
+	std::size_t result = 0;
+	std::size_t index = 0;
+	while (index != count)
+	{
+#ifdef SIMPLE_ASN1_SIMD_X86
+		if (count - index >= sizeof(__m128i) && !_mm_movemask_epi8(
+			_mm_loadu_si128(reinterpret_cast<const __m128i*>(src + index))))
+		{
+			result += sizeof(__m128i);
+			index += sizeof(__m128i);
+			continue;
+		}
+#endif //SIMPLE_ASN1_SIMD_X86
+
+		result += utf8_length(t61_to_unicode(src[index++]));
+	}
+	return result;
+}
+
+//Transcodes the TeletexString to UTF-8, diacritical marks are moved after the base character
+inline void t61_to_utf8(const std::uint8_t* src, std::size_t count, std::uint8_t* dst) noexcept
+{
+	std::size_t index = 0;
+	while (index != count)
+	{
+#ifdef SIMPLE_ASN1_SIMD_X86
+		if (count - index >= sizeof(__m128i))
+		{
+			auto v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + index));
+			if (!_mm_movemask_epi8(v))
+			{
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(dst), v);
+				dst += sizeof(__m128i);
+				index += sizeof(__m128i);
+				continue;
+			}
+		}
+#endif //SIMPLE_ASN1_SIMD_X86
+
+		auto value = src[index++];
+		if (is_t61_diacritic(value) && index != count && !is_t61_diacritic(src[index]))
+			dst = write_utf8(t61_to_unicode(src[index++]), dst);
+		dst = write_utf8(t61_to_unicode(value), dst);
+	}
+}
+
+//Transcodes len bytes of the BMPString (char16_t), UniversalString (char32_t)
+//or TeletexString (char) starting at begin to the UTF-8 string (std::string or std::u8string)
+//with a single allocation and advances begin.
+//Returns false if the string contains code points, which can not be transcoded.
+template<typename Char, bool AllowSurrogatePairs, typename Iterator, typename String>
+[[nodiscard]] bool transcode_to_utf8(Iterator& begin, std::size_t len, String& result)
+{
+	const std::uint8_t* src;
+	[[maybe_unused]] std::vector<std::uint8_t> buffer;
+	if constexpr (ContiguousByteIterator<Iterator>)
+	{
+		src = to_byte_pointer(begin);
+		begin += static_cast<std::iter_difference_t<Iterator>>(len);
+	}
+	else
+	{
+		buffer.reserve(len);
+		for (std::size_t i = 0; i != len; ++i)
+			buffer.push_back(static_cast<std::uint8_t>(*begin++));
+		src = buffer.data();
+	}
+
+	const auto count = len / sizeof(Char);
+	if constexpr (sizeof(Char) == 1u)
+	{
+		resize_for_overwrite(result, t61_utf8_length(src, count));
+		t61_to_utf8(src, count, reinterpret_cast<std::uint8_t*>(result.data()));
+	}
+	else
+	{
+		auto length = utf8_length<Char, AllowSurrogatePairs>(src, count);
+		if (length == invalid_utf8_length)
+			return false;
+
+		resize_for_overwrite(result, length);
+		to_utf8<Char, AllowSurrogatePairs>(src, count,
+			reinterpret_cast<std::uint8_t*>(result.data()));
+	}
+	return true;
+}
+} //namespace asn1::detail::strings
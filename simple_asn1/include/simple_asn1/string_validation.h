@@ -0,0 +1,513 @@
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+
+#include "simple_asn1/decode.h"
+
+//Define SIMPLE_ASN1_NO_SIMD to use only the scalar string kernels
+#if !defined(SIMPLE_ASN1_NO_SIMD) && (defined(__SSE2__) || defined(_M_X64) \
+	|| (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#define SIMPLE_ASN1_SIMD_X86
+#include <immintrin.h>
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#define SIMPLE_ASN1_TARGET_AVX2
+#else
+#define SIMPLE_ASN1_TARGET_AVX2 __attribute__((target("avx2")))
+#endif
+#endif
+
+namespace asn1::detail::strings
+{
+enum class charset
+{
+	numeric, //digits and space
+	printable, //letters, digits, space and '()+,-./:=?
+	ia5, //0x00-0x7f
+	visible, //0x20-0x7e
+	utf8,
+	bmp, //big-endian UCS-2, no surrogates
+	universal //big-endian UTF-32, no surrogates, up to U+10FFFF
+};
+
+template<charset Charset>
+consteval std::array<bool, 256> make_charset_table() noexcept
+{
+	std::array<bool, 256> result{};
+	for (std::size_t c = 0; c != result.size(); ++c)
+	{
+		if constexpr (Charset == charset::numeric)
+			result[c] = (c >= '0' && c <= '9') || c == ' ';
+		else if constexpr (Charset == charset::printable)
+		{
+			result[c] = (c >= '0' && c <= '9') || (c >= 'A' && c <= 'Z')
+				|| (c >= 'a' && c <= 'z') || c == ' ' || c == '\'' || c == '('
+				|| c == ')' || c == '+' || c == ',' || c == '-' || c == '.'
+				|| c == '/' || c == ':' || c == '=' || c == '?';
+		}
+		else if constexpr (Charset == charset::ia5)
+			result[c] = c < 0x80u;
+		else if constexpr (Charset == charset::visible)
+			result[c] = c >= 0x20u && c < 0x7fu;
+	}
+	return result;
+}
+
+template<charset Charset>
+inline constexpr auto charset_table = make_charset_table<Charset>();
+
+//Byte by byte UTF-8 validator, rejects overlong forms, surrogates
+//and code points above U+10FFFF
+class utf8_validator
+{
+public:
+	[[nodiscard]]
+	constexpr bool feed(std::uint8_t byte) noexcept
+	{
+		if (!remaining_)
+		{
+			if (byte < 0x80u)
+				return true;
+
+			lower_ = 0x80u;
+			upper_ = 0xbfu;
+			if (byte >= 0xc2u && byte <= 0xdfu)
+				remaining_ = 1u;
+			else if (byte >= 0xe0u && byte <= 0xefu)
+			{
+				remaining_ = 2u;
+				if (byte == 0xe0u)
+					lower_ = 0xa0u;
+				else if (byte == 0xedu)
+					upper_ = 0x9fu;
+			}
+			else if (byte >= 0xf0u && byte <= 0xf4u)
+			{
+				remaining_ = 3u;
+				if (byte == 0xf0u)
+					lower_ = 0x90u;
+				else if (byte == 0xf4u)
+					upper_ = 0x8fu;
+			}
+			else
+			{
+				return false;
+			}
+			return true;
+		}
+
+		if (byte < lower_ || byte > upper_)
+			return false;
+
+		lower_ = 0x80u;
+		upper_ = 0xbfu;
+		--remaining_;
+		return true;
+	}
+
+	[[nodiscard]]
+	constexpr bool complete() const noexcept
+	{
+		return !remaining_;
+	}
+
+private:
+	std::uint8_t remaining_{};
+	std::uint8_t lower_{};
+	std::uint8_t upper_{};
+};
+
+//Validates one byte of a string, validator is only used for UTF-8
+template<charset Charset>
+[[nodiscard]] constexpr bool is_valid_byte(std::uint8_t byte,
+	[[maybe_unused]] utf8_validator& validator) noexcept
+{
+	if constexpr (Charset == charset::utf8)
+		return validator.feed(byte);
+	else
+		return charset_table<Charset>[byte];
+}
+
+//Validates [src, src + len) and copies it to dst, if dst is not null
+template<charset Charset>
+[[nodiscard]] bool validate_copy_scalar(const std::uint8_t* src, std::size_t len,
+	std::uint8_t* dst, utf8_validator& validator) noexcept
+{
+	for (std::size_t i = 0; i != len; ++i)
+	{
+		if (!is_valid_byte<Charset>(src[i], validator))
+			return false;
+		if (dst)
+			dst[i] = src[i];
+	}
+	return true;
+}
+
+template<typename Char>
+[[nodiscard]] constexpr bool is_valid_code_unit(Char value) noexcept
+{
+	if constexpr (sizeof(Char) == 2u)
+		return (value & 0xf800u) != 0xd800u;
+	else
+		return value <= 0x10ffffu && (value & 0xfffff800u) != 0xd800u;
+}
+
+//Converts big-endian BMPString (char16_t) or UniversalString (char32_t)
+//code units to the native byte order and stores them to dst, if dst is not null
+template<typename Char, bool Validate>
+[[nodiscard]] bool byteswap_copy_scalar(const std::uint8_t* src, std::size_t count,
+	Char* dst) noexcept
+{
+	for (std::size_t i = 0; i != count; ++i)
+	{
+		std::make_unsigned_t<Char> value{};
+		for (std::size_t byte = 0; byte != sizeof(Char); ++byte)
+		{
+			if constexpr (sizeof(Char) > 1u)
+				value <<= 8u;
+			value |= *src++;
+		}
+
+		if constexpr (Validate)
+		{
+			if (!is_valid_code_unit(value))
+				return false;
+		}
+
+		if (dst)
+			dst[i] = static_cast<Char>(value);
+	}
+	return true;
+}
+
+#ifdef SIMPLE_ASN1_SIMD_X86
+[[nodiscard]] inline bool cpu_has_avx2() noexcept
+{
+#if defined(_MSC_VER) && !defined(__clang__)
+	int info[4]{};
+	__cpuid(info, 0);
+	if (info[0] < 7)
+		return false;
+	__cpuid(info, 1);
+	constexpr int osxsave_avx = (1 << 27) | (1 << 28);
+	if ((info[2] & osxsave_avx) != osxsave_avx || (_xgetbv(0) & 6u) != 6u)
+		return false;
+	__cpuidex(info, 7, 0);
+	return (info[1] & (1 << 5)) != 0;
+#else
+	__builtin_cpu_init();
+	return __builtin_cpu_supports("avx2");
+#endif
+}
+
+inline const bool has_avx2 = cpu_has_avx2();
+
+[[nodiscard]] inline __m128i in_range_sse2(__m128i v, char low, char high) noexcept
+{
+	return _mm_and_si128(_mm_cmpgt_epi8(v, _mm_set1_epi8(static_cast<char>(low - 1))),
+		_mm_cmplt_epi8(v, _mm_set1_epi8(static_cast<char>(high + 1))));
+}
+
+//Returns true if all 16 bytes belong to the charset (only ASCII is checked for UTF-8)
+template<charset Charset>
+[[nodiscard]] inline bool is_valid_chunk_sse2(__m128i v) noexcept
+{
+	__m128i valid;
+	if constexpr (Charset == charset::ia5 || Charset == charset::utf8)
+		return _mm_movemask_epi8(v) == 0;
+	else if constexpr (Charset == charset::visible)
+		valid = in_range_sse2(v, 0x20, 0x7e);
+	else if constexpr (Charset == charset::numeric)
+	{
+		valid = _mm_or_si128(in_range_sse2(v, '0', '9'),
+			_mm_cmpeq_epi8(v, _mm_set1_epi8(' ')));
+	}
+	else
+	{
+		//Bytes above 0x7f are negative and never match
+		valid = _mm_or_si128(
+			_mm_or_si128(in_range_sse2(_mm_or_si128(v, _mm_set1_epi8(0x20)), 'a', 'z'),
+				_mm_or_si128(in_range_sse2(v, '\'', ')'), in_range_sse2(v, '+', ':'))),
+			_mm_or_si128(_mm_cmpeq_epi8(v, _mm_set1_epi8(' ')),
+				_mm_or_si128(_mm_cmpeq_epi8(v, _mm_set1_epi8('=')),
+					_mm_cmpeq_epi8(v, _mm_set1_epi8('?')))));
+	}
+	return _mm_movemask_epi8(valid) == 0xffff;
+}
+
+template<charset Charset>
+[[nodiscard]] bool validate_copy_sse2(const std::uint8_t* src, std::size_t len,
+	std::uint8_t* dst, utf8_validator& validator) noexcept
+{
+	constexpr std::size_t width = sizeof(__m128i);
+	while (len >= width)
+	{
+		auto v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src));
+		if (validator.complete() && is_valid_chunk_sse2<Charset>(v))
+		{
+			if (dst)
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(dst), v);
+		}
+		else if (Charset != charset::utf8
+			|| !validate_copy_scalar<Charset>(src, width, dst, validator))
+		{
+			return false;
+		}
+
+		src += width;
+		if (dst)
+			dst += width;
+		len -= width;
+	}
+	return validate_copy_scalar<Charset>(src, len, dst, validator);
+}
+
+template<typename Char, bool Validate>
+[[nodiscard]] bool byteswap_copy_sse2(const std::uint8_t* src, std::size_t count,
+	Char* dst) noexcept
+{
+	constexpr std::size_t width = sizeof(__m128i) / sizeof(Char);
+	for (; count >= width; count -= width, src += sizeof(__m128i))
+	{
+		auto v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src));
+		if constexpr (sizeof(Char) == 4u)
+			v = _mm_shufflehi_epi16(_mm_shufflelo_epi16(v, 0xb1), 0xb1);
+		v = _mm_or_si128(_mm_slli_epi16(v, 8), _mm_srli_epi16(v, 8));
+
+		if constexpr (Validate)
+		{
+			__m128i invalid;
+			if constexpr (sizeof(Char) == 2u)
+			{
+				invalid = _mm_cmpeq_epi16(_mm_and_si128(v,
+					_mm_set1_epi16(static_cast<short>(0xf800))),
+					_mm_set1_epi16(static_cast<short>(0xd800)));
+			}
+			else
+			{
+				invalid = _mm_or_si128(
+					_mm_cmpeq_epi32(_mm_and_si128(v,
+						_mm_set1_epi32(static_cast<int>(0xfffff800u))),
+						_mm_set1_epi32(0xd800)),
+					_mm_cmpgt_epi32(_mm_srli_epi32(v, 16), _mm_set1_epi32(0x10)));
+			}
+			if (_mm_movemask_epi8(invalid))
+				return false;
+		}
+
+		if (dst)
+		{
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(dst), v);
+			dst += width;
+		}
+	}
+	return byteswap_copy_scalar<Char, Validate>(src, count, dst);
+}
+
+[[nodiscard]] SIMPLE_ASN1_TARGET_AVX2 inline __m256i in_range_avx2(__m256i v, char low, char high) noexcept
+{
+	return _mm256_and_si256(
+		_mm256_cmpgt_epi8(v, _mm256_set1_epi8(static_cast<char>(low - 1))),
+		_mm256_cmpgt_epi8(_mm256_set1_epi8(static_cast<char>(high + 1)), v));
+}
+
+template<charset Charset>
+[[nodiscard]] SIMPLE_ASN1_TARGET_AVX2 inline bool is_valid_chunk_avx2(__m256i v) noexcept
+{
+	__m256i valid;
+	if constexpr (Charset == charset::ia5 || Charset == charset::utf8)
+		return _mm256_movemask_epi8(v) == 0;
+	else if constexpr (Charset == charset::visible)
+		valid = in_range_avx2(v, 0x20, 0x7e);
+	else if constexpr (Charset == charset::numeric)
+	{
+		valid = _mm256_or_si256(in_range_avx2(v, '0', '9'),
+			_mm256_cmpeq_epi8(v, _mm256_set1_epi8(' ')));
+	}
+	else
+	{
+		valid = _mm256_or_si256(
+			_mm256_or_si256(in_range_avx2(_mm256_or_si256(v, _mm256_set1_epi8(0x20)), 'a', 'z'),
+				_mm256_or_si256(in_range_avx2(v, '\'', ')'), in_range_avx2(v, '+', ':'))),
+			_mm256_or_si256(_mm256_cmpeq_epi8(v, _mm256_set1_epi8(' ')),
+				_mm256_or_si256(_mm256_cmpeq_epi8(v, _mm256_set1_epi8('=')),
+					_mm256_cmpeq_epi8(v, _mm256_set1_epi8('?')))));
+	}
+	return _mm256_movemask_epi8(valid) == -1;
+}
+
+template<charset Charset>
+[[nodiscard]] SIMPLE_ASN1_TARGET_AVX2 bool validate_copy_avx2(const std::uint8_t* src,
+	std::size_t len, std::uint8_t* dst, utf8_validator& validator) noexcept
+{
+	constexpr std::size_t width = sizeof(__m256i);
+	while (len >= width)
+	{
+		auto v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src));
+		if (validator.complete() && is_valid_chunk_avx2<Charset>(v))
+		{
+			if (dst)
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(dst), v);
+		}
+		else if (Charset != charset::utf8
+			|| !validate_copy_scalar<Charset>(src, width, dst, validator))
+		{
+			return false;
+		}
+
+		src += width;
+		if (dst)
+			dst += width;
+		len -= width;
+	}
+	return validate_copy_sse2<Charset>(src, len, dst, validator);
+}
+template<typename Char, bool Validate>
+[[nodiscard]] SIMPLE_ASN1_TARGET_AVX2 bool byteswap_copy_avx2(const std::uint8_t* src,
+	std::size_t count, Char* dst) noexcept
+{
+	constexpr std::size_t width = sizeof(__m256i) / sizeof(Char);
+	const auto shuffle = sizeof(Char) == 2u
+		? _mm256_setr_epi8(1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14,
+			1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14)
+		: _mm256_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12,
+			3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12);
+	for (; count >= width; count -= width, src += sizeof(__m256i))
+	{
+		auto v = _mm256_shuffle_epi8(
+			_mm256_loadu_si256(reinterpret_cast<const __m256i*>(src)), shuffle);
+
+		if constexpr (Validate)
+		{
+			__m256i invalid;
+			if constexpr (sizeof(Char) == 2u)
+			{
+				invalid = _mm256_cmpeq_epi16(_mm256_and_si256(v,
+					_mm256_set1_epi16(static_cast<short>(0xf800))),
+					_mm256_set1_epi16(static_cast<short>(0xd800)));
+			}
+			else
+			{
+				invalid = _mm256_or_si256(
+					_mm256_cmpeq_epi32(_mm256_and_si256(v,
+						_mm256_set1_epi32(static_cast<int>(0xfffff800u))),
+						_mm256_set1_epi32(0xd800)),
+					_mm256_cmpgt_epi32(_mm256_srli_epi32(v, 16), _mm256_set1_epi32(0x10)));
+			}
+			if (_mm256_movemask_epi8(invalid))
+				return false;
+		}
+
+		if (dst)
+		{
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(dst), v);
+			dst += width;
+		}
+	}
+	return byteswap_copy_sse2<Char, Validate>(src, count, dst);
+}
+#endif //SIMPLE_ASN1_SIMD_X86
+
+//Validates [src, src + len) and copies it to dst, if dst is not null.
+//Uses AVX2 or SSE2 kernels if available.
+template<charset Charset>
+[[nodiscard]] bool validate_copy_bytes(const std::uint8_t* src, std::size_t len,
+	std::uint8_t* dst) noexcept
+{
+	utf8_validator validator;
+#ifdef SIMPLE_ASN1_SIMD_X86
+	bool valid = has_avx2
+		? validate_copy_avx2<Charset>(src, len, dst, validator)
+		: validate_copy_sse2<Charset>(src, len, dst, validator);
+#else
+	bool valid = validate_copy_scalar<Charset>(src, len, dst, validator);
+#endif
+	return valid && validator.complete();
+}
+
+//Converts count big-endian code units to the native byte order,
+//validates them if requested and stores them to dst, if dst is not null.
+//Uses AVX2 or SSE2 kernels if available.
+template<typename Char, bool Validate>
+[[nodiscard]] bool byteswap_copy(const std::uint8_t* src, std::size_t count,
+	Char* dst) noexcept
+{
+	static_assert(sizeof(Char) == 2u || sizeof(Char) == 4u);
+#ifdef SIMPLE_ASN1_SIMD_X86
+	return has_avx2
+		? byteswap_copy_avx2<Char, Validate>(src, count, dst)
+		: byteswap_copy_sse2<Char, Validate>(src, count, dst);
+#else
+	return byteswap_copy_scalar<Char, Validate>(src, count, dst);
+#endif
+}
+
+//Validates len bytes starting at begin, advances begin
+//and copies the bytes to dst, if dst is not null
+template<charset Charset, typename Iterator>
+[[nodiscard]] bool validate_copy(Iterator& begin, std::size_t len, std::uint8_t* dst)
+{
+	if constexpr (ContiguousByteIterator<Iterator>)
+	{
+		bool valid = validate_copy_bytes<Charset>(to_byte_pointer(begin), len, dst);
+		begin += static_cast<std::iter_difference_t<Iterator>>(len);
+		return valid;
+	}
+	else
+	{
+		utf8_validator validator;
+		for (; len; --len)
+		{
+			auto byte = static_cast<std::uint8_t>(*begin++);
+			if (!is_valid_byte<Charset>(byte, validator))
+				return false;
+			if (dst)
+				*dst++ = byte;
+		}
+		return validator.complete();
+	}
+}
+
+//Converts count big-endian code units starting at begin to the native byte order,
+//advances begin, validates the code units if requested
+//and stores them to dst, if dst is not null
+template<typename Char, bool Validate, typename Iterator>
+[[nodiscard]] bool byteswap_copy(Iterator& begin, std::size_t count, Char* dst)
+{
+	if constexpr (ContiguousByteIterator<Iterator>)
+	{
+		bool valid = byteswap_copy<Char, Validate>(to_byte_pointer(begin), count, dst);
+		begin += static_cast<std::iter_difference_t<Iterator>>(count * sizeof(Char));
+		return valid;
+	}
+	else
+	{
+		for (std::size_t i = 0; i != count; ++i)
+		{
+			std::make_unsigned_t<Char> value{};
+			for (std::size_t byte = 0; byte != sizeof(Char); ++byte)
+			{
+				value <<= 8u;
+				value |= static_cast<std::uint8_t>(*begin++);
+			}
+
+			if constexpr (Validate)
+			{
+				if (!is_valid_code_unit(value))
+					return false;
+			}
+
+			if (dst)
+				dst[i] = static_cast<Char>(value);
+		}
+		return true;
+	}
+}
+} //namespace asn1::detail::strings
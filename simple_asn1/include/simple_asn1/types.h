@@ -2,15 +2,70 @@
 
 #pragma once
 
+#include <algorithm>
 #include <array>
+#include <compare>
+#include <concepts>
 #include <cstddef>
 #include <cstdint>
+#include <cstdlib>
+#include <initializer_list>
+#include <iterator>
 #include <limits>
+#include <memory_resource>
+#include <optional>
+#include <ranges>
+#include <stdexcept>
 #include <string>
+#include <tuple>
+#include <utility>
+
+#include "simple_asn1/decode_error.h"
 
 namespace asn1
 {
-using tag_type = std::uint8_t;
+//Identifier of an element. For low tag numbers (0-30) this is the identifier byte.
+//For high tag numbers the lowest byte is the first identifier byte
+//(class, constructed bit and 0x1f), and the upper bytes contain the tag number.
+using tag_type = std::uint32_t;
+
+namespace detail
+{
+//Tag number bits of the first identifier byte, which denote the high tag number form
+constexpr tag_type high_tag_number_form = 0x1fu;
+constexpr std::uint32_t max_tag_number = 0xffffffu;
+
+[[nodiscard]]
+constexpr bool is_high_tag_number(tag_type tag) noexcept
+{
+	return (tag & high_tag_number_form) == high_tag_number_form;
+}
+
+[[nodiscard]]
+constexpr std::uint32_t tag_number(tag_type tag) noexcept
+{
+	return is_high_tag_number(tag) ? tag >> 8u : tag & high_tag_number_form;
+}
+
+[[nodiscard]]
+constexpr tag_type make_tag(std::uint32_t number, std::uint8_t first_byte_bits) noexcept
+{
+	if (number < high_tag_number_form)
+		return number | first_byte_bits;
+	return (number << 8u) | high_tag_number_form | first_byte_bits;
+}
+
+//Not constexpr, so exceeding the inline_oid capacity during
+//constant evaluation makes the program ill-formed
+[[noreturn]] inline void throw_inline_oid_overflow()
+{
+#if defined(__cpp_exceptions) || defined(_CPPUNWIND)
+	throw std::length_error("Too many inline_oid components");
+#else //defined(__cpp_exceptions) || defined(_CPPUNWIND)
+	std::abort();
+#endif //defined(__cpp_exceptions) || defined(_CPPUNWIND)
+}
+} //namespace detail
 
 struct extension_sentinel final {};
 
@@ -58,6 +113,85 @@ struct [[nodiscard]] decoded_object_identifier
 		const decoded_object_identifier&) noexcept = default;
 };
 
+//Fixed-capacity OID component container, which does not allocate.
+//Decoding an OID with more than Capacity components fails with a parse error.
+//Adding more than Capacity components otherwise throws std::length_error
+//(or aborts without exceptions), and does not compile in constant expressions.
+template<std::size_t Capacity, std::unsigned_integral T = std::uint32_t>
+class [[nodiscard]] inline_oid
+{
+	static_assert(Capacity >= 2u, "OID has at least two components");
+
+public:
+	using value_type = T;
+	using size_type = std::size_t;
+	using difference_type = std::ptrdiff_t;
+	using reference = T&;
+	using const_reference = const T&;
+	using pointer = T*;
+	using const_pointer = const T*;
+	using iterator = T*;
+	using const_iterator = const T*;
+
+	constexpr inline_oid() noexcept = default;
+
+	constexpr inline_oid(std::initializer_list<T> components)
+		: size_(components.size())
+	{
+		if (components.size() > Capacity)
+			detail::throw_inline_oid_overflow();
+		std::copy_n(components.begin(), size_, components_.begin());
+	}
+
+	[[nodiscard]] static constexpr size_type capacity() noexcept { return Capacity; }
+	[[nodiscard]] static constexpr size_type max_size() noexcept { return Capacity; }
+	[[nodiscard]] constexpr size_type size() const noexcept { return size_; }
+	[[nodiscard]] constexpr bool empty() const noexcept { return !size_; }
+	[[nodiscard]] constexpr bool full() const noexcept { return size_ == Capacity; }
+
+	[[nodiscard]] constexpr pointer data() noexcept { return components_.data(); }
+	[[nodiscard]] constexpr const_pointer data() const noexcept { return components_.data(); }
+	[[nodiscard]] constexpr iterator begin() noexcept { return data(); }
+	[[nodiscard]] constexpr const_iterator begin() const noexcept { return data(); }
+	[[nodiscard]] constexpr iterator end() noexcept { return data() + size_; }
+	[[nodiscard]] constexpr const_iterator end() const noexcept { return data() + size_; }
+
+	[[nodiscard]] constexpr reference operator[](size_type index) noexcept
+	{
+		return components_[index];
+	}
+	[[nodiscard]] constexpr const_reference operator[](size_type index) const noexcept
+	{
+		return components_[index];
+	}
+
+	constexpr reference emplace_back(T value = {})
+	{
+		if (full())
+			detail::throw_inline_oid_overflow();
+		return components_[size_++] = value;
+	}
+	constexpr void push_back(T value) { emplace_back(value); }
+	constexpr void pop_back() noexcept { --size_; }
+	constexpr void clear() noexcept { size_ = 0; }
+
+	[[nodiscard]]
+	friend constexpr auto operator<=>(const inline_oid& l, const inline_oid& r) noexcept
+	{
+		return std::lexicographical_compare_three_way(l.begin(), l.end(),
+			r.begin(), r.end());
+	}
+	[[nodiscard]]
+	friend constexpr bool operator==(const inline_oid& l, const inline_oid& r) noexcept
+	{
+		return std::equal(l.begin(), l.end(), r.begin(), r.end());
+	}
+
+private:
+	std::array<T, Capacity> components_{};
+	size_type size_{};
+};
+
 struct [[nodiscard]] utc_time
 {
 	std::uint8_t year{};
@@ -82,13 +216,47 @@ struct [[nodiscard]] generalized_time
 	std::uint8_t minute{};
 	std::uint8_t second{};
 	std::uint64_t seconds_fraction{};
+	//Number of seconds_fraction digits, including the leading zeros
+	//(2 for ".05"). Zero means the number of significant seconds_fraction digits.
+	std::uint8_t seconds_fraction_digits{};
 
+	//Seconds fractions are compared by their values, so ".12345" is equal
+	//to the seconds_fraction 12345 with zero seconds_fraction_digits
+	[[nodiscard]]
+	friend constexpr std::strong_ordering operator<=>(const generalized_time& l,
+		const generalized_time& r) noexcept
+	{
+		return std::tuple(l.year, l.month, l.day, l.hour, l.minute, l.second,
+			l.normalized_seconds_fraction())
+			<=> std::tuple(r.year, r.month, r.day, r.hour, r.minute, r.second,
+				r.normalized_seconds_fraction());
+	}
 	[[nodiscard]]
-	friend auto operator<=>(const generalized_time&,
-		const generalized_time&) noexcept = default;
+	friend constexpr bool operator==(const generalized_time& l,
+		const generalized_time& r) noexcept
+	{
+		return (l <=> r) == 0;
+	}
+
+private:
+	static constexpr std::uint8_t max_seconds_fraction_digits = 19u;
+
+	//Seconds fraction scaled to max_seconds_fraction_digits digits
 	[[nodiscard]]
-	friend bool operator==(const generalized_time&,
-		const generalized_time&) noexcept = default;
+	constexpr std::uint64_t normalized_seconds_fraction() const noexcept
+	{
+		std::uint8_t significant_digits = 0u;
+		for (auto fraction = seconds_fraction; fraction; fraction /= 10u)
+			++significant_digits;
+
+		auto digits = (std::max)(seconds_fraction_digits, significant_digits);
+		auto result = seconds_fraction;
+		for (; digits < max_seconds_fraction_digits; ++digits)
+			result *= 10u;
+		for (; digits > max_seconds_fraction_digits; --digits)
+			result /= 10u;
+		return result;
+	}
 };
 
 namespace detail
@@ -177,4 +345,268 @@ struct with_raw_data
 	RangeType raw;
 };
 
+//Limits of the outer decode state, which are applied to the values
+//decoded after the outer decoding has finished (lazy, sequence_of_view)
+struct deferred_decode_limits
+{
+	//Recursion depth which was left when the value was skipped
+	std::size_t max_recursion_depth = (std::numeric_limits<std::size_t>::max)();
+	std::pmr::memory_resource* memory_resource{};
+};
+
+//Stores the raw DER data of an element and decodes it on the first access.
+//The outer decoder only validates the element header and skips its contents.
+//The remaining recursion depth limit and the memory resource of the outer
+//decode state are applied on the first access.
+//If RangeType does not own the data, the buffer must outlive the object.
+//Decoding on the first access is not thread-safe. get() throws parse_error on errors,
+//try_get() returns them.
+template<typename RangeType, typename Value>
+class [[nodiscard]] lazy
+{
+public:
+	//Throws parse_error if error is null, otherwise stores the error
+	//and returns false on failure
+	using decoder_type = bool (*)(const RangeType& raw, Value& value,
+		const deferred_decode_limits& limits, decode_error* error);
+
+public:
+	lazy() = default;
+
+	lazy(Value value)
+		: value_(std::move(value))
+	{
+	}
+
+	lazy(RangeType raw, decoder_type decoder, const deferred_decode_limits& limits = {})
+		: raw_(std::move(raw))
+		, decoder_(decoder)
+		, limits_(limits)
+	{
+	}
+
+	[[nodiscard]]
+	const Value& get() const
+	{
+		if (!value_)
+		{
+			Value value{};
+			if (decoder_)
+				(void)decoder_(raw_, value, limits_, nullptr);
+			value_ = std::move(value);
+		}
+		return *value_;
+	}
+
+	//Returns the pointer to the decoded value, or the decoding error
+	//(offsets are relative to raw()). The value is decoded again
+	//on the next access after a failure.
+	[[nodiscard]]
+	decode_result<const Value*> try_get() const
+	{
+		if (!value_)
+		{
+			Value value{};
+			decode_error error{};
+			if (decoder_ && !decoder_(raw_, value, limits_, &error))
+				return error;
+			value_ = std::move(value);
+		}
+		return &*value_;
+	}
+
+	[[nodiscard]]
+	const Value& operator*() const
+	{
+		return get();
+	}
+
+	[[nodiscard]]
+	const Value* operator->() const
+	{
+		return &get();
+	}
+
+	[[nodiscard]]
+	bool is_decoded() const noexcept
+	{
+		return value_.has_value();
+	}
+
+	//Element header and contents for explicitly tagged elements,
+	//only contents for implicitly tagged ones
+	[[nodiscard]]
+	const RangeType& raw() const noexcept
+	{
+		return raw_;
+	}
+
+private:
+	RangeType raw_{};
+	decoder_type decoder_{};
+	deferred_decode_limits limits_{};
+	mutable std::optional<Value> value_;
+};
+
+//Stores the raw contents of a SEQUENCE OF / SET OF and decodes the elements
+//one at a time while they are iterated. The outer decoder only validates the
+//SEQUENCE OF / SET OF header and skips its contents. Every iterator holds
+//a single element value, which is reset and reused for each element, so the list
+//is scanned with O(1) memory and the elements after the last visited one are not decoded.
+//The iterators are input iterators: references returned by an iterator are valid
+//until it is incremented or destroyed, and the iterators point into the view, so they
+//are invalidated when the view is moved or destroyed.
+//If RangeType does not own the data, the buffer must outlive the object.
+//The elements are decoded with the remaining recursion depth limit and the memory
+//resource of the outer decode state.
+//Decoding errors are thrown as parse_error, or stored to the error passed to begin(),
+//offsets are relative to raw().
+template<typename RangeType, typename Value>
+class [[nodiscard]] sequence_of_view
+{
+public:
+	using value_type = Value;
+	using raw_iterator_type = decltype(std::ranges::cbegin(std::declval<const RangeType&>()));
+	//Decodes the element at begin into value and returns the end of the element.
+	//Throws parse_error if error is null, otherwise stores the error
+	//and returns the end of raw on failure.
+	using decoder_type = raw_iterator_type (*)(const RangeType& raw,
+		raw_iterator_type begin, Value& value, const deferred_decode_limits& limits,
+		decode_error* error);
+
+	class iterator
+	{
+	public:
+		using value_type = Value;
+		using difference_type = std::ptrdiff_t;
+		using reference = const Value&;
+		using pointer = const Value*;
+		using iterator_category = std::input_iterator_tag;
+		using iterator_concept = std::input_iterator_tag;
+
+	public:
+		iterator() = default;
+
+		[[nodiscard]]
+		const Value& operator*() const noexcept
+		{
+			return value_;
+		}
+
+		[[nodiscard]]
+		const Value* operator->() const noexcept
+		{
+			return &value_;
+		}
+
+		iterator& operator++()
+		{
+			begin_ = next_;
+			decode();
+			return *this;
+		}
+
+		iterator operator++(int)
+		{
+			auto result = *this;
+			++*this;
+			return result;
+		}
+
+		[[nodiscard]]
+		friend bool operator==(const iterator& left, const iterator& right) noexcept
+		{
+			return left.begin_ == right.begin_;
+		}
+
+	private:
+		friend class sequence_of_view;
+
+		iterator(const RangeType* raw, raw_iterator_type begin, decoder_type decoder,
+			const deferred_decode_limits* limits, decode_error* error)
+			: raw_(raw)
+			, begin_(begin)
+			, next_(begin)
+			, decoder_(decoder)
+			, limits_(limits)
+			, error_(error)
+		{
+			decode();
+		}
+
+		void decode()
+		{
+			if (begin_ == std::ranges::cend(*raw_))
+				return;
+
+			value_ = Value{};
+			next_ = decoder_(*raw_, begin_, value_, *limits_, error_);
+			//The range ends at the element which has failed to decode
+			if (error_ && error_->code != decode_errc::none)
+				begin_ = next_;
+		}
+
+	private:
+		const RangeType* raw_{};
+		raw_iterator_type begin_{};
+		raw_iterator_type next_{};
+		decoder_type decoder_{};
+		const deferred_decode_limits* limits_{};
+		decode_error* error_{};
+		Value value_{};
+	};
+
+public:
+	sequence_of_view() = default;
+
+	sequence_of_view(RangeType raw, decoder_type decoder,
+		const deferred_decode_limits& limits = {})
+		: raw_(std::move(raw))
+		, decoder_(decoder)
+		, limits_(limits)
+	{
+	}
+
+	//Decodes the first element
+	[[nodiscard]]
+	iterator begin() const
+	{
+		return iterator(&raw_, std::ranges::cbegin(raw_), decoder_, &limits_, nullptr);
+	}
+
+	//Decodes the first element. Does not throw decoding errors (and can be used
+	//without exceptions): the error is stored to error, and the iterator becomes equal
+	//to end(). error must outlive the iterator, it is cleared by this call.
+	[[nodiscard]]
+	iterator begin(decode_error& error) const
+	{
+		error = {};
+		return iterator(&raw_, std::ranges::cbegin(raw_), decoder_, &limits_, &error);
+	}
+
+	[[nodiscard]]
+	iterator end() const
+	{
+		return iterator(&raw_, std::ranges::cend(raw_), decoder_, &limits_, nullptr);
+	}
+
+	[[nodiscard]]
+	bool empty() const
+	{
+		return std::ranges::cbegin(raw_) == std::ranges::cend(raw_);
+	}
+
+	//Contents of the SEQUENCE OF / SET OF (the elements with their headers)
+	[[nodiscard]]
+	const RangeType& raw() const noexcept
+	{
+		return raw_;
+	}
+
+private:
+	RangeType raw_{};
+	decoder_type decoder_{};
+	deferred_decode_limits limits_{};
+};
+
 } //namespace asn1
@@ -0,0 +1,5 @@
+// SPDX-License-Identifier: MIT
+
+#include "simple_asn1/crypto/precompiled.h"
+
+SIMPLE_ASN1_CRYPTO_DECODERS()
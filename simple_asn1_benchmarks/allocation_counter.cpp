@@ -0,0 +1,41 @@
+// SPDX-License-Identifier: MIT
+
+#include <atomic>
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+
+#include "simple_asn1_benchmarks/allocation_counter.h"
+
+namespace
+{
+std::atomic<std::size_t> allocations{};
+} //namespace
+
+namespace asn1::benchmarks
+{
+std::size_t allocation_count() noexcept
+{
+	return allocations.load(std::memory_order_relaxed);
+}
+} //namespace asn1::benchmarks
+
+//Array, nothrow and sized forms forward to these by default.
+//Over-aligned allocations are not counted.
+void* operator new(std::size_t size)
+{
+	allocations.fetch_add(1u, std::memory_order_relaxed);
+	if (auto ptr = std::malloc(size ? size : 1u))
+		return ptr;
+	throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept
+{
+	std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept
+{
+	std::free(ptr);
+}
@@ -0,0 +1,12 @@
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <cstddef>
+
+namespace asn1::benchmarks
+{
+//Number of global operator new calls since the program start.
+//The benchmark executable replaces the global allocation functions to count them.
+[[nodiscard]] std::size_t allocation_count() noexcept;
+} //namespace asn1::benchmarks
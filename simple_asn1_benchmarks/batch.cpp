@@ -0,0 +1,101 @@
+// SPDX-License-Identifier: MIT
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "simple_asn1/der_batch_decode.h"
+#include "simple_asn1/der_decode.h"
+#include "simple_asn1/der_encode.h"
+#include "simple_asn1/spec.h"
+#include "simple_asn1/crypto/x509/spec.h"
+#include "simple_asn1/crypto/x509/types.h"
+
+#include "simple_asn1_benchmarks/corpus.h"
+
+//Decodes a batch of independent x509 certificates with der::decode_batch,
+//and a single huge SEQUENCE OF with opts::parallel_decode.
+//The benchmark argument (template argument) is the number of threads,
+//compare items/s between them to see the scaling.
+namespace
+{
+using asn1::benchmarks::range_type;
+
+constexpr std::size_t batch_size = 4096u;
+
+std::vector<range_type> certificate_batch()
+{
+	const auto certificates = asn1::benchmarks::find_certificates();
+	std::vector<range_type> result;
+	result.reserve(batch_size);
+	for (std::size_t i = 0; i != batch_size; ++i)
+		result.emplace_back(certificates[i % certificates.size()]);
+	return result;
+}
+
+void report(benchmark::State& state, const std::vector<range_type>& inputs)
+{
+	std::size_t bytes = 0;
+	for (auto input : inputs)
+		bytes += input.size();
+
+	state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * inputs.size()));
+	state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * bytes));
+}
+
+void batch_certificates(benchmark::State& state)
+{
+	const auto inputs = certificate_batch();
+	std::vector<asn1::crypto::x509::certificate<range_type>> outputs(inputs.size());
+	asn1::thread_pool_executor executor(static_cast<std::size_t>(state.range(0)));
+	for (auto _ : state)
+	{
+		auto errors = asn1::der::decode_batch<asn1::spec::crypto::x509::certificate>(
+			inputs, outputs, executor);
+		benchmark::DoNotOptimize(errors);
+	}
+	report(state, inputs);
+}
+BENCHMARK(batch_certificates)->Arg(1)->Arg(2)->Arg(4)->Arg(8)->UseRealTime();
+
+//CRL-like list, every entry contains two short OCTET STRINGs
+using entry_spec = asn1::spec::sequence_of<asn1::spec::octet_string<>>;
+using entries_type = std::vector<std::vector<std::uint8_t>>;
+
+constexpr std::size_t list_size = 1u << 18u;
+
+std::vector<std::uint8_t> huge_list()
+{
+	std::vector<entries_type> value(list_size);
+	for (std::size_t i = 0; i != list_size; ++i)
+	{
+		value[i].emplace_back(16u, static_cast<std::uint8_t>(i));
+		value[i].emplace_back(8u, static_cast<std::uint8_t>(i >> 8u));
+	}
+	return asn1::der::encode<asn1::spec::sequence_of<entry_spec>>(value);
+}
+
+template<std::size_t Threads>
+void parallel_sequence_of(benchmark::State& state)
+{
+	using spec = asn1::spec::sequence_of_with_options<
+		asn1::opts::options<asn1::opts::parallel_decode<1024u, Threads>>, entry_spec>;
+	const auto der = huge_list();
+	for (auto _ : state)
+	{
+		std::vector<entries_type> value;
+		asn1::der::decode<spec>(der.data(), der.data() + der.size(), value);
+		benchmark::DoNotOptimize(value);
+	}
+	state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * list_size));
+	state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * der.size()));
+}
+//One thread is the serial decoding baseline
+BENCHMARK(parallel_sequence_of<1u>)->UseRealTime();
+BENCHMARK(parallel_sequence_of<2u>)->UseRealTime();
+BENCHMARK(parallel_sequence_of<4u>)->UseRealTime();
+BENCHMARK(parallel_sequence_of<8u>)->UseRealTime();
+} //namespace
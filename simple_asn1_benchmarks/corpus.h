@@ -0,0 +1,69 @@
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include "simple_asn1/der_index.h"
+#include "simple_asn1/oid_map.h"
+#include "simple_asn1/crypto/pkcs9/oids.h"
+
+#include "simple_asn1_tests/pkcs7_data.h"
+
+namespace asn1::benchmarks
+{
+using range_type = std::span<const std::uint8_t>;
+
+//The whole CMS (PKCS#7) signed data blob
+[[nodiscard]] inline range_type cms_corpus()
+{
+	return { pkcs7.data(), pkcs7.size() };
+}
+
+//X.509 certificates embedded into the CMS blob:
+//ContentInfo -> [0] -> SignedData -> [0] IMPLICIT certificates
+[[nodiscard]] inline std::vector<range_type> find_certificates()
+{
+	auto index = asn1::der::build_index(pkcs7.cbegin(), pkcs7.cend());
+	auto content = index[index[0].first_child].next_sibling;
+	auto certificates = index[index[content].first_child].first_child;
+	while (index[certificates].tag != 0xa0u)
+		certificates = index[certificates].next_sibling;
+
+	std::vector<range_type> result;
+	for (auto cert = index[certificates].first_child; cert != asn1::der::index_node::npos;
+		cert = index[cert].next_sibling)
+	{
+		result.emplace_back(pkcs7.data() + index[cert].header_offset,
+			pkcs7.data() + index[cert].end_offset());
+	}
+	return result;
+}
+
+//TSTInfo of the nested timestamp signature:
+//OBJECT IDENTIFIER id-ct-TSTInfo -> [0] -> OCTET STRING (TSTInfo)
+[[nodiscard]] inline range_type find_tst_info()
+{
+	using oid_map_type = asn1::oid_map<asn1::crypto::pkcs9::oid_tst_info>;
+	auto index = asn1::der::build_index(pkcs7.cbegin(), pkcs7.cend());
+	for (const auto& node : index)
+	{
+		if (node.tag != 0x06u || node.next_sibling == asn1::der::index_node::npos)
+			continue;
+
+		const range_type contents(pkcs7.data() + node.content_offset, node.length);
+		if (oid_map_type::find(contents) == oid_map_type::npos)
+			continue;
+
+		const auto& explicit_tag = index[node.next_sibling];
+		if (explicit_tag.first_child == asn1::der::index_node::npos)
+			continue;
+
+		const auto& encapsulated = index[explicit_tag.first_child];
+		return { pkcs7.data() + encapsulated.content_offset, encapsulated.length };
+	}
+	return {};
+}
+} //namespace asn1::benchmarks
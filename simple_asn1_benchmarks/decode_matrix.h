@@ -0,0 +1,150 @@
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "simple_asn1/der_decode.h"
+
+#include "simple_asn1_benchmarks/allocation_counter.h"
+
+//Registers asn1::der::decode benchmarks for every combination of
+//the byte type (std::int8_t, std::uint8_t, std::byte) and the input
+//iterator kind (pointer, std::vector iterator).
+//Benchmarks are named "decode/<case>/<byte type>/<input>".
+namespace asn1::benchmarks
+{
+using corpus_type = std::vector<std::vector<std::uint8_t>>;
+
+template<typename ByteType>
+using span_value = std::span<const ByteType>;
+template<typename ByteType>
+using vector_value = std::vector<ByteType>;
+
+template<typename ByteType>
+constexpr const char* byte_type_name = nullptr;
+template<>
+constexpr const char* byte_type_name<std::int8_t> = "int8_t";
+template<>
+constexpr const char* byte_type_name<std::uint8_t> = "uint8_t";
+template<>
+constexpr const char* byte_type_name<std::byte> = "byte";
+
+struct pointer_input
+{
+	static constexpr const char* name = "pointer";
+
+	template<typename ByteType>
+	[[nodiscard]] static const ByteType* begin(const std::vector<ByteType>& buffer) noexcept
+	{
+		return buffer.data();
+	}
+
+	template<typename ByteType>
+	[[nodiscard]] static const ByteType* end(const std::vector<ByteType>& buffer) noexcept
+	{
+		return buffer.data() + buffer.size();
+	}
+};
+
+struct iterator_input
+{
+	static constexpr const char* name = "iterator";
+
+	template<typename ByteType>
+	[[nodiscard]] static auto begin(const std::vector<ByteType>& buffer) noexcept
+	{
+		return buffer.cbegin();
+	}
+
+	template<typename ByteType>
+	[[nodiscard]] static auto end(const std::vector<ByteType>& buffer) noexcept
+	{
+		return buffer.cend();
+	}
+};
+
+template<typename ByteType>
+[[nodiscard]] std::vector<std::vector<ByteType>> to_buffers(const corpus_type& corpus)
+{
+	std::vector<std::vector<ByteType>> result;
+	result.reserve(corpus.size());
+	for (const auto& item : corpus)
+	{
+		auto& buffer = result.emplace_back(item.size());
+		for (std::size_t i = 0; i != item.size(); ++i)
+			buffer[i] = static_cast<ByteType>(item[i]);
+	}
+	return result;
+}
+
+[[nodiscard]] inline corpus_type to_corpus(const std::vector<std::span<const std::uint8_t>>& ranges)
+{
+	corpus_type result;
+	for (auto range : ranges)
+		result.emplace_back(range.begin(), range.end());
+	return result;
+}
+
+//Decodes every corpus item into a new value on each iteration.
+//Reports bytes/s, items/s (decoded values) and the average number
+//of heap allocations per decoded value ("allocs").
+template<typename Spec, typename Value, typename Input, typename ByteType>
+void decode_corpus(benchmark::State& state, const std::vector<std::vector<ByteType>>& buffers)
+{
+	std::size_t bytes = 0;
+	for (const auto& buffer : buffers)
+		bytes += buffer.size();
+
+	std::size_t allocations = 0;
+	for (auto _ : state)
+	{
+		const auto allocations_before = allocation_count();
+		for (const auto& buffer : buffers)
+		{
+			Value value{};
+			asn1::der::decode<Spec>(Input::begin(buffer), Input::end(buffer), value);
+			benchmark::DoNotOptimize(value);
+		}
+		allocations += allocation_count() - allocations_before;
+	}
+
+	const auto items = static_cast<std::int64_t>(state.iterations() * buffers.size());
+	state.SetItemsProcessed(items);
+	state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * bytes));
+	state.counters["allocs"] = items
+		? static_cast<double>(allocations) / static_cast<double>(items) : 0.;
+}
+
+template<typename Spec, template<typename> typename Value, typename ByteType, typename Input>
+void register_decode_benchmark(const std::string& name, const corpus_type& corpus)
+{
+	const auto full_name = "decode/" + name + '/' + byte_type_name<ByteType> + '/' + Input::name;
+	benchmark::RegisterBenchmark(full_name.c_str(),
+		[buffers = to_buffers<ByteType>(corpus)](benchmark::State& state) {
+			decode_corpus<Spec, Value<ByteType>, Input>(state, buffers);
+		});
+}
+
+template<typename Spec, template<typename> typename Value, typename ByteType>
+void register_decode_inputs(const std::string& name, const corpus_type& corpus)
+{
+	register_decode_benchmark<Spec, Value, ByteType, pointer_input>(name, corpus);
+	register_decode_benchmark<Spec, Value, ByteType, iterator_input>(name, corpus);
+}
+
+//Value<ByteType> is the type the corpus items are decoded to
+template<typename Spec, template<typename> typename Value>
+void register_decode(const std::string& name, const corpus_type& corpus)
+{
+	register_decode_inputs<Spec, Value, std::int8_t>(name, corpus);
+	register_decode_inputs<Spec, Value, std::uint8_t>(name, corpus);
+	register_decode_inputs<Spec, Value, std::byte>(name, corpus);
+}
+} //namespace asn1::benchmarks
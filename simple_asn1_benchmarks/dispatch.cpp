@@ -0,0 +1,77 @@
+// SPDX-License-Identifier: MIT
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "simple_asn1/der_decode.h"
+#include "simple_asn1/der_encode.h"
+#include "simple_asn1/crypto/pkcs7/cms/spec.h"
+#include "simple_asn1/crypto/pkcs7/cms/types.h"
+#include "simple_asn1/crypto/x509/extensions_spec.h"
+#include "simple_asn1/crypto/x509/extensions_types.h"
+
+#include "simple_asn1_benchmarks/corpus.h"
+
+namespace
+{
+using asn1::benchmarks::range_type;
+using asn1::benchmarks::find_certificates;
+
+constexpr std::array<std::uint8_t, 4> ip_address{ 127u, 0u, 0u, 1u };
+
+using general_names_spec = asn1::spec::crypto::x509::ext::general_names<"GeneralNames">;
+using general_names_type = asn1::crypto::x509::ext::general_names<range_type>;
+
+//Alternatives from the beginning and the end of the CHOICE
+std::vector<std::uint8_t> create_general_names()
+{
+	general_names_type names;
+	names.emplace_back().emplace<2>("www.example.com");
+	names.emplace_back().emplace<2>("example.com");
+	names.emplace_back().emplace<1>("user@example.com");
+	names.emplace_back().emplace<6>("https://example.com/ca.crt");
+	names.emplace_back().emplace<7>(ip_address);
+	names.emplace_back().emplace<2>("*.example.org");
+	return asn1::der::encode<general_names_spec>(names);
+}
+
+void certificate_choices(benchmark::State& state)
+{
+	const auto certificates = find_certificates();
+	std::size_t bytes = 0;
+	for (auto certificate : certificates)
+		bytes += certificate.size();
+
+	for (auto _ : state)
+	{
+		for (auto certificate : certificates)
+		{
+			asn1::crypto::pkcs7::cms::certificate_choices_type<range_type> value;
+			asn1::der::decode<asn1::spec::crypto::pkcs7::cms::certificate_choices>(
+				certificate.begin(), certificate.end(), value);
+			benchmark::DoNotOptimize(value);
+		}
+	}
+	state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * bytes));
+}
+BENCHMARK(certificate_choices);
+
+void general_name(benchmark::State& state)
+{
+	const auto data = create_general_names();
+	for (auto _ : state)
+	{
+		general_names_type value;
+		asn1::der::decode<general_names_spec>(data.cbegin(), data.cend(), value);
+		benchmark::DoNotOptimize(value);
+	}
+	state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * data.size()));
+}
+BENCHMARK(general_name);
+} //namespace
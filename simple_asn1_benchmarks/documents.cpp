@@ -0,0 +1,136 @@
+// SPDX-License-Identifier: MIT
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <string>
+#include <vector>
+
+#include "simple_asn1/der_encode.h"
+#include "simple_asn1/spec.h"
+#include "simple_asn1/crypto/pkcs7/authenticode/spec.h"
+#include "simple_asn1/crypto/pkcs7/authenticode/types.h"
+#include "simple_asn1/crypto/tst/spec.h"
+#include "simple_asn1/crypto/tst/types.h"
+#include "simple_asn1/crypto/x509/spec.h"
+#include "simple_asn1/crypto/x509/types.h"
+
+#include "simple_asn1_benchmarks/corpus.h"
+#include "simple_asn1_benchmarks/decode_matrix.h"
+
+//Whole documents: real x509, Authenticode PKCS#7 and TSTInfo structures
+//from the test corpus, and synthetic deep (recursive) and wide (SEQUENCE OF) ones
+namespace
+{
+using asn1::benchmarks::corpus_type;
+using asn1::benchmarks::register_decode;
+
+template<typename ByteType>
+using certificate_span_value = asn1::crypto::x509::certificate<std::span<const ByteType>>;
+template<typename ByteType>
+using certificate_vector_value = asn1::crypto::x509::certificate<std::vector<ByteType>>;
+template<typename ByteType>
+using authenticode_span_value
+	= asn1::crypto::pkcs7::authenticode::content_info<std::span<const ByteType>>;
+template<typename ByteType>
+using authenticode_vector_value
+	= asn1::crypto::pkcs7::authenticode::content_info<std::vector<ByteType>>;
+template<typename ByteType>
+using tst_info_span_value = asn1::crypto::tst::tst_info<std::span<const ByteType>>;
+template<typename ByteType>
+using tst_info_vector_value = asn1::crypto::tst::tst_info<std::vector<ByteType>>;
+
+struct list_spec : asn1::spec::recursive<list_spec>
+{
+	using type = asn1::spec::sequence<
+		asn1::spec::integer<>,
+		asn1::spec::optional<list_spec>
+	>;
+};
+
+struct list_node
+{
+	std::int32_t value;
+	std::unique_ptr<list_node> next;
+};
+
+template<typename>
+using list_value = list_node;
+
+using wide_integers_spec = asn1::spec::sequence_of<asn1::spec::integer<>>;
+template<typename>
+using wide_integers_value = std::vector<std::int64_t>;
+
+using wide_octet_strings_spec = asn1::spec::sequence_of<asn1::spec::octet_string<>>;
+template<typename ByteType>
+using wide_octet_strings_span_value = std::vector<std::span<const ByteType>>;
+template<typename ByteType>
+using wide_octet_strings_vector_value = std::vector<std::vector<ByteType>>;
+
+constexpr std::size_t list_depth = 256u;
+constexpr std::size_t wide_element_count = 4096u;
+
+corpus_type deep_list()
+{
+	list_node head;
+	auto* node = &head;
+	for (std::size_t i = 1; i != list_depth; ++i)
+	{
+		node->value = static_cast<std::int32_t>(i);
+		node->next = std::make_unique<list_node>();
+		node = node->next.get();
+	}
+	return { asn1::der::encode<list_spec>(head) };
+}
+
+corpus_type wide_integers()
+{
+	std::vector<std::int64_t> value;
+	for (std::size_t i = 0; i != wide_element_count; ++i)
+		value.emplace_back(static_cast<std::int64_t>(i * 7919u) - 1000000);
+	return { asn1::der::encode<wide_integers_spec>(value) };
+}
+
+corpus_type wide_octet_strings()
+{
+	std::vector<std::vector<std::uint8_t>> value;
+	for (std::size_t i = 0; i != wide_element_count; ++i)
+		value.emplace_back(16u, static_cast<std::uint8_t>(i));
+	return { asn1::der::encode<wide_octet_strings_spec>(value) };
+}
+
+[[maybe_unused]] const bool registered = [] {
+	const auto certificates = asn1::benchmarks::to_corpus(
+		asn1::benchmarks::find_certificates());
+	register_decode<asn1::spec::crypto::x509::certificate, certificate_span_value>(
+		"x509_certificate/span", certificates);
+	register_decode<asn1::spec::crypto::x509::certificate, certificate_vector_value>(
+		"x509_certificate/vector", certificates);
+
+	const auto authenticode = asn1::benchmarks::to_corpus(
+		{ asn1::benchmarks::cms_corpus() });
+	register_decode<asn1::spec::crypto::pkcs7::authenticode::content_info,
+		authenticode_span_value>("authenticode/span", authenticode);
+	register_decode<asn1::spec::crypto::pkcs7::authenticode::content_info,
+		authenticode_vector_value>("authenticode/vector", authenticode);
+
+	const auto tst_info = asn1::benchmarks::to_corpus(
+		{ asn1::benchmarks::find_tst_info() });
+	register_decode<asn1::spec::crypto::tst::tst_info, tst_info_span_value>(
+		"tst_info/span", tst_info);
+	register_decode<asn1::spec::crypto::tst::tst_info, tst_info_vector_value>(
+		"tst_info/vector", tst_info);
+
+	register_decode<list_spec, list_value>("deep_list/unique_ptr", deep_list());
+
+	register_decode<wide_integers_spec, wide_integers_value>(
+		"wide_integers/int64", wide_integers());
+	const auto octet_strings = wide_octet_strings();
+	register_decode<wide_octet_strings_spec, wide_octet_strings_span_value>(
+		"wide_octet_strings/span", octet_strings);
+	register_decode<wide_octet_strings_spec, wide_octet_strings_vector_value>(
+		"wide_octet_strings/vector", octet_strings);
+	return true;
+}();
+} //namespace
@@ -0,0 +1,91 @@
+// SPDX-License-Identifier: MIT
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <iterator>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "simple_asn1/der_decode.h"
+
+#include "simple_asn1_benchmarks/corpus.h"
+
+//Decodes every TLV header of the x509 and CMS corpora.
+//Pointer input takes the contiguous header/INTEGER kernels,
+//std::deque input takes the generic byte-at-a-time path.
+namespace
+{
+using asn1::benchmarks::range_type;
+
+template<typename Iterator>
+std::size_t walk_headers(Iterator begin, Iterator end)
+{
+	asn1::decode_state state(begin, end);
+	std::size_t count = 0;
+	while (state.begin != state.end)
+	{
+		auto [tag, length] = asn1::detail::der::decode_type_length(state);
+		++count;
+		//Primitive element contents are skipped, constructed ones are walked into
+		if (!(tag & 0x20u))
+			std::advance(state.begin, length);
+	}
+	return count;
+}
+
+template<typename Container>
+void run_walk(benchmark::State& state, const std::vector<Container>& buffers)
+{
+	std::size_t headers = 0;
+	std::size_t bytes = 0;
+	for (const auto& buffer : buffers)
+	{
+		headers += walk_headers(std::begin(buffer), std::end(buffer));
+		bytes += std::size(buffer);
+	}
+
+	for (auto _ : state)
+	{
+		for (const auto& buffer : buffers)
+			benchmark::DoNotOptimize(walk_headers(std::begin(buffer), std::end(buffer)));
+	}
+
+	state.counters["headers"] = benchmark::Counter(
+		static_cast<double>(state.iterations() * headers), benchmark::Counter::kIsRate);
+	state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * bytes));
+}
+
+std::vector<std::deque<std::uint8_t>> to_deques(const std::vector<range_type>& buffers)
+{
+	std::vector<std::deque<std::uint8_t>> result;
+	for (auto buffer : buffers)
+		result.emplace_back(buffer.begin(), buffer.end());
+	return result;
+}
+
+void x509_headers_contiguous(benchmark::State& state)
+{
+	run_walk(state, asn1::benchmarks::find_certificates());
+}
+BENCHMARK(x509_headers_contiguous);
+
+void x509_headers_generic(benchmark::State& state)
+{
+	run_walk(state, to_deques(asn1::benchmarks::find_certificates()));
+}
+BENCHMARK(x509_headers_generic);
+
+void cms_headers_contiguous(benchmark::State& state)
+{
+	run_walk(state, std::vector{ asn1::benchmarks::cms_corpus() });
+}
+BENCHMARK(cms_headers_contiguous);
+
+void cms_headers_generic(benchmark::State& state)
+{
+	run_walk(state, to_deques({ asn1::benchmarks::cms_corpus() }));
+}
+BENCHMARK(cms_headers_generic);
+} //namespace
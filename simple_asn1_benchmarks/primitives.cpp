@@ -0,0 +1,194 @@
+// SPDX-License-Identifier: MIT
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "simple_asn1/der_encode.h"
+#include "simple_asn1/spec.h"
+#include "simple_asn1/types.h"
+#include "simple_asn1/crypto/algorithms.h"
+
+#include "simple_asn1_benchmarks/decode_matrix.h"
+
+namespace
+{
+using asn1::benchmarks::corpus_type;
+using asn1::benchmarks::register_decode;
+using asn1::benchmarks::span_value;
+using asn1::benchmarks::vector_value;
+
+//Short-form length TLV
+std::vector<std::uint8_t> tlv(std::uint8_t tag, std::string_view contents)
+{
+	std::vector<std::uint8_t> result{ tag, static_cast<std::uint8_t>(contents.size()) };
+	result.insert(result.end(), contents.begin(), contents.end());
+	return result;
+}
+
+corpus_type integers()
+{
+	corpus_type result;
+	for (std::int64_t value : { std::int64_t{ 0 }, std::int64_t{ 1 }, std::int64_t{ -1 },
+		std::int64_t{ 127 }, std::int64_t{ -128 }, std::int64_t{ 65535 }, std::int64_t{ -40000 },
+		std::int64_t{ 0x12345678 }, std::int64_t{ -0x123456789abc },
+		(std::numeric_limits<std::int64_t>::max)(), (std::numeric_limits<std::int64_t>::min)() })
+	{
+		result.emplace_back(asn1::der::encode<asn1::spec::integer<>>(value));
+	}
+	return result;
+}
+
+corpus_type object_identifiers()
+{
+	corpus_type result;
+	const auto add = [&result](const auto& oid) {
+		asn1::decoded_object_identifier<std::vector<std::uint32_t>> value{
+			{ oid.begin(), oid.end() } };
+		result.emplace_back(asn1::der::encode<asn1::spec::object_identifier<>>(value));
+	};
+	add(asn1::crypto::hash::id_sha1);
+	add(asn1::crypto::hash::id_sha256);
+	add(asn1::crypto::pki::id_rsa);
+	add(asn1::crypto::pki::id_sha256_with_rsa);
+	add(asn1::crypto::pki::id_ec_public_key);
+	add(asn1::crypto::pki::id_dsa);
+	return result;
+}
+
+corpus_type printable_strings()
+{
+	return { tlv(0x13u, "US"), tlv(0x13u, "Example Root CA"), tlv(0x13u, "Some-City"),
+		tlv(0x13u, "Example Organization (Test), Inc.") };
+}
+
+corpus_type utf8_strings()
+{
+	return { tlv(0x0cu, "example.com"),
+		tlv(0x0cu, "\xd0\x9f\xd1\x80\xd0\xb8\xd0\xbc\xd0\xb5\xd1\x80"),
+		tlv(0x0cu, "Example Intermediate Certification Authority G2") };
+}
+
+corpus_type ia5_strings()
+{
+	return { tlv(0x16u, "user@example.com"), tlv(0x16u, "https://example.com/ca.crt"),
+		tlv(0x16u, "*.example.org") };
+}
+
+corpus_type bmp_strings()
+{
+	using namespace std::string_view_literals;
+	return { tlv(0x1eu, "\0E\0x\0a\0m\0p\0l\0e\0 \0P\0r\0o\0g\0r\0a\0m"sv),
+		tlv(0x1eu, "\x04\x1f\x04\x40\x04\x38\x04\x3c\x04\x35\x04\x40"sv) };
+}
+
+corpus_type octet_strings()
+{
+	return { tlv(0x04u, std::string(20u, '\xab')), tlv(0x04u, std::string(32u, '\x5c')),
+		tlv(0x04u, std::string(64u, '\x01')) };
+}
+
+corpus_type bit_strings()
+{
+	using namespace std::string_view_literals;
+	return { tlv(0x03u, "\x05\xa0"sv),
+		tlv(0x03u, std::string(1u, '\0') + std::string(64u, '\x7f')) };
+}
+
+corpus_type utc_times()
+{
+	return { tlv(0x17u, "230315123456Z"), tlv(0x17u, "491231235959Z"),
+		tlv(0x17u, "000101000000Z") };
+}
+
+corpus_type generalized_times()
+{
+	return { tlv(0x18u, "20230315123456Z"), tlv(0x18u, "20230315123456.789Z"),
+		tlv(0x18u, "19991231235959.123456Z") };
+}
+
+template<typename>
+using int64_value = std::int64_t;
+template<typename>
+using string_value = std::string;
+template<typename>
+using u16string_value = std::u16string;
+template<typename>
+using oid_vector_value = asn1::decoded_object_identifier<std::vector<std::uint32_t>>;
+template<typename>
+using inline_oid_value = asn1::decoded_object_identifier<asn1::inline_oid<32>>;
+template<typename ByteType>
+using bit_string_span_value = asn1::bit_string<std::span<const ByteType>>;
+template<typename ByteType>
+using bit_string_vector_value = asn1::bit_string<std::vector<ByteType>>;
+template<typename>
+using utc_time_value = asn1::utc_time;
+template<typename>
+using generalized_time_value = asn1::generalized_time;
+template<typename>
+using sys_microseconds_value = std::chrono::sys_time<std::chrono::microseconds>;
+
+using utc_time_spec = asn1::spec::utc_time<
+	asn1::opts::options<asn1::opts::zero_year<2000u>>>;
+
+[[maybe_unused]] const bool registered = [] {
+	const auto integer_corpus = integers();
+	register_decode<asn1::spec::integer<>, int64_value>("integer/int64", integer_corpus);
+	register_decode<asn1::spec::integer<>, span_value>("integer/span", integer_corpus);
+	register_decode<asn1::spec::integer<>, vector_value>("integer/vector", integer_corpus);
+
+	const auto oid_corpus = object_identifiers();
+	register_decode<asn1::spec::object_identifier<>, span_value>(
+		"object_identifier/span", oid_corpus);
+	register_decode<asn1::spec::object_identifier<>, oid_vector_value>(
+		"object_identifier/vector", oid_corpus);
+	register_decode<asn1::spec::object_identifier<>, inline_oid_value>(
+		"object_identifier/inline_oid", oid_corpus);
+
+	const auto printable_corpus = printable_strings();
+	register_decode<asn1::spec::printable_string<>, span_value>(
+		"printable_string/span", printable_corpus);
+	register_decode<asn1::spec::printable_string<>, string_value>(
+		"printable_string/string", printable_corpus);
+
+	const auto utf8_corpus = utf8_strings();
+	register_decode<asn1::spec::utf8_string<>, span_value>("utf8_string/span", utf8_corpus);
+	register_decode<asn1::spec::utf8_string<>, string_value>("utf8_string/string", utf8_corpus);
+
+	const auto ia5_corpus = ia5_strings();
+	register_decode<asn1::spec::ia5_string<>, span_value>("ia5_string/span", ia5_corpus);
+	register_decode<asn1::spec::ia5_string<>, string_value>("ia5_string/string", ia5_corpus);
+
+	const auto bmp_corpus = bmp_strings();
+	register_decode<asn1::spec::bmp_string<>, span_value>("bmp_string/span", bmp_corpus);
+	register_decode<asn1::spec::bmp_string<>, u16string_value>(
+		"bmp_string/u16string", bmp_corpus);
+	register_decode<asn1::spec::bmp_string<>, string_value>("bmp_string/utf8", bmp_corpus);
+
+	const auto octet_corpus = octet_strings();
+	register_decode<asn1::spec::octet_string<>, span_value>("octet_string/span", octet_corpus);
+	register_decode<asn1::spec::octet_string<>, vector_value>(
+		"octet_string/vector", octet_corpus);
+
+	const auto bit_corpus = bit_strings();
+	register_decode<asn1::spec::bit_string<>, bit_string_span_value>(
+		"bit_string/span", bit_corpus);
+	register_decode<asn1::spec::bit_string<>, bit_string_vector_value>(
+		"bit_string/vector", bit_corpus);
+
+	const auto utc_corpus = utc_times();
+	register_decode<utc_time_spec, utc_time_value>("utc_time/struct", utc_corpus);
+	register_decode<utc_time_spec, sys_microseconds_value>("utc_time/sys_time", utc_corpus);
+
+	const auto generalized_corpus = generalized_times();
+	register_decode<asn1::spec::generalized_time<>, generalized_time_value>(
+		"generalized_time/struct", generalized_corpus);
+	register_decode<asn1::spec::generalized_time<>, sys_microseconds_value>(
+		"generalized_time/sys_time", generalized_corpus);
+	return true;
+}();
+} //namespace
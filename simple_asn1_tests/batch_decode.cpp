@@ -0,0 +1,345 @@
+// SPDX-License-Identifier: MIT
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <mutex>
+#include <set>
+#include <span>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+#include "simple_asn1/der_batch_decode.h"
+#include "simple_asn1/der_decode.h"
+#include "simple_asn1/der_encode.h"
+#include "simple_asn1/spec.h"
+
+using namespace testing;
+
+namespace
+{
+using integers_spec = asn1::spec::sequence_of<asn1::spec::integer<>>;
+
+//Item i is SEQUENCE OF { i, i + 1, ... } with i % 5 elements,
+//every seventh item is truncated
+std::vector<std::vector<std::uint8_t>> create_items(std::size_t count)
+{
+	std::vector<std::vector<std::uint8_t>> result;
+	for (std::size_t i = 0; i != count; ++i)
+	{
+		std::vector<std::int32_t> value;
+		for (std::size_t j = 0; j != i % 5u; ++j)
+			value.emplace_back(static_cast<std::int32_t>(i + j));
+
+		auto& item = result.emplace_back(asn1::der::encode<integers_spec>(value));
+		if (i % 7u == 3u)
+			item.pop_back();
+	}
+	return result;
+}
+
+std::vector<std::span<const std::uint8_t>> to_spans(
+	const std::vector<std::vector<std::uint8_t>>& items)
+{
+	return { items.begin(), items.end() };
+}
+
+template<typename Outputs>
+void check_results(const std::vector<asn1::decode_error>& errors, const Outputs& outputs)
+{
+	for (std::size_t i = 0; i != errors.size(); ++i)
+	{
+		if (i % 7u == 3u)
+		{
+			EXPECT_NE(errors[i].code, asn1::decode_errc::none) << i;
+			continue;
+		}
+
+		ASSERT_EQ(errors[i].code, asn1::decode_errc::none) << i;
+		ASSERT_EQ(outputs[i].size(), i % 5u) << i;
+		for (std::size_t j = 0; j != outputs[i].size(); ++j)
+			EXPECT_EQ(outputs[i][j], static_cast<std::int32_t>(i + j));
+	}
+}
+} //namespace
+
+TEST(DecodeBatch, Sequential)
+{
+	const auto items = create_items(30u);
+	std::vector<std::vector<std::int32_t>> outputs(items.size(), { -1 });
+	asn1::sequential_executor executor;
+	auto errors = asn1::der::decode_batch<integers_spec>(to_spans(items), outputs, executor);
+	ASSERT_EQ(errors.size(), items.size());
+	check_results(errors, outputs);
+	EXPECT_EQ(errors[3].code, asn1::decode_errc::invalid_header);
+}
+
+TEST(DecodeBatch, UnconsumedData)
+{
+	const std::vector<std::vector<std::uint8_t>> items{
+		{ 0x30u, 0x03u, 0x02u, 0x01u, 0x05u, 0x00u },
+		{ 0x30u, 0x03u, 0x02u, 0x01u, 0x05u }
+	};
+	std::vector<std::vector<std::int32_t>> outputs(items.size());
+	asn1::sequential_executor executor;
+	auto errors = asn1::der::decode_batch<integers_spec>(items, outputs, executor);
+	EXPECT_EQ(errors[0].code, asn1::decode_errc::unconsumed_data);
+	EXPECT_EQ(errors[0].offset, 5u);
+	EXPECT_EQ(errors[1].code, asn1::decode_errc::none);
+	EXPECT_EQ(outputs[1], (std::vector<std::int32_t>{ 5 }));
+}
+
+TEST(DecodeBatch, ThreadPool)
+{
+	const auto items = create_items(1000u);
+	std::vector<std::vector<std::int32_t>> outputs(items.size());
+	asn1::thread_pool_executor executor(4u);
+	EXPECT_EQ(executor.concurrency(), 4u);
+	for (int run = 0; run != 3; ++run)
+	{
+		auto errors = asn1::der::decode_batch<integers_spec>(to_spans(items), outputs, executor);
+		ASSERT_EQ(errors.size(), items.size());
+		check_results(errors, outputs);
+	}
+}
+
+TEST(DecodeBatch, Arenas)
+{
+	const auto items = create_items(200u);
+	asn1::thread_pool_executor executor(3u);
+	//Arenas must outlive the decoded values
+	asn1::batch_arenas arenas(executor.concurrency());
+	std::vector<std::pmr::vector<std::int32_t>> outputs(items.size());
+	auto errors = asn1::der::decode_batch<integers_spec>(
+		to_spans(items), outputs, executor, &arenas);
+	check_results(errors, outputs);
+
+	for (std::size_t i = 0; i != outputs.size(); ++i)
+	{
+		if (i % 7u == 3u || outputs[i].empty())
+			continue;
+
+		auto resource = outputs[i].get_allocator().resource();
+		EXPECT_TRUE(resource == arenas[0] || resource == arenas[1] || resource == arenas[2]) << i;
+	}
+}
+
+TEST(DecodeBatch, InvalidArguments)
+{
+	const auto items = create_items(10u);
+	asn1::thread_pool_executor executor(3u);
+	asn1::batch_arenas arenas(executor.concurrency() - 1u);
+	std::vector<std::vector<std::int32_t>> outputs(items.size());
+	EXPECT_THROW((void)asn1::der::decode_batch<integers_spec>(
+		to_spans(items), outputs, executor, &arenas), std::invalid_argument);
+
+	outputs.pop_back();
+	EXPECT_THROW((void)asn1::der::decode_batch<integers_spec>(
+		to_spans(items), outputs, executor), std::invalid_argument);
+}
+
+TEST(DecodeBatch, Empty)
+{
+	std::vector<std::span<const std::uint8_t>> inputs;
+	std::vector<std::vector<std::int32_t>> outputs;
+	asn1::thread_pool_executor executor(2u);
+	EXPECT_TRUE(asn1::der::decode_batch<integers_spec>(inputs, outputs, executor).empty());
+}
+
+TEST(ThreadPoolExecutor, EveryIndexOnce)
+{
+	asn1::thread_pool_executor executor(4u);
+	std::vector<std::atomic<int>> calls(10007u);
+	std::atomic<bool> bad_worker{};
+	executor.bulk(calls.size(), [&](std::size_t worker, std::size_t index) {
+		if (worker >= executor.concurrency())
+			bad_worker = true;
+		++calls[index];
+	});
+	EXPECT_FALSE(bad_worker);
+	EXPECT_TRUE(std::ranges::all_of(calls, [](const auto& count) { return count == 1; }));
+}
+
+TEST(ThreadPoolExecutor, Exception)
+{
+	asn1::thread_pool_executor executor(4u);
+	EXPECT_THROW(executor.bulk(1000u, [](std::size_t, std::size_t index) {
+		if (index == 500u)
+			throw std::runtime_error("Test");
+	}), std::runtime_error);
+
+	std::atomic<std::size_t> calls{};
+	executor.bulk(100u, [&calls](std::size_t, std::size_t) { ++calls; });
+	EXPECT_EQ(calls, 100u);
+}
+
+namespace
+{
+using parallel_options = asn1::opts::options<asn1::opts::parallel_decode<64u, 4u>>;
+using parallel_spec = asn1::spec::sequence_of_with_options<parallel_options, integers_spec>;
+using serial_spec = asn1::spec::sequence_of<integers_spec>;
+using lists_type = std::vector<std::vector<std::int32_t>>;
+
+std::vector<std::uint8_t> create_lists(std::size_t count)
+{
+	lists_type value;
+	for (std::size_t i = 0; i != count; ++i)
+	{
+		auto& list = value.emplace_back();
+		for (std::size_t j = 0; j != i % 6u; ++j)
+			list.emplace_back(static_cast<std::int32_t>(i * 1000u + j) - 100000);
+	}
+	return asn1::der::encode<serial_spec>(value);
+}
+
+//Returns the offset of the element with the index in the top-level SEQUENCE OF
+std::size_t element_offset(const std::vector<std::uint8_t>& der, std::size_t index)
+{
+	//Top-level header has a long form length, elements have short form ones
+	std::size_t offset = 2u + (der[1] & 0x7fu);
+	for (; index; --index)
+		offset += 2u + der[offset + 1u];
+	return offset;
+}
+
+struct thread_recorder
+{
+	inline static std::mutex mutex;
+	inline static std::set<std::thread::id> ids;
+
+	template<typename Value>
+	bool operator()(const Value&) const
+	{
+		std::lock_guard lock(mutex);
+		ids.insert(std::this_thread::get_id());
+		return true;
+	}
+};
+
+template<std::size_t MinElements>
+using recorded_spec = asn1::spec::sequence_of_with_options<
+	asn1::opts::options<asn1::opts::parallel_decode<MinElements, 4u>>,
+	asn1::spec::sequence_of_with_options<
+		asn1::opts::options<asn1::opts::validator<thread_recorder>>,
+		asn1::spec::integer<>>>;
+} //namespace
+
+TEST(ParallelSequenceOf, SameAsSerial)
+{
+	const auto der = create_lists(5000u);
+	ASSERT_GT(der[1], 0x80u);
+	lists_type serial, parallel{ { 1, 2 } };
+	asn1::der::decode<serial_spec>(der.begin(), der.end(), serial);
+	asn1::der::decode<parallel_spec>(der.begin(), der.end(), parallel);
+	ASSERT_EQ(parallel.size(), serial.size() + 1u);
+	EXPECT_EQ(parallel.front(), (std::vector<std::int32_t>{ 1, 2 }));
+	EXPECT_TRUE(std::equal(serial.begin(), serial.end(), parallel.begin() + 1));
+
+	std::vector<lists_type> nested_serial, nested_parallel;
+	const auto nested_der = asn1::der::encode<asn1::spec::sequence_of<serial_spec>>(
+		std::vector<lists_type>(3u, serial));
+	asn1::der::decode<asn1::spec::sequence_of<serial_spec>>(
+		nested_der.data(), nested_der.data() + nested_der.size(), nested_serial);
+	asn1::der::decode<asn1::spec::sequence_of<parallel_spec>>(
+		nested_der.data(), nested_der.data() + nested_der.size(), nested_parallel);
+	EXPECT_EQ(nested_parallel, nested_serial);
+}
+
+TEST(ParallelSequenceOf, FirstErrorInDocumentOrder)
+{
+	auto der = create_lists(5000u);
+	//Unexpected tags of two elements
+	der[element_offset(der, 4321u)] = 0x31u;
+	der[element_offset(der, 1234u)] = 0x31u;
+
+	lists_type serial, parallel;
+	auto serial_result = asn1::der::try_decode<serial_spec>(der.begin(), der.end(), serial);
+	auto parallel_result = asn1::der::try_decode<parallel_spec>(
+		der.begin(), der.end(), parallel);
+	ASSERT_FALSE(serial_result);
+	ASSERT_FALSE(parallel_result);
+	EXPECT_EQ(parallel_result.error().code, asn1::decode_errc::unexpected_tag);
+	//After the element header
+	EXPECT_EQ(parallel_result.error().offset, element_offset(der, 1234u) + 2u);
+	EXPECT_EQ(parallel_result.error().offset, serial_result.error().offset);
+	EXPECT_STREQ(parallel_result.error().message, serial_result.error().message);
+	EXPECT_EQ(parallel_result.error().context.data(), serial_result.error().context.data());
+	EXPECT_EQ(parallel, serial);
+
+	try
+	{
+		asn1::der::decode<parallel_spec>(der.begin(), der.end(), parallel);
+		FAIL();
+	}
+	catch (const asn1::parse_error& e)
+	{
+		EXPECT_EQ(e.get_offset(), element_offset(der, 1234u) + 2u);
+	}
+}
+
+TEST(ParallelSequenceOf, ElementCount)
+{
+	const auto der = create_lists(100u);
+	using limited_spec = asn1::spec::sequence_of_with_options<
+		asn1::opts::options<asn1::opts::parallel_decode<64u, 4u>,
+			asn1::opts::min_max_elements<1u, 99u>>,
+		integers_spec>;
+	lists_type value;
+	auto result = asn1::der::try_decode<limited_spec>(der.begin(), der.end(), value);
+	ASSERT_FALSE(result);
+	EXPECT_EQ(result.error().code, asn1::decode_errc::element_count);
+	EXPECT_EQ(value.size(), 99u);
+}
+
+TEST(ParallelSequenceOf, CountAndReserve)
+{
+	using reserved_spec = asn1::spec::sequence_of_with_options<
+		asn1::opts::options<asn1::opts::parallel_decode<64u, 4u>,
+			asn1::opts::count_and_reserve>,
+		integers_spec>;
+	lists_type serial;
+	for (std::size_t count : { 5000u, 50u })
+	{
+		const auto der = create_lists(count);
+		asn1::der::decode<serial_spec>(der.begin(), der.end(), serial);
+		lists_type value;
+		asn1::der::decode<reserved_spec>(der.begin(), der.end(), value);
+		EXPECT_EQ(value, serial);
+		EXPECT_EQ(value.capacity(), count);
+		serial.clear();
+	}
+}
+
+TEST(ParallelSequenceOf, Threshold)
+{
+	const auto der = create_lists(100u);
+	thread_recorder::ids.clear();
+	std::vector<std::vector<std::int32_t>> value;
+	asn1::der::decode<recorded_spec<101u>>(der.begin(), der.end(), value);
+	EXPECT_EQ(value.size(), 100u);
+	EXPECT_THAT(thread_recorder::ids, ElementsAre(std::this_thread::get_id()));
+
+	thread_recorder::ids.clear();
+	value.clear();
+	asn1::der::decode<recorded_spec<100u>>(der.begin(), der.end(), value);
+	EXPECT_EQ(value.size(), 100u);
+	EXPECT_THAT(thread_recorder::ids, SizeIs(Le(4u)));
+}
+
+TEST(ParallelSequenceOf, MemoryResource)
+{
+	const auto der = create_lists(200u);
+	thread_recorder::ids.clear();
+	std::pmr::monotonic_buffer_resource arena;
+	asn1::decode_state state(der.begin(), der.end(), &arena);
+	std::pmr::vector<std::pmr::vector<std::int32_t>> value;
+	asn1::der::decode<recorded_spec<64u>>(state, value);
+	EXPECT_EQ(value.size(), 200u);
+	EXPECT_THAT(thread_recorder::ids, ElementsAre(std::this_thread::get_id()));
+}
@@ -0,0 +1,522 @@
+// SPDX-License-Identifier: MIT
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <optional>
+#include <span>
+#include <string>
+#include <variant>
+#include <vector>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+#include "simple_asn1/der_decode.h"
+#include "simple_asn1/der_encode.h"
+#include "simple_asn1/spec.h"
+#include "simple_asn1/types.h"
+
+using namespace testing;
+
+namespace
+{
+template<typename Spec, typename T>
+T decode_encoded(const std::vector<std::uint8_t>& encoded)
+{
+	T result{};
+	auto end = asn1::der::decode<Spec>(encoded.cbegin(), encoded.cend(), result);
+	EXPECT_EQ(end, encoded.cend());
+	return result;
+}
+} //namespace
+
+TEST(DerEncode, Integer)
+{
+	EXPECT_THAT(asn1::der::encode<asn1::spec::integer<>>(0),
+		ElementsAre(0x02u, 0x01u, 0x00u));
+	EXPECT_THAT(asn1::der::encode<asn1::spec::integer<>>(127),
+		ElementsAre(0x02u, 0x01u, 0x7fu));
+	EXPECT_THAT(asn1::der::encode<asn1::spec::integer<>>(128),
+		ElementsAre(0x02u, 0x02u, 0x00u, 0x80u));
+	EXPECT_THAT(asn1::der::encode<asn1::spec::integer<>>(-128),
+		ElementsAre(0x02u, 0x01u, 0x80u));
+	EXPECT_THAT(asn1::der::encode<asn1::spec::integer<>>(-129),
+		ElementsAre(0x02u, 0x02u, 0xffu, 0x7fu));
+	EXPECT_THAT(asn1::der::encode<asn1::spec::integer<>>(std::int64_t{ -1 }),
+		ElementsAre(0x02u, 0x01u, 0xffu));
+}
+
+TEST(DerEncode, IntegerRoundTrip)
+{
+	for (std::int64_t value : { 0ll, 1ll, -1ll, 255ll, 256ll, -256ll, -257ll,
+		0x7fffffffffffffffll, -0x7fffffffffffffffll - 1 })
+	{
+		auto encoded = asn1::der::encode<asn1::spec::integer<>>(value);
+		EXPECT_EQ(encoded.size(), asn1::der::encoded_size<asn1::spec::integer<>>(value));
+		EXPECT_EQ((decode_encoded<asn1::spec::integer<>, std::int64_t>(encoded)), value);
+	}
+}
+
+TEST(DerEncode, LongLength)
+{
+	std::vector<std::uint8_t> value(300u, 0xabu);
+	auto encoded = asn1::der::encode<asn1::spec::octet_string<>>(value);
+	ASSERT_EQ(encoded.size(), 304u);
+	EXPECT_THAT(std::vector(encoded.begin(), encoded.begin() + 4),
+		ElementsAre(0x04u, 0x82u, 0x01u, 0x2cu));
+	EXPECT_EQ((decode_encoded<asn1::spec::octet_string<>, std::vector<std::uint8_t>>(encoded)),
+		value);
+}
+
+TEST(DerEncode, BooleanAndNull)
+{
+	EXPECT_THAT(asn1::der::encode<asn1::spec::boolean<>>(true),
+		ElementsAre(0x01u, 0x01u, 0xffu));
+	EXPECT_THAT(asn1::der::encode<asn1::spec::null<>>(nullptr),
+		ElementsAre(0x05u, 0x00u));
+	static_assert(asn1::der::fixed_encoded_size<asn1::spec::boolean<>, bool>() == 3u);
+	static_assert(asn1::der::fixed_encoded_size<asn1::spec::null<>, std::nullptr_t>() == 2u);
+	static_assert(!asn1::der::fixed_encoded_size<asn1::spec::integer<>, int>());
+}
+
+TEST(DerEncode, Tagged)
+{
+	using explicit_spec = asn1::spec::tagged<3u, asn1::spec::encoding::expl,
+		asn1::spec::cls::context_specific, asn1::spec::boolean<>>;
+	using implicit_spec = asn1::spec::tagged<3u, asn1::spec::encoding::impl,
+		asn1::spec::cls::context_specific, asn1::spec::boolean<>>;
+	EXPECT_THAT(asn1::der::encode<explicit_spec>(true),
+		ElementsAre(0xa3u, 0x03u, 0x01u, 0x01u, 0xffu));
+	EXPECT_THAT(asn1::der::encode<implicit_spec>(true),
+		ElementsAre(0x83u, 0x01u, 0xffu));
+	static_assert(asn1::der::fixed_encoded_size<explicit_spec, bool>() == 5u);
+}
+
+TEST(DerEncode, HighTagNumbers)
+{
+	using explicit_spec = asn1::spec::tagged<100u, asn1::spec::encoding::expl,
+		asn1::spec::cls::application, asn1::spec::boolean<>>;
+	using implicit_spec = asn1::spec::tagged<1000u, asn1::spec::encoding::impl,
+		asn1::spec::cls::context_specific, asn1::spec::boolean<>>;
+	EXPECT_THAT(asn1::der::encode<explicit_spec>(true),
+		ElementsAre(0x7fu, 0x64u, 0x03u, 0x01u, 0x01u, 0xffu));
+	EXPECT_THAT(asn1::der::encode<implicit_spec>(true),
+		ElementsAre(0x9fu, 0x87u, 0x68u, 0x01u, 0xffu));
+	static_assert(asn1::der::fixed_encoded_size<explicit_spec, bool>() == 6u);
+	static_assert(asn1::der::fixed_encoded_size<implicit_spec, bool>() == 5u);
+	EXPECT_TRUE((decode_encoded<implicit_spec, bool>(
+		asn1::der::encode<implicit_spec>(true))));
+}
+
+TEST(DerEncode, Oid)
+{
+	using oid_type = asn1::decoded_object_identifier<std::vector<std::uint32_t>>;
+	oid_type oid{ { 1u, 2u, 840u, 113549u, 1u, 1u, 11u } };
+	auto encoded = asn1::der::encode<asn1::spec::object_identifier<>>(oid);
+	constexpr auto expected = asn1::encode_oid<1u, 2u, 840u, 113549u, 1u, 1u, 11u>();
+	ASSERT_EQ(encoded.size(), expected.size() + 2u);
+	EXPECT_TRUE(std::equal(expected.begin(), expected.end(), encoded.begin() + 2));
+	EXPECT_EQ((decode_encoded<asn1::spec::object_identifier<>, oid_type>(encoded)), oid);
+
+	EXPECT_THROW((asn1::der::encode<asn1::spec::object_identifier<>>(oid_type{ { 1u } })),
+		asn1::encode_error);
+	EXPECT_THROW((asn1::der::encode<asn1::spec::object_identifier<>>(oid_type{ { 1u, 40u } })),
+		asn1::encode_error);
+}
+
+TEST(DerEncode, BitString)
+{
+	asn1::bit_string<std::vector<std::uint8_t>> value{ { 0xa0u, 0x80u }, 9u };
+	auto encoded = asn1::der::encode<asn1::spec::bit_string<>>(value);
+	EXPECT_THAT(encoded, ElementsAre(0x03u, 0x03u, 0x07u, 0xa0u, 0x80u));
+	EXPECT_EQ((decode_encoded<asn1::spec::bit_string<>, decltype(value)>(encoded)), value);
+
+	value.bit_count = 17u;
+	EXPECT_THROW(asn1::der::encode<asn1::spec::bit_string<>>(value), asn1::encode_error);
+}
+
+TEST(DerEncode, Strings)
+{
+	EXPECT_THAT(asn1::der::encode<asn1::spec::printable_string<>>(std::string("ab")),
+		ElementsAre(0x13u, 0x02u, 'a', 'b'));
+	EXPECT_THAT(asn1::der::encode<asn1::spec::bmp_string<>>(std::u16string(u"\x0102")),
+		ElementsAre(0x1eu, 0x02u, 0x01u, 0x02u));
+	EXPECT_THAT(asn1::der::encode<asn1::spec::universal_string<>>(std::u32string(U"\x01020304")),
+		ElementsAre(0x1cu, 0x04u, 0x01u, 0x02u, 0x03u, 0x04u));
+
+	auto encoded = asn1::der::encode<asn1::spec::bmp_string<>>(std::u16string(u"test"));
+	EXPECT_EQ((decode_encoded<asn1::spec::bmp_string<>, std::u16string>(encoded)), u"test");
+	EXPECT_THROW(asn1::der::encode<asn1::spec::bmp_string<>>(
+		std::vector<std::uint8_t>{ 1u, 2u, 3u }), asn1::encode_error);
+}
+
+TEST(DerEncode, Time)
+{
+	asn1::utc_time utc{ 23u, 2u, 28u, 13u, 5u, 9u };
+	auto encoded = asn1::der::encode<asn1::spec::utc_time<>>(utc);
+	EXPECT_THAT(encoded, ElementsAre(0x17u, 0x0du,
+		'2', '3', '0', '2', '2', '8', '1', '3', '0', '5', '0', '9', 'Z'));
+	EXPECT_EQ((decode_encoded<asn1::spec::utc_time<>, asn1::utc_time>(encoded)), utc);
+
+	asn1::generalized_time generalized{ 2023u, 12u, 31u, 23u, 59u, 58u, 125u, 3u };
+	encoded = asn1::der::encode<asn1::spec::generalized_time<>>(generalized);
+	EXPECT_EQ(std::string(encoded.begin() + 2, encoded.end()), "20231231235958.125Z");
+	EXPECT_EQ((decode_encoded<asn1::spec::generalized_time<>,
+		asn1::generalized_time>(encoded)), generalized);
+
+	//Without the digit count, the significant digits are written
+	generalized.seconds_fraction_digits = 0u;
+	EXPECT_EQ(asn1::der::encode<asn1::spec::generalized_time<>>(generalized), encoded);
+
+	generalized.seconds_fraction_digits = 2u;
+	EXPECT_THROW(asn1::der::encode<asn1::spec::generalized_time<>>(generalized),
+		asn1::encode_error);
+
+	//More than 19 fraction digits
+	generalized.seconds_fraction = 10000000000000000001ull;
+	for (std::uint8_t digits : { 0u, 19u, 20u })
+	{
+		generalized.seconds_fraction_digits = digits;
+		EXPECT_THROW(asn1::der::encode<asn1::spec::generalized_time<>>(generalized),
+			asn1::encode_error);
+	}
+}
+
+TEST(DerEncode, InvalidDateTime)
+{
+	for (const auto& value : {
+		asn1::utc_time{ 20u, 113u, 1u, 0u, 0u, 0u },
+		asn1::utc_time{ 20u, 0u, 1u, 0u, 0u, 0u },
+		asn1::utc_time{ 20u, 4u, 31u, 0u, 0u, 0u },
+		asn1::utc_time{ 20u, 1u, 0u, 0u, 0u, 0u },
+		asn1::utc_time{ 20u, 1u, 1u, 24u, 0u, 0u },
+		asn1::utc_time{ 20u, 1u, 1u, 0u, 60u, 0u },
+		asn1::utc_time{ 20u, 1u, 1u, 0u, 0u, 60u } })
+	{
+		EXPECT_THROW(asn1::der::encode<asn1::spec::utc_time<>>(value), asn1::encode_error);
+	}
+
+	EXPECT_THROW(asn1::der::encode<asn1::spec::utc_time<>>(
+		asn1::utc_time{ 23u, 2u, 29u, 0u, 0u, 0u }), asn1::encode_error);
+	EXPECT_NO_THROW(asn1::der::encode<asn1::spec::utc_time<>>(
+		asn1::utc_time{ 24u, 2u, 29u, 0u, 0u, 0u }));
+	//The century is unknown without the zero_year option
+	EXPECT_NO_THROW(asn1::der::encode<asn1::spec::utc_time<asn1::opts::options<>>>(
+		asn1::utc_time{ 23u, 2u, 29u, 0u, 0u, 0u }));
+
+	EXPECT_THROW(asn1::der::encode<asn1::spec::generalized_time<>>(
+		asn1::generalized_time{ 2023u, 2u, 29u, 0u, 0u, 0u }), asn1::encode_error);
+	EXPECT_NO_THROW(asn1::der::encode<asn1::spec::generalized_time<>>(
+		asn1::generalized_time{ 2024u, 2u, 29u, 0u, 0u, 0u }));
+	EXPECT_THROW(asn1::der::encode<asn1::spec::generalized_time<>>(
+		asn1::generalized_time{ 2023u, 107u, 1u, 0u, 0u, 0u }), asn1::encode_error);
+}
+
+TEST(DerEncode, InvalidValueKeepsOutput)
+{
+	using spec = asn1::spec::sequence<
+		asn1::spec::integer<>,
+		asn1::spec::utc_time<>,
+		asn1::spec::bit_string<>>;
+	struct value_type
+	{
+		std::int32_t number;
+		asn1::utc_time time;
+		asn1::bit_string<std::vector<std::uint8_t>> bits;
+	};
+
+	const std::vector<std::uint8_t> prefix{ 1u, 2u, 3u };
+	auto out = prefix;
+	value_type value{ 5, { 123u, 1u, 1u, 0u, 0u, 0u }, { { 0xffu }, 8u } };
+	EXPECT_THROW(asn1::der::encode<spec>(value, out), asn1::encode_error);
+	EXPECT_EQ(out, prefix);
+
+	value.time.year = 23u;
+	value.bits.bit_count = 9u;
+	EXPECT_THROW(asn1::der::encode<spec>(value, out), asn1::encode_error);
+	EXPECT_EQ(out, prefix);
+
+	EXPECT_THROW(asn1::der::encode<asn1::spec::generalized_time<>>(
+		asn1::generalized_time{ 10000u, 1u, 1u, 0u, 0u, 0u }, out), asn1::encode_error);
+	EXPECT_EQ(out, prefix);
+}
+
+TEST(DerEncode, GeneralizedTimeLeadingZeroFraction)
+{
+	const std::string time = "20230101000000.05Z";
+	std::vector<std::uint8_t> encoded{ 0x18u, static_cast<std::uint8_t>(time.size()) };
+	encoded.insert(encoded.end(), time.begin(), time.end());
+
+	auto decoded = decode_encoded<asn1::spec::generalized_time<>, asn1::generalized_time>(encoded);
+	EXPECT_EQ(decoded.seconds_fraction, 5u);
+	EXPECT_EQ(decoded.seconds_fraction_digits, 2u);
+	EXPECT_EQ(asn1::der::encode<asn1::spec::generalized_time<>>(decoded), encoded);
+
+	//".05" is less than ".5", but equal to ".050"
+	EXPECT_LT(decoded, (asn1::generalized_time{ 2023u, 1u, 1u, 0u, 0u, 0u, 5u }));
+	EXPECT_EQ(decoded, (asn1::generalized_time{ 2023u, 1u, 1u, 0u, 0u, 0u, 50u, 3u }));
+}
+
+namespace
+{
+using sequence_spec = asn1::spec::sequence<
+	asn1::spec::integer<>,
+	asn1::spec::optional<asn1::spec::boolean<>>,
+	asn1::spec::optional_default<asn1::spec::default_value<5>,
+		asn1::spec::tagged<0u, asn1::spec::encoding::expl,
+			asn1::spec::cls::context_specific, asn1::spec::integer<>>>,
+	asn1::spec::sequence_of<asn1::spec::octet_string<>>,
+	asn1::spec::choice<asn1::spec::null<>, asn1::spec::ia5_string<>>
+>;
+
+struct sequence_type
+{
+	std::int32_t number{};
+	std::optional<bool> flag;
+	std::int32_t with_default{};
+	std::vector<std::vector<std::uint8_t>> strings;
+	std::variant<std::nullptr_t, std::string> choice;
+
+	bool operator==(const sequence_type&) const = default;
+};
+} //namespace
+
+TEST(DerEncode, SequenceRoundTrip)
+{
+	sequence_type value{ 300, std::nullopt, 5, { { 1u, 2u }, {} }, std::string("text") };
+	auto encoded = asn1::der::encode<sequence_spec>(value);
+	EXPECT_THAT(encoded, ElementsAre(0x30u, 0x12u,
+		0x02u, 0x02u, 0x01u, 0x2cu,
+		0x30u, 0x06u, 0x04u, 0x02u, 0x01u, 0x02u, 0x04u, 0x00u,
+		0x16u, 0x04u, 't', 'e', 'x', 't'));
+	EXPECT_EQ((decode_encoded<sequence_spec, sequence_type>(encoded)), value);
+
+	value.flag = false;
+	value.with_default = 7;
+	value.choice = nullptr;
+	encoded = asn1::der::encode<sequence_spec>(value);
+	EXPECT_EQ(encoded.size(), asn1::der::encoded_size<sequence_spec>(value));
+	EXPECT_EQ((decode_encoded<sequence_spec, sequence_type>(encoded)), value);
+}
+
+TEST(DerEncode, SetCanonicalOrder)
+{
+	using set_spec = asn1::spec::set<
+		asn1::spec::null<>,
+		asn1::spec::boolean<>,
+		asn1::spec::integer<>>;
+	struct set_type
+	{
+		std::nullptr_t null;
+		bool flag{};
+		std::int32_t number{};
+
+		bool operator==(const set_type&) const = default;
+	};
+
+	set_type value{ nullptr, true, 1 };
+	auto encoded = asn1::der::encode<set_spec>(value);
+	EXPECT_THAT(encoded, ElementsAre(0x31u, 0x08u,
+		0x01u, 0x01u, 0xffu, 0x02u, 0x01u, 0x01u, 0x05u, 0x00u));
+	EXPECT_EQ((decode_encoded<set_spec, set_type>(encoded)), value);
+}
+
+TEST(DerEncode, SetCanonicalOrderHighTags)
+{
+	using set_spec = asn1::spec::set<
+		asn1::spec::tagged<200u, asn1::spec::encoding::impl,
+			asn1::spec::cls::context_specific, asn1::spec::integer<>>,
+		asn1::spec::tagged<31u, asn1::spec::encoding::impl,
+			asn1::spec::cls::context_specific, asn1::spec::integer<>>,
+		asn1::spec::tagged<2u, asn1::spec::encoding::impl,
+			asn1::spec::cls::application, asn1::spec::integer<>>,
+		asn1::spec::tagged<5u, asn1::spec::encoding::impl,
+			asn1::spec::cls::context_specific, asn1::spec::boolean<>>>;
+	struct set_type
+	{
+		std::int32_t v200{};
+		std::int32_t v31{};
+		std::int32_t application2{};
+		bool v5{};
+
+		bool operator==(const set_type&) const = default;
+	};
+
+	set_type value{ 3, 2, 1, true };
+	auto encoded = asn1::der::encode<set_spec>(value);
+	EXPECT_THAT(encoded, ElementsAre(0x31u, 0x0fu,
+		0x42u, 0x01u, 0x01u,
+		0x85u, 0x01u, 0xffu,
+		0x9fu, 0x1fu, 0x01u, 0x02u,
+		0x9fu, 0x81u, 0x48u, 0x01u, 0x03u));
+	EXPECT_EQ((decode_encoded<set_spec, set_type>(encoded)), value);
+}
+
+TEST(DerEncode, SetVariableLengthFields)
+{
+	using set_spec = asn1::spec::set<
+		asn1::spec::tagged<1u, asn1::spec::encoding::impl,
+			asn1::spec::cls::context_specific,
+			asn1::spec::sequence_of<asn1::spec::octet_string<>>>,
+		asn1::spec::tagged<0u, asn1::spec::encoding::expl,
+			asn1::spec::cls::context_specific,
+			asn1::spec::sequence<asn1::spec::octet_string<>>>>;
+	struct inner_type
+	{
+		std::vector<std::uint8_t> data;
+
+		bool operator==(const inner_type&) const = default;
+	};
+	struct set_type
+	{
+		std::vector<std::vector<std::uint8_t>> list;
+		inner_type inner;
+
+		bool operator==(const set_type&) const = default;
+	};
+
+	set_type value{ { std::vector<std::uint8_t>(100u, 1u), std::vector<std::uint8_t>(10u, 2u) },
+		{ { 3u, 4u, 5u, 6u, 7u, 8u } } };
+	auto encoded = asn1::der::encode<set_spec>(value);
+	EXPECT_EQ(encoded.size(), asn1::der::encoded_size<set_spec>(value));
+	EXPECT_THAT(std::vector(encoded.begin(), encoded.begin() + 17), ElementsAre(
+		0x31u, 0x81u, 0x80u,
+		0xa0u, 0x0au, 0x30u, 0x08u, 0x04u, 0x06u, 0x03u, 0x04u, 0x05u, 0x06u, 0x07u, 0x08u,
+		0xa1u, 0x72u));
+	EXPECT_EQ((decode_encoded<set_spec, set_type>(encoded)), value);
+
+	std::vector<std::uint8_t> inserted;
+	asn1::der::encode<set_spec>(value, std::back_inserter(inserted));
+	EXPECT_EQ(inserted, encoded);
+}
+
+TEST(DerEncode, SetOfSortedElements)
+{
+	using set_of_spec = asn1::spec::set_of<asn1::spec::integer<>>;
+	std::vector<std::int32_t> value{ 300, 5, -1, 127 };
+	EXPECT_THAT(asn1::der::encode<set_of_spec>(value), ElementsAre(0x31u, 0x0du,
+		0x02u, 0x01u, 0x05u,
+		0x02u, 0x01u, 0x7fu,
+		0x02u, 0x01u, 0xffu,
+		0x02u, 0x02u, 0x01u, 0x2cu));
+}
+
+TEST(DerEncode, SetOfSortedVariableLengthElements)
+{
+	using set_of_spec = asn1::spec::set_of<
+		asn1::spec::sequence_of<asn1::spec::octet_string<>>>;
+	std::vector<std::vector<std::vector<std::uint8_t>>> value{
+		{ { 1u, 2u, 3u } }, { {} }, { { 9u }, { 8u } } };
+	auto encoded = asn1::der::encode<set_of_spec>(value);
+	EXPECT_THAT(encoded, ElementsAre(0x31u, 0x13u,
+		0x30u, 0x02u, 0x04u, 0x00u,
+		0x30u, 0x05u, 0x04u, 0x03u, 0x01u, 0x02u, 0x03u,
+		0x30u, 0x06u, 0x04u, 0x01u, 0x09u, 0x04u, 0x01u, 0x08u));
+	EXPECT_EQ(encoded.size(), asn1::der::encoded_size<set_of_spec>(value));
+
+	std::vector<std::uint8_t> inserted;
+	asn1::der::encode<set_of_spec>(value, std::back_inserter(inserted));
+	EXPECT_EQ(inserted, encoded);
+}
+
+namespace
+{
+struct linked_list_spec : asn1::spec::recursive<linked_list_spec>
+{
+	using type = asn1::spec::sequence<
+		asn1::spec::integer<>,
+		asn1::spec::optional<linked_list_spec>
+	>;
+};
+
+struct linked_list
+{
+	std::int32_t value{};
+	std::unique_ptr<linked_list> next;
+};
+} //namespace
+
+TEST(DerEncode, OpenType)
+{
+	static constexpr auto oid_integer = std::to_array<std::uint32_t>({ 1, 2, 3 });
+	using spec_type = asn1::spec::sequence<
+		asn1::spec::object_identifier<>,
+		asn1::spec::open_type<0, asn1::spec::open_type_registry<
+			asn1::spec::open_type_entry<oid_integer,
+				asn1::spec::octet_string_with<asn1::spec::integer<>>>>,
+			asn1::spec::octet_string<>>>;
+	struct value_type
+	{
+		asn1::decoded_object_identifier<std::vector<std::uint32_t>> id;
+		std::variant<std::vector<std::uint8_t>, int> value;
+	};
+
+	value_type value{ { { 1, 2, 3 } }, 5 };
+	auto encoded = asn1::der::encode<spec_type>(value);
+	EXPECT_THAT(encoded, ElementsAre(0x30u, 0x09u, 0x06u, 0x02u, 0x2au, 0x03u,
+		0x04u, 0x03u, 0x02u, 0x01u, 0x05u));
+	auto decoded = decode_encoded<spec_type, value_type>(encoded);
+	EXPECT_EQ(decoded.id, value.id);
+	EXPECT_EQ(decoded.value, value.value);
+}
+
+TEST(DerEncode, Recursive)
+{
+	linked_list list{ 1, std::make_unique<linked_list>(
+		linked_list{ 2, std::make_unique<linked_list>(linked_list{ 3, nullptr }) }) };
+	auto encoded = asn1::der::encode<linked_list_spec>(list);
+	EXPECT_EQ(encoded.size(), asn1::der::encoded_size<linked_list_spec>(list));
+
+	auto decoded = decode_encoded<linked_list_spec, linked_list>(encoded);
+	EXPECT_EQ(decoded.value, 1);
+	ASSERT_NE(decoded.next, nullptr);
+	EXPECT_EQ(decoded.next->value, 2);
+	ASSERT_NE(decoded.next->next, nullptr);
+	EXPECT_EQ(decoded.next->next->value, 3);
+	EXPECT_EQ(decoded.next->next->next, nullptr);
+}
+
+TEST(DerEncode, OutputTargets)
+{
+	std::vector<std::byte> bytes{ std::byte{ 0x11u } };
+	asn1::der::encode<asn1::spec::integer<>>(5, bytes);
+	EXPECT_THAT(bytes, ElementsAre(std::byte{ 0x11u }, std::byte{ 0x02u },
+		std::byte{ 0x01u }, std::byte{ 0x05u }));
+
+	std::vector<std::int8_t> signed_bytes;
+	asn1::der::encode<asn1::spec::boolean<>>(true, std::back_inserter(signed_bytes));
+	EXPECT_THAT(signed_bytes, ElementsAre(0x01, 0x01, -1));
+}
+
+TEST(DerEncode, WithRawData)
+{
+	std::vector<std::uint8_t> encoded{ 0x02u, 0x01u, 0x05u };
+	asn1::with_raw_data<std::vector<std::uint8_t>, std::int32_t> value;
+	asn1::der::decode<asn1::spec::integer<>>(encoded.cbegin(), encoded.cend(), value);
+	EXPECT_EQ(asn1::der::encode<asn1::spec::integer<>>(value), encoded);
+}
+
+TEST(DerEncode, Lazy)
+{
+	using lazy_type = asn1::lazy<std::vector<std::uint8_t>, std::int32_t>;
+	EXPECT_THAT(asn1::der::encode<asn1::spec::integer<>>(lazy_type(5)),
+		ElementsAre(0x02u, 0x01u, 0x05u));
+
+	std::vector<std::uint8_t> encoded{ 0x02u, 0x02u, 0x01u, 0x2cu };
+	lazy_type value;
+	asn1::der::decode<asn1::spec::integer<>>(encoded.cbegin(), encoded.cend(), value);
+	EXPECT_EQ(asn1::der::encode<asn1::spec::integer<>>(value), encoded);
+}
+
+TEST(DerEncode, SequenceOfView)
+{
+	using spec = asn1::spec::sequence_of<asn1::spec::integer<>>;
+	std::vector<std::uint8_t> encoded{ 0x30u, 0x07u,
+		0x02u, 0x02u, 0x01u, 0x2cu, 0x02u, 0x01u, 0x05u };
+	asn1::sequence_of_view<std::span<const std::uint8_t>, std::int32_t> value;
+	asn1::der::decode<spec>(encoded.data(), encoded.data() + encoded.size(), value);
+	EXPECT_EQ(asn1::der::encode<spec>(value), encoded);
+}
@@ -0,0 +1,104 @@
+// SPDX-License-Identifier: MIT
+
+#include <cstdint>
+#include <forward_list>
+#include <vector>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+#include "simple_asn1/der_index.h"
+#include "simple_asn1/spec.h"
+
+using namespace testing;
+
+namespace
+{
+constexpr auto npos = asn1::der::index_node::npos;
+
+const std::vector<std::uint8_t> nested_data{
+	0x30u, 0x0cu, //SEQUENCE
+		0x02u, 0x01u, 0x05u, //INTEGER
+		0xa0u, 0x05u, //[0]
+			0x01u, 0x01u, 0xffu, //BOOLEAN
+			0x30u, 0x00u, //SEQUENCE
+		0x05u, 0x00u, //NULL
+	0x04u, 0x01u, 0xabu //OCTET STRING
+};
+} //namespace
+
+TEST(DerIndex, Structure)
+{
+	auto index = asn1::der::build_index(nested_data.begin(), nested_data.end());
+	ASSERT_EQ(index.size(), 7u);
+
+	using node = asn1::der::index_node;
+	EXPECT_EQ(index[0], (node{ 0x30u, 0u, 2u, 12u, npos, 1u, 6u }));
+	EXPECT_EQ(index[1], (node{ 0x02u, 2u, 4u, 1u, 0u, npos, 2u }));
+	EXPECT_EQ(index[2], (node{ 0xa0u, 5u, 7u, 5u, 0u, 3u, 5u }));
+	EXPECT_EQ(index[3], (node{ 0x01u, 7u, 9u, 1u, 2u, npos, 4u }));
+	EXPECT_EQ(index[4], (node{ 0x30u, 10u, 12u, 0u, 2u, npos, npos }));
+	EXPECT_EQ(index[5], (node{ 0x05u, 12u, 14u, 0u, 0u, npos, npos }));
+	EXPECT_EQ(index[6], (node{ 0x04u, 14u, 16u, 1u, npos, npos, npos }));
+}
+
+TEST(DerIndex, DecodeNode)
+{
+	auto index = asn1::der::build_index(nested_data.begin(), nested_data.end());
+	ASSERT_EQ(index.size(), 7u);
+
+	bool flag{};
+	EXPECT_EQ(asn1::der::decode<asn1::spec::boolean<>>(
+		nested_data.begin(), index[3], flag), nested_data.begin() + index[3].end_offset());
+	EXPECT_TRUE(flag);
+
+	std::int32_t number{};
+	asn1::der::decode<asn1::spec::integer<>>(nested_data.begin(), index[1], number);
+	EXPECT_EQ(number, 5);
+}
+
+TEST(DerIndex, ReuseAndForwardIterators)
+{
+	asn1::der::index_type index;
+	asn1::der::build_index(nested_data.begin(), nested_data.end(), index);
+	auto capacity = index.capacity();
+
+	std::forward_list<std::uint8_t> list(nested_data.begin(), nested_data.end());
+	asn1::der::build_index(list.begin(), list.end(), index);
+	EXPECT_EQ(index, asn1::der::build_index(nested_data.begin(), nested_data.end()));
+	EXPECT_EQ(index.capacity(), capacity);
+
+	//The top-level element overruns the end of the list
+	list.assign(nested_data.begin(), nested_data.end() - 1);
+	EXPECT_THROW(asn1::der::build_index(list.begin(), list.end(), index), asn1::parse_error);
+}
+
+TEST(DerIndex, LongLength)
+{
+	std::vector<std::uint8_t> data{ 0x04u, 0x82u, 0x01u, 0x00u };
+	data.resize(data.size() + 0x100u);
+	auto index = asn1::der::build_index(data.begin(), data.end());
+	ASSERT_EQ(index.size(), 1u);
+	EXPECT_EQ(index[0].content_offset, 4u);
+	EXPECT_EQ(index[0].length, 0x100u);
+}
+
+TEST(DerIndex, Errors)
+{
+	std::vector<std::uint8_t> data;
+	EXPECT_TRUE(asn1::der::build_index(data.begin(), data.end()).empty());
+
+	data = { 0x30u };
+	EXPECT_THROW((void)asn1::der::build_index(data.begin(), data.end()), asn1::parse_error);
+
+	data = { 0x30u, 0x03u, 0x01u, 0x01u };
+	EXPECT_THROW((void)asn1::der::build_index(data.begin(), data.end()), asn1::parse_error);
+
+	//Child overruns the parent
+	data = { 0x30u, 0x02u, 0x04u, 0x01u, 0xffu };
+	EXPECT_THROW((void)asn1::der::build_index(data.begin(), data.end()), asn1::parse_error);
+
+	//Long form length overruns the buffer
+	data = { 0x04u, 0x82u, 0x00u, 0x01u };
+	EXPECT_THROW((void)asn1::der::build_index(data.begin(), data.end()), asn1::parse_error);
+}
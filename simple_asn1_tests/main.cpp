@@ -1,21 +1,30 @@
 // SPDX-License-Identifier: MIT
 
 #include <algorithm>
+#include <array>
+#include <chrono>
 #include <cstddef>
 #include <cstdint>
+#include <deque>
 #include <exception>
 #include <forward_list>
+#include <memory_resource>
 #include <optional>
+#include <ranges>
 #include <span>
 #include <sstream>
+#include <string>
 #include <string_view>
 #include <stdexcept>
+#include <type_traits>
+#include <variant>
 #include <vector>
 
 #include "gmock/gmock.h"
 #include "gtest/gtest.h"
 
 #include "simple_asn1/der_decode.h"
+#include "simple_asn1/oid_map.h"
 #include "simple_asn1/spec.h"
 #include "simple_asn1/types.h"
 
@@ -71,12 +80,12 @@ TYPED_TEST(Asn1TestFixture, DecodeInteger1)
 {
 	buffer_wrapper_base<typename TestFixture::byte_type, 1, 2> wrapper;
 	EXPECT_THROW(asn1::detail::decode_integer<std::int8_t>(2, wrapper.state),
-		std::runtime_error);
+		asn1::parse_error);
 
 	EXPECT_EQ(asn1::detail::decode_integer<std::int8_t>(1, wrapper.state), 1u);
 	EXPECT_EQ(asn1::detail::decode_integer<std::int8_t>(1, wrapper.state), 2u);
 	EXPECT_THROW(asn1::detail::decode_integer<std::int8_t>(1, wrapper.state),
-		std::runtime_error);
+		asn1::parse_error);
 }
 
 TYPED_TEST(Asn1TestFixture, DecodeInteger2)
@@ -92,9 +101,9 @@ TYPED_TEST(Asn1TestFixture, DecodeInteger3)
 {
 	buffer_wrapper_base<typename TestFixture::byte_type, 1, 2, 3> wrapper;
 	EXPECT_THROW(asn1::detail::decode_integer<std::int8_t>(0, wrapper.state),
-		std::runtime_error);
+		asn1::parse_error);
 	EXPECT_THROW(asn1::detail::decode_integer<std::int64_t>(8, wrapper.state),
-		std::runtime_error);
+		asn1::parse_error);
 }
 
 TYPED_TEST(Asn1TestFixture, DecodeNegativeInteger1)
@@ -129,23 +138,23 @@ TYPED_TEST(Asn1TestFixture, DecodeTypeLength1)
 {
 	buffer_wrapper_base<typename TestFixture::byte_type, 1, 2, 3> wrapper;
 	EXPECT_EQ(asn1::detail::der::decode_type_length(wrapper.state),
-		(std::pair<std::uint8_t, asn1::detail::length_type>(1, 2)));
+		(std::pair<asn1::tag_type, asn1::detail::length_type>(1, 2)));
 	EXPECT_THROW(asn1::detail::der::decode_type_length(wrapper.state),
-		std::runtime_error);
+		asn1::parse_error);
 }
 
 TYPED_TEST(Asn1TestFixture, DecodeTypeLength2)
 {
 	buffer_wrapper_base<typename TestFixture::byte_type, 1, 0xffu, 3> wrapper;
 	EXPECT_THROW(asn1::detail::der::decode_type_length(wrapper.state),
-		std::runtime_error);
+		asn1::parse_error);
 }
 
 TYPED_TEST(Asn1TestFixture, DecodeTypeLength3)
 {
 	buffer_wrapper_base<typename TestFixture::byte_type, 1, 0x83u, 1, 2, 3> wrapper;
 	EXPECT_EQ(asn1::detail::der::decode_type_length(wrapper.state),
-		(std::pair<std::uint8_t, asn1::detail::length_type>(1, 0x010203u)));
+		(std::pair<asn1::tag_type, asn1::detail::length_type>(1, 0x010203u)));
 }
 
 TYPED_TEST(Asn1TestFixture, DecodeTypeLength4)
@@ -153,7 +162,141 @@ TYPED_TEST(Asn1TestFixture, DecodeTypeLength4)
 	buffer_wrapper_base<typename TestFixture::byte_type, 1, 0x89u, 1, 2, 3, 4,
 		5, 6, 7, 8, 9> wrapper;
 	EXPECT_THROW(asn1::detail::der::decode_type_length(wrapper.state),
-		std::runtime_error);
+		asn1::parse_error);
+}
+
+TYPED_TEST(Asn1TestFixture, DecodeTypeLengthHighTagNumber)
+{
+	buffer_wrapper_base<typename TestFixture::byte_type, 0xbfu, 0x81u, 0x00u, 0x02u> wrapper;
+	EXPECT_EQ(asn1::detail::der::decode_type_length(wrapper.state),
+		(std::pair<asn1::tag_type, asn1::detail::length_type>((128u << 8u) | 0xbfu, 2u)));
+	EXPECT_EQ(wrapper.state.begin, wrapper.vec.cend());
+}
+
+TYPED_TEST(Asn1TestFixture, DecodeTypeLengthHighTagNumberErrors)
+{
+	//Leading zero
+	buffer_wrapper_base<typename TestFixture::byte_type, 0x9fu, 0x80u, 0x7fu, 0x00u> wrapper1;
+	EXPECT_THROW(asn1::detail::der::decode_type_length(wrapper1.state),
+		asn1::parse_error);
+	//Low tag number in the high tag number form
+	buffer_wrapper_base<typename TestFixture::byte_type, 0x9fu, 0x1eu, 0x00u> wrapper2;
+	EXPECT_THROW(asn1::detail::der::decode_type_length(wrapper2.state),
+		asn1::parse_error);
+	//No length
+	buffer_wrapper_base<typename TestFixture::byte_type, 0x9fu, 0x81u, 0x00u> wrapper3;
+	EXPECT_THROW(asn1::detail::der::decode_type_length(wrapper3.state),
+		asn1::parse_error);
+	//Unterminated tag number
+	buffer_wrapper_base<typename TestFixture::byte_type, 0x9fu, 0x81u> wrapper4;
+	EXPECT_THROW(asn1::detail::der::decode_type_length(wrapper4.state),
+		asn1::parse_error);
+	//Tag number is too large
+	buffer_wrapper_base<typename TestFixture::byte_type, 0x9fu, 0x88u, 0x80u, 0x80u,
+		0x00u, 0x00u> wrapper5;
+	EXPECT_THROW(asn1::detail::der::decode_type_length(wrapper5.state),
+		asn1::parse_error);
+}
+
+TYPED_TEST(Asn1TestFixture, DecodeTypeLengthMaxLength)
+{
+	buffer_wrapper_base<typename TestFixture::byte_type, 0x30u, 0x82u, 0x01u, 0x00u> wrapper;
+	std::size_t max_length = 0x83u;
+	EXPECT_THROW(asn1::detail::der::decode_type_length(wrapper.state, &max_length),
+		asn1::parse_error);
+
+	wrapper.state.begin = wrapper.vec.cbegin();
+	max_length = 0x84u;
+	EXPECT_EQ(asn1::detail::der::decode_type_length(wrapper.state, &max_length),
+		(std::pair<asn1::tag_type, asn1::detail::length_type>(0x30u, 0x100u)));
+	EXPECT_EQ(max_length, 0x80u);
+	EXPECT_EQ(wrapper.state.begin, wrapper.vec.cend());
+}
+
+TYPED_TEST(Asn1TestFixture, DecodeLongFormLengthOverrun)
+{
+	//Long form length octets are counted, 0x82 bytes do not fit the buffer
+	buffer_wrapper_base<typename TestFixture::byte_type, 0x04u, 0x81u, 0x82u> wrapper;
+	wrapper.vec.resize(3u + 0x81u);
+	std::vector<typename TestFixture::byte_type> value;
+	EXPECT_THROW((asn1::der::decode<asn1::spec::octet_string<>>(
+		wrapper.vec.cbegin(), wrapper.vec.cend(), value)), asn1::parse_error);
+
+	asn1::validated_extent_decode_state<decltype(wrapper.state)> state(
+		wrapper.vec.cbegin(), wrapper.vec.cend());
+	EXPECT_THROW((asn1::der::decode<asn1::spec::octet_string<>>(state, value)),
+		asn1::parse_error);
+}
+
+TYPED_TEST(Asn1TestFixture, ValidatedExtentDecode)
+{
+	buffer_wrapper_base<typename TestFixture::byte_type,
+		0x30u, 0x0du,
+			0x02u, 0x02u, 0xfbu, 0x2eu,
+			0x06u, 0x03u, 0x2au, 0x86u, 0x48u,
+			0x04u, 0x02u, 0x01u, 0x02u> wrapper;
+	using spec_type = asn1::spec::sequence<asn1::spec::integer<>,
+		asn1::spec::object_identifier<>, asn1::spec::octet_string<>>;
+	struct value_type
+	{
+		std::int32_t number;
+		asn1::decoded_object_identifier<std::vector<std::uint32_t>> oid;
+		std::vector<typename TestFixture::byte_type> octets;
+	};
+
+	asn1::validated_extent_decode_state<decltype(wrapper.state)> state(
+		wrapper.vec.cbegin(), wrapper.vec.cend());
+	value_type value;
+	ASSERT_NO_THROW((asn1::der::decode<spec_type>(state, value)));
+	EXPECT_EQ(state.begin, wrapper.vec.cend());
+	EXPECT_EQ(value.number, -1234);
+	EXPECT_EQ(value.oid.container, (std::vector<std::uint32_t>{ 1, 2, 840 }));
+	EXPECT_EQ(value.octets.size(), 2u);
+
+	//Child length exceeds the parent length
+	wrapper.vec[7] = static_cast<typename TestFixture::byte_type>(0x0au);
+	asn1::validated_extent_decode_state<decltype(wrapper.state)> invalid_state(
+		wrapper.vec.cbegin(), wrapper.vec.cend());
+	EXPECT_THROW((asn1::der::decode<spec_type>(invalid_state, value)), asn1::parse_error);
+}
+
+namespace
+{
+template<typename T, typename Container>
+std::vector<T> decode_all_integer_lengths(const Container& buffer)
+{
+	std::vector<T> result;
+	for (std::size_t offset = 0; offset != buffer.size(); ++offset)
+	{
+		for (std::size_t length = 1; length <= sizeof(T)
+			&& offset + length <= buffer.size(); ++length)
+		{
+			asn1::decode_state state(buffer.begin() + offset, buffer.end());
+			result.emplace_back(asn1::detail::decode_integer<T>(length, state));
+			EXPECT_EQ(state.begin, buffer.begin() + offset + length);
+		}
+	}
+	return result;
+}
+
+template<typename T>
+void test_contiguous_integers_match_generic()
+{
+	const std::vector<std::uint8_t> contiguous{ 0x80u, 0x01u, 0xffu, 0x7fu,
+		0x23u, 0x00u, 0xfeu, 0x81u, 0x45u, 0x67u, 0x89u };
+	const std::deque<std::uint8_t> generic(contiguous.begin(), contiguous.end());
+	EXPECT_EQ(decode_all_integer_lengths<T>(contiguous),
+		decode_all_integer_lengths<T>(generic));
+}
+} //namespace
+
+TEST(DecodeInteger, ContiguousMatchesGeneric)
+{
+	test_contiguous_integers_match_generic<std::int8_t>();
+	test_contiguous_integers_match_generic<std::uint16_t>();
+	test_contiguous_integers_match_generic<std::int32_t>();
+	test_contiguous_integers_match_generic<std::int64_t>();
+	test_contiguous_integers_match_generic<std::uint64_t>();
 }
 
 TYPED_TEST(Asn1TestFixture, DecodeBase128_16_Short)
@@ -177,7 +320,7 @@ TYPED_TEST(Asn1TestFixture, DecodeBase128_16_LongTooSmallInt)
 	buffer_wrapper_base<typename TestFixture::byte_type, 0x86u, 0xf7u, 0x0du, 0x00u> wrapper;
 	asn1::detail::length_type length = 4u;
 	EXPECT_THROW(asn1::detail::decode_base128<std::uint16_t>(length, wrapper.state),
-		std::runtime_error);
+		asn1::parse_error);
 }
 
 TYPED_TEST(Asn1TestFixture, DecodeBase128_16_LongErrorTooShortLength)
@@ -185,7 +328,7 @@ TYPED_TEST(Asn1TestFixture, DecodeBase128_16_LongErrorTooShortLength)
 	buffer_wrapper_base<typename TestFixture::byte_type, 0x86u, 0xf7u, 0x0du, 0x00u> wrapper;
 	asn1::detail::length_type length = 2u;
 	EXPECT_THROW(asn1::detail::decode_base128<std::uint32_t>(length, wrapper.state),
-		std::runtime_error);
+		asn1::parse_error);
 }
 
 TYPED_TEST(Asn1TestFixture, DecodeOid)
@@ -227,14 +370,14 @@ TYPED_TEST(Asn1TestFixture, DecodeOidTooShort)
 	buffer_wrapper_base<typename TestFixture::byte_type,
 		0x2au, 0x86u, 0x48u, 0x86u, 0xf7u> wrapper;
 	EXPECT_THROW((asn1::detail::decode_oid<std::vector<std::uint32_t>, false>(
-		wrapper.vec.size(), wrapper.state)), std::runtime_error);
+		wrapper.vec.size(), wrapper.state)), asn1::parse_error);
 }
 
 TYPED_TEST(Asn1TestFixture, DecodeOidTooShort2)
 {
 	buffer_wrapper_base<typename TestFixture::byte_type> wrapper;
 	EXPECT_THROW((asn1::detail::decode_oid<std::vector<std::uint32_t>, false>(
-		wrapper.vec.size(), wrapper.state)), std::runtime_error);
+		wrapper.vec.size(), wrapper.state)), asn1::parse_error);
 }
 
 TYPED_TEST(Asn1TestFixture, ExplicitInteger)
@@ -415,6 +558,28 @@ TYPED_TEST(Asn1TestFixture, TaggedExplicit)
 		wrapper.vec.begin(), wrapper.vec.end())), 0x05u);
 }
 
+TYPED_TEST(Asn1TestFixture, TaggedHighTagNumber)
+{
+	buffer_wrapper_base<typename TestFixture::byte_type,
+		0x9fu, 0x81u, 0x48u, 0x01u, 0x05u> implicit_wrapper;
+	//[200] IMPLICIT INTEGER
+	EXPECT_EQ((asn1::der::decode<std::int8_t, implicit_spec<asn1::spec::integer<>, 200u>>(
+		implicit_wrapper.vec.begin(), implicit_wrapper.vec.end())), 0x05u);
+
+	buffer_wrapper_base<typename TestFixture::byte_type,
+		0x7fu, 0x64u, 0x03u, 0x02u, 0x01u, 0x05u> explicit_wrapper;
+	//[APPLICATION 100] EXPLICIT INTEGER
+	using application_spec = asn1::spec::tagged<100u, asn1::spec::encoding::expl,
+		asn1::spec::cls::application, asn1::spec::integer<>>;
+	EXPECT_EQ((asn1::der::decode<std::int8_t, application_spec>(
+		explicit_wrapper.vec.begin(), explicit_wrapper.vec.end())), 0x05u);
+
+	//[100] EXPLICIT INTEGER
+	std::int8_t value{};
+	EXPECT_THROW((asn1::der::decode<explicit_spec<asn1::spec::integer<>, 100u>>(
+		explicit_wrapper.vec.begin(), explicit_wrapper.vec.end(), value)), asn1::parse_error);
+}
+
 TYPED_TEST(Asn1TestFixture, TaggedImplicitExplicit)
 {
 	buffer_wrapper_base<typename TestFixture::byte_type,
@@ -562,6 +727,46 @@ TYPED_TEST(Asn1TestFixture, ChoiceSecond)
 	EXPECT_EQ(std::get<std::int16_t>(value), 5u);
 }
 
+namespace
+{
+using high_tag_choice = asn1::spec::choice<
+	asn1::spec::integer<>,
+	implicit_spec<asn1::spec::integer<>, 31u>,
+	implicit_spec<asn1::spec::boolean<>, 1000u>,
+	implicit_spec<asn1::spec::null<>, 0xffffffu>>;
+using high_tag_choice_type = std::variant<std::int32_t, std::int32_t, bool, std::nullptr_t>;
+} //namespace
+
+TYPED_TEST(Asn1TestFixture, ChoiceHighTagNumbers)
+{
+	buffer_wrapper_base<typename TestFixture::byte_type,
+		0x9fu, 0x87u, 0x68u, 0x01u, 0xffu> wrapper1;
+	high_tag_choice_type value;
+	ASSERT_NO_THROW((asn1::der::decode<high_tag_choice>(
+		wrapper1.vec.begin(), wrapper1.vec.end(), value)));
+	ASSERT_EQ(value.index(), 2u);
+	EXPECT_TRUE(std::get<2>(value));
+
+	buffer_wrapper_base<typename TestFixture::byte_type,
+		0x9fu, 0x1fu, 0x01u, 0x07u> wrapper2;
+	ASSERT_NO_THROW((asn1::der::decode<high_tag_choice>(
+		wrapper2.vec.begin(), wrapper2.vec.end(), value)));
+	ASSERT_EQ(value.index(), 1u);
+	EXPECT_EQ(std::get<1>(value), 7);
+
+	buffer_wrapper_base<typename TestFixture::byte_type,
+		0x9fu, 0x87u, 0xffu, 0xffu, 0x7fu, 0x00u> wrapper3;
+	ASSERT_NO_THROW((asn1::der::decode<high_tag_choice>(
+		wrapper3.vec.begin(), wrapper3.vec.end(), value)));
+	EXPECT_EQ(value.index(), 3u);
+
+	//[1001]
+	buffer_wrapper_base<typename TestFixture::byte_type,
+		0x9fu, 0x87u, 0x69u, 0x01u, 0xffu> wrapper4;
+	EXPECT_THROW((asn1::der::decode<high_tag_choice>(
+		wrapper4.vec.begin(), wrapper4.vec.end(), value)), asn1::parse_error);
+}
+
 namespace
 {
 using null_choice = asn1::spec::choice<
@@ -799,10 +1004,10 @@ TYPED_TEST(Asn1TestFixture, ExplicitNestedSequenceAllFieldsWithIterators)
 {
 	struct sequence_type_with_iterators
 	{
-		asn1::with_iterators<std::vector<typename TestFixture::byte_type>::iterator, bool> v1;
+		asn1::with_iterators<typename std::vector<typename TestFixture::byte_type>::iterator, bool> v1;
 		std::optional<std::nullptr_t> v2;
 		std::optional<asn1::with_iterators<
-			std::vector<typename TestFixture::byte_type>::iterator, nested_sequence_type>> nested;
+			typename std::vector<typename TestFixture::byte_type>::iterator, nested_sequence_type>> nested;
 	};
 
 	buffer_wrapper_base<typename TestFixture::byte_type,
@@ -873,10 +1078,10 @@ TYPED_TEST(Asn1TestFixture, ExplicitNestedSequenceAllFieldsWithRawData)
 {
 	struct sequence_type_with_raw_data
 	{
-		asn1::with_raw_data<std::vector<TestFixture::byte_type>, bool> v1;
+		asn1::with_raw_data<std::vector<typename TestFixture::byte_type>, bool> v1;
 		std::optional<std::nullptr_t> v2;
 		std::optional<asn1::with_raw_data<
-			std::vector<TestFixture::byte_type>, nested_sequence_type>> nested;
+			std::vector<typename TestFixture::byte_type>, nested_sequence_type>> nested;
 	};
 
 	buffer_wrapper_base<typename TestFixture::byte_type,
@@ -906,6 +1111,226 @@ TYPED_TEST(Asn1TestFixture, ExplicitNestedSequenceAllFieldsWithRawData)
 	EXPECT_TRUE(value.nested->value.v3);
 }
 
+TYPED_TEST(Asn1TestFixture, LazyNestedSequence)
+{
+	struct sequence_type_with_lazy
+	{
+		bool v1;
+		std::optional<std::nullptr_t> v2;
+		std::optional<asn1::lazy<std::span<const typename TestFixture::byte_type>,
+			nested_sequence_type>> nested;
+	};
+
+	buffer_wrapper_base<typename TestFixture::byte_type,
+		0x30u, 0x12u,
+			0x01u, 0x01u, 0xffu,
+			0x05u, 0x00u,
+			0x30u, 0x0bu,
+				0xa5u, 0x03u, 0x02u, 0x01u, 0x55u,
+				0x02u, 0x01u, 0x78u,
+				0x01u, 0x01u, 0xffu
+	> wrapper;
+	sequence_type_with_lazy value{};
+	ASSERT_NO_THROW((asn1::der::decode<sequence_spec>(
+		wrapper.vec.begin(), wrapper.vec.end(), value)));
+
+	EXPECT_TRUE(value.v1);
+	EXPECT_TRUE(value.v2);
+	ASSERT_TRUE(value.nested);
+	EXPECT_FALSE(value.nested->is_decoded());
+	EXPECT_TRUE(std::equal(value.nested->raw().begin(),
+		value.nested->raw().end(), wrapper.vec.begin() + 7, wrapper.vec.end()));
+
+	EXPECT_EQ(value.nested->get().v1, 0x55u);
+	EXPECT_TRUE(value.nested->is_decoded());
+	EXPECT_EQ((*value.nested)->v2, 0x78u);
+	EXPECT_TRUE((*value.nested)->v3);
+}
+
+TYPED_TEST(Asn1TestFixture, LazyNestedSequenceDeferredError)
+{
+	struct sequence_type_with_lazy
+	{
+		bool v1;
+		std::optional<std::nullptr_t> v2;
+		std::optional<asn1::lazy<std::vector<typename TestFixture::byte_type>,
+			nested_sequence_type>> nested;
+	};
+
+	buffer_wrapper_base<typename TestFixture::byte_type,
+		0x30u, 0x12u,
+			0x01u, 0x01u, 0xffu,
+			0x05u, 0x00u,
+			0x30u, 0x0bu,
+				0xa6u, 0x03u, 0x02u, 0x01u, 0x55u,
+				0x02u, 0x01u, 0xabu,
+				0x01u, 0x01u, 0xffu
+	> wrapper;
+	sequence_type_with_lazy value{};
+	ASSERT_NO_THROW((asn1::der::decode<sequence_spec>(
+		wrapper.vec.begin(), wrapper.vec.end(), value)));
+	ASSERT_TRUE(value.nested);
+	EXPECT_THAT(([&]() { (void)value.nested->get(); }),
+		Throws<asn1::parse_error>(HasExactContext("sequence_spec/nested_sequence_spec")));
+	EXPECT_FALSE(value.nested->is_decoded());
+}
+
+TYPED_TEST(Asn1TestFixture, LazyHeaderErrors)
+{
+	using lazy_type = asn1::lazy<std::span<const typename TestFixture::byte_type>,
+		nested_sequence_type>;
+
+	buffer_wrapper_base<typename TestFixture::byte_type,
+		0x31u, 0x00u> wrong_tag;
+	lazy_type value;
+	EXPECT_THAT(([&]() { asn1::der::decode<nested_sequence_spec>(
+		wrong_tag.vec.begin(), wrong_tag.vec.end(), value); }),
+		Throws<asn1::parse_error>(Property(&asn1::parse_error::what,
+			StrEq("Expected SEQUENCE"))));
+
+	buffer_wrapper_base<typename TestFixture::byte_type,
+		0x30u, 0x05u, 0x01u> overrun;
+	EXPECT_THROW((asn1::der::decode<nested_sequence_spec>(
+		overrun.vec.begin(), overrun.vec.end(), value)), asn1::parse_error);
+}
+
+TYPED_TEST(Asn1TestFixture, LazyRawData)
+{
+	using tagged_spec = asn1::spec::tagged<1u, asn1::spec::encoding::impl,
+		asn1::spec::cls::context_specific, asn1::spec::boolean<>>;
+	using lazy_type = asn1::lazy<std::vector<typename TestFixture::byte_type>, bool>;
+
+	buffer_wrapper_base<typename TestFixture::byte_type,
+		0x81u, 0x01u, 0xffu> tagged;
+	lazy_type value;
+	ASSERT_NO_THROW((asn1::der::decode<tagged_spec>(
+		tagged.vec.begin(), tagged.vec.end(), value)));
+	EXPECT_EQ(value.raw(), tagged.vec);
+	EXPECT_TRUE(value.get());
+
+	// CHOICE alternatives are decoded implicitly after the tag is matched
+	using choice_spec = asn1::spec::choice<asn1::spec::null<>, asn1::spec::boolean<>>;
+	buffer_wrapper_base<typename TestFixture::byte_type,
+		0x01u, 0x01u, 0xffu> choice;
+	std::variant<std::nullptr_t, lazy_type> choice_value;
+	ASSERT_NO_THROW((asn1::der::decode<choice_spec>(
+		choice.vec.begin(), choice.vec.end(), choice_value)));
+	ASSERT_EQ(choice_value.index(), 1u);
+	EXPECT_EQ(std::get<1>(choice_value).raw().size(), 1u);
+	EXPECT_TRUE(std::get<1>(choice_value).get());
+}
+
+TYPED_TEST(Asn1TestFixture, SequenceOfView)
+{
+	using view_type = asn1::sequence_of_view<
+		std::span<const typename TestFixture::byte_type>, std::int16_t>;
+	static_assert(std::ranges::input_range<view_type>);
+	static_assert(!std::ranges::forward_range<view_type>);
+
+	buffer_wrapper_base<typename TestFixture::byte_type,
+		0x30u, 0x0au,
+		0x02u, 0x02u, 0x03u, 0x05u,
+		0x02u, 0x01u, 0x07u,
+		0x02u, 0x01u, 0x08u
+	> wrapper;
+	view_type value;
+	EXPECT_TRUE(value.empty());
+	ASSERT_NO_THROW((asn1::der::decode<asn1::spec::sequence_of<asn1::spec::integer<>>>(
+		wrapper.vec.begin(), wrapper.vec.end(), value)));
+	EXPECT_FALSE(value.empty());
+	EXPECT_TRUE(std::equal(value.raw().begin(), value.raw().end(),
+		wrapper.vec.begin() + 2, wrapper.vec.end()));
+	EXPECT_THAT(value, ElementsAre(0x0305, 0x07, 0x08));
+
+	auto found = std::ranges::find(value, std::int16_t{ 0x07 });
+	ASSERT_NE(found, value.end());
+	EXPECT_EQ(*++found, 0x08);
+	EXPECT_EQ(++found, value.end());
+
+	buffer_wrapper_base<typename TestFixture::byte_type, 0x31u, 0x00u> empty;
+	ASSERT_NO_THROW((asn1::der::decode<asn1::spec::set_of<asn1::spec::integer<>>>(
+		empty.vec.begin(), empty.vec.end(), value)));
+	EXPECT_TRUE(value.empty());
+	EXPECT_EQ(value.begin(), value.end());
+}
+
+TYPED_TEST(Asn1TestFixture, SequenceOfViewDeferredError)
+{
+	using view_type = asn1::sequence_of_view<
+		std::vector<typename TestFixture::byte_type>, std::vector<std::int16_t>>;
+	using spec = asn1::spec::sequence_of_with_options<
+		asn1::opts::options<asn1::opts::name<"list">>,
+		asn1::spec::sequence_of<asn1::spec::integer<>>>;
+
+	buffer_wrapper_base<typename TestFixture::byte_type,
+		0x30u, 0x0bu,
+		0x30u, 0x03u, 0x02u, 0x01u, 0x07u,
+		0x30u, 0x04u, 0x04u, 0x02u, 0x01u, 0x02u
+	> wrapper;
+	view_type value;
+	ASSERT_NO_THROW((asn1::der::decode<spec>(wrapper.vec.begin(), wrapper.vec.end(), value)));
+
+	auto it = value.begin();
+	EXPECT_THAT(*it, ElementsAre(0x07));
+	try
+	{
+		++it;
+		FAIL();
+	}
+	catch (const asn1::parse_error& e)
+	{
+		//Relative to raw()
+		EXPECT_EQ(e.get_offset(), 9u);
+		ASSERT_FALSE(e.get_context().empty());
+		EXPECT_EQ(e.get_context()[0].spec_name, "list");
+	}
+
+	asn1::decode_error error;
+	std::size_t count = 0;
+	for (auto error_it = value.begin(error); error_it != value.end(); ++error_it)
+	{
+		EXPECT_THAT(*error_it, ElementsAre(0x07));
+		++count;
+	}
+	EXPECT_EQ(count, 1u);
+	EXPECT_EQ(error.code, asn1::decode_errc::unexpected_tag);
+	EXPECT_EQ(error.offset, 9u);
+	ASSERT_FALSE(error.context.empty());
+	EXPECT_EQ(error.context[0].spec_name, "list");
+
+	//The error is cleared by begin()
+	view_type empty_value;
+	EXPECT_EQ(empty_value.begin(error), empty_value.end());
+	EXPECT_EQ(error.code, asn1::decode_errc::none);
+}
+
+TYPED_TEST(Asn1TestFixture, SequenceOfViewElementCount)
+{
+	using view_type = asn1::sequence_of_view<
+		std::span<const typename TestFixture::byte_type>, std::int16_t>;
+	using spec = asn1::spec::set_of_with_options<
+		asn1::opts::options<asn1::opts::min_max_elements<1, 2>>,
+		asn1::spec::integer<>>;
+
+	buffer_wrapper_base<typename TestFixture::byte_type,
+		0x31u, 0x09u,
+		0x02u, 0x01u, 0x07u,
+		0x02u, 0x01u, 0x08u,
+		0x02u, 0x01u, 0x09u
+	> wrapper;
+	view_type value;
+	EXPECT_THAT(([&]() { asn1::der::decode<spec>(
+		wrapper.vec.begin(), wrapper.vec.end(), value); }),
+		Throws<asn1::parse_error>(Property(&asn1::parse_error::what,
+			StrEq("Too many elements"))));
+
+	buffer_wrapper_base<typename TestFixture::byte_type, 0x31u, 0x00u> empty;
+	EXPECT_THAT(([&]() { asn1::der::decode<spec>(
+		empty.vec.begin(), empty.vec.end(), value); }),
+		Throws<asn1::parse_error>(Property(&asn1::parse_error::what,
+			StrEq("Too few elements"))));
+}
+
 namespace
 {
 template<typename ByteType>
@@ -1034,6 +1459,53 @@ TYPED_TEST(Asn1TestFixture, ExtendedSequenceExplicitExtension)
 	EXPECT_EQ(value.v2, true);
 }
 
+namespace
+{
+struct high_tag_sequence_type
+{
+	std::optional<std::int32_t> v1;
+	std::int32_t v2{};
+};
+
+using high_tag_sequence_spec = asn1::spec::sequence<
+	asn1::spec::optional<implicit_spec<asn1::spec::integer<>, 300u>>,
+	asn1::spec::integer<>
+>;
+} //namespace
+
+TYPED_TEST(Asn1TestFixture, SequenceOptionalHighTagNumber)
+{
+	buffer_wrapper_base<typename TestFixture::byte_type,
+		0x30u, 0x08u,
+			0x9fu, 0x82u, 0x2cu, 0x01u, 0x07u,
+			0x02u, 0x01u, 0x08u
+	> wrapper1;
+	high_tag_sequence_type value{};
+	ASSERT_NO_THROW((asn1::der::decode<high_tag_sequence_spec>(
+		wrapper1.vec.begin(), wrapper1.vec.end(), value)));
+	EXPECT_EQ(value.v1, 7);
+	EXPECT_EQ(value.v2, 8);
+
+	buffer_wrapper_base<typename TestFixture::byte_type,
+		0x30u, 0x03u,
+			0x02u, 0x01u, 0x08u
+	> wrapper2;
+	value = {};
+	ASSERT_NO_THROW((asn1::der::decode<high_tag_sequence_spec>(
+		wrapper2.vec.begin(), wrapper2.vec.end(), value)));
+	EXPECT_FALSE(value.v1);
+	EXPECT_EQ(value.v2, 8);
+
+	//[301]
+	buffer_wrapper_base<typename TestFixture::byte_type,
+		0x30u, 0x08u,
+			0x9fu, 0x82u, 0x2du, 0x01u, 0x07u,
+			0x02u, 0x01u, 0x08u
+	> wrapper3;
+	EXPECT_THROW((asn1::der::decode<high_tag_sequence_spec>(
+		wrapper3.vec.begin(), wrapper3.vec.end(), value)), asn1::parse_error);
+}
+
 TYPED_TEST(Asn1TestFixture, SequenceOfExplicit)
 {
 	buffer_wrapper_base<typename TestFixture::byte_type,
@@ -1220,6 +1692,47 @@ TYPED_TEST(Asn1TestFixture, ExplicitNestedSetDuplicateFields)
 		Throws<asn1::parse_error>(HasContext("MyBoolean")));
 }
 
+namespace
+{
+struct high_tag_set_type
+{
+	std::int32_t v1{};
+	std::int32_t v2{};
+	std::int32_t v3{};
+};
+
+using high_tag_set_spec = asn1::spec::set<
+	implicit_spec<asn1::spec::integer<>, 100u>,
+	implicit_spec<asn1::spec::integer<>, 5u>,
+	asn1::spec::optional_default<asn1::spec::default_value<7>,
+		implicit_spec<asn1::spec::integer<>, 4000u>>
+>;
+} //namespace
+
+TYPED_TEST(Asn1TestFixture, ExplicitSetHighTagNumbers)
+{
+	buffer_wrapper_base<typename TestFixture::byte_type,
+		0x31u, 0x07u,
+			0x85u, 0x01u, 0x02u,
+			0x9fu, 0x64u, 0x01u, 0x01u
+	> wrapper1;
+	high_tag_set_type value{};
+	ASSERT_NO_THROW((asn1::der::decode<high_tag_set_spec>(
+		wrapper1.vec.begin(), wrapper1.vec.end(), value)));
+	EXPECT_EQ(value.v1, 1);
+	EXPECT_EQ(value.v2, 2);
+	EXPECT_EQ(value.v3, 7);
+
+	buffer_wrapper_base<typename TestFixture::byte_type,
+		0x31u, 0x0bu,
+			0x85u, 0x01u, 0x02u,
+			0x9fu, 0x64u, 0x01u, 0x01u,
+			0x9fu, 0x64u, 0x01u, 0x03u
+	> wrapper2;
+	EXPECT_THROW((asn1::der::decode<high_tag_set_spec>(
+		wrapper2.vec.begin(), wrapper2.vec.end(), value)), asn1::parse_error);
+}
+
 TYPED_TEST(Asn1TestFixture, ExplicitNestedSetMissingOptionalFields)
 {
 	buffer_wrapper_base<typename TestFixture::byte_type,
@@ -1462,6 +1975,27 @@ TYPED_TEST(Asn1TestFixture, ImplicitOctetStringVector)
 	EXPECT_EQ(value, (buffer_wrapper_base<typename TestFixture::byte_type, 4, 2>{}.vec));
 }
 
+TYPED_TEST(Asn1TestFixture, ExplicitOctetStringVectorWithPointers)
+{
+	buffer_wrapper_base<typename TestFixture::byte_type, 4, 3, 3, 4, 5> wrapper;
+	std::vector<typename TestFixture::byte_type> value{ wrapper.vec };
+	const auto* data = wrapper.vec.data();
+	ASSERT_NO_THROW((asn1::der::decode<asn1::spec::octet_string<>>(
+		data, data + wrapper.vec.size(), value)));
+	EXPECT_EQ(value, (buffer_wrapper_base<typename TestFixture::byte_type, 3, 4, 5>{}.vec));
+}
+
+TYPED_TEST(Asn1TestFixture, ExplicitOctetStringVectorWithDequeIterators)
+{
+	buffer_wrapper_base<typename TestFixture::byte_type, 4, 3, 3, 4, 5> wrapper;
+	const std::deque<typename TestFixture::byte_type> buffer(
+		wrapper.vec.begin(), wrapper.vec.end());
+	std::vector<typename TestFixture::byte_type> value{};
+	ASSERT_NO_THROW((asn1::der::decode<asn1::spec::octet_string<>>(
+		buffer.begin(), buffer.end(), value)));
+	EXPECT_EQ(value, (buffer_wrapper_base<typename TestFixture::byte_type, 3, 4, 5>{}.vec));
+}
+
 TYPED_TEST(Asn1TestFixture, ExplicitBitStringVector)
 {
 	buffer_wrapper_base<typename TestFixture::byte_type, 3, 3, 1, 25, 26> wrapper;
@@ -1574,6 +2108,250 @@ TYPED_TEST(Asn1TestFixture, ExplicitOidDecodeTooSmallType)
 		Throws<asn1::parse_error>(HasContext("MyOID")));
 }
 
+TYPED_TEST(Asn1TestFixture, ExplicitOidDecodeInline)
+{
+	buffer_wrapper_base<typename TestFixture::byte_type,
+		0x06u, 0x09u, 0x2au, 0x86u, 0x48u, 0x86u,
+		0xf7u, 0x0du, 0x01u, 0x01u, 0x0bu> wrapper;
+	asn1::decoded_object_identifier<asn1::inline_oid<7>> value;
+	ASSERT_NO_THROW((asn1::der::decode<asn1::spec::object_identifier<>>(
+		wrapper.vec.begin(), wrapper.vec.end(), value)));
+	EXPECT_EQ(value.container, (asn1::inline_oid<7>{1, 2, 840, 113549, 1, 1, 11}));
+	EXPECT_TRUE(value.container.full());
+}
+
+TEST(InlineOid, Capacity)
+{
+	static constexpr asn1::inline_oid<3> oid{ 1u, 2u, 3u };
+	static_assert(oid.full() && oid[2] == 3u);
+
+	EXPECT_THROW((asn1::inline_oid<3>{ 1u, 2u, 3u, 4u }), std::length_error);
+
+	auto copy = oid;
+	EXPECT_THROW(copy.push_back(4u), std::length_error);
+	EXPECT_THROW(copy.emplace_back(), std::length_error);
+	EXPECT_EQ(copy, oid);
+
+	copy.pop_back();
+	copy.push_back(5u);
+	EXPECT_EQ(copy, (asn1::inline_oid<3>{ 1u, 2u, 5u }));
+}
+
+TYPED_TEST(Asn1TestFixture, ExplicitOidDecodeInlineTooManyComponents)
+{
+	buffer_wrapper_base<typename TestFixture::byte_type,
+		0x06u, 0x09u, 0x2au, 0x86u, 0x48u, 0x86u,
+		0xf7u, 0x0du, 0x01u, 0x01u, 0x0bu> wrapper;
+	asn1::decoded_object_identifier<asn1::inline_oid<6>> value;
+	EXPECT_THAT(([&]() { asn1::der::decode<
+		asn1::spec::object_identifier<asn1::opts::options<asn1::opts::name<"MyOID">>>>(
+			wrapper.vec.begin(), wrapper.vec.end(), value); }),
+		Throws<asn1::parse_error>(HasContext("MyOID")));
+}
+
+namespace
+{
+constexpr auto oid_sha256_with_rsa = std::to_array<std::uint32_t>({ 1, 2, 840, 113549, 1, 1, 11 });
+constexpr auto oid_common_name = std::to_array<std::uint32_t>({ 2, 5, 4, 3 });
+constexpr auto oid_large_first = std::to_array<std::uint32_t>({ 2, 999, 3 });
+using test_oid_map = asn1::oid_map<oid_sha256_with_rsa, oid_common_name, oid_large_first>;
+static_assert(test_oid_map::index_of<oid_common_name>() == 1u);
+static_assert(test_oid_map::find(asn1::encode_oid<2, 999, 3>()) == 2u);
+} //namespace
+
+TYPED_TEST(Asn1TestFixture, OidMapRawContents)
+{
+	buffer_wrapper_base<typename TestFixture::byte_type,
+		0x30u, 0x10u,
+			0x06u, 0x09u, 0x2au, 0x86u, 0x48u, 0x86u, 0xf7u, 0x0du, 0x01u, 0x01u, 0x0bu,
+			0x06u, 0x03u, 0x55u, 0x04u, 0x03u> wrapper;
+	std::vector<std::span<const typename TestFixture::byte_type>> value;
+	ASSERT_NO_THROW((asn1::der::decode<asn1::spec::sequence_of<asn1::spec::object_identifier<>>>(
+		wrapper.vec.begin(), wrapper.vec.end(), value)));
+	ASSERT_EQ(value.size(), 2u);
+	EXPECT_EQ(test_oid_map::find(value[0]), 0u);
+	EXPECT_EQ(test_oid_map::find(value[1]), 1u);
+	EXPECT_EQ(test_oid_map::find(value[0].first(8)), test_oid_map::npos);
+	EXPECT_EQ(test_oid_map::find(value[1].subspan(1)), test_oid_map::npos);
+}
+
+TEST(OidMap, DecodedOid)
+{
+	using oid_type = asn1::decoded_object_identifier<std::vector<std::uint32_t>>;
+	EXPECT_EQ(test_oid_map::find(oid_type{ { 1, 2, 840, 113549, 1, 1, 11 } }), 0u);
+	EXPECT_EQ(test_oid_map::find(oid_type{ { 2, 999, 3 } }), 2u);
+	EXPECT_EQ(test_oid_map::find(oid_type{ { 2, 5, 4, 4 } }), test_oid_map::npos);
+	EXPECT_EQ(test_oid_map::find(oid_type{ { 1, 2, 840, 113549, 1, 1, 11, 1 } }),
+		test_oid_map::npos);
+	EXPECT_EQ(test_oid_map::find(oid_type{ { 2 } }), test_oid_map::npos);
+	//{ 1, 40 } and { 0, 80 } would be encoded the same way as { 2, 0 }
+	using two_zero_map = asn1::oid_map<std::to_array<std::uint32_t>({ 2, 0 })>;
+	EXPECT_EQ(two_zero_map::find(oid_type{ { 2, 0 } }), 0u);
+	EXPECT_EQ(two_zero_map::find(oid_type{ { 1, 40 } }), two_zero_map::npos);
+	EXPECT_EQ(two_zero_map::find(oid_type{ { 0, 80 } }), two_zero_map::npos);
+	EXPECT_EQ(test_oid_map::find(oid_type{ { 3, 5, 4, 3 } }), test_oid_map::npos);
+	EXPECT_EQ(test_oid_map::find(asn1::decoded_object_identifier<asn1::inline_oid<4>>{
+		{ 2, 5, 4, 3 } }), 1u);
+}
+
+TEST(OidMap, ManyOids)
+{
+	constexpr auto oid = [](std::uint32_t last) {
+		return std::to_array<std::uint32_t>({ 1, 3, 6, 1, 4, 1, 311, last });
+	};
+	using map_type = asn1::oid_map<oid(0), oid(1), oid(2), oid(127), oid(128), oid(255),
+		oid(256), oid(1000), oid(16383), oid(16384), oid(100000), oid(0xffffffffu)>;
+	static_assert(map_type::index_of<oid(16384)>() == 9u);
+	constexpr std::array<std::uint32_t, map_type::size> last_components{ 0u, 1u, 2u,
+		127u, 128u, 255u, 256u, 1000u, 16383u, 16384u, 100000u, 0xffffffffu };
+	for (std::size_t i = 0; i != last_components.size(); ++i)
+	{
+		asn1::decoded_object_identifier<std::vector<std::uint32_t>> value;
+		auto components = oid(last_components[i]);
+		value.container.assign(components.begin(), components.end());
+		EXPECT_EQ(map_type::find(value), i);
+	}
+	EXPECT_EQ(map_type::find(asn1::decoded_object_identifier<std::vector<std::uint32_t>>{
+		{ 1, 3, 6, 1, 4, 1, 311, 3 } }), map_type::npos);
+}
+
+namespace
+{
+constexpr auto oid_integer_extension = std::to_array<std::uint32_t>({ 1, 2, 3 });
+constexpr auto oid_boolean_extension = std::to_array<std::uint32_t>({ 1, 2, 4 });
+
+using open_type_registry = asn1::spec::open_type_registry<
+	asn1::spec::open_type_entry<oid_integer_extension,
+		asn1::spec::octet_string_with<asn1::spec::integer<asn1::opts::named<"int">>>>,
+	asn1::spec::open_type_entry<oid_boolean_extension,
+		asn1::spec::octet_string_with<asn1::spec::boolean<>>>>;
+
+using open_type_extension_spec = asn1::spec::sequence<
+	asn1::spec::object_identifier<>,
+	asn1::spec::optional_default<asn1::spec::default_value<false>, asn1::spec::boolean<>>,
+	asn1::spec::open_type<0, open_type_registry, asn1::spec::octet_string<>,
+		asn1::opts::named<"value">>>;
+
+template<typename OidType, typename RangeType>
+struct open_type_extension
+{
+	OidType id;
+	bool critical;
+	std::variant<RangeType, int, bool> value;
+};
+
+using optional_open_type_spec = asn1::spec::sequence<
+	asn1::spec::object_identifier<>,
+	asn1::spec::optional<asn1::spec::open_type<0, asn1::spec::open_type_registry<
+		asn1::spec::open_type_entry<oid_integer_extension, asn1::spec::integer<>>>>>>;
+
+template<typename RangeType>
+struct optional_open_type
+{
+	asn1::decoded_object_identifier<asn1::inline_oid<8>> algorithm;
+	std::optional<std::variant<RangeType, int>> parameters;
+};
+} //namespace
+
+TYPED_TEST(Asn1TestFixture, OpenTypeKnownOid)
+{
+	buffer_wrapper_base<typename TestFixture::byte_type,
+		0x30u, 0x0du,
+			0x06u, 0x02u, 0x2au, 0x03u,
+			0x01u, 0x01u, 0xffu,
+			0x04u, 0x04u, 0x02u, 0x02u, 0x01u, 0x23u> wrapper;
+	open_type_extension<asn1::decoded_object_identifier<std::vector<std::uint32_t>>,
+		std::span<const typename TestFixture::byte_type>> value;
+	ASSERT_NO_THROW((asn1::der::decode<open_type_extension_spec>(
+		wrapper.vec.begin(), wrapper.vec.end(), value)));
+	EXPECT_TRUE(value.critical);
+	ASSERT_EQ(value.value.index(), 1u);
+	EXPECT_EQ(std::get<1>(value.value), 0x123);
+}
+
+TYPED_TEST(Asn1TestFixture, OpenTypeRawOid)
+{
+	buffer_wrapper_base<typename TestFixture::byte_type,
+		0x30u, 0x07u,
+			0x06u, 0x02u, 0x2au, 0x04u,
+			0x04u, 0x01u, 0x00u> wrapper;
+	using range_type = std::span<const typename TestFixture::byte_type>;
+	open_type_extension<range_type, range_type> value;
+	EXPECT_THAT(([&]() { asn1::der::decode<open_type_extension_spec>(
+		wrapper.vec.begin(), wrapper.vec.end(), value); }),
+		Throws<asn1::parse_error>(HasContext("value")));
+
+	buffer_wrapper_base<typename TestFixture::byte_type,
+		0x30u, 0x09u,
+			0x06u, 0x02u, 0x2au, 0x04u,
+			0x04u, 0x03u, 0x01u, 0x01u, 0x00u> valid;
+	ASSERT_NO_THROW((asn1::der::decode<open_type_extension_spec>(
+		valid.vec.begin(), valid.vec.end(), value)));
+	EXPECT_FALSE(value.critical);
+	ASSERT_EQ(value.value.index(), 2u);
+	EXPECT_FALSE(std::get<2>(value.value));
+}
+
+TYPED_TEST(Asn1TestFixture, OpenTypeUnknownOid)
+{
+	buffer_wrapper_base<typename TestFixture::byte_type,
+		0x30u, 0x09u,
+			0x06u, 0x02u, 0x2au, 0x05u,
+			0x04u, 0x03u, 0x02u, 0x01u, 0x05u> wrapper;
+	open_type_extension<asn1::decoded_object_identifier<std::vector<std::uint32_t>>,
+		std::vector<typename TestFixture::byte_type>> value;
+	ASSERT_NO_THROW((asn1::der::decode<open_type_extension_spec>(
+		wrapper.vec.begin(), wrapper.vec.end(), value)));
+	ASSERT_EQ(value.value.index(), 0u);
+	EXPECT_EQ(std::get<0>(value.value),
+		(buffer_wrapper_base<typename TestFixture::byte_type, 0x02u, 0x01u, 0x05u>{}.vec));
+}
+
+TYPED_TEST(Asn1TestFixture, OpenTypeInvalidPayload)
+{
+	buffer_wrapper_base<typename TestFixture::byte_type,
+		0x30u, 0x09u,
+			0x06u, 0x02u, 0x2au, 0x03u,
+			0x04u, 0x03u, 0x01u, 0x01u, 0x00u> wrapper;
+	open_type_extension<asn1::decoded_object_identifier<std::vector<std::uint32_t>>,
+		std::span<const typename TestFixture::byte_type>> value;
+	EXPECT_THAT(([&]() { asn1::der::decode<open_type_extension_spec>(
+		wrapper.vec.begin(), wrapper.vec.end(), value); }),
+		Throws<asn1::parse_error>(HasExactContext("value/int")));
+}
+
+TYPED_TEST(Asn1TestFixture, OptionalOpenType)
+{
+	buffer_wrapper_base<typename TestFixture::byte_type,
+		0x30u, 0x07u,
+			0x06u, 0x02u, 0x2au, 0x03u,
+			0x02u, 0x01u, 0x07u> wrapper;
+	optional_open_type<std::span<const typename TestFixture::byte_type>> value;
+	ASSERT_NO_THROW((asn1::der::decode<optional_open_type_spec>(
+		wrapper.vec.begin(), wrapper.vec.end(), value)));
+	ASSERT_TRUE(value.parameters);
+	ASSERT_EQ(value.parameters->index(), 1u);
+	EXPECT_EQ(std::get<1>(*value.parameters), 7);
+
+	buffer_wrapper_base<typename TestFixture::byte_type,
+		0x30u, 0x06u,
+			0x06u, 0x02u, 0x2au, 0x05u,
+			0x05u, 0x00u> unknown;
+	ASSERT_NO_THROW((asn1::der::decode<optional_open_type_spec>(
+		unknown.vec.begin(), unknown.vec.end(), value)));
+	ASSERT_TRUE(value.parameters);
+	ASSERT_EQ(value.parameters->index(), 0u);
+	EXPECT_EQ(std::get<0>(*value.parameters).size(), 2u);
+
+	buffer_wrapper_base<typename TestFixture::byte_type,
+		0x30u, 0x04u,
+			0x06u, 0x02u, 0x2au, 0x03u> absent;
+	value = {};
+	ASSERT_NO_THROW((asn1::der::decode<optional_open_type_spec>(
+		absent.vec.begin(), absent.vec.end(), value)));
+	EXPECT_FALSE(value.parameters);
+}
+
 template<typename Types>
 struct Asn1StringTestFixture : public testing::Test
 {
@@ -2059,6 +2837,93 @@ TYPED_TEST(Asn1TestFixture, ExplicitGeneralizedTimeFractionFeb29)
 	EXPECT_EQ(value, (asn1::generalized_time{ 1996, 2, 29, 11, 22, 33, 1 }));
 }
 
+TYPED_TEST(Asn1TestFixture, GeneralizedTimeSysTime)
+{
+	using namespace std::chrono;
+	buffer_wrapper_base<typename TestFixture::byte_type,
+		24, 25, '2', '0', '2', '4', '0', '2', '2', '9', '1', '1',
+		'2', '2', '3', '3', '.', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'Z'> wrapper;
+	sys_time<nanoseconds> nanoseconds_value;
+	ASSERT_NO_THROW((asn1::der::decode<generalized_time_spec>(
+		wrapper.vec.begin(), wrapper.vec.end(), nanoseconds_value)));
+	auto expected = sys_days{ 2024y / February / 29 } + 11h + 22min + 33s;
+	EXPECT_EQ(nanoseconds_value, expected + 123456789ns);
+
+	sys_time<milliseconds> milliseconds_value;
+	ASSERT_NO_THROW((asn1::der::decode<generalized_time_spec>(
+		wrapper.vec.begin(), wrapper.vec.end(), milliseconds_value)));
+	EXPECT_EQ(milliseconds_value, expected + 123ms);
+
+	sys_seconds seconds_value;
+	ASSERT_NO_THROW((asn1::der::decode<generalized_time_spec>(
+		wrapper.vec.begin(), wrapper.vec.end(), seconds_value)));
+	EXPECT_EQ(seconds_value, expected);
+}
+
+TYPED_TEST(Asn1TestFixture, GeneralizedTimeSysTimeShortFraction)
+{
+	using namespace std::chrono;
+	buffer_wrapper_base<typename TestFixture::byte_type,
+		24, 18, '1', '9', '6', '9', '1', '2', '3', '1', '2', '3',
+		'5', '9', '5', '9', '.', '0', '5', 'Z'> wrapper;
+	sys_time<microseconds> value;
+	ASSERT_NO_THROW((asn1::der::decode<generalized_time_spec>(
+		wrapper.vec.begin(), wrapper.vec.end(), value)));
+	EXPECT_EQ(value, sys_time<microseconds>{ -950000us });
+}
+
+TYPED_TEST(Asn1TestFixture, GeneralizedTimeSysTimeOutOfRange)
+{
+	buffer_wrapper_base<typename TestFixture::byte_type,
+		'2', '5', '9', '1', '0', '5', '2', '4', '1', '1',
+		'2', '2', '3', '3', 'Z'> wrapper;
+	using decoder = asn1::detail::der::der_decoder<decltype(wrapper.state),
+		asn1::decode_options<>, asn1::detail::parent_context_list<>,
+		generalized_time_spec, std::chrono::sys_time<std::chrono::nanoseconds>>;
+	std::chrono::sys_time<std::chrono::nanoseconds> value;
+	EXPECT_THAT(([&]() { decoder::decode_implicit(wrapper.vec.size(), value, wrapper.state); }),
+		Throws<asn1::parse_error>(HasContext("GeneralizedTime")));
+}
+
+TYPED_TEST(Asn1TestFixture, GeneralizedTimeSysTimeInvalidDay)
+{
+	buffer_wrapper_base<typename TestFixture::byte_type,
+		24, 15, '2', '0', '2', '3', '0', '2', '2', '9', '1', '1',
+		'2', '2', '3', '3', 'Z'> wrapper;
+	std::chrono::sys_seconds value;
+	EXPECT_THAT(([&]() { asn1::der::decode<generalized_time_spec>(
+		wrapper.vec.begin(), wrapper.vec.end(), value); }),
+		Throws<asn1::parse_error>(HasContext("GeneralizedTime")));
+}
+
+TYPED_TEST(Asn1TestFixture, UtcTimeSysTime)
+{
+	using namespace std::chrono;
+	using spec_type = asn1::spec::utc_time<asn1::opts::options<asn1::opts::zero_year<2000u>>>;
+
+	buffer_wrapper_base<typename TestFixture::byte_type,
+		23, 13, '5', '0', '1', '2', '3', '1', '2', '3',
+		'5', '9', '5', '9', 'Z'> wrapper;
+	sys_seconds value;
+	ASSERT_NO_THROW((asn1::der::decode<spec_type>(
+		wrapper.vec.begin(), wrapper.vec.end(), value)));
+	EXPECT_EQ(value, sys_days{ 2050y / December / 31 } + 23h + 59min + 59s);
+
+	buffer_wrapper_base<typename TestFixture::byte_type,
+		23, 13, '5', '1', '0', '1', '0', '1', '0', '0',
+		'0', '0', '0', '0', 'Z'> previous_century;
+	sys_time<milliseconds> milliseconds_value;
+	ASSERT_NO_THROW((asn1::der::decode<spec_type>(
+		previous_century.vec.begin(), previous_century.vec.end(), milliseconds_value)));
+	EXPECT_EQ(milliseconds_value, sys_days{ 1951y / January / 1 });
+
+	buffer_wrapper_base<typename TestFixture::byte_type,
+		23, 13, '5', '1', '0', '1', '0', '1', '0', 'x',
+		'0', '0', '0', '0', 'Z'> invalid;
+	EXPECT_THROW((asn1::der::decode<spec_type>(
+		invalid.vec.begin(), invalid.vec.end(), value)), asn1::parse_error);
+}
+
 namespace
 {
 struct linked_list_spec : asn1::spec::recursive<linked_list_spec>
@@ -2231,6 +3096,209 @@ TYPED_TEST(Asn1TestFixture, Validators)
 	EXPECT_EQ(value[0], 5u);
 }
 
+MATCHER_P(HasExactErrorContext, value, "") {
+	std::stringstream ss;
+	const char* delim = "";
+	for (const auto& ctx : arg.context)
+	{
+		if (!ctx.spec_name.empty())
+		{
+			ss << delim;
+			delim = "/";
+			ss << ctx.spec_name;
+		}
+	}
+	return ss.view() == value;
+}
+
+TYPED_TEST(Asn1TestFixture, TryDecode)
+{
+	buffer_wrapper_base<typename TestFixture::byte_type,
+		0x30u, 0x06u, 0x02u, 0x01u, 0x05u, 0x01u, 0x01u, 0xffu> wrapper;
+	using spec = asn1::spec::sequence<asn1::spec::integer<>, asn1::spec::boolean<>>;
+	struct value_type
+	{
+		int number;
+		bool flag;
+	} value{};
+	auto result = asn1::der::try_decode<spec>(wrapper.vec.cbegin(), wrapper.vec.cend(), value);
+	ASSERT_TRUE(result);
+	EXPECT_EQ(*result, wrapper.vec.cend());
+	EXPECT_EQ(value.number, 5);
+	EXPECT_TRUE(value.flag);
+}
+
+TYPED_TEST(Asn1TestFixture, TryDecodeError)
+{
+	buffer_wrapper_base<typename TestFixture::byte_type,
+		0x30u, 0x06u, 0x02u, 0x01u, 0x05u, 0x01u, 0x01u, 0x12u> wrapper;
+	using spec = asn1::spec::sequence_with_options<asn1::opts::named<"seq">,
+		asn1::spec::integer<>,
+		asn1::spec::boolean<asn1::opts::named<"flag">>>;
+	struct value_type
+	{
+		int number;
+		bool flag;
+	} value{};
+	auto result = asn1::der::try_decode<spec>(wrapper.vec.cbegin(), wrapper.vec.cend(), value);
+	ASSERT_FALSE(result);
+	EXPECT_EQ(result.error().code, asn1::decode_errc::invalid_value);
+	EXPECT_STREQ(result.error().message, "Invalid BOOLEAN value");
+	EXPECT_EQ(result.error().offset, 8u);
+	EXPECT_THAT(result.error(), HasExactErrorContext("seq/flag"));
+
+	EXPECT_THAT(([&]() { asn1::der::decode<spec>(
+		wrapper.vec.cbegin(), wrapper.vec.cend(), value); }),
+		Throws<asn1::parse_error>(AllOf(HasExactContext("seq/flag"),
+			Property(&asn1::parse_error::what, StrEq("Invalid BOOLEAN value")))));
+}
+
+TYPED_TEST(Asn1TestFixture, ParseErrorOffsetAndStaticContext)
+{
+	static_assert(std::is_nothrow_copy_constructible_v<asn1::parse_error>);
+	buffer_wrapper_base<typename TestFixture::byte_type,
+		0x30u, 0x06u, 0x02u, 0x01u, 0x05u, 0x01u, 0x01u, 0x12u> wrapper;
+	using spec = asn1::spec::sequence_with_options<asn1::opts::named<"seq">,
+		asn1::spec::integer<>,
+		asn1::spec::boolean<asn1::opts::named<"flag">>>;
+	struct value_type
+	{
+		int number;
+		bool flag;
+	} value{};
+	auto result = asn1::der::try_decode<spec>(wrapper.vec.cbegin(), wrapper.vec.cend(), value);
+	ASSERT_FALSE(result);
+
+	try
+	{
+		asn1::der::decode<spec>(wrapper.vec.cbegin(), wrapper.vec.cend(), value);
+		FAIL();
+	}
+	catch (const asn1::parse_error& e)
+	{
+		EXPECT_EQ(e.get_offset(), result.error().offset);
+		EXPECT_EQ(e.get_context().data(), result.error().context.data());
+		EXPECT_EQ(e.get_context().size(), result.error().context.size());
+	}
+}
+
+TYPED_TEST(Asn1TestFixture, TryDecodeErrorCodes)
+{
+	buffer_wrapper_base<typename TestFixture::byte_type,
+		0x30u, 0x03u, 0x02u, 0x01u, 0x05u, 0x00u> wrapper;
+	using spec = asn1::spec::sequence<asn1::spec::integer<>>;
+	struct value_type
+	{
+		int number;
+	};
+
+	auto result = asn1::der::try_decode<value_type, spec>(
+		wrapper.vec.cbegin(), wrapper.vec.cend());
+	ASSERT_FALSE(result);
+	EXPECT_EQ(result.error().code, asn1::decode_errc::unconsumed_data);
+	EXPECT_EQ(result.error().offset, 5u);
+
+	result = asn1::der::try_decode<value_type, spec>(
+		wrapper.vec.cbegin(), wrapper.vec.cbegin() + 3);
+	ASSERT_FALSE(result);
+	EXPECT_EQ(result.error().code, asn1::decode_errc::invalid_header);
+
+	result = asn1::der::try_decode<value_type, spec>(
+		wrapper.vec.cbegin() + 2, wrapper.vec.cend() - 1);
+	ASSERT_FALSE(result);
+	EXPECT_EQ(result.error().code, asn1::decode_errc::unexpected_tag);
+	EXPECT_STREQ(result.error().message, "Expected SEQUENCE");
+
+	result = asn1::der::try_decode<value_type, spec>(
+		wrapper.vec.cbegin(), wrapper.vec.cend() - 1);
+	ASSERT_TRUE(result);
+	EXPECT_EQ(result->number, 5);
+}
+
+TYPED_TEST(Asn1TestFixture, TryDecodeValidators)
+{
+	constexpr auto throwing_validator = [](int val) {
+		if (val > 5)
+			throw std::runtime_error("Too big");
+	};
+	constexpr auto bool_validator = [](int val) { return val <= 5; };
+	buffer_wrapper_base<typename TestFixture::byte_type,
+		0x31u, 0x09u, 2, 1, 5, 2, 1, 10, 2, 1, 1> wrapper;
+	using throwing_spec = asn1::spec::set_of_with_options<
+		asn1::opts::named<"set_of">,
+		asn1::spec::integer<asn1::opts::options<
+			asn1::opts::name<"int">,
+			asn1::opts::validator_func<throwing_validator>
+		>>
+	>;
+	using bool_spec = asn1::spec::set_of_with_options<
+		asn1::opts::named<"set_of">,
+		asn1::spec::integer<asn1::opts::options<
+			asn1::opts::name<"int">,
+			asn1::opts::validator_func<bool_validator>
+		>>
+	>;
+
+	auto result = asn1::der::try_decode<std::vector<int>, throwing_spec>(
+		wrapper.vec.cbegin(), wrapper.vec.cend());
+	ASSERT_FALSE(result);
+	EXPECT_EQ(result.error().code, asn1::decode_errc::validation_failed);
+	EXPECT_THAT(result.error(), HasExactErrorContext("set_of/int"));
+
+	result = asn1::der::try_decode<std::vector<int>, bool_spec>(
+		wrapper.vec.cbegin(), wrapper.vec.cend());
+	ASSERT_FALSE(result);
+	EXPECT_EQ(result.error().code, asn1::decode_errc::validation_failed);
+	EXPECT_EQ(result.error().offset, 8u);
+
+	std::vector<int> value;
+	EXPECT_THAT(([&]() { asn1::der::decode<bool_spec>(
+		wrapper.vec.begin(), wrapper.vec.end(), value); }),
+		Throws<asn1::parse_error>(HasExactContext("set_of/int")));
+}
+
+TYPED_TEST(Asn1TestFixture, TryDecodeRecursionDepth)
+{
+	optional_list_wrapper_type<typename TestFixture::byte_type> wrapper;
+	optional_linked_list_wrapper value;
+	auto result = asn1::der::try_decode<optional_recursive_spec>(3u,
+		wrapper.vec.begin(), wrapper.vec.end(), value);
+	ASSERT_FALSE(result);
+	EXPECT_EQ(result.error().code, asn1::decode_errc::recursion_depth);
+	EXPECT_THAT(result.error(), HasExactErrorContext("LinkedList/LinkedListNode"));
+}
+
+TYPED_TEST(Asn1TestFixture, LazyRecursionDepth)
+{
+	struct lazy_linked_list_wrapper
+	{
+		bool value;
+		asn1::lazy<std::span<const typename TestFixture::byte_type>,
+			optional_linked_list> list;
+	};
+
+	optional_list_wrapper_type<typename TestFixture::byte_type> wrapper;
+	lazy_linked_list_wrapper value{};
+	ASSERT_NO_THROW((asn1::der::decode<optional_recursive_spec>(3u,
+		wrapper.vec.begin(), wrapper.vec.end(), value)));
+	EXPECT_FALSE(value.list.is_decoded());
+
+	auto result = value.list.try_get();
+	ASSERT_FALSE(result);
+	EXPECT_EQ(result.error().code, asn1::decode_errc::recursion_depth);
+	EXPECT_THAT(result.error(), HasExactErrorContext("LinkedList/LinkedListNode"));
+	EXPECT_FALSE(value.list.is_decoded());
+	EXPECT_THAT(([&]() { (void)value.list.get(); }),
+		Throws<asn1::parse_error>(HasExactContext("LinkedList/LinkedListNode")));
+
+	ASSERT_NO_THROW((asn1::der::decode<optional_recursive_spec>(100u,
+		wrapper.vec.begin(), wrapper.vec.end(), value)));
+	result = value.list.try_get();
+	ASSERT_TRUE(result);
+	EXPECT_EQ((*result)->value, 1);
+	EXPECT_TRUE(value.list.is_decoded());
+}
+
 TYPED_TEST(Asn1TestFixture, TaggedExplicitFwdIterator)
 {
 	using type = typename TestFixture::byte_type;
@@ -2280,6 +3348,170 @@ TYPED_TEST(Asn1TestFixture, SequenceOfTooManyElems)
 		wrapper.vec.begin(), wrapper.vec.end(), value)), asn1::parse_error);
 }
 
+TYPED_TEST(Asn1TestFixture, SequenceOfCountAndReserve)
+{
+	buffer_wrapper_base<typename TestFixture::byte_type,
+		0x30u, 0x0au,
+		0x02u, 0x02u, 0x03u, 0x05u,
+		0x02u, 0x01u, 0x07u,
+		0x02u, 0x01u, 0x08u
+	> wrapper;
+
+	using spec = asn1::spec::sequence_of_with_options<
+		asn1::opts::options<asn1::opts::count_and_reserve>,
+		asn1::spec::integer<>>;
+	std::vector<std::int16_t> value{};
+	ASSERT_NO_THROW((asn1::der::decode<spec>(
+		wrapper.vec.begin(), wrapper.vec.end(), value)));
+	EXPECT_EQ(value, (std::vector<std::int16_t>{ 0x0305u, 0x07u, 0x08u }));
+	EXPECT_EQ(value.capacity(), 3u);
+}
+
+TYPED_TEST(Asn1TestFixture, SequenceOfCountAndReserveInvalidElement)
+{
+	buffer_wrapper_base<typename TestFixture::byte_type,
+		0x30u, 0x07u,
+		0x02u, 0x01u, 0x07u,
+		0x02u, 0x05u, 0x01u, 0x02u
+	> wrapper;
+
+	using spec = asn1::spec::set_of_with_options<
+		asn1::opts::options<asn1::opts::count_and_reserve>,
+		asn1::spec::integer<>>;
+	std::vector<std::int16_t> value{};
+	EXPECT_THROW((asn1::der::decode<spec>(
+		wrapper.vec.begin(), wrapper.vec.end(), value)), asn1::parse_error);
+}
+
+TYPED_TEST(Asn1TestFixture, SequenceOfCountAndReserveManyTinyElements)
+{
+	//100 NULL element headers, while each element must be
+	//a SEQUENCE of at least 11 bytes
+	std::vector<typename TestFixture::byte_type> data{
+		static_cast<typename TestFixture::byte_type>(0x30u),
+		static_cast<typename TestFixture::byte_type>(0x81u),
+		static_cast<typename TestFixture::byte_type>(200u) };
+	for (std::size_t i = 0; i != 100u; ++i)
+	{
+		data.push_back(static_cast<typename TestFixture::byte_type>(0x05u));
+		data.push_back(static_cast<typename TestFixture::byte_type>(0x00u));
+	}
+
+	using spec = asn1::spec::sequence_of_with_options<
+		asn1::opts::options<asn1::opts::count_and_reserve>,
+		asn1::spec::sequence<asn1::spec::integer<>, asn1::spec::integer<>,
+			asn1::spec::integer<>>>;
+	struct element_type
+	{
+		std::int32_t a, b, c;
+	};
+	std::vector<element_type> value{};
+	EXPECT_THROW((asn1::der::decode<spec>(data.begin(), data.end(), value)),
+		asn1::parse_error);
+	EXPECT_LE(value.capacity(), 200u / 11u);
+}
+
+TYPED_TEST(Asn1TestFixture, SequenceOfReserveHint)
+{
+	buffer_wrapper_base<typename TestFixture::byte_type,
+		0x30u, 0x03u,
+		0x02u, 0x01u, 0x07u
+	> wrapper;
+
+	using spec = asn1::spec::sequence_of_with_options<
+		asn1::opts::options<asn1::opts::reserve_hint<16>>,
+		asn1::spec::integer<>>;
+	std::vector<std::int16_t> value{};
+	ASSERT_NO_THROW((asn1::der::decode<spec>(
+		wrapper.vec.begin(), wrapper.vec.end(), value)));
+	EXPECT_EQ(value, (std::vector<std::int16_t>{ 0x07u }));
+	EXPECT_GE(value.capacity(), 16u);
+
+	using limited_spec = asn1::spec::sequence_of_with_options<
+		asn1::opts::options<asn1::opts::reserve_hint<16>,
+			asn1::opts::min_max_elements<1, 4>>,
+		asn1::spec::integer<>>;
+	std::vector<std::int16_t> limited_value{};
+	ASSERT_NO_THROW((asn1::der::decode<limited_spec>(
+		wrapper.vec.begin(), wrapper.vec.end(), limited_value)));
+	EXPECT_EQ(limited_value.capacity(), 4u);
+
+	//Containers without reserve() are filled as usual
+	std::deque<std::int16_t> deque_value{};
+	ASSERT_NO_THROW((asn1::der::decode<spec>(
+		wrapper.vec.begin(), wrapper.vec.end(), deque_value)));
+	EXPECT_EQ(deque_value, (std::deque<std::int16_t>{ 0x07u }));
+}
+
+namespace
+{
+using memory_resource_spec = asn1::spec::sequence<
+	asn1::spec::sequence_of<asn1::spec::utf8_string<>>,
+	asn1::spec::octet_string<>,
+	asn1::spec::object_identifier<>
+>;
+
+template<typename ByteType>
+struct memory_resource_value
+{
+	std::pmr::vector<std::pmr::string> strings;
+	std::pmr::vector<ByteType> octets;
+	asn1::decoded_object_identifier<std::pmr::vector<std::uint32_t>> oid;
+};
+
+template<typename ByteType>
+using memory_resource_wrapper_type = buffer_wrapper_base<ByteType,
+	0x30u, 0x26u,
+		0x30u, 0x1au,
+			0x0cu, 0x02u, 'a', 'b',
+			0x0cu, 0x14u, 'a', 'b', 'c', 'd', 'e', 'f', 'g', 'h', 'i', 'j',
+				'k', 'l', 'm', 'n', 'o', 'p', 'q', 'r', 's', 't',
+		0x04u, 0x03u, 0x01u, 0x02u, 0x03u,
+		0x06u, 0x03u, 0x2au, 0x86u, 0x48u>;
+} //namespace
+
+TYPED_TEST(Asn1TestFixture, DecodeWithMemoryResource)
+{
+	memory_resource_wrapper_type<typename TestFixture::byte_type> wrapper;
+	std::array<std::byte, 1024> buffer;
+	std::pmr::monotonic_buffer_resource arena(buffer.data(), buffer.size(),
+		std::pmr::null_memory_resource());
+
+	//Any allocation from the default resource would throw
+	auto previous_resource = std::pmr::set_default_resource(
+		std::pmr::null_memory_resource());
+	memory_resource_value<typename TestFixture::byte_type> value;
+	asn1::decode_state state(wrapper.vec.cbegin(), wrapper.vec.cend(), &arena);
+	EXPECT_NO_THROW((asn1::der::decode<memory_resource_spec>(state, value)));
+	std::pmr::set_default_resource(previous_resource);
+
+	EXPECT_EQ(value.strings.get_allocator().resource(), &arena);
+	ASSERT_EQ(value.strings.size(), 2u);
+	EXPECT_EQ(value.strings[0], "ab");
+	EXPECT_EQ(value.strings[1], "abcdefghijklmnopqrst");
+	EXPECT_EQ(value.strings[1].get_allocator().resource(), &arena);
+	EXPECT_EQ(value.octets.get_allocator().resource(), &arena);
+	EXPECT_EQ(value.octets.size(), 3u);
+	EXPECT_EQ(value.oid.container.get_allocator().resource(), &arena);
+	EXPECT_EQ(value.oid.container, (std::pmr::vector<std::uint32_t>{ 1u, 2u, 840u }));
+}
+
+TYPED_TEST(Asn1TestFixture, DecodeWithoutMemoryResource)
+{
+	memory_resource_wrapper_type<typename TestFixture::byte_type> wrapper;
+	std::pmr::monotonic_buffer_resource resource;
+	memory_resource_value<typename TestFixture::byte_type> value{
+		std::pmr::vector<std::pmr::string>(&resource), {}, {} };
+	ASSERT_NO_THROW((asn1::der::decode<memory_resource_spec>(
+		wrapper.vec.cbegin(), wrapper.vec.cend(), value)));
+
+	EXPECT_EQ(value.strings.get_allocator().resource(), &resource);
+	ASSERT_EQ(value.strings.size(), 2u);
+	EXPECT_EQ(value.strings[1].get_allocator().resource(), &resource);
+	EXPECT_EQ(value.octets.get_allocator().resource(),
+		std::pmr::get_default_resource());
+}
+
 namespace
 {
 namespace my_spec
@@ -0,0 +1,83 @@
+// SPDX-License-Identifier: MIT
+
+//Checks that try_decode and sequence_of_view can be used when exceptions are disabled
+
+#include <array>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <string_view>
+#include <vector>
+
+#include "simple_asn1/der_decode.h"
+#include "simple_asn1/spec.h"
+#include "simple_asn1/types.h"
+
+namespace
+{
+constexpr auto validator = [](int value) { return value <= 5; };
+
+using spec = asn1::spec::sequence_with_options<
+	asn1::opts::named<"Data">,
+	asn1::spec::integer<asn1::opts::options<
+		asn1::opts::name<"Number">,
+		asn1::opts::validator_func<validator>
+	>>,
+	asn1::spec::optional<asn1::spec::boolean<>>,
+	asn1::spec::sequence_of<asn1::spec::object_identifier<>>
+>;
+
+struct data
+{
+	int number;
+	std::optional<bool> flag;
+	std::vector<asn1::decoded_object_identifier<std::vector<std::uint32_t>>> oids;
+};
+} //namespace
+
+int main()
+{
+	constexpr auto valid = std::to_array<std::uint8_t>({
+		0x30u, 0x0du, 0x02u, 0x01u, 0x05u, 0x30u, 0x08u,
+		0x06u, 0x06u, 0x2au, 0x86u, 0x48u, 0x86u, 0xf7u, 0x0du });
+	auto result = asn1::der::try_decode<data, spec>(valid.begin(), valid.end());
+	if (!result || result->number != 5 || result->flag || result->oids.size() != 1u
+		|| result->oids[0].container != std::vector<std::uint32_t>{ 1u, 2u, 840u, 113549u })
+	{
+		return 1;
+	}
+
+	auto invalid = valid;
+	invalid[4] = 6u;
+	result = asn1::der::try_decode<data, spec>(invalid.begin(), invalid.end());
+	if (result || result.error().code != asn1::decode_errc::validation_failed
+		|| result.error().offset != 5u || result.error().context.size() != 2u
+		|| result.error().context[1].spec_name != std::string_view("Number"))
+	{
+		return 1;
+	}
+
+	invalid = valid;
+	invalid[14] = 0x8du;
+	result = asn1::der::try_decode<data, spec>(invalid.begin(), invalid.end());
+	if (result || result.error().code != asn1::decode_errc::invalid_value)
+		return 1;
+
+	//sequence_of_view elements are decoded while iterating
+	using view_spec = asn1::spec::sequence_of<asn1::spec::integer<>>;
+	using view_type = asn1::sequence_of_view<std::span<const std::uint8_t>, int>;
+	constexpr auto list = std::to_array<std::uint8_t>({
+		0x30u, 0x06u, 0x02u, 0x01u, 0x05u, 0x04u, 0x01u, 0x06u });
+	auto view = asn1::der::try_decode<view_type, view_spec>(list.begin(), list.end());
+	if (!view)
+		return 1;
+
+	asn1::decode_error error;
+	int sum = 0;
+	for (auto it = view->begin(error); it != view->end(); ++it)
+		sum += *it;
+	if (sum != 5 || error.code != asn1::decode_errc::unexpected_tag || error.offset != 5u)
+		return 1;
+
+	return 0;
+}
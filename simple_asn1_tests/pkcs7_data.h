@@ -0,0 +1,1227 @@
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+
+//Authenticode PKCS#7 signature with the certificate chain
+//and a nested RFC3161 timestamp signature
+inline constexpr auto pkcs7 = std::to_array<std::uint8_t>({
+	0x30, 0x82, 0x4B, 0xF2, 0x06, 0x09, 0x2A, 0x86, 0x48, 0x86, 0xF7, 0x0D, 0x01, 0x07, 0x02, 0xA0,
+	0x82, 0x4B, 0xE3, 0x30, 0x82, 0x4B, 0xDF, 0x02, 0x01, 0x01, 0x31, 0x0F, 0x30, 0x0D, 0x06, 0x09,
+	0x60, 0x86, 0x48, 0x01, 0x65, 0x03, 0x04, 0x02, 0x01, 0x05, 0x00, 0x30, 0x5C, 0x06, 0x0A, 0x2B,
+	0x06, 0x01, 0x04, 0x01, 0x82, 0x37, 0x02, 0x01, 0x04, 0xA0, 0x4E, 0x30, 0x4C, 0x30, 0x17, 0x06,
+	0x0A, 0x2B, 0x06, 0x01, 0x04, 0x01, 0x82, 0x37, 0x02, 0x01, 0x0F, 0x30, 0x09, 0x03, 0x01, 0x00,
+	0xA0, 0x04, 0xA2, 0x02, 0x80, 0x00, 0x30, 0x31, 0x30, 0x0D, 0x06, 0x09, 0x60, 0x86, 0x48, 0x01,
+	0x65, 0x03, 0x04, 0x02, 0x01, 0x05, 0x00, 0x04, 0x20, 0xE0, 0xAE, 0xBF, 0xEA, 0x4A, 0x2E, 0x02,
+	0xD4, 0x8E, 0xA2, 0x79, 0x15, 0x25, 0xE2, 0xCF, 0x94, 0x1A, 0x79, 0xDC, 0x3B, 0x89, 0x2A, 0x62,
+	0x0C, 0x7A, 0xAD, 0xF3, 0x85, 0x75, 0x9A, 0xAA, 0x40, 0xA0, 0x82, 0x0D, 0xB7, 0x30, 0x82, 0x06,
+	0xB0, 0x30, 0x82, 0x04, 0x98, 0xA0, 0x03, 0x02, 0x01, 0x02, 0x02, 0x10, 0x08, 0xAD, 0x40, 0xB2,
+	0x60, 0xD2, 0x9C, 0x4C, 0x9F, 0x5E, 0xCD, 0xA9, 0xBD, 0x93, 0xAE, 0xD9, 0x30, 0x0D, 0x06, 0x09,
+	0x2A, 0x86, 0x48, 0x86, 0xF7, 0x0D, 0x01, 0x01, 0x0C, 0x05, 0x00, 0x30, 0x62, 0x31, 0x0B, 0x30,
+	0x09, 0x06, 0x03, 0x55, 0x04, 0x06, 0x13, 0x02, 0x55, 0x53, 0x31, 0x15, 0x30, 0x13, 0x06, 0x03,
+	0x55, 0x04, 0x0A, 0x13, 0x0C, 0x44, 0x69, 0x67, 0x69, 0x43, 0x65, 0x72, 0x74, 0x20, 0x49, 0x6E,
+	0x63, 0x31, 0x19, 0x30, 0x17, 0x06, 0x03, 0x55, 0x04, 0x0B, 0x13, 0x10, 0x77, 0x77, 0x77, 0x2E,
+	0x64, 0x69, 0x67, 0x69, 0x63, 0x65, 0x72, 0x74, 0x2E, 0x63, 0x6F, 0x6D, 0x31, 0x21, 0x30, 0x1F,
+	0x06, 0x03, 0x55, 0x04, 0x03, 0x13, 0x18, 0x44, 0x69, 0x67, 0x69, 0x43, 0x65, 0x72, 0x74, 0x20,
+	0x54, 0x72, 0x75, 0x73, 0x74, 0x65, 0x64, 0x20, 0x52, 0x6F, 0x6F, 0x74, 0x20, 0x47, 0x34, 0x30,
+	0x1E, 0x17, 0x0D, 0x32, 0x31, 0x30, 0x34, 0x32, 0x39, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x5A,
+	0x17, 0x0D, 0x33, 0x36, 0x30, 0x34, 0x32, 0x38, 0x32, 0x33, 0x35, 0x39, 0x35, 0x39, 0x5A, 0x30,
+	0x69, 0x31, 0x0B, 0x30, 0x09, 0x06, 0x03, 0x55, 0x04, 0x06, 0x13, 0x02, 0x55, 0x53, 0x31, 0x17,
+	0x30, 0x15, 0x06, 0x03, 0x55, 0x04, 0x0A, 0x13, 0x0E, 0x44, 0x69, 0x67, 0x69, 0x43, 0x65, 0x72,
+	0x74, 0x2C, 0x20, 0x49, 0x6E, 0x63, 0x2E, 0x31, 0x41, 0x30, 0x3F, 0x06, 0x03, 0x55, 0x04, 0x03,
+	0x13, 0x38, 0x44, 0x69, 0x67, 0x69, 0x43, 0x65, 0x72, 0x74, 0x20, 0x54, 0x72, 0x75, 0x73, 0x74,
+	0x65, 0x64, 0x20, 0x47, 0x34, 0x20, 0x43, 0x6F, 0x64, 0x65, 0x20, 0x53, 0x69, 0x67, 0x6E, 0x69,
+	0x6E, 0x67, 0x20, 0x52, 0x53, 0x41, 0x34, 0x30, 0x39, 0x36, 0x20, 0x53, 0x48, 0x41, 0x33, 0x38,
+	0x34, 0x20, 0x32, 0x30, 0x32, 0x31, 0x20, 0x43, 0x41, 0x31, 0x30, 0x82, 0x02, 0x22, 0x30, 0x0D,
+	0x06, 0x09, 0x2A, 0x86, 0x48, 0x86, 0xF7, 0x0D, 0x01, 0x01, 0x01, 0x05, 0x00, 0x03, 0x82, 0x02,
+	0x0F, 0x00, 0x30, 0x82, 0x02, 0x0A, 0x02, 0x82, 0x02, 0x01, 0x00, 0xD5, 0xB4, 0x2F, 0x42, 0xD0,
+	0x28, 0xAD, 0x78, 0xB7, 0x5D, 0xD5, 0x39, 0x59, 0x1B, 0xB1, 0x88, 0x42, 0xF5, 0x33, 0x8C, 0xEB,
+	0x3D, 0x81, 0x97, 0x70, 0xC5, 0xBB, 0xC4, 0x85, 0x26, 0x30, 0x9F, 0xA4, 0x8E, 0x68, 0xD8, 0x5C,
+	0xF5, 0xEB, 0x34, 0x24, 0x07, 0xE1, 0x4B, 0x4F, 0xD3, 0x78, 0x43, 0xF4, 0x17, 0xD7, 0x1E, 0xDA,
+	0xF9, 0xD2, 0xD5, 0x67, 0x1A, 0x52, 0x4F, 0x0E, 0xA1, 0x57, 0xFC, 0x88, 0x99, 0xC1, 0x91, 0xCC,
+	0x81, 0x03, 0x3E, 0x4D, 0x70, 0x24, 0x64, 0xB3, 0x8D, 0xE2, 0x08, 0x7D, 0x34, 0x7D, 0x4C, 0x80,
+	0x57, 0x12, 0x6B, 0x43, 0x9A, 0x99, 0xF2, 0xC5, 0x3B, 0x1F, 0xF2, 0xEF, 0xCB, 0x47, 0x5A, 0x13,
+	0xA6, 0x4C, 0xB3, 0x01, 0x20, 0x25, 0xF3, 0x10, 0xD3, 0x8B, 0xB2, 0xFB, 0x08, 0xF0, 0x8A, 0xE0,
+	0x9D, 0x09, 0xC0, 0x65, 0xA7, 0xFA, 0x98, 0x80, 0x49, 0x35, 0x87, 0x3D, 0x51, 0x19, 0xE8, 0x90,
+	0x21, 0x78, 0x45, 0x2E, 0xA1, 0x9F, 0x2C, 0xE1, 0x18, 0xC2, 0x1A, 0xCC, 0xC5, 0xEE, 0x93, 0x49,
+	0x70, 0x42, 0x32, 0x8F, 0xFB, 0xC6, 0xEA, 0x1C, 0xF3, 0x65, 0x68, 0x91, 0xA2, 0x4D, 0x4C, 0x82,
+	0x11, 0x48, 0x52, 0x68, 0xDE, 0x10, 0xBD, 0x14, 0x57, 0x5D, 0xE8, 0x18, 0x13, 0x65, 0xC5, 0x7F,
+	0xB2, 0x4F, 0x85, 0x2C, 0x48, 0xA4, 0x56, 0x84, 0x35, 0xD6, 0xF9, 0x2E, 0x9C, 0xAA, 0x00, 0x15,
+	0xD1, 0x37, 0xFE, 0x1A, 0x06, 0x94, 0xC2, 0x7C, 0xC8, 0xEA, 0x1B, 0x32, 0xE6, 0xCA, 0xC2, 0xF4,
+	0xA7, 0xA3, 0x03, 0x0E, 0x74, 0xA5, 0xAF, 0x39, 0xB6, 0xAB, 0x60, 0x12, 0xE3, 0xE8, 0xD6, 0xB9,
+	0xF7, 0x31, 0xE1, 0xDC, 0xAD, 0xE4, 0x18, 0xA0, 0xD8, 0xC1, 0x23, 0x47, 0x47, 0xB3, 0xA1, 0x0F,
+	0x6E, 0xA3, 0xAB, 0x6D, 0x98, 0x06, 0x83, 0x1B, 0xB7, 0x6A, 0x67, 0x2D, 0xD2, 0xBD, 0x44, 0x1A,
+	0x92, 0x10, 0x81, 0x8F, 0xB0, 0x3B, 0x09, 0xD7, 0xC7, 0x9B, 0x32, 0x5A, 0xC2, 0xFF, 0x6A, 0x60,
+	0x54, 0x8B, 0x49, 0xC1, 0x93, 0xED, 0xE1, 0xB4, 0x5C, 0xE0, 0x6F, 0xEB, 0x26, 0xF9, 0x8C, 0xD5,
+	0xB2, 0xF9, 0x38, 0x10, 0xE6, 0xEA, 0xCE, 0x91, 0xF5, 0xBE, 0xD3, 0xFB, 0x6F, 0x93, 0x61, 0x34,
+	0x5C, 0xBC, 0x93, 0x45, 0x28, 0x83, 0x36, 0x2A, 0x66, 0x28, 0x5F, 0xB0, 0x73, 0xCE, 0x8B, 0x26,
+	0x25, 0x06, 0xB2, 0x83, 0xD4, 0x5C, 0xF6, 0x15, 0x19, 0x4C, 0xED, 0x62, 0xE0, 0x5E, 0x33, 0xF2,
+	0xE8, 0xE8, 0xEC, 0x0A, 0xA7, 0xB0, 0x03, 0x2B, 0x91, 0xB2, 0x36, 0x79, 0xBE, 0xF7, 0xAD, 0x08,
+	0x1E, 0x75, 0xA6, 0x65, 0xCC, 0xBB, 0xE3, 0x48, 0x50, 0xF3, 0x77, 0x91, 0x1A, 0xFE, 0xDB, 0x50,
+	0xA2, 0x46, 0xC8, 0x61, 0x58, 0x98, 0xF5, 0x7C, 0x02, 0x16, 0x3C, 0x83, 0x28, 0xAD, 0x39, 0x86,
+	0xEC, 0xD4, 0xB7, 0x0D, 0x53, 0xD0, 0xF8, 0x47, 0xE6, 0x75, 0x30, 0x8D, 0xEC, 0x30, 0x93, 0x76,
+	0x14, 0xA6, 0x5B, 0x4B, 0x5D, 0x74, 0x61, 0x4D, 0x3F, 0x12, 0x91, 0x76, 0xDE, 0xBF, 0x58, 0xCB,
+	0x72, 0x10, 0x29, 0x41, 0xF0, 0xD5, 0xC5, 0x6D, 0x26, 0x76, 0x68, 0x11, 0x41, 0x13, 0x58, 0x9A,
+	0xDC, 0x26, 0x2B, 0x01, 0xF4, 0x89, 0x4D, 0x59, 0xDB, 0x78, 0xCF, 0x81, 0x4A, 0x3E, 0x40, 0x47,
+	0x5F, 0xC9, 0x81, 0x50, 0x73, 0x85, 0x10, 0x23, 0x21, 0x59, 0x60, 0x8A, 0x64, 0x54, 0xC1, 0xCC,
+	0x21, 0x1A, 0xE8, 0x38, 0x19, 0x7C, 0x66, 0x1C, 0xCD, 0x78, 0x38, 0x45, 0x30, 0x99, 0x4F, 0xFF,
+	0x63, 0x4F, 0x4C, 0xBB, 0xAA, 0x0D, 0x08, 0x53, 0x41, 0x7C, 0x58, 0x3D, 0x47, 0xB3, 0xFA, 0xB6,
+	0xEC, 0x8C, 0x32, 0x09, 0x02, 0xCC, 0x6C, 0x3C, 0x0C, 0x56, 0x11, 0x02, 0x03, 0x01, 0x00, 0x01,
+	0xA3, 0x82, 0x01, 0x59, 0x30, 0x82, 0x01, 0x55, 0x30, 0x12, 0x06, 0x03, 0x55, 0x1D, 0x13, 0x01,
+	0x01, 0xFF, 0x04, 0x08, 0x30, 0x06, 0x01, 0x01, 0xFF, 0x02, 0x01, 0x00, 0x30, 0x1D, 0x06, 0x03,
+	0x55, 0x1D, 0x0E, 0x04, 0x16, 0x04, 0x14, 0x68, 0x37, 0xE0, 0xEB, 0xB6, 0x3B, 0xF8, 0x5F, 0x11,
+	0x86, 0xFB, 0xFE, 0x61, 0x7B, 0x08, 0x88, 0x65, 0xF4, 0x4E, 0x42, 0x30, 0x1F, 0x06, 0x03, 0x55,
+	0x1D, 0x23, 0x04, 0x18, 0x30, 0x16, 0x80, 0x14, 0xEC, 0xD7, 0xE3, 0x82, 0xD2, 0x71, 0x5D, 0x64,
+	0x4C, 0xDF, 0x2E, 0x67, 0x3F, 0xE7, 0xBA, 0x98, 0xAE, 0x1C, 0x0F, 0x4F, 0x30, 0x0E, 0x06, 0x03,
+	0x55, 0x1D, 0x0F, 0x01, 0x01, 0xFF, 0x04, 0x04, 0x03, 0x02, 0x01, 0x86, 0x30, 0x13, 0x06, 0x03,
+	0x55, 0x1D, 0x25, 0x04, 0x0C, 0x30, 0x0A, 0x06, 0x08, 0x2B, 0x06, 0x01, 0x05, 0x05, 0x07, 0x03,
+	0x03, 0x30, 0x77, 0x06, 0x08, 0x2B, 0x06, 0x01, 0x05, 0x05, 0x07, 0x01, 0x01, 0x04, 0x6B, 0x30,
+	0x69, 0x30, 0x24, 0x06, 0x08, 0x2B, 0x06, 0x01, 0x05, 0x05, 0x07, 0x30, 0x01, 0x86, 0x18, 0x68,
+	0x74, 0x74, 0x70, 0x3A, 0x2F, 0x2F, 0x6F, 0x63, 0x73, 0x70, 0x2E, 0x64, 0x69, 0x67, 0x69, 0x63,
+	0x65, 0x72, 0x74, 0x2E, 0x63, 0x6F, 0x6D, 0x30, 0x41, 0x06, 0x08, 0x2B, 0x06, 0x01, 0x05, 0x05,
+	0x07, 0x30, 0x02, 0x86, 0x35, 0x68, 0x74, 0x74, 0x70, 0x3A, 0x2F, 0x2F, 0x63, 0x61, 0x63, 0x65,
+	0x72, 0x74, 0x73, 0x2E, 0x64, 0x69, 0x67, 0x69, 0x63, 0x65, 0x72, 0x74, 0x2E, 0x63, 0x6F, 0x6D,
+	0x2F, 0x44, 0x69, 0x67, 0x69, 0x43, 0x65, 0x72, 0x74, 0x54, 0x72, 0x75, 0x73, 0x74, 0x65, 0x64,
+	0x52, 0x6F, 0x6F, 0x74, 0x47, 0x34, 0x2E, 0x63, 0x72, 0x74, 0x30, 0x43, 0x06, 0x03, 0x55, 0x1D,
+	0x1F, 0x04, 0x3C, 0x30, 0x3A, 0x30, 0x38, 0xA0, 0x36, 0xA0, 0x34, 0x86, 0x32, 0x68, 0x74, 0x74,
+	0x70, 0x3A, 0x2F, 0x2F, 0x63, 0x72, 0x6C, 0x33, 0x2E, 0x64, 0x69, 0x67, 0x69, 0x63, 0x65, 0x72,
+	0x74, 0x2E, 0x63, 0x6F, 0x6D, 0x2F, 0x44, 0x69, 0x67, 0x69, 0x43, 0x65, 0x72, 0x74, 0x54, 0x72,
+	0x75, 0x73, 0x74, 0x65, 0x64, 0x52, 0x6F, 0x6F, 0x74, 0x47, 0x34, 0x2E, 0x63, 0x72, 0x6C, 0x30,
+	0x1C, 0x06, 0x03, 0x55, 0x1D, 0x20, 0x04, 0x15, 0x30, 0x13, 0x30, 0x07, 0x06, 0x05, 0x67, 0x81,
+	0x0C, 0x01, 0x03, 0x30, 0x08, 0x06, 0x06, 0x67, 0x81, 0x0C, 0x01, 0x04, 0x01, 0x30, 0x0D, 0x06,
+	0x09, 0x2A, 0x86, 0x48, 0x86, 0xF7, 0x0D, 0x01, 0x01, 0x0C, 0x05, 0x00, 0x03, 0x82, 0x02, 0x01,
+	0x00, 0x3A, 0x23, 0x44, 0x3D, 0x8D, 0x08, 0x76, 0xEE, 0x8F, 0xBC, 0x3A, 0x99, 0xD3, 0x56, 0xE0,
+	0x02, 0x1A, 0xA5, 0xF8, 0x48, 0x34, 0xF3, 0x2C, 0xB6, 0xE6, 0x74, 0x66, 0xF7, 0x94, 0x72, 0xB1,
+	0x00, 0xCA, 0xAF, 0x6C, 0x30, 0x27, 0x13, 0x12, 0x9E, 0x90, 0x44, 0x9F, 0x4B, 0xFD, 0x9E, 0xA3,
+	0x7C, 0x26, 0xD5, 0x37, 0xBC, 0x3A, 0x5D, 0x48, 0x6D, 0x95, 0xD5, 0x3F, 0x49, 0xF4, 0x27, 0xBB,
+	0x16, 0x81, 0x45, 0x50, 0xFD, 0x9C, 0xBD, 0xB6, 0x85, 0xE0, 0x76, 0x7E, 0x37, 0x71, 0xCB, 0x22,
+	0xF7, 0x5A, 0xAA, 0x90, 0xCF, 0xF5, 0x93, 0x6A, 0xE3, 0xEB, 0x20, 0xD1, 0xD5, 0x50, 0x79, 0x88,
+	0x9A, 0x8A, 0x8A, 0xC1, 0xB6, 0xBD, 0xA1, 0x48, 0x18, 0x7E, 0xDC, 0xD8, 0x80, 0x1A, 0x11, 0x19,
+	0x18, 0xCD, 0x61, 0x99, 0x81, 0x56, 0xF6, 0xC9, 0xE3, 0x76, 0xE7, 0xC4, 0xE4, 0x1B, 0x5F, 0x43,
+	0xF8, 0x3E, 0x94, 0xFF, 0x76, 0x39, 0x3D, 0x9E, 0xD4, 0x99, 0xCF, 0x4A, 0xDD, 0x28, 0xEB, 0x5F,
+	0x26, 0xA1, 0x95, 0x58, 0x48, 0xD5, 0x1A, 0xFE, 0xD7, 0x27, 0x3F, 0xFD, 0x90, 0xD1, 0x76, 0x86,
+	0xDD, 0x1C, 0xB0, 0x60, 0x5C, 0xF3, 0x0D, 0xA8, 0xEE, 0xE0, 0x89, 0xA1, 0xBD, 0x39, 0xE1, 0x38,
+	0x4E, 0xDA, 0x6E, 0xBB, 0x36, 0x9D, 0xFB, 0xE5, 0x21, 0x53, 0x5A, 0xC3, 0xCA, 0xE9, 0x6A, 0xF1,
+	0xA2, 0x3E, 0xDB, 0x43, 0xB8, 0x33, 0xC8, 0x4F, 0x38, 0x14, 0x92, 0x99, 0xF5, 0xDD, 0xCE, 0x54,
+	0x6D, 0xD9, 0x5D, 0x02, 0x14, 0x1F, 0x40, 0x33, 0x7C, 0x03, 0xE2, 0x95, 0xB2, 0xC2, 0x21, 0x75,
+	0x73, 0x52, 0xCB, 0x46, 0xD8, 0xC4, 0x34, 0x1C, 0xA2, 0xA5, 0x4B, 0x8D, 0xCD, 0x6F, 0x76, 0x37,
+	0x2C, 0x85, 0x3F, 0x1A, 0xCE, 0x26, 0xE9, 0x18, 0xBE, 0x90, 0x07, 0xB0, 0x43, 0x7F, 0x95, 0x88,
+	0x20, 0x82, 0x70, 0xF0, 0xCC, 0xCA, 0xEF, 0xFD, 0x29, 0x35, 0x5C, 0x1F, 0x89, 0x38, 0x55, 0xF7,
+	0x37, 0x8A, 0x8B, 0x09, 0xA1, 0xCB, 0x0B, 0xE9, 0x31, 0x1A, 0xFF, 0x2E, 0x19, 0x5C, 0x39, 0x71,
+	0xE1, 0xBE, 0x9C, 0xA7, 0x0A, 0x06, 0xD6, 0x26, 0x67, 0xB7, 0x92, 0xE6, 0x4E, 0x5F, 0xDE, 0x7A,
+	0xAC, 0x49, 0xCF, 0x2E, 0xA4, 0x74, 0x92, 0xAD, 0xDB, 0x3C, 0xA4, 0x9C, 0x86, 0x1F, 0xE3, 0xC1,
+	0x56, 0x1B, 0x2B, 0x23, 0xFF, 0x8F, 0xB5, 0xEA, 0x88, 0x7B, 0x70, 0x6B, 0xE6, 0xA0, 0xBA, 0xFD,
+	0x3A, 0x3F, 0x45, 0xA6, 0xC4, 0xE8, 0x16, 0x91, 0x52, 0x8B, 0x41, 0xC0, 0x48, 0x84, 0x4B, 0x96,
+	0x4D, 0xAB, 0x44, 0x40, 0xE3, 0x8D, 0xF0, 0x15, 0x28, 0xCE, 0xED, 0xF1, 0x18, 0x56, 0x07, 0x2A,
+	0x2F, 0x10, 0xC4, 0x0C, 0x08, 0x64, 0x3C, 0x33, 0x8F, 0xAE, 0x28, 0x8C, 0x3C, 0xCB, 0x8F, 0x88,
+	0x0B, 0x0D, 0xBF, 0x3B, 0xF4, 0xCE, 0x1E, 0x7B, 0x8E, 0xEF, 0xB5, 0xEB, 0xCB, 0xB7, 0xF0, 0x77,
+	0x13, 0xE6, 0xE7, 0x28, 0x3F, 0xAC, 0x12, 0xAE, 0xA5, 0x2F, 0x22, 0x6C, 0x41, 0xF9, 0x82, 0x5C,
+	0x15, 0x66, 0xCC, 0x6C, 0x0E, 0xCA, 0xC5, 0x86, 0xC3, 0xF6, 0x26, 0x33, 0x0C, 0x07, 0x4B, 0xA0,
+	0xD3, 0x07, 0x02, 0x6A, 0x6A, 0x40, 0x30, 0x48, 0x4B, 0x34, 0xA8, 0x51, 0x20, 0xBB, 0xAD, 0x1B,
+	0x85, 0x08, 0xE2, 0x59, 0x0D, 0x6D, 0xCA, 0x05, 0x50, 0x2B, 0xEA, 0x4A, 0x1C, 0x9E, 0xA5, 0xFD,
+	0xA0, 0xA7, 0x1F, 0x06, 0x74, 0xE7, 0xF2, 0xD6, 0x52, 0x90, 0xFD, 0xAF, 0x85, 0x48, 0x21, 0xF9,
+	0x57, 0x3B, 0xB4, 0x9C, 0x03, 0xED, 0x86, 0x45, 0xF4, 0xB4, 0x61, 0x6E, 0xBF, 0x68, 0xE2, 0x26,
+	0x60, 0x86, 0xEA, 0xC8, 0xAF, 0xA9, 0xFE, 0x94, 0x1D, 0xE7, 0x63, 0x1B, 0x3A, 0x86, 0x56, 0x78,
+	0x4E, 0x30, 0x82, 0x06, 0xFF, 0x30, 0x82, 0x04, 0xE7, 0xA0, 0x03, 0x02, 0x01, 0x02, 0x02, 0x10,
+	0x08, 0x00, 0xEE, 0x4E, 0xD1, 0xA9, 0x59, 0xCC, 0x98, 0x87, 0xE9, 0x05, 0xAD, 0x66, 0x2B, 0xFE,
+	0x30, 0x0D, 0x06, 0x09, 0x2A, 0x86, 0x48, 0x86, 0xF7, 0x0D, 0x01, 0x01, 0x0B, 0x05, 0x00, 0x30,
+	0x69, 0x31, 0x0B, 0x30, 0x09, 0x06, 0x03, 0x55, 0x04, 0x06, 0x13, 0x02, 0x55, 0x53, 0x31, 0x17,
+	0x30, 0x15, 0x06, 0x03, 0x55, 0x04, 0x0A, 0x13, 0x0E, 0x44, 0x69, 0x67, 0x69, 0x43, 0x65, 0x72,
+	0x74, 0x2C, 0x20, 0x49, 0x6E, 0x63, 0x2E, 0x31, 0x41, 0x30, 0x3F, 0x06, 0x03, 0x55, 0x04, 0x03,
+	0x13, 0x38, 0x44, 0x69, 0x67, 0x69, 0x43, 0x65, 0x72, 0x74, 0x20, 0x54, 0x72, 0x75, 0x73, 0x74,
+	0x65, 0x64, 0x20, 0x47, 0x34, 0x20, 0x43, 0x6F, 0x64, 0x65, 0x20, 0x53, 0x69, 0x67, 0x6E, 0x69,
+	0x6E, 0x67, 0x20, 0x52, 0x53, 0x41, 0x34, 0x30, 0x39, 0x36, 0x20, 0x53, 0x48, 0x41, 0x33, 0x38,
+	0x34, 0x20, 0x32, 0x30, 0x32, 0x31, 0x20, 0x43, 0x41, 0x31, 0x30, 0x1E, 0x17, 0x0D, 0x32, 0x32,
+	0x30, 0x32, 0x32, 0x36, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x5A, 0x17, 0x0D, 0x32, 0x33, 0x30,
+	0x33, 0x30, 0x31, 0x32, 0x33, 0x35, 0x39, 0x35, 0x39, 0x5A, 0x30, 0x81, 0x83, 0x31, 0x0B, 0x30,
+	0x09, 0x06, 0x03, 0x55, 0x04, 0x06, 0x13, 0x02, 0x55, 0x53, 0x31, 0x13, 0x30, 0x11, 0x06, 0x03,
+	0x55, 0x04, 0x08, 0x13, 0x0A, 0x43, 0x61, 0x6C, 0x69, 0x66, 0x6F, 0x72, 0x6E, 0x69, 0x61, 0x31,
+	0x14, 0x30, 0x12, 0x06, 0x03, 0x55, 0x04, 0x07, 0x13, 0x0B, 0x53, 0x61, 0x6E, 0x74, 0x61, 0x20,
+	0x43, 0x6C, 0x61, 0x72, 0x61, 0x31, 0x1B, 0x30, 0x19, 0x06, 0x03, 0x55, 0x04, 0x0A, 0x13, 0x12,
+	0x4E, 0x76, 0x69, 0x64, 0x69, 0x61, 0x20, 0x43, 0x6F, 0x72, 0x70, 0x6F, 0x72, 0x61, 0x74, 0x69,
+	0x6F, 0x6E, 0x31, 0x0F, 0x30, 0x0D, 0x06, 0x03, 0x55, 0x04, 0x0B, 0x13, 0x06, 0x49, 0x54, 0x2D,
+	0x4D, 0x49, 0x53, 0x31, 0x1B, 0x30, 0x19, 0x06, 0x03, 0x55, 0x04, 0x03, 0x13, 0x12, 0x4E, 0x76,
+	0x69, 0x64, 0x69, 0x61, 0x20, 0x43, 0x6F, 0x72, 0x70, 0x6F, 0x72, 0x61, 0x74, 0x69, 0x6F, 0x6E,
+	0x30, 0x82, 0x01, 0xA2, 0x30, 0x0D, 0x06, 0x09, 0x2A, 0x86, 0x48, 0x86, 0xF7, 0x0D, 0x01, 0x01,
+	0x01, 0x05, 0x00, 0x03, 0x82, 0x01, 0x8F, 0x00, 0x30, 0x82, 0x01, 0x8A, 0x02, 0x82, 0x01, 0x81,
+	0x00, 0xBC, 0xD4, 0x46, 0xF7, 0xA9, 0x38, 0x6C, 0xC2, 0x48, 0xCD, 0x3F, 0x17, 0x0C, 0x48, 0x07,
+	0xD5, 0xC8, 0xEF, 0xE0, 0xFF, 0xA7, 0x9D, 0xF2, 0x20, 0x58, 0xEC, 0x5E, 0x53, 0xDE, 0x40, 0x0E,
+	0xA6, 0x60, 0x10, 0xE2, 0xBC, 0x66, 0xE9, 0xC4, 0x6E, 0xF6, 0x46, 0x14, 0x99, 0x04, 0xD7, 0xB9,
+	0xEA, 0xE1, 0xFF, 0x7B, 0xC5, 0xE7, 0xC4, 0x23, 0x45, 0xEC, 0x45, 0xF9, 0xC8, 0x0A, 0x9B, 0x4B,
+	0xF0, 0x81, 0x8B, 0xEF, 0xF8, 0xC4, 0xBA, 0xBE, 0x4D, 0x54, 0x94, 0x82, 0x3A, 0x90, 0x1E, 0x49,
+	0x08, 0x80, 0x0C, 0x61, 0x1F, 0xAD, 0xF7, 0x1E, 0x31, 0x79, 0x0A, 0x44, 0xFD, 0x6F, 0xE5, 0x34,
+	0x99, 0xE5, 0xC2, 0x11, 0x66, 0x04, 0x60, 0x95, 0x7D, 0x26, 0x3A, 0xAB, 0x54, 0x48, 0xD9, 0x61,
+	0x21, 0xBE, 0xB2, 0x02, 0x25, 0x30, 0x42, 0x76, 0x1C, 0x14, 0x6C, 0x04, 0xDA, 0x6D, 0xD6, 0x2C,
+	0xC0, 0x1A, 0xE3, 0xAD, 0x32, 0x39, 0xDE, 0x7D, 0x0A, 0xAE, 0xA3, 0x3C, 0x3D, 0x2B, 0xAE, 0xDD,
+	0x4B, 0xB0, 0x0D, 0x1B, 0xBA, 0x41, 0x96, 0x2E, 0xF6, 0x20, 0x84, 0xBD, 0x95, 0x43, 0xD8, 0x7E,
+	0x68, 0x1C, 0x1B, 0x09, 0xFE, 0x66, 0xB6, 0xCB, 0x4B, 0xB7, 0xDF, 0x19, 0xA5, 0x3F, 0xD2, 0x6C,
+	0x96, 0x83, 0x3F, 0x16, 0x94, 0x5B, 0x8D, 0x36, 0x8B, 0xBD, 0x4E, 0x6E, 0x70, 0x6B, 0xCC, 0x21,
+	0xFC, 0x45, 0x56, 0x83, 0xE2, 0x99, 0xF1, 0x80, 0xAE, 0x25, 0x5F, 0x7E, 0xEE, 0x78, 0x0D, 0xC3,
+	0x02, 0x54, 0xED, 0x8F, 0x45, 0xA0, 0xC4, 0x0C, 0xD0, 0x4D, 0x04, 0x0D, 0xE8, 0x15, 0x35, 0x5A,
+	0xD8, 0x89, 0xDB, 0xE1, 0xDB, 0x13, 0xCA, 0x32, 0x82, 0xAC, 0x13, 0xB0, 0x6B, 0x80, 0x8A, 0xBC,
+	0x22, 0xB9, 0x3F, 0xD2, 0xD1, 0x82, 0x66, 0x5C, 0xAA, 0x04, 0xF7, 0xC2, 0xA8, 0xE2, 0xCD, 0x67,
+	0xBE, 0x21, 0x98, 0xD1, 0xCB, 0x98, 0xDB, 0x0D, 0x1B, 0x61, 0x4B, 0x54, 0x63, 0x06, 0x77, 0xBD,
+	0x73, 0x6D, 0xED, 0x5A, 0x55, 0xE5, 0xE2, 0x6F, 0xD0, 0xEA, 0x1D, 0xBE, 0xBE, 0x23, 0xF2, 0x7B,
+	0x37, 0x98, 0x4E, 0x39, 0xB8, 0xBB, 0x00, 0xEC, 0x9F, 0xE3, 0xE2, 0x21, 0xB4, 0x42, 0xED, 0xAB,
+	0xD6, 0xA4, 0x2C, 0xF4, 0x3A, 0xF4, 0x57, 0x6F, 0x51, 0x9D, 0xA0, 0x5C, 0x48, 0x5D, 0x72, 0x1D,
+	0x91, 0xB4, 0x49, 0xF2, 0x08, 0x0C, 0x97, 0xFD, 0xA2, 0xCD, 0x88, 0x1E, 0x81, 0xB3, 0xF4, 0x47,
+	0x96, 0x2D, 0x7D, 0x30, 0x39, 0x12, 0x42, 0x68, 0xE3, 0xD1, 0x84, 0xC2, 0x57, 0x96, 0x0D, 0xDA,
+	0x33, 0x31, 0x3F, 0xCF, 0x4E, 0xA5, 0x72, 0xB4, 0xD5, 0x88, 0xB6, 0x48, 0x61, 0x12, 0x0C, 0xFC,
+	0xF6, 0xE5, 0xEC, 0x86, 0x01, 0x4B, 0x88, 0x82, 0x04, 0xD6, 0xA2, 0x3C, 0x41, 0x86, 0xE8, 0x70,
+	0x9B, 0x02, 0x03, 0x01, 0x00, 0x01, 0xA3, 0x82, 0x02, 0x06, 0x30, 0x82, 0x02, 0x02, 0x30, 0x1F,
+	0x06, 0x03, 0x55, 0x1D, 0x23, 0x04, 0x18, 0x30, 0x16, 0x80, 0x14, 0x68, 0x37, 0xE0, 0xEB, 0xB6,
+	0x3B, 0xF8, 0x5F, 0x11, 0x86, 0xFB, 0xFE, 0x61, 0x7B, 0x08, 0x88, 0x65, 0xF4, 0x4E, 0x42, 0x30,
+	0x1D, 0x06, 0x03, 0x55, 0x1D, 0x0E, 0x04, 0x16, 0x04, 0x14, 0xC6, 0x47, 0xF3, 0x33, 0x9B, 0x84,
+	0x71, 0xBA, 0x6A, 0x0C, 0xFA, 0x9F, 0x05, 0xBB, 0x1C, 0x17, 0x4B, 0x4E, 0xCF, 0xAF, 0x30, 0x0E,
+	0x06, 0x03, 0x55, 0x1D, 0x0F, 0x01, 0x01, 0xFF, 0x04, 0x04, 0x03, 0x02, 0x07, 0x80, 0x30, 0x13,
+	0x06, 0x03, 0x55, 0x1D, 0x25, 0x04, 0x0C, 0x30, 0x0A, 0x06, 0x08, 0x2B, 0x06, 0x01, 0x05, 0x05,
+	0x07, 0x03, 0x03, 0x30, 0x81, 0xB5, 0x06, 0x03, 0x55, 0x1D, 0x1F, 0x04, 0x81, 0xAD, 0x30, 0x81,
+	0xAA, 0x30, 0x53, 0xA0, 0x51, 0xA0, 0x4F, 0x86, 0x4D, 0x68, 0x74, 0x74, 0x70, 0x3A, 0x2F, 0x2F,
+	0x63, 0x72, 0x6C, 0x33, 0x2E, 0x64, 0x69, 0x67, 0x69, 0x63, 0x65, 0x72, 0x74, 0x2E, 0x63, 0x6F,
+	0x6D, 0x2F, 0x44, 0x69, 0x67, 0x69, 0x43, 0x65, 0x72, 0x74, 0x54, 0x72, 0x75, 0x73, 0x74, 0x65,
+	0x64, 0x47, 0x34, 0x43, 0x6F, 0x64, 0x65, 0x53, 0x69, 0x67, 0x6E, 0x69, 0x6E, 0x67, 0x52, 0x53,
+	0x41, 0x34, 0x30, 0x39, 0x36, 0x53, 0x48, 0x41, 0x33, 0x38, 0x34, 0x32, 0x30, 0x32, 0x31, 0x43,
+	0x41, 0x31, 0x2E, 0x63, 0x72, 0x6C, 0x30, 0x53, 0xA0, 0x51, 0xA0, 0x4F, 0x86, 0x4D, 0x68, 0x74,
+	0x74, 0x70, 0x3A, 0x2F, 0x2F, 0x63, 0x72, 0x6C, 0x34, 0x2E, 0x64, 0x69, 0x67, 0x69, 0x63, 0x65,
+	0x72, 0x74, 0x2E, 0x63, 0x6F, 0x6D, 0x2F, 0x44, 0x69, 0x67, 0x69, 0x43, 0x65, 0x72, 0x74, 0x54,
+	0x72, 0x75, 0x73, 0x74, 0x65, 0x64, 0x47, 0x34, 0x43, 0x6F, 0x64, 0x65, 0x53, 0x69, 0x67, 0x6E,
+	0x69, 0x6E, 0x67, 0x52, 0x53, 0x41, 0x34, 0x30, 0x39, 0x36, 0x53, 0x48, 0x41, 0x33, 0x38, 0x34,
+	0x32, 0x30, 0x32, 0x31, 0x43, 0x41, 0x31, 0x2E, 0x63, 0x72, 0x6C, 0x30, 0x3E, 0x06, 0x03, 0x55,
+	0x1D, 0x20, 0x04, 0x37, 0x30, 0x35, 0x30, 0x33, 0x06, 0x06, 0x67, 0x81, 0x0C, 0x01, 0x04, 0x01,
+	0x30, 0x29, 0x30, 0x27, 0x06, 0x08, 0x2B, 0x06, 0x01, 0x05, 0x05, 0x07, 0x02, 0x01, 0x16, 0x1B,
+	0x68, 0x74, 0x74, 0x70, 0x3A, 0x2F, 0x2F, 0x77, 0x77, 0x77, 0x2E, 0x64, 0x69, 0x67, 0x69, 0x63,
+	0x65, 0x72, 0x74, 0x2E, 0x63, 0x6F, 0x6D, 0x2F, 0x43, 0x50, 0x53, 0x30, 0x81, 0x94, 0x06, 0x08,
+	0x2B, 0x06, 0x01, 0x05, 0x05, 0x07, 0x01, 0x01, 0x04, 0x81, 0x87, 0x30, 0x81, 0x84, 0x30, 0x24,
+	0x06, 0x08, 0x2B, 0x06, 0x01, 0x05, 0x05, 0x07, 0x30, 0x01, 0x86, 0x18, 0x68, 0x74, 0x74, 0x70,
+	0x3A, 0x2F, 0x2F, 0x6F, 0x63, 0x73, 0x70, 0x2E, 0x64, 0x69, 0x67, 0x69, 0x63, 0x65, 0x72, 0x74,
+	0x2E, 0x63, 0x6F, 0x6D, 0x30, 0x5C, 0x06, 0x08, 0x2B, 0x06, 0x01, 0x05, 0x05, 0x07, 0x30, 0x02,
+	0x86, 0x50, 0x68, 0x74, 0x74, 0x70, 0x3A, 0x2F, 0x2F, 0x63, 0x61, 0x63, 0x65, 0x72, 0x74, 0x73,
+	0x2E, 0x64, 0x69, 0x67, 0x69, 0x63, 0x65, 0x72, 0x74, 0x2E, 0x63, 0x6F, 0x6D, 0x2F, 0x44, 0x69,
+	0x67, 0x69, 0x43, 0x65, 0x72, 0x74, 0x54, 0x72, 0x75, 0x73, 0x74, 0x65, 0x64, 0x47, 0x34, 0x43,
+	0x6F, 0x64, 0x65, 0x53, 0x69, 0x67, 0x6E, 0x69, 0x6E, 0x67, 0x52, 0x53, 0x41, 0x34, 0x30, 0x39,
+	0x36, 0x53, 0x48, 0x41, 0x33, 0x38, 0x34, 0x32, 0x30, 0x32, 0x31, 0x43, 0x41, 0x31, 0x2E, 0x63,
+	0x72, 0x74, 0x30, 0x0C, 0x06, 0x03, 0x55, 0x1D, 0x13, 0x01, 0x01, 0xFF, 0x04, 0x02, 0x30, 0x00,
+	0x30, 0x0D, 0x06, 0x09, 0x2A, 0x86, 0x48, 0x86, 0xF7, 0x0D, 0x01, 0x01, 0x0B, 0x05, 0x00, 0x03,
+	0x82, 0x02, 0x01, 0x00, 0x18, 0x6D, 0x1B, 0xB9, 0x4D, 0x2A, 0xF6, 0x68, 0xB5, 0x6C, 0x80, 0xB8,
+	0x49, 0x22, 0x28, 0x52, 0x08, 0x15, 0x67, 0xB0, 0xC0, 0x4D, 0xAA, 0xAD, 0x9F, 0x63, 0x2D, 0x71,
+	0xCE, 0x40, 0xA1, 0x8D, 0x4A, 0x5D, 0x0F, 0x29, 0xA8, 0xD4, 0x40, 0xDE, 0xA7, 0x10, 0x02, 0x49,
+	0xBF, 0x2E, 0x81, 0xC8, 0x4D, 0xA3, 0xFA, 0xF1, 0x2D, 0x2E, 0xDF, 0xCC, 0x5D, 0x37, 0xF1, 0x36,
+	0xD9, 0x7A, 0x42, 0x5F, 0xF0, 0xB8, 0x76, 0xF9, 0x93, 0x1C, 0x33, 0xA4, 0xF8, 0x4E, 0x08, 0x2F,
+	0x8D, 0xBF, 0x2B, 0x42, 0x4C, 0xBC, 0xD1, 0xE5, 0x1F, 0x8C, 0xB6, 0xA0, 0x3F, 0x53, 0x9E, 0x1F,
+	0xC9, 0xE2, 0x49, 0x4A, 0x4F, 0xF5, 0x81, 0xAD, 0x7B, 0x2A, 0x04, 0x85, 0xD4, 0x6C, 0xED, 0xBD,
+	0x49, 0x0C, 0xA1, 0x9D, 0x38, 0x78, 0x0A, 0xE3, 0x92, 0x28, 0x4B, 0x81, 0xC2, 0xC7, 0xF5, 0x5B,
+	0x1B, 0x2A, 0xE1, 0x87, 0x95, 0x6B, 0x6D, 0x0D, 0xA3, 0xE0, 0x74, 0x31, 0x4E, 0xE3, 0xDD, 0x53,
+	0x13, 0x6A, 0xE6, 0x34, 0xE6, 0x29, 0xDE, 0x3F, 0x55, 0xED, 0x2F, 0xC5, 0x5B, 0x37, 0x29, 0xD3,
+	0x2B, 0x00, 0x03, 0x60, 0x20, 0x96, 0x5E, 0x5F, 0x39, 0x3B, 0x0A, 0x34, 0x7A, 0x2A, 0xD3, 0x60,
+	0xB0, 0x39, 0x82, 0x73, 0x07, 0x4C, 0x9D, 0x40, 0x9D, 0x94, 0x16, 0x83, 0x42, 0xDB, 0x3C, 0xE4,
+	0x0F, 0xCC, 0x13, 0x3D, 0xB9, 0xFE, 0x4A, 0x93, 0x73, 0x5B, 0x68, 0x00, 0x6B, 0x9B, 0x02, 0xD8,
+	0x41, 0x95, 0x20, 0x9D, 0xAA, 0x5B, 0x0D, 0xD1, 0xFF, 0xCE, 0xD6, 0x9F, 0x68, 0x01, 0xBF, 0x35,
+	0xE2, 0x24, 0xD5, 0xB4, 0x7C, 0xE2, 0x38, 0xBE, 0xB8, 0x51, 0x97, 0x86, 0x69, 0xA5, 0xD4, 0xD1,
+	0x1A, 0x9A, 0x0A, 0x8F, 0xF3, 0x57, 0x7F, 0x4E, 0x57, 0x8B, 0x72, 0x88, 0x62, 0x9B, 0x8A, 0x61,
+	0x8D, 0xAF, 0x96, 0xC7, 0x1B, 0x26, 0xB8, 0x6C, 0x31, 0x4E, 0xE5, 0x60, 0x30, 0x00, 0xD4, 0x88,
+	0x05, 0xC7, 0x14, 0xAF, 0x8E, 0x42, 0x3A, 0x7E, 0x5D, 0x1C, 0x94, 0x92, 0x26, 0x3B, 0xF5, 0x65,
+	0xD5, 0xCE, 0xC5, 0x4B, 0x75, 0x5E, 0x81, 0xBC, 0x1D, 0x11, 0xA6, 0x53, 0xA9, 0xC5, 0xB3, 0xB3,
+	0x82, 0x78, 0x8E, 0x3E, 0xDF, 0xBB, 0x09, 0xBD, 0xB9, 0xDD, 0xF2, 0xD8, 0x18, 0x46, 0xDD, 0xC0,
+	0xAC, 0x70, 0xD0, 0x5F, 0x3A, 0xCE, 0x6A, 0xED, 0xFC, 0xE1, 0xA4, 0xEC, 0x36, 0x81, 0x8A, 0xAD,
+	0x57, 0xB3, 0xDA, 0xE0, 0x47, 0xB6, 0xBC, 0x4D, 0x35, 0xAE, 0x00, 0x8E, 0x7E, 0x09, 0xDE, 0x02,
+	0x36, 0x9B, 0x8C, 0x5D, 0x65, 0x93, 0x8C, 0xA4, 0xD3, 0xAD, 0x33, 0xBA, 0x34, 0xDA, 0xB6, 0x25,
+	0x1C, 0x7D, 0x1A, 0x44, 0x2B, 0x00, 0x3C, 0x06, 0x71, 0x86, 0xEF, 0x4E, 0x69, 0x06, 0xEB, 0x40,
+	0xC6, 0x7E, 0x50, 0x2B, 0x20, 0x2D, 0xA2, 0xB2, 0xEE, 0x8E, 0x66, 0x16, 0xD1, 0xF3, 0x38, 0x5C,
+	0x79, 0x9E, 0x63, 0x61, 0x6E, 0x4F, 0xCF, 0x95, 0x20, 0x3C, 0x31, 0xE3, 0x9B, 0x0C, 0x82, 0xCD,
+	0xB4, 0xBD, 0xBE, 0xE1, 0xEB, 0x9D, 0xC8, 0x53, 0x11, 0x86, 0xC3, 0xC0, 0x89, 0xBA, 0x81, 0x6F,
+	0x9D, 0xF4, 0xF3, 0xD8, 0x17, 0x64, 0x0C, 0x6B, 0x53, 0x39, 0x49, 0x28, 0xAE, 0xB6, 0xED, 0xCC,
+	0x8A, 0x75, 0xEF, 0xB8, 0x4F, 0x3E, 0x2B, 0xB8, 0x69, 0x33, 0x64, 0xA2, 0x7B, 0x56, 0xA6, 0xD0,
+	0xA0, 0x07, 0xD4, 0xD8, 0x48, 0xDB, 0x56, 0xBF, 0x3F, 0xA2, 0x6F, 0x21, 0x08, 0xD9, 0x18, 0x55,
+	0xDF, 0x59, 0xC2, 0x9E, 0x94, 0x33, 0x61, 0x55, 0xF7, 0x21, 0x8E, 0x21, 0x73, 0x9B, 0xED, 0xA3,
+	0x60, 0x19, 0x9B, 0xCD, 0x63, 0x33, 0xDC, 0x1D, 0x50, 0x33, 0xD7, 0xF8, 0x6E, 0xEA, 0x07, 0xEB,
+	0x27, 0x8A, 0x00, 0x0E, 0x31, 0x82, 0x3D, 0xAE, 0x30, 0x82, 0x3D, 0xAA, 0x02, 0x01, 0x01, 0x30,
+	0x7D, 0x30, 0x69, 0x31, 0x0B, 0x30, 0x09, 0x06, 0x03, 0x55, 0x04, 0x06, 0x13, 0x02, 0x55, 0x53,
+	0x31, 0x17, 0x30, 0x15, 0x06, 0x03, 0x55, 0x04, 0x0A, 0x13, 0x0E, 0x44, 0x69, 0x67, 0x69, 0x43,
+	0x65, 0x72, 0x74, 0x2C, 0x20, 0x49, 0x6E, 0x63, 0x2E, 0x31, 0x41, 0x30, 0x3F, 0x06, 0x03, 0x55,
+	0x04, 0x03, 0x13, 0x38, 0x44, 0x69, 0x67, 0x69, 0x43, 0x65, 0x72, 0x74, 0x20, 0x54, 0x72, 0x75,
+	0x73, 0x74, 0x65, 0x64, 0x20, 0x47, 0x34, 0x20, 0x43, 0x6F, 0x64, 0x65, 0x20, 0x53, 0x69, 0x67,
+	0x6E, 0x69, 0x6E, 0x67, 0x20, 0x52, 0x53, 0x41, 0x34, 0x30, 0x39, 0x36, 0x20, 0x53, 0x48, 0x41,
+	0x33, 0x38, 0x34, 0x20, 0x32, 0x30, 0x32, 0x31, 0x20, 0x43, 0x41, 0x31, 0x02, 0x10, 0x08, 0x00,
+	0xEE, 0x4E, 0xD1, 0xA9, 0x59, 0xCC, 0x98, 0x87, 0xE9, 0x05, 0xAD, 0x66, 0x2B, 0xFE, 0x30, 0x0D,
+	0x06, 0x09, 0x60, 0x86, 0x48, 0x01, 0x65, 0x03, 0x04, 0x02, 0x01, 0x05, 0x00, 0xA0, 0x7C, 0x30,
+	0x10, 0x06, 0x0A, 0x2B, 0x06, 0x01, 0x04, 0x01, 0x82, 0x37, 0x02, 0x01, 0x0C, 0x31, 0x02, 0x30,
+	0x00, 0x30, 0x19, 0x06, 0x09, 0x2A, 0x86, 0x48, 0x86, 0xF7, 0x0D, 0x01, 0x09, 0x03, 0x31, 0x0C,
+	0x06, 0x0A, 0x2B, 0x06, 0x01, 0x04, 0x01, 0x82, 0x37, 0x02, 0x01, 0x04, 0x30, 0x1C, 0x06, 0x0A,
+	0x2B, 0x06, 0x01, 0x04, 0x01, 0x82, 0x37, 0x02, 0x01, 0x0B, 0x31, 0x0E, 0x30, 0x0C, 0x06, 0x0A,
+	0x2B, 0x06, 0x01, 0x04, 0x01, 0x82, 0x37, 0x02, 0x01, 0x15, 0x30, 0x2F, 0x06, 0x09, 0x2A, 0x86,
+	0x48, 0x86, 0xF7, 0x0D, 0x01, 0x09, 0x04, 0x31, 0x22, 0x04, 0x20, 0x86, 0xE2, 0x83, 0x08, 0x59,
+	0xA5, 0x08, 0x71, 0xB1, 0xE6, 0xB1, 0x28, 0x84, 0x80, 0xFC, 0xF0, 0xD7, 0xC0, 0x77, 0x75, 0x79,
+	0x69, 0xA7, 0x65, 0x9D, 0x1F, 0x29, 0xDE, 0x8F, 0x07, 0xE2, 0x7C, 0x30, 0x0D, 0x06, 0x09, 0x2A,
+	0x86, 0x48, 0x86, 0xF7, 0x0D, 0x01, 0x01, 0x01, 0x05, 0x00, 0x04, 0x82, 0x01, 0x80, 0x4F, 0x6D,
+	0xF6, 0xB4, 0xE6, 0xF1, 0xC5, 0x92, 0x44, 0x7A, 0x1F, 0x54, 0x2C, 0xB2, 0x93, 0x31, 0x8B, 0xFD,
+	0x7C, 0xE8, 0x26, 0x97, 0xE1, 0xD1, 0x27, 0x32, 0x06, 0xB5, 0xCA, 0xAA, 0x16, 0x0D, 0xEC, 0x7A,
+	0xF6, 0x09, 0x96, 0xF4, 0x68, 0x33, 0x45, 0x5E, 0x0F, 0xDC, 0xAC, 0x1C, 0x77, 0x7F, 0xA4, 0x90,
+	0x79, 0xD8, 0x1B, 0xC6, 0x9C, 0x2C, 0xDA, 0x48, 0x52, 0x18, 0x96, 0x39, 0xE1, 0xE6, 0x36, 0x7C,
+	0xA6, 0x6C, 0x96, 0xB1, 0xC3, 0x73, 0x5F, 0x21, 0xB4, 0x42, 0xF1, 0xF4, 0xF8, 0x4F, 0x5A, 0xEB,
+	0x9E, 0xB7, 0xCB, 0xD9, 0x0B, 0x1D, 0x66, 0x5A, 0x24, 0x33, 0xCE, 0xAE, 0xC2, 0x1E, 0xCC, 0x43,
+	0xE3, 0xA2, 0xE0, 0x88, 0x2D, 0xD4, 0x80, 0xEB, 0xF7, 0xFE, 0xC1, 0xE5, 0x37, 0x2B, 0x82, 0x75,
+	0xC1, 0xA5, 0x0C, 0x33, 0x90, 0xE4, 0x78, 0xB5, 0xFB, 0x90, 0x62, 0xA4, 0x6C, 0x53, 0x62, 0xEA,
+	0x8B, 0x3D, 0xCA, 0xA0, 0x77, 0xD8, 0x0B, 0x8B, 0x99, 0x6F, 0xCD, 0x4B, 0x60, 0x50, 0x60, 0xC6,
+	0xAF, 0xB2, 0x69, 0x3C, 0x02, 0x37, 0x70, 0x9F, 0xC2, 0xE9, 0xA4, 0xBE, 0xEE, 0xAF, 0x62, 0x88,
+	0xC3, 0xEF, 0x34, 0x75, 0x8F, 0xB1, 0xFE, 0x09, 0x93, 0xF5, 0x89, 0x11, 0xFD, 0x61, 0xF0, 0x5D,
+	0xD4, 0x8E, 0x31, 0x54, 0xFA, 0x96, 0xF2, 0xCD, 0x26, 0xEC, 0x39, 0x39, 0x2C, 0xD7, 0x2F, 0x14,
+	0xAD, 0x2B, 0x9C, 0x28, 0xAE, 0x7A, 0x4F, 0xF3, 0x4E, 0xCB, 0x80, 0x2B, 0x76, 0xA4, 0xDC, 0x49,
+	0xB6, 0x7F, 0xCA, 0x63, 0x96, 0x78, 0xB6, 0x14, 0xD9, 0xEE, 0x11, 0x01, 0xD5, 0x68, 0x7B, 0x80,
+	0xF2, 0x45, 0xE3, 0xAA, 0x5A, 0x40, 0xEA, 0x84, 0x51, 0x91, 0x9D, 0xD2, 0x5F, 0x93, 0xAD, 0x8B,
+	0xF3, 0x74, 0xA5, 0x35, 0x4B, 0x5E, 0xE9, 0x5E, 0x43, 0x3D, 0xA7, 0x60, 0x34, 0x2A, 0x00, 0x33,
+	0x40, 0x5C, 0xA6, 0xC1, 0x31, 0x01, 0x5C, 0xED, 0x3E, 0xA3, 0xC7, 0xDF, 0x09, 0xE6, 0xC0, 0x1E,
+	0xE9, 0xCE, 0x0C, 0x2A, 0x05, 0x80, 0x2A, 0x95, 0x6B, 0x5E, 0x45, 0x8F, 0x58, 0xA8, 0xD7, 0x3B,
+	0x3B, 0x93, 0xA2, 0x00, 0x64, 0x8B, 0xC9, 0x38, 0xE7, 0xAE, 0x8F, 0x0C, 0x55, 0x83, 0x78, 0x28,
+	0x77, 0x89, 0x77, 0x41, 0xC7, 0x60, 0x44, 0x11, 0x21, 0x81, 0xF5, 0xBB, 0x48, 0xD9, 0x8B, 0x3E,
+	0xF0, 0x65, 0xC4, 0xB4, 0xF5, 0x03, 0x66, 0x61, 0x1E, 0xC2, 0x5E, 0x71, 0x28, 0x86, 0x1A, 0x38,
+	0x09, 0xD0, 0x36, 0x10, 0x19, 0x21, 0xCB, 0x5E, 0xEC, 0xA7, 0x65, 0xA1, 0x88, 0x71, 0x97, 0xB6,
+	0x28, 0xE7, 0x1B, 0x5D, 0xD1, 0x05, 0xDC, 0x40, 0xB3, 0xEC, 0x39, 0x6A, 0x12, 0x2B, 0x53, 0xE5,
+	0x31, 0x10, 0x08, 0x4B, 0xA2, 0x92, 0x6D, 0xA7, 0x97, 0x75, 0x52, 0x32, 0x32, 0xC1, 0xA1, 0x82,
+	0x3B, 0x04, 0x30, 0x82, 0x15, 0x27, 0x06, 0x0A, 0x2B, 0x06, 0x01, 0x04, 0x01, 0x82, 0x37, 0x03,
+	0x03, 0x01, 0x31, 0x82, 0x15, 0x17, 0x30, 0x82, 0x15, 0x13, 0x06, 0x09, 0x2A, 0x86, 0x48, 0x86,
+	0xF7, 0x0D, 0x01, 0x07, 0x02, 0xA0, 0x82, 0x15, 0x04, 0x30, 0x82, 0x15, 0x00, 0x02, 0x01, 0x03,
+	0x31, 0x0D, 0x30, 0x0B, 0x06, 0x09, 0x60, 0x86, 0x48, 0x01, 0x65, 0x03, 0x04, 0x02, 0x01, 0x30,
+	0x81, 0xF4, 0x06, 0x0B, 0x2A, 0x86, 0x48, 0x86, 0xF7, 0x0D, 0x01, 0x09, 0x10, 0x01, 0x04, 0xA0,
+	0x81, 0xE4, 0x04, 0x81, 0xE1, 0x30, 0x81, 0xDE, 0x02, 0x01, 0x01, 0x06, 0x0A, 0x60, 0x86, 0x48,
+	0x01, 0x86, 0xFA, 0x6C, 0x0A, 0x03, 0x05, 0x30, 0x31, 0x30, 0x0D, 0x06, 0x09, 0x60, 0x86, 0x48,
+	0x01, 0x65, 0x03, 0x04, 0x02, 0x01, 0x05, 0x00, 0x04, 0x20, 0x5F, 0x89, 0x39, 0xC4, 0xDF, 0x33,
+	0xE8, 0x5F, 0x6B, 0x25, 0xF1, 0x3A, 0xF0, 0x9B, 0xCD, 0x85, 0xC4, 0x57, 0xB8, 0xB8, 0x6A, 0xC2,
+	0x94, 0x23, 0xB0, 0x05, 0x49, 0x43, 0x2B, 0xC6, 0xD2, 0x27, 0x02, 0x09, 0x00, 0xDB, 0x08, 0x06,
+	0x13, 0x85, 0x24, 0xBF, 0x05, 0x18, 0x0F, 0x32, 0x30, 0x32, 0x32, 0x30, 0x37, 0x31, 0x39, 0x31,
+	0x32, 0x34, 0x39, 0x32, 0x37, 0x5A, 0x30, 0x03, 0x02, 0x01, 0x01, 0xA0, 0x79, 0xA4, 0x77, 0x30,
+	0x75, 0x31, 0x0B, 0x30, 0x09, 0x06, 0x03, 0x55, 0x04, 0x06, 0x13, 0x02, 0x43, 0x41, 0x31, 0x10,
+	0x30, 0x0E, 0x06, 0x03, 0x55, 0x04, 0x08, 0x13, 0x07, 0x4F, 0x6E, 0x74, 0x61, 0x72, 0x69, 0x6F,
+	0x31, 0x0F, 0x30, 0x0D, 0x06, 0x03, 0x55, 0x04, 0x07, 0x13, 0x06, 0x4F, 0x74, 0x74, 0x61, 0x77,
+	0x61, 0x31, 0x16, 0x30, 0x14, 0x06, 0x03, 0x55, 0x04, 0x0A, 0x13, 0x0D, 0x45, 0x6E, 0x74, 0x72,
+	0x75, 0x73, 0x74, 0x2C, 0x20, 0x49, 0x6E, 0x63, 0x2E, 0x31, 0x2B, 0x30, 0x29, 0x06, 0x03, 0x55,
+	0x04, 0x03, 0x13, 0x22, 0x45, 0x6E, 0x74, 0x72, 0x75, 0x73, 0x74, 0x20, 0x54, 0x69, 0x6D, 0x65,
+	0x73, 0x74, 0x61, 0x6D, 0x70, 0x20, 0x41, 0x75, 0x74, 0x68, 0x6F, 0x72, 0x69, 0x74, 0x79, 0x20,
+	0x2D, 0x20, 0x54, 0x53, 0x41, 0x31, 0xA0, 0x82, 0x0F, 0x55, 0x30, 0x82, 0x04, 0x2A, 0x30, 0x82,
+	0x03, 0x12, 0xA0, 0x03, 0x02, 0x01, 0x02, 0x02, 0x04, 0x38, 0x63, 0xDE, 0xF8, 0x30, 0x0D, 0x06,
+	0x09, 0x2A, 0x86, 0x48, 0x86, 0xF7, 0x0D, 0x01, 0x01, 0x05, 0x05, 0x00, 0x30, 0x81, 0xB4, 0x31,
+	0x14, 0x30, 0x12, 0x06, 0x03, 0x55, 0x04, 0x0A, 0x13, 0x0B, 0x45, 0x6E, 0x74, 0x72, 0x75, 0x73,
+	0x74, 0x2E, 0x6E, 0x65, 0x74, 0x31, 0x40, 0x30, 0x3E, 0x06, 0x03, 0x55, 0x04, 0x0B, 0x14, 0x37,
+	0x77, 0x77, 0x77, 0x2E, 0x65, 0x6E, 0x74, 0x72, 0x75, 0x73, 0x74, 0x2E, 0x6E, 0x65, 0x74, 0x2F,
+	0x43, 0x50, 0x53, 0x5F, 0x32, 0x30, 0x34, 0x38, 0x20, 0x69, 0x6E, 0x63, 0x6F, 0x72, 0x70, 0x2E,
+	0x20, 0x62, 0x79, 0x20, 0x72, 0x65, 0x66, 0x2E, 0x20, 0x28, 0x6C, 0x69, 0x6D, 0x69, 0x74, 0x73,
+	0x20, 0x6C, 0x69, 0x61, 0x62, 0x2E, 0x29, 0x31, 0x25, 0x30, 0x23, 0x06, 0x03, 0x55, 0x04, 0x0B,
+	0x13, 0x1C, 0x28, 0x63, 0x29, 0x20, 0x31, 0x39, 0x39, 0x39, 0x20, 0x45, 0x6E, 0x74, 0x72, 0x75,
+	0x73, 0x74, 0x2E, 0x6E, 0x65, 0x74, 0x20, 0x4C, 0x69, 0x6D, 0x69, 0x74, 0x65, 0x64, 0x31, 0x33,
+	0x30, 0x31, 0x06, 0x03, 0x55, 0x04, 0x03, 0x13, 0x2A, 0x45, 0x6E, 0x74, 0x72, 0x75, 0x73, 0x74,
+	0x2E, 0x6E, 0x65, 0x74, 0x20, 0x43, 0x65, 0x72, 0x74, 0x69, 0x66, 0x69, 0x63, 0x61, 0x74, 0x69,
+	0x6F, 0x6E, 0x20, 0x41, 0x75, 0x74, 0x68, 0x6F, 0x72, 0x69, 0x74, 0x79, 0x20, 0x28, 0x32, 0x30,
+	0x34, 0x38, 0x29, 0x30, 0x1E, 0x17, 0x0D, 0x39, 0x39, 0x31, 0x32, 0x32, 0x34, 0x31, 0x37, 0x35,
+	0x30, 0x35, 0x31, 0x5A, 0x17, 0x0D, 0x32, 0x39, 0x30, 0x37, 0x32, 0x34, 0x31, 0x34, 0x31, 0x35,
+	0x31, 0x32, 0x5A, 0x30, 0x81, 0xB4, 0x31, 0x14, 0x30, 0x12, 0x06, 0x03, 0x55, 0x04, 0x0A, 0x13,
+	0x0B, 0x45, 0x6E, 0x74, 0x72, 0x75, 0x73, 0x74, 0x2E, 0x6E, 0x65, 0x74, 0x31, 0x40, 0x30, 0x3E,
+	0x06, 0x03, 0x55, 0x04, 0x0B, 0x14, 0x37, 0x77, 0x77, 0x77, 0x2E, 0x65, 0x6E, 0x74, 0x72, 0x75,
+	0x73, 0x74, 0x2E, 0x6E, 0x65, 0x74, 0x2F, 0x43, 0x50, 0x53, 0x5F, 0x32, 0x30, 0x34, 0x38, 0x20,
+	0x69, 0x6E, 0x63, 0x6F, 0x72, 0x70, 0x2E, 0x20, 0x62, 0x79, 0x20, 0x72, 0x65, 0x66, 0x2E, 0x20,
+	0x28, 0x6C, 0x69, 0x6D, 0x69, 0x74, 0x73, 0x20, 0x6C, 0x69, 0x61, 0x62, 0x2E, 0x29, 0x31, 0x25,
+	0x30, 0x23, 0x06, 0x03, 0x55, 0x04, 0x0B, 0x13, 0x1C, 0x28, 0x63, 0x29, 0x20, 0x31, 0x39, 0x39,
+	0x39, 0x20, 0x45, 0x6E, 0x74, 0x72, 0x75, 0x73, 0x74, 0x2E, 0x6E, 0x65, 0x74, 0x20, 0x4C, 0x69,
+	0x6D, 0x69, 0x74, 0x65, 0x64, 0x31, 0x33, 0x30, 0x31, 0x06, 0x03, 0x55, 0x04, 0x03, 0x13, 0x2A,
+	0x45, 0x6E, 0x74, 0x72, 0x75, 0x73, 0x74, 0x2E, 0x6E, 0x65, 0x74, 0x20, 0x43, 0x65, 0x72, 0x74,
+	0x69, 0x66, 0x69, 0x63, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x41, 0x75, 0x74, 0x68, 0x6F, 0x72,
+	0x69, 0x74, 0x79, 0x20, 0x28, 0x32, 0x30, 0x34, 0x38, 0x29, 0x30, 0x82, 0x01, 0x22, 0x30, 0x0D,
+	0x06, 0x09, 0x2A, 0x86, 0x48, 0x86, 0xF7, 0x0D, 0x01, 0x01, 0x01, 0x05, 0x00, 0x03, 0x82, 0x01,
+	0x0F, 0x00, 0x30, 0x82, 0x01, 0x0A, 0x02, 0x82, 0x01, 0x01, 0x00, 0xAD, 0x4D, 0x4B, 0xA9, 0x12,
+	0x86, 0xB2, 0xEA, 0xA3, 0x20, 0x07, 0x15, 0x16, 0x64, 0x2A, 0x2B, 0x4B, 0xD1, 0xBF, 0x0B, 0x4A,
+	0x4D, 0x8E, 0xED, 0x80, 0x76, 0xA5, 0x67, 0xB7, 0x78, 0x40, 0xC0, 0x73, 0x42, 0xC8, 0x68, 0xC0,
+	0xDB, 0x53, 0x2B, 0xDD, 0x5E, 0xB8, 0x76, 0x98, 0x35, 0x93, 0x8B, 0x1A, 0x9D, 0x7C, 0x13, 0x3A,
+	0x0E, 0x1F, 0x5B, 0xB7, 0x1E, 0xCF, 0xE5, 0x24, 0x14, 0x1E, 0xB1, 0x81, 0xA9, 0x8D, 0x7D, 0xB8,
+	0xCC, 0x6B, 0x4B, 0x03, 0xF1, 0x02, 0x0C, 0xDC, 0xAB, 0xA5, 0x40, 0x24, 0x00, 0x7F, 0x74, 0x94,
+	0xA1, 0x9D, 0x08, 0x29, 0xB3, 0x88, 0x0B, 0xF5, 0x87, 0x77, 0x9D, 0x55, 0xCD, 0xE4, 0xC3, 0x7E,
+	0xD7, 0x6A, 0x64, 0xAB, 0x85, 0x14, 0x86, 0x95, 0x5B, 0x97, 0x32, 0x50, 0x6F, 0x3D, 0xC8, 0xBA,
+	0x66, 0x0C, 0xE3, 0xFC, 0xBD, 0xB8, 0x49, 0xC1, 0x76, 0x89, 0x49, 0x19, 0xFD, 0xC0, 0xA8, 0xBD,
+	0x89, 0xA3, 0x67, 0x2F, 0xC6, 0x9F, 0xBC, 0x71, 0x19, 0x60, 0xB8, 0x2D, 0xE9, 0x2C, 0xC9, 0x90,
+	0x76, 0x66, 0x7B, 0x94, 0xE2, 0xAF, 0x78, 0xD6, 0x65, 0x53, 0x5D, 0x3C, 0xD6, 0x9C, 0xB2, 0xCF,
+	0x29, 0x03, 0xF9, 0x2F, 0xA4, 0x50, 0xB2, 0xD4, 0x48, 0xCE, 0x05, 0x32, 0x55, 0x8A, 0xFD, 0xB2,
+	0x64, 0x4C, 0x0E, 0xE4, 0x98, 0x07, 0x75, 0xDB, 0x7F, 0xDF, 0xB9, 0x08, 0x55, 0x60, 0x85, 0x30,
+	0x29, 0xF9, 0x7B, 0x48, 0xA4, 0x69, 0x86, 0xE3, 0x35, 0x3F, 0x1E, 0x86, 0x5D, 0x7A, 0x7A, 0x15,
+	0xBD, 0xEF, 0x00, 0x8E, 0x15, 0x22, 0x54, 0x17, 0x00, 0x90, 0x26, 0x93, 0xBC, 0x0E, 0x49, 0x68,
+	0x91, 0xBF, 0xF8, 0x47, 0xD3, 0x9D, 0x95, 0x42, 0xC1, 0x0E, 0x4D, 0xDF, 0x6F, 0x26, 0xCF, 0xC3,
+	0x18, 0x21, 0x62, 0x66, 0x43, 0x70, 0xD6, 0xD5, 0xC0, 0x07, 0xE1, 0x02, 0x03, 0x01, 0x00, 0x01,
+	0xA3, 0x42, 0x30, 0x40, 0x30, 0x0E, 0x06, 0x03, 0x55, 0x1D, 0x0F, 0x01, 0x01, 0xFF, 0x04, 0x04,
+	0x03, 0x02, 0x01, 0x06, 0x30, 0x0F, 0x06, 0x03, 0x55, 0x1D, 0x13, 0x01, 0x01, 0xFF, 0x04, 0x05,
+	0x30, 0x03, 0x01, 0x01, 0xFF, 0x30, 0x1D, 0x06, 0x03, 0x55, 0x1D, 0x0E, 0x04, 0x16, 0x04, 0x14,
+	0x55, 0xE4, 0x81, 0xD1, 0x11, 0x80, 0xBE, 0xD8, 0x89, 0xB9, 0x08, 0xA3, 0x31, 0xF9, 0xA1, 0x24,
+	0x09, 0x16, 0xB9, 0x70, 0x30, 0x0D, 0x06, 0x09, 0x2A, 0x86, 0x48, 0x86, 0xF7, 0x0D, 0x01, 0x01,
+	0x05, 0x05, 0x00, 0x03, 0x82, 0x01, 0x01, 0x00, 0x3B, 0x9B, 0x8F, 0x56, 0x9B, 0x30, 0xE7, 0x53,
+	0x99, 0x7C, 0x7A, 0x79, 0xA7, 0x4D, 0x97, 0xD7, 0x19, 0x95, 0x90, 0xFB, 0x06, 0x1F, 0xCA, 0x33,
+	0x7C, 0x46, 0x63, 0x8F, 0x96, 0x66, 0x24, 0xFA, 0x40, 0x1B, 0x21, 0x27, 0xCA, 0xE6, 0x72, 0x73,
+	0xF2, 0x4F, 0xFE, 0x31, 0x99, 0xFD, 0xC8, 0x0C, 0x4C, 0x68, 0x53, 0xC6, 0x80, 0x82, 0x13, 0x98,
+	0xFA, 0xB6, 0xAD, 0xDA, 0x5D, 0x3D, 0xF1, 0xCE, 0x6E, 0xF6, 0x15, 0x11, 0x94, 0x82, 0x0C, 0xEE,
+	0x3F, 0x95, 0xAF, 0x11, 0xAB, 0x0F, 0xD7, 0x2F, 0xDE, 0x1F, 0x03, 0x8F, 0x57, 0x2C, 0x1E, 0xC9,
+	0xBB, 0x9A, 0x1A, 0x44, 0x95, 0xEB, 0x18, 0x4F, 0xA6, 0x1F, 0xCD, 0x7D, 0x57, 0x10, 0x2F, 0x9B,
+	0x04, 0x09, 0x5A, 0x84, 0xB5, 0x6E, 0xD8, 0x1D, 0x3A, 0xE1, 0xD6, 0x9E, 0xD1, 0x6C, 0x79, 0x5E,
+	0x79, 0x1C, 0x14, 0xC5, 0xE3, 0xD0, 0x4C, 0x93, 0x3B, 0x65, 0x3C, 0xED, 0xDF, 0x3D, 0xBE, 0xA6,
+	0xE5, 0x95, 0x1A, 0xC3, 0xB5, 0x19, 0xC3, 0xBD, 0x5E, 0x5B, 0xBB, 0xFF, 0x23, 0xEF, 0x68, 0x19,
+	0xCB, 0x12, 0x93, 0x27, 0x5C, 0x03, 0x2D, 0x6F, 0x30, 0xD0, 0x1E, 0xB6, 0x1A, 0xAC, 0xDE, 0x5A,
+	0xF7, 0xD1, 0xAA, 0xA8, 0x27, 0xA6, 0xFE, 0x79, 0x81, 0xC4, 0x79, 0x99, 0x33, 0x57, 0xBA, 0x12,
+	0xB0, 0xA9, 0xE0, 0x42, 0x6C, 0x93, 0xCA, 0x56, 0xDE, 0xFE, 0x6D, 0x84, 0x0B, 0x08, 0x8B, 0x7E,
+	0x8D, 0xEA, 0xD7, 0x98, 0x21, 0xC6, 0xF3, 0xE7, 0x3C, 0x79, 0x2F, 0x5E, 0x9C, 0xD1, 0x4C, 0x15,
+	0x8D, 0xE1, 0xEC, 0x22, 0x37, 0xCC, 0x9A, 0x43, 0x0B, 0x97, 0xDC, 0x80, 0x90, 0x8D, 0xB3, 0x67,
+	0x9B, 0x6F, 0x48, 0x08, 0x15, 0x56, 0xCF, 0xBF, 0xF1, 0x2B, 0x7C, 0x5E, 0x9A, 0x76, 0xE9, 0x59,
+	0x90, 0xC5, 0x7C, 0x83, 0x35, 0x11, 0x65, 0x51, 0x30, 0x82, 0x05, 0x13, 0x30, 0x82, 0x03, 0xFB,
+	0xA0, 0x03, 0x02, 0x01, 0x02, 0x02, 0x0C, 0x58, 0xDA, 0x13, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x51,
+	0xCE, 0x0D, 0xF7, 0x30, 0x0D, 0x06, 0x09, 0x2A, 0x86, 0x48, 0x86, 0xF7, 0x0D, 0x01, 0x01, 0x0B,
+	0x05, 0x00, 0x30, 0x81, 0xB4, 0x31, 0x14, 0x30, 0x12, 0x06, 0x03, 0x55, 0x04, 0x0A, 0x13, 0x0B,
+	0x45, 0x6E, 0x74, 0x72, 0x75, 0x73, 0x74, 0x2E, 0x6E, 0x65, 0x74, 0x31, 0x40, 0x30, 0x3E, 0x06,
+	0x03, 0x55, 0x04, 0x0B, 0x14, 0x37, 0x77, 0x77, 0x77, 0x2E, 0x65, 0x6E, 0x74, 0x72, 0x75, 0x73,
+	0x74, 0x2E, 0x6E, 0x65, 0x74, 0x2F, 0x43, 0x50, 0x53, 0x5F, 0x32, 0x30, 0x34, 0x38, 0x20, 0x69,
+	0x6E, 0x63, 0x6F, 0x72, 0x70, 0x2E, 0x20, 0x62, 0x79, 0x20, 0x72, 0x65, 0x66, 0x2E, 0x20, 0x28,
+	0x6C, 0x69, 0x6D, 0x69, 0x74, 0x73, 0x20, 0x6C, 0x69, 0x61, 0x62, 0x2E, 0x29, 0x31, 0x25, 0x30,
+	0x23, 0x06, 0x03, 0x55, 0x04, 0x0B, 0x13, 0x1C, 0x28, 0x63, 0x29, 0x20, 0x31, 0x39, 0x39, 0x39,
+	0x20, 0x45, 0x6E, 0x74, 0x72, 0x75, 0x73, 0x74, 0x2E, 0x6E, 0x65, 0x74, 0x20, 0x4C, 0x69, 0x6D,
+	0x69, 0x74, 0x65, 0x64, 0x31, 0x33, 0x30, 0x31, 0x06, 0x03, 0x55, 0x04, 0x03, 0x13, 0x2A, 0x45,
+	0x6E, 0x74, 0x72, 0x75, 0x73, 0x74, 0x2E, 0x6E, 0x65, 0x74, 0x20, 0x43, 0x65, 0x72, 0x74, 0x69,
+	0x66, 0x69, 0x63, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x41, 0x75, 0x74, 0x68, 0x6F, 0x72, 0x69,
+	0x74, 0x79, 0x20, 0x28, 0x32, 0x30, 0x34, 0x38, 0x29, 0x30, 0x1E, 0x17, 0x0D, 0x31, 0x35, 0x30,
+	0x37, 0x32, 0x32, 0x31, 0x39, 0x30, 0x32, 0x35, 0x34, 0x5A, 0x17, 0x0D, 0x32, 0x39, 0x30, 0x36,
+	0x32, 0x32, 0x31, 0x39, 0x33, 0x32, 0x35, 0x34, 0x5A, 0x30, 0x81, 0xB2, 0x31, 0x0B, 0x30, 0x09,
+	0x06, 0x03, 0x55, 0x04, 0x06, 0x13, 0x02, 0x55, 0x53, 0x31, 0x16, 0x30, 0x14, 0x06, 0x03, 0x55,
+	0x04, 0x0A, 0x13, 0x0D, 0x45, 0x6E, 0x74, 0x72, 0x75, 0x73, 0x74, 0x2C, 0x20, 0x49, 0x6E, 0x63,
+	0x2E, 0x31, 0x28, 0x30, 0x26, 0x06, 0x03, 0x55, 0x04, 0x0B, 0x13, 0x1F, 0x53, 0x65, 0x65, 0x20,
+	0x77, 0x77, 0x77, 0x2E, 0x65, 0x6E, 0x74, 0x72, 0x75, 0x73, 0x74, 0x2E, 0x6E, 0x65, 0x74, 0x2F,
+	0x6C, 0x65, 0x67, 0x61, 0x6C, 0x2D, 0x74, 0x65, 0x72, 0x6D, 0x73, 0x31, 0x39, 0x30, 0x37, 0x06,
+	0x03, 0x55, 0x04, 0x0B, 0x13, 0x30, 0x28, 0x63, 0x29, 0x20, 0x32, 0x30, 0x31, 0x35, 0x20, 0x45,
+	0x6E, 0x74, 0x72, 0x75, 0x73, 0x74, 0x2C, 0x20, 0x49, 0x6E, 0x63, 0x2E, 0x20, 0x2D, 0x20, 0x66,
+	0x6F, 0x72, 0x20, 0x61, 0x75, 0x74, 0x68, 0x6F, 0x72, 0x69, 0x7A, 0x65, 0x64, 0x20, 0x75, 0x73,
+	0x65, 0x20, 0x6F, 0x6E, 0x6C, 0x79, 0x31, 0x26, 0x30, 0x24, 0x06, 0x03, 0x55, 0x04, 0x03, 0x13,
+	0x1D, 0x45, 0x6E, 0x74, 0x72, 0x75, 0x73, 0x74, 0x20, 0x54, 0x69, 0x6D, 0x65, 0x73, 0x74, 0x61,
+	0x6D, 0x70, 0x69, 0x6E, 0x67, 0x20, 0x43, 0x41, 0x20, 0x2D, 0x20, 0x54, 0x53, 0x31, 0x30, 0x82,
+	0x01, 0x22, 0x30, 0x0D, 0x06, 0x09, 0x2A, 0x86, 0x48, 0x86, 0xF7, 0x0D, 0x01, 0x01, 0x01, 0x05,
+	0x00, 0x03, 0x82, 0x01, 0x0F, 0x00, 0x30, 0x82, 0x01, 0x0A, 0x02, 0x82, 0x01, 0x01, 0x00, 0xD9,
+	0x23, 0xE6, 0x14, 0xA4, 0xE8, 0x7C, 0x4B, 0x85, 0x71, 0x58, 0xFB, 0xF8, 0x81, 0xE6, 0x72, 0x8B,
+	0x5D, 0x46, 0xC3, 0x88, 0x00, 0x1F, 0x38, 0xD0, 0x8A, 0xE1, 0xD6, 0x6E, 0x56, 0x30, 0xE5, 0xAF,
+	0xDA, 0x64, 0x50, 0x7D, 0xC2, 0x13, 0x39, 0xFB, 0xBD, 0x66, 0xB4, 0xDA, 0x84, 0xFB, 0x83, 0xD0,
+	0x28, 0x1F, 0xCB, 0x76, 0xE8, 0x60, 0x50, 0x69, 0x9B, 0xF3, 0xCE, 0x4F, 0x13, 0xE2, 0xC1, 0x3E,
+	0xC1, 0xDF, 0x12, 0xCB, 0x32, 0xA3, 0xF8, 0x5E, 0x44, 0x22, 0x0E, 0xCC, 0x3A, 0xE9, 0x8D, 0x49,
+	0xB9, 0x60, 0x74, 0xC8, 0xDE, 0x54, 0x3D, 0x41, 0x5E, 0x43, 0x5F, 0x28, 0x46, 0xA9, 0xA6, 0xB7,
+	0xCA, 0x10, 0x2B, 0x22, 0xBC, 0x5B, 0x4D, 0x5B, 0x8C, 0x17, 0x65, 0x12, 0x86, 0xFD, 0x2C, 0x77,
+	0xD5, 0xC5, 0xA0, 0x8C, 0xCA, 0xC2, 0x83, 0xE0, 0x47, 0x57, 0x7C, 0xE7, 0x70, 0xAE, 0x62, 0x45,
+	0x27, 0x31, 0x18, 0x0A, 0xD4, 0xC0, 0xA4, 0x18, 0x55, 0x52, 0xF7, 0x60, 0xC6, 0x04, 0x4B, 0xB3,
+	0xDD, 0x68, 0x32, 0x6E, 0x10, 0x1F, 0x34, 0x11, 0xB8, 0x12, 0x78, 0x64, 0xF1, 0xEE, 0xA9, 0xE0,
+	0xF7, 0xE3, 0xB1, 0x22, 0x8F, 0x34, 0x5A, 0x65, 0xCB, 0x8A, 0xF4, 0xE1, 0x45, 0x50, 0x74, 0xDF,
+	0x93, 0x97, 0xA6, 0x34, 0xE6, 0xD0, 0x4C, 0x3B, 0x9F, 0x37, 0x49, 0x52, 0xA7, 0x53, 0x4E, 0x9F,
+	0x2E, 0x67, 0x5C, 0xED, 0x96, 0xFC, 0xA5, 0xBF, 0x74, 0x51, 0x88, 0xE3, 0xAA, 0x8E, 0xBD, 0xD9,
+	0xB1, 0x2F, 0x5F, 0x50, 0x30, 0x16, 0xF4, 0x51, 0x60, 0x22, 0x6B, 0x99, 0xCB, 0xFF, 0xE1, 0x54,
+	0x3B, 0xB9, 0xFB, 0x44, 0x38, 0xA5, 0x08, 0x39, 0x23, 0x9B, 0x69, 0x47, 0xFA, 0x3C, 0xC4, 0xD0,
+	0xE7, 0xAA, 0xDF, 0x46, 0xB2, 0xEC, 0xF2, 0x8A, 0x19, 0xAC, 0x29, 0xB2, 0x38, 0x95, 0x75, 0x02,
+	0x03, 0x01, 0x00, 0x01, 0xA3, 0x82, 0x01, 0x23, 0x30, 0x82, 0x01, 0x1F, 0x30, 0x12, 0x06, 0x03,
+	0x55, 0x1D, 0x13, 0x01, 0x01, 0xFF, 0x04, 0x08, 0x30, 0x06, 0x01, 0x01, 0xFF, 0x02, 0x01, 0x00,
+	0x30, 0x0E, 0x06, 0x03, 0x55, 0x1D, 0x0F, 0x01, 0x01, 0xFF, 0x04, 0x04, 0x03, 0x02, 0x01, 0x06,
+	0x30, 0x3B, 0x06, 0x03, 0x55, 0x1D, 0x20, 0x04, 0x34, 0x30, 0x32, 0x30, 0x30, 0x06, 0x04, 0x55,
+	0x1D, 0x20, 0x00, 0x30, 0x28, 0x30, 0x26, 0x06, 0x08, 0x2B, 0x06, 0x01, 0x05, 0x05, 0x07, 0x02,
+	0x01, 0x16, 0x1A, 0x68, 0x74, 0x74, 0x70, 0x3A, 0x2F, 0x2F, 0x77, 0x77, 0x77, 0x2E, 0x65, 0x6E,
+	0x74, 0x72, 0x75, 0x73, 0x74, 0x2E, 0x6E, 0x65, 0x74, 0x2F, 0x72, 0x70, 0x61, 0x30, 0x33, 0x06,
+	0x08, 0x2B, 0x06, 0x01, 0x05, 0x05, 0x07, 0x01, 0x01, 0x04, 0x27, 0x30, 0x25, 0x30, 0x23, 0x06,
+	0x08, 0x2B, 0x06, 0x01, 0x05, 0x05, 0x07, 0x30, 0x01, 0x86, 0x17, 0x68, 0x74, 0x74, 0x70, 0x3A,
+	0x2F, 0x2F, 0x6F, 0x63, 0x73, 0x70, 0x2E, 0x65, 0x6E, 0x74, 0x72, 0x75, 0x73, 0x74, 0x2E, 0x6E,
+	0x65, 0x74, 0x30, 0x32, 0x06, 0x03, 0x55, 0x1D, 0x1F, 0x04, 0x2B, 0x30, 0x29, 0x30, 0x27, 0xA0,
+	0x25, 0xA0, 0x23, 0x86, 0x21, 0x68, 0x74, 0x74, 0x70, 0x3A, 0x2F, 0x2F, 0x63, 0x72, 0x6C, 0x2E,
+	0x65, 0x6E, 0x74, 0x72, 0x75, 0x73, 0x74, 0x2E, 0x6E, 0x65, 0x74, 0x2F, 0x32, 0x30, 0x34, 0x38,
+	0x63, 0x61, 0x2E, 0x63, 0x72, 0x6C, 0x30, 0x13, 0x06, 0x03, 0x55, 0x1D, 0x25, 0x04, 0x0C, 0x30,
+	0x0A, 0x06, 0x08, 0x2B, 0x06, 0x01, 0x05, 0x05, 0x07, 0x03, 0x08, 0x30, 0x1D, 0x06, 0x03, 0x55,
+	0x1D, 0x0E, 0x04, 0x16, 0x04, 0x14, 0xC3, 0xC2, 0x71, 0xD2, 0x7B, 0xD7, 0x68, 0x05, 0xAE, 0x3B,
+	0x39, 0x9B, 0x34, 0x25, 0x0C, 0x62, 0x03, 0xC7, 0x57, 0x68, 0x30, 0x1F, 0x06, 0x03, 0x55, 0x1D,
+	0x23, 0x04, 0x18, 0x30, 0x16, 0x80, 0x14, 0x55, 0xE4, 0x81, 0xD1, 0x11, 0x80, 0xBE, 0xD8, 0x89,
+	0xB9, 0x08, 0xA3, 0x31, 0xF9, 0xA1, 0x24, 0x09, 0x16, 0xB9, 0x70, 0x30, 0x0D, 0x06, 0x09, 0x2A,
+	0x86, 0x48, 0x86, 0xF7, 0x0D, 0x01, 0x01, 0x0B, 0x05, 0x00, 0x03, 0x82, 0x01, 0x01, 0x00, 0x1D,
+	0x24, 0xE7, 0x9A, 0x74, 0x5B, 0xAA, 0x70, 0xFC, 0xB1, 0x0E, 0x31, 0x45, 0xD7, 0x2C, 0x00, 0x7F,
+	0x66, 0x3A, 0x2B, 0xA0, 0x9A, 0x34, 0xAA, 0xAC, 0x63, 0x6D, 0x89, 0xF9, 0x9F, 0xDF, 0x0D, 0x77,
+	0xFD, 0x24, 0x23, 0xFC, 0x4F, 0x9C, 0xB7, 0x6F, 0x8F, 0xF3, 0xF4, 0x1F, 0xB6, 0xC1, 0xFD, 0xD6,
+	0x1C, 0xC4, 0x8C, 0x88, 0x66, 0xC1, 0x63, 0x8D, 0xBA, 0x57, 0x77, 0xD3, 0xB8, 0x1A, 0x1E, 0xC8,
+	0x51, 0xAD, 0xCC, 0x60, 0x36, 0x1A, 0x87, 0x6A, 0x28, 0xEA, 0x11, 0x65, 0xDE, 0xCC, 0x3C, 0x2C,
+	0x8C, 0x74, 0xB7, 0xE8, 0x50, 0x43, 0xD3, 0xCC, 0x28, 0xE8, 0x15, 0x6C, 0x11, 0x2A, 0x9F, 0x14,
+	0x95, 0x29, 0xC9, 0x05, 0x57, 0xB5, 0x67, 0x36, 0xE8, 0x3C, 0xA9, 0x83, 0xEF, 0x41, 0xC1, 0x21,
+	0x16, 0xD3, 0x7E, 0xF7, 0x2D, 0x11, 0x47, 0x66, 0x76, 0x60, 0x82, 0x12, 0x69, 0x8C, 0x76, 0x55,
+	0x73, 0x0F, 0xDF, 0x2F, 0x4B, 0x5D, 0xE9, 0x6C, 0x23, 0xF8, 0x07, 0xF6, 0xB5, 0x7D, 0xD6, 0x69,
+	0x45, 0x9C, 0x58, 0x7D, 0x61, 0x2E, 0xFC, 0x78, 0x4B, 0x43, 0x4E, 0x89, 0x91, 0x46, 0x44, 0x2C,
+	0xA0, 0x53, 0xA8, 0x45, 0xA1, 0xF6, 0x16, 0x58, 0xBB, 0x91, 0x13, 0xF2, 0x4B, 0xC5, 0xDF, 0x0B,
+	0xC0, 0xE7, 0xAE, 0x29, 0x7A, 0xBD, 0x45, 0xB3, 0xE7, 0x70, 0x30, 0xE7, 0x34, 0x8E, 0xEB, 0x7A,
+	0xF6, 0xD3, 0xB5, 0xD1, 0xDE, 0x6B, 0x13, 0x99, 0x46, 0xB3, 0x8B, 0xD2, 0x4D, 0x93, 0x75, 0xB5,
+	0xF1, 0x6F, 0xBF, 0xDC, 0x00, 0x28, 0xC2, 0x25, 0xBF, 0xBC, 0xE7, 0xA3, 0x65, 0x34, 0xEC, 0x3F,
+	0x0D, 0x1D, 0x97, 0x8C, 0xFA, 0xAA, 0x88, 0x22, 0xA4, 0x18, 0x35, 0xDB, 0x05, 0x8E, 0x76, 0xE3,
+	0x10, 0xC8, 0x29, 0x8F, 0x63, 0xD0, 0xAE, 0xAC, 0x18, 0xD9, 0xDA, 0xC4, 0x9F, 0x51, 0x12, 0x30,
+	0x82, 0x06, 0x0C, 0x30, 0x82, 0x04, 0xF4, 0xA0, 0x03, 0x02, 0x01, 0x02, 0x02, 0x11, 0x00, 0x8D,
+	0xCE, 0x15, 0xF3, 0xA7, 0x94, 0xC5, 0x87, 0x00, 0x00, 0x00, 0x00, 0x55, 0x92, 0x33, 0xF4, 0x30,
+	0x0D, 0x06, 0x09, 0x2A, 0x86, 0x48, 0x86, 0xF7, 0x0D, 0x01, 0x01, 0x0B, 0x05, 0x00, 0x30, 0x81,
+	0xB2, 0x31, 0x0B, 0x30, 0x09, 0x06, 0x03, 0x55, 0x04, 0x06, 0x13, 0x02, 0x55, 0x53, 0x31, 0x16,
+	0x30, 0x14, 0x06, 0x03, 0x55, 0x04, 0x0A, 0x13, 0x0D, 0x45, 0x6E, 0x74, 0x72, 0x75, 0x73, 0x74,
+	0x2C, 0x20, 0x49, 0x6E, 0x63, 0x2E, 0x31, 0x28, 0x30, 0x26, 0x06, 0x03, 0x55, 0x04, 0x0B, 0x13,
+	0x1F, 0x53, 0x65, 0x65, 0x20, 0x77, 0x77, 0x77, 0x2E, 0x65, 0x6E, 0x74, 0x72, 0x75, 0x73, 0x74,
+	0x2E, 0x6E, 0x65, 0x74, 0x2F, 0x6C, 0x65, 0x67, 0x61, 0x6C, 0x2D, 0x74, 0x65, 0x72, 0x6D, 0x73,
+	0x31, 0x39, 0x30, 0x37, 0x06, 0x03, 0x55, 0x04, 0x0B, 0x13, 0x30, 0x28, 0x63, 0x29, 0x20, 0x32,
+	0x30, 0x31, 0x35, 0x20, 0x45, 0x6E, 0x74, 0x72, 0x75, 0x73, 0x74, 0x2C, 0x20, 0x49, 0x6E, 0x63,
+	0x2E, 0x20, 0x2D, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x61, 0x75, 0x74, 0x68, 0x6F, 0x72, 0x69, 0x7A,
+	0x65, 0x64, 0x20, 0x75, 0x73, 0x65, 0x20, 0x6F, 0x6E, 0x6C, 0x79, 0x31, 0x26, 0x30, 0x24, 0x06,
+	0x03, 0x55, 0x04, 0x03, 0x13, 0x1D, 0x45, 0x6E, 0x74, 0x72, 0x75, 0x73, 0x74, 0x20, 0x54, 0x69,
+	0x6D, 0x65, 0x73, 0x74, 0x61, 0x6D, 0x70, 0x69, 0x6E, 0x67, 0x20, 0x43, 0x41, 0x20, 0x2D, 0x20,
+	0x54, 0x53, 0x31, 0x30, 0x1E, 0x17, 0x0D, 0x32, 0x30, 0x30, 0x37, 0x32, 0x32, 0x31, 0x35, 0x33,
+	0x33, 0x32, 0x39, 0x5A, 0x17, 0x0D, 0x33, 0x30, 0x31, 0x32, 0x32, 0x39, 0x31, 0x36, 0x32, 0x39,
+	0x32, 0x33, 0x5A, 0x30, 0x75, 0x31, 0x0B, 0x30, 0x09, 0x06, 0x03, 0x55, 0x04, 0x06, 0x13, 0x02,
+	0x43, 0x41, 0x31, 0x10, 0x30, 0x0E, 0x06, 0x03, 0x55, 0x04, 0x08, 0x13, 0x07, 0x4F, 0x6E, 0x74,
+	0x61, 0x72, 0x69, 0x6F, 0x31, 0x0F, 0x30, 0x0D, 0x06, 0x03, 0x55, 0x04, 0x07, 0x13, 0x06, 0x4F,
+	0x74, 0x74, 0x61, 0x77, 0x61, 0x31, 0x16, 0x30, 0x14, 0x06, 0x03, 0x55, 0x04, 0x0A, 0x13, 0x0D,
+	0x45, 0x6E, 0x74, 0x72, 0x75, 0x73, 0x74, 0x2C, 0x20, 0x49, 0x6E, 0x63, 0x2E, 0x31, 0x2B, 0x30,
+	0x29, 0x06, 0x03, 0x55, 0x04, 0x03, 0x13, 0x22, 0x45, 0x6E, 0x74, 0x72, 0x75, 0x73, 0x74, 0x20,
+	0x54, 0x69, 0x6D, 0x65, 0x73, 0x74, 0x61, 0x6D, 0x70, 0x20, 0x41, 0x75, 0x74, 0x68, 0x6F, 0x72,
+	0x69, 0x74, 0x79, 0x20, 0x2D, 0x20, 0x54, 0x53, 0x41, 0x31, 0x30, 0x82, 0x02, 0x22, 0x30, 0x0D,
+	0x06, 0x09, 0x2A, 0x86, 0x48, 0x86, 0xF7, 0x0D, 0x01, 0x01, 0x01, 0x05, 0x00, 0x03, 0x82, 0x02,
+	0x0F, 0x00, 0x30, 0x82, 0x02, 0x0A, 0x02, 0x82, 0x02, 0x01, 0x00, 0xCA, 0x3E, 0xEC, 0x24, 0x62,
+	0xE1, 0xF7, 0xFE, 0xDF, 0xD1, 0x36, 0xA9, 0x37, 0x66, 0xD6, 0x79, 0x17, 0x14, 0x94, 0x42, 0x00,
+	0xA4, 0x86, 0x97, 0xB8, 0x27, 0x8C, 0xEB, 0x4F, 0xA9, 0xF7, 0xD3, 0xAE, 0xE2, 0xAB, 0x30, 0x04,
+	0x08, 0x28, 0x5F, 0x9B, 0x53, 0xA6, 0x87, 0x8A, 0x2D, 0xDD, 0x02, 0x52, 0x5F, 0xB5, 0xB8, 0xE5,
+	0xB6, 0x50, 0xF0, 0x9C, 0xAB, 0x12, 0xC1, 0xEE, 0x1A, 0x56, 0x78, 0x8A, 0x6E, 0x44, 0x3F, 0xA9,
+	0x8A, 0x8F, 0xD7, 0xDB, 0x53, 0xD9, 0xC6, 0x47, 0xC8, 0x0C, 0xDC, 0x46, 0x57, 0x00, 0x67, 0x06,
+	0x17, 0x1A, 0x85, 0xB7, 0x40, 0xAA, 0xAF, 0x76, 0x07, 0xE7, 0x90, 0x5F, 0x94, 0x92, 0xD5, 0xAE,
+	0xD6, 0xD7, 0xCD, 0x79, 0xA1, 0xC5, 0x35, 0x2B, 0x44, 0x84, 0x5F, 0x49, 0x1C, 0xD5, 0x73, 0xB8,
+	0x81, 0x8D, 0x72, 0x94, 0x02, 0x6A, 0xA9, 0xCF, 0x56, 0x92, 0xAA, 0x36, 0x94, 0xC3, 0x50, 0xC9,
+	0x56, 0x97, 0x88, 0x5C, 0xE1, 0x7F, 0x5F, 0xFD, 0xFB, 0xDF, 0x14, 0x8E, 0x3D, 0xAB, 0x24, 0x0D,
+	0xF6, 0x7B, 0x8F, 0x6A, 0xFA, 0x6E, 0x1E, 0xFA, 0x95, 0xBD, 0x7D, 0x90, 0xF8, 0xE4, 0x42, 0x14,
+	0xBF, 0x55, 0x5E, 0x04, 0x54, 0x93, 0x31, 0x43, 0xF7, 0xC3, 0xE7, 0xC2, 0x05, 0x11, 0x68, 0xAC,
+	0x40, 0x69, 0xC7, 0x23, 0x37, 0xEC, 0x5A, 0x4C, 0x29, 0xC9, 0xDF, 0x35, 0xB3, 0x7E, 0x49, 0x4E,
+	0xC6, 0x7A, 0xDB, 0xCE, 0xC2, 0x25, 0x94, 0x9E, 0x37, 0x3F, 0x88, 0xEC, 0x24, 0x4D, 0x39, 0x8F,
+	0x7F, 0xEF, 0x15, 0x6B, 0x54, 0x4C, 0x71, 0xF1, 0x0D, 0x21, 0x7C, 0x5A, 0x75, 0xD0, 0x87, 0x53,
+	0x89, 0xA0, 0x5B, 0xE0, 0x1D, 0xFB, 0x9C, 0x07, 0xC0, 0xA8, 0xA1, 0xB4, 0x22, 0xD0, 0x62, 0xA4,
+	0xC7, 0x17, 0x7F, 0x37, 0x4E, 0xCE, 0x2D, 0x3A, 0x58, 0xE3, 0xE5, 0xF0, 0x26, 0x86, 0x4D, 0x42,
+	0x07, 0x9F, 0xBE, 0xA3, 0xE2, 0x19, 0xA2, 0x6B, 0x72, 0xA5, 0x46, 0xBF, 0xCB, 0x64, 0x5B, 0x25,
+	0xC8, 0x45, 0xF4, 0xDE, 0xE8, 0x3C, 0xB6, 0xFD, 0x9C, 0xF3, 0xA0, 0xEF, 0x83, 0x41, 0x7C, 0x36,
+	0x70, 0x90, 0xC3, 0x52, 0x62, 0xB0, 0xC7, 0x7F, 0x3D, 0x7B, 0xE5, 0x96, 0x87, 0xA5, 0x56, 0xFF,
+	0x0E, 0xEA, 0x49, 0x05, 0xDF, 0xB4, 0xDD, 0x13, 0x6F, 0x45, 0xD3, 0x9B, 0xC8, 0x23, 0x79, 0x2A,
+	0x30, 0x99, 0x9D, 0x99, 0xDC, 0xCC, 0xCD, 0xA5, 0x2E, 0x81, 0x53, 0x52, 0x22, 0xF2, 0xD0, 0x3D,
+	0xA2, 0x37, 0x52, 0x91, 0x91, 0x46, 0x70, 0xD6, 0xC5, 0x4B, 0x05, 0xFF, 0x4E, 0xF4, 0xDC, 0x64,
+	0x06, 0x97, 0xFE, 0x7C, 0x90, 0x86, 0x27, 0xAF, 0x9F, 0x34, 0x55, 0x48, 0x89, 0xAB, 0x22, 0xC0,
+	0x75, 0x07, 0x8C, 0x21, 0xD9, 0x04, 0xD3, 0x1C, 0xA7, 0xEA, 0x6D, 0xA4, 0xC9, 0x52, 0x2B, 0xE2,
+	0xC4, 0x02, 0x89, 0x30, 0x5E, 0xE7, 0x9B, 0x31, 0xE6, 0x39, 0x65, 0xAD, 0x71, 0xAD, 0xEF, 0x67,
+	0x5B, 0xDC, 0xA3, 0x24, 0xED, 0x0D, 0xE6, 0xE2, 0xA9, 0x7A, 0x3A, 0x18, 0x55, 0xDE, 0xF0, 0x46,
+	0x2E, 0x34, 0x4D, 0x1A, 0x4D, 0x98, 0x80, 0x0D, 0x4E, 0xD1, 0x6C, 0x85, 0x75, 0xB8, 0x03, 0xC2,
+	0x00, 0xD5, 0x22, 0x4A, 0x26, 0xD1, 0x8E, 0xDD, 0xED, 0xB5, 0xD4, 0x27, 0xD6, 0x3A, 0x7C, 0x67,
+	0x69, 0x86, 0xD7, 0x54, 0x3F, 0x97, 0xCF, 0x64, 0xBE, 0x91, 0xAB, 0x6E, 0xB6, 0x9D, 0x19, 0x10,
+	0x79, 0xB5, 0x97, 0x0E, 0xF4, 0xD1, 0x85, 0xC9, 0xE4, 0xAE, 0xC7, 0xC0, 0xB4, 0xAA, 0x07, 0xC4,
+	0x1F, 0xC1, 0x3A, 0x57, 0x9F, 0xCD, 0x0E, 0xA6, 0x7A, 0xE5, 0x15, 0x86, 0xB2, 0xAA, 0xF4, 0xA2,
+	0x93, 0x2C, 0xCF, 0x8C, 0xF7, 0x51, 0xFA, 0xDD, 0x8C, 0xD0, 0x49, 0x02, 0x03, 0x01, 0x00, 0x01,
+	0xA3, 0x82, 0x01, 0x57, 0x30, 0x82, 0x01, 0x53, 0x30, 0x0E, 0x06, 0x03, 0x55, 0x1D, 0x0F, 0x01,
+	0x01, 0xFF, 0x04, 0x04, 0x03, 0x02, 0x07, 0x80, 0x30, 0x16, 0x06, 0x03, 0x55, 0x1D, 0x25, 0x01,
+	0x01, 0xFF, 0x04, 0x0C, 0x30, 0x0A, 0x06, 0x08, 0x2B, 0x06, 0x01, 0x05, 0x05, 0x07, 0x03, 0x08,
+	0x30, 0x41, 0x06, 0x03, 0x55, 0x1D, 0x20, 0x04, 0x3A, 0x30, 0x38, 0x30, 0x36, 0x06, 0x0A, 0x60,
+	0x86, 0x48, 0x01, 0x86, 0xFA, 0x6C, 0x0A, 0x03, 0x05, 0x30, 0x28, 0x30, 0x26, 0x06, 0x08, 0x2B,
+	0x06, 0x01, 0x05, 0x05, 0x07, 0x02, 0x01, 0x16, 0x1A, 0x68, 0x74, 0x74, 0x70, 0x3A, 0x2F, 0x2F,
+	0x77, 0x77, 0x77, 0x2E, 0x65, 0x6E, 0x74, 0x72, 0x75, 0x73, 0x74, 0x2E, 0x6E, 0x65, 0x74, 0x2F,
+	0x72, 0x70, 0x61, 0x30, 0x09, 0x06, 0x03, 0x55, 0x1D, 0x13, 0x04, 0x02, 0x30, 0x00, 0x30, 0x68,
+	0x06, 0x08, 0x2B, 0x06, 0x01, 0x05, 0x05, 0x07, 0x01, 0x01, 0x04, 0x5C, 0x30, 0x5A, 0x30, 0x23,
+	0x06, 0x08, 0x2B, 0x06, 0x01, 0x05, 0x05, 0x07, 0x30, 0x01, 0x86, 0x17, 0x68, 0x74, 0x74, 0x70,
+	0x3A, 0x2F, 0x2F, 0x6F, 0x63, 0x73, 0x70, 0x2E, 0x65, 0x6E, 0x74, 0x72, 0x75, 0x73, 0x74, 0x2E,
+	0x6E, 0x65, 0x74, 0x30, 0x33, 0x06, 0x08, 0x2B, 0x06, 0x01, 0x05, 0x05, 0x07, 0x30, 0x02, 0x86,
+	0x27, 0x68, 0x74, 0x74, 0x70, 0x3A, 0x2F, 0x2F, 0x61, 0x69, 0x61, 0x2E, 0x65, 0x6E, 0x74, 0x72,
+	0x75, 0x73, 0x74, 0x2E, 0x6E, 0x65, 0x74, 0x2F, 0x74, 0x73, 0x31, 0x2D, 0x63, 0x68, 0x61, 0x69,
+	0x6E, 0x32, 0x35, 0x36, 0x2E, 0x63, 0x65, 0x72, 0x30, 0x31, 0x06, 0x03, 0x55, 0x1D, 0x1F, 0x04,
+	0x2A, 0x30, 0x28, 0x30, 0x26, 0xA0, 0x24, 0xA0, 0x22, 0x86, 0x20, 0x68, 0x74, 0x74, 0x70, 0x3A,
+	0x2F, 0x2F, 0x63, 0x72, 0x6C, 0x2E, 0x65, 0x6E, 0x74, 0x72, 0x75, 0x73, 0x74, 0x2E, 0x6E, 0x65,
+	0x74, 0x2F, 0x74, 0x73, 0x31, 0x63, 0x61, 0x2E, 0x63, 0x72, 0x6C, 0x30, 0x1F, 0x06, 0x03, 0x55,
+	0x1D, 0x23, 0x04, 0x18, 0x30, 0x16, 0x80, 0x14, 0xC3, 0xC2, 0x71, 0xD2, 0x7B, 0xD7, 0x68, 0x05,
+	0xAE, 0x3B, 0x39, 0x9B, 0x34, 0x25, 0x0C, 0x62, 0x03, 0xC7, 0x57, 0x68, 0x30, 0x1D, 0x06, 0x03,
+	0x55, 0x1D, 0x0E, 0x04, 0x16, 0x04, 0x14, 0x2D, 0x56, 0x80, 0xEF, 0x8E, 0xF7, 0x4A, 0x43, 0x1C,
+	0x43, 0xA1, 0xB5, 0xDE, 0xD9, 0xD7, 0xA8, 0xAA, 0x6B, 0x26, 0x28, 0x30, 0x0D, 0x06, 0x09, 0x2A,
+	0x86, 0x48, 0x86, 0xF7, 0x0D, 0x01, 0x01, 0x0B, 0x05, 0x00, 0x03, 0x82, 0x01, 0x01, 0x00, 0x58,
+	0x4B, 0xCE, 0xD8, 0xFE, 0x81, 0xD7, 0x51, 0xD8, 0xC7, 0x5C, 0x8D, 0x92, 0xD2, 0x4E, 0x95, 0x1E,
+	0x85, 0x86, 0x43, 0xED, 0xE0, 0x1A, 0xE6, 0x9A, 0x21, 0x42, 0x33, 0x5D, 0xE3, 0x91, 0xBE, 0xF8,
+	0x50, 0x7C, 0x76, 0x8C, 0x25, 0xA9, 0x41, 0xD4, 0x84, 0x99, 0xE8, 0xE8, 0xA2, 0xB6, 0x99, 0x97,
+	0x68, 0xA2, 0x20, 0xBD, 0x32, 0xA8, 0xAA, 0x29, 0x7C, 0x0A, 0x76, 0x1A, 0x9F, 0xC8, 0x55, 0x8E,
+	0xAB, 0xD3, 0x7B, 0xD4, 0xE3, 0x7E, 0x59, 0x7E, 0x92, 0x70, 0x39, 0x0F, 0xED, 0xF6, 0x2F, 0xF3,
+	0x4F, 0xFF, 0x74, 0x5C, 0xF3, 0xE7, 0x30, 0x34, 0x40, 0xA3, 0x11, 0xA3, 0x6B, 0x72, 0xA4, 0x32,
+	0x11, 0x05, 0x7C, 0xFD, 0x91, 0x8B, 0x47, 0xA8, 0x57, 0x36, 0x52, 0xC7, 0xFA, 0xB5, 0x45, 0x84,
+	0xD1, 0xB2, 0x3E, 0x42, 0xE5, 0x16, 0x5E, 0xDD, 0x03, 0xD3, 0xA9, 0xFD, 0x3D, 0x70, 0x67, 0x7A,
+	0xDA, 0x13, 0xE0, 0x84, 0x82, 0x67, 0x38, 0x60, 0x56, 0xC3, 0xAD, 0xB0, 0x88, 0xE1, 0x0A, 0x37,
+	0x7E, 0x62, 0x81, 0x06, 0xBB, 0x23, 0x04, 0xEF, 0x58, 0xA0, 0x23, 0xA8, 0xD1, 0x09, 0x63, 0x30,
+	0xCD, 0xD9, 0x19, 0x38, 0xF4, 0xEB, 0x5A, 0x77, 0x58, 0xBE, 0x5F, 0xBF, 0xEB, 0x94, 0x2D, 0xFF,
+	0x2F, 0x04, 0x30, 0x64, 0x10, 0x8F, 0x3E, 0x59, 0x56, 0x2E, 0x3A, 0x36, 0x4F, 0x0E, 0x3C, 0x96,
+	0x0F, 0x8F, 0xC9, 0xEA, 0x7E, 0x7F, 0x49, 0x32, 0x1F, 0xA3, 0x5F, 0x6E, 0xDA, 0x22, 0x9F, 0xD7,
+	0xD9, 0x17, 0x39, 0x59, 0xDE, 0x48, 0x17, 0x7A, 0x02, 0x4B, 0x58, 0x71, 0xFF, 0xB7, 0x0C, 0x2D,
+	0xA1, 0xF0, 0x67, 0xA3, 0x11, 0xDC, 0xF7, 0xC9, 0xBC, 0xD9, 0x1E, 0xCB, 0x6C, 0x0C, 0x15, 0x27,
+	0x78, 0x48, 0x16, 0x6B, 0x2C, 0xF1, 0xAD, 0x97, 0xB8, 0x75, 0x6C, 0xBB, 0x95, 0xC3, 0x8E, 0x31,
+	0x82, 0x04, 0x9A, 0x30, 0x82, 0x04, 0x96, 0x02, 0x01, 0x01, 0x30, 0x81, 0xC8, 0x30, 0x81, 0xB2,
+	0x31, 0x0B, 0x30, 0x09, 0x06, 0x03, 0x55, 0x04, 0x06, 0x13, 0x02, 0x55, 0x53, 0x31, 0x16, 0x30,
+	0x14, 0x06, 0x03, 0x55, 0x04, 0x0A, 0x13, 0x0D, 0x45, 0x6E, 0x74, 0x72, 0x75, 0x73, 0x74, 0x2C,
+	0x20, 0x49, 0x6E, 0x63, 0x2E, 0x31, 0x28, 0x30, 0x26, 0x06, 0x03, 0x55, 0x04, 0x0B, 0x13, 0x1F,
+	0x53, 0x65, 0x65, 0x20, 0x77, 0x77, 0x77, 0x2E, 0x65, 0x6E, 0x74, 0x72, 0x75, 0x73, 0x74, 0x2E,
+	0x6E, 0x65, 0x74, 0x2F, 0x6C, 0x65, 0x67, 0x61, 0x6C, 0x2D, 0x74, 0x65, 0x72, 0x6D, 0x73, 0x31,
+	0x39, 0x30, 0x37, 0x06, 0x03, 0x55, 0x04, 0x0B, 0x13, 0x30, 0x28, 0x63, 0x29, 0x20, 0x32, 0x30,
+	0x31, 0x35, 0x20, 0x45, 0x6E, 0x74, 0x72, 0x75, 0x73, 0x74, 0x2C, 0x20, 0x49, 0x6E, 0x63, 0x2E,
+	0x20, 0x2D, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x61, 0x75, 0x74, 0x68, 0x6F, 0x72, 0x69, 0x7A, 0x65,
+	0x64, 0x20, 0x75, 0x73, 0x65, 0x20, 0x6F, 0x6E, 0x6C, 0x79, 0x31, 0x26, 0x30, 0x24, 0x06, 0x03,
+	0x55, 0x04, 0x03, 0x13, 0x1D, 0x45, 0x6E, 0x74, 0x72, 0x75, 0x73, 0x74, 0x20, 0x54, 0x69, 0x6D,
+	0x65, 0x73, 0x74, 0x61, 0x6D, 0x70, 0x69, 0x6E, 0x67, 0x20, 0x43, 0x41, 0x20, 0x2D, 0x20, 0x54,
+	0x53, 0x31, 0x02, 0x11, 0x00, 0x8D, 0xCE, 0x15, 0xF3, 0xA7, 0x94, 0xC5, 0x87, 0x00, 0x00, 0x00,
+	0x00, 0x55, 0x92, 0x33, 0xF4, 0x30, 0x0B, 0x06, 0x09, 0x60, 0x86, 0x48, 0x01, 0x65, 0x03, 0x04,
+	0x02, 0x01, 0xA0, 0x82, 0x01, 0xA6, 0x30, 0x1A, 0x06, 0x09, 0x2A, 0x86, 0x48, 0x86, 0xF7, 0x0D,
+	0x01, 0x09, 0x03, 0x31, 0x0D, 0x06, 0x0B, 0x2A, 0x86, 0x48, 0x86, 0xF7, 0x0D, 0x01, 0x09, 0x10,
+	0x01, 0x04, 0x30, 0x1C, 0x06, 0x09, 0x2A, 0x86, 0x48, 0x86, 0xF7, 0x0D, 0x01, 0x09, 0x05, 0x31,
+	0x0F, 0x17, 0x0D, 0x32, 0x32, 0x30, 0x37, 0x31, 0x39, 0x31, 0x32, 0x34, 0x39, 0x32, 0x37, 0x5A,
+	0x30, 0x29, 0x06, 0x09, 0x2A, 0x86, 0x48, 0x86, 0xF7, 0x0D, 0x01, 0x09, 0x34, 0x31, 0x1C, 0x30,
+	0x1A, 0x30, 0x0B, 0x06, 0x09, 0x60, 0x86, 0x48, 0x01, 0x65, 0x03, 0x04, 0x02, 0x01, 0xA1, 0x0B,
+	0x06, 0x09, 0x2A, 0x86, 0x48, 0x86, 0xF7, 0x0D, 0x01, 0x01, 0x0B, 0x30, 0x2F, 0x06, 0x09, 0x2A,
+	0x86, 0x48, 0x86, 0xF7, 0x0D, 0x01, 0x09, 0x04, 0x31, 0x22, 0x04, 0x20, 0xA6, 0x3D, 0x46, 0x1D,
+	0x71, 0xB0, 0x13, 0xE7, 0xCF, 0x47, 0xB9, 0x03, 0xDF, 0x0B, 0xEF, 0x49, 0x55, 0xCE, 0x0C, 0x6A,
+	0x01, 0x83, 0x18, 0x34, 0xC8, 0x4A, 0xA1, 0x33, 0x26, 0xA9, 0x22, 0x5E, 0x30, 0x82, 0x01, 0x0C,
+	0x06, 0x0B, 0x2A, 0x86, 0x48, 0x86, 0xF7, 0x0D, 0x01, 0x09, 0x10, 0x02, 0x2F, 0x31, 0x81, 0xFC,
+	0x30, 0x81, 0xF9, 0x30, 0x81, 0xF6, 0x30, 0x81, 0xF3, 0x04, 0x20, 0x95, 0x0A, 0x26, 0xFD, 0xC7,
+	0xC0, 0x20, 0x18, 0xE9, 0xF7, 0x91, 0xA9, 0x5C, 0x38, 0xF2, 0x6E, 0xEF, 0x3D, 0xA4, 0x32, 0x67,
+	0xCA, 0xB0, 0xCD, 0x15, 0xA5, 0x55, 0xAF, 0x63, 0x10, 0x72, 0xC9, 0x30, 0x81, 0xCE, 0x30, 0x81,
+	0xB8, 0xA4, 0x81, 0xB5, 0x30, 0x81, 0xB2, 0x31, 0x0B, 0x30, 0x09, 0x06, 0x03, 0x55, 0x04, 0x06,
+	0x13, 0x02, 0x55, 0x53, 0x31, 0x16, 0x30, 0x14, 0x06, 0x03, 0x55, 0x04, 0x0A, 0x13, 0x0D, 0x45,
+	0x6E, 0x74, 0x72, 0x75, 0x73, 0x74, 0x2C, 0x20, 0x49, 0x6E, 0x63, 0x2E, 0x31, 0x28, 0x30, 0x26,
+	0x06, 0x03, 0x55, 0x04, 0x0B, 0x13, 0x1F, 0x53, 0x65, 0x65, 0x20, 0x77, 0x77, 0x77, 0x2E, 0x65,
+	0x6E, 0x74, 0x72, 0x75, 0x73, 0x74, 0x2E, 0x6E, 0x65, 0x74, 0x2F, 0x6C, 0x65, 0x67, 0x61, 0x6C,
+	0x2D, 0x74, 0x65, 0x72, 0x6D, 0x73, 0x31, 0x39, 0x30, 0x37, 0x06, 0x03, 0x55, 0x04, 0x0B, 0x13,
+	0x30, 0x28, 0x63, 0x29, 0x20, 0x32, 0x30, 0x31, 0x35, 0x20, 0x45, 0x6E, 0x74, 0x72, 0x75, 0x73,
+	0x74, 0x2C, 0x20, 0x49, 0x6E, 0x63, 0x2E, 0x20, 0x2D, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x61, 0x75,
+	0x74, 0x68, 0x6F, 0x72, 0x69, 0x7A, 0x65, 0x64, 0x20, 0x75, 0x73, 0x65, 0x20, 0x6F, 0x6E, 0x6C,
+	0x79, 0x31, 0x26, 0x30, 0x24, 0x06, 0x03, 0x55, 0x04, 0x03, 0x13, 0x1D, 0x45, 0x6E, 0x74, 0x72,
+	0x75, 0x73, 0x74, 0x20, 0x54, 0x69, 0x6D, 0x65, 0x73, 0x74, 0x61, 0x6D, 0x70, 0x69, 0x6E, 0x67,
+	0x20, 0x43, 0x41, 0x20, 0x2D, 0x20, 0x54, 0x53, 0x31, 0x02, 0x11, 0x00, 0x8D, 0xCE, 0x15, 0xF3,
+	0xA7, 0x94, 0xC5, 0x87, 0x00, 0x00, 0x00, 0x00, 0x55, 0x92, 0x33, 0xF4, 0x30, 0x0B, 0x06, 0x09,
+	0x2A, 0x86, 0x48, 0x86, 0xF7, 0x0D, 0x01, 0x01, 0x0B, 0x04, 0x82, 0x02, 0x00, 0xAA, 0x59, 0x58,
+	0x86, 0xED, 0xBC, 0xA3, 0x76, 0x4C, 0x36, 0xCC, 0x98, 0x50, 0x96, 0x57, 0x37, 0xF7, 0x41, 0x0F,
+	0xDB, 0x7A, 0x87, 0xC6, 0xB4, 0x92, 0x70, 0x28, 0x38, 0x8A, 0x88, 0x3D, 0xD5, 0xD2, 0xF0, 0xEC,
+	0x0B, 0x83, 0x3F, 0x00, 0xF9, 0x98, 0x93, 0xB8, 0xA3, 0x3D, 0x41, 0x31, 0xB9, 0x7D, 0x5A, 0x13,
+	0x1F, 0x20, 0xA0, 0x2B, 0x1C, 0x0F, 0xE2, 0x89, 0x12, 0x4E, 0x12, 0xCC, 0x36, 0xEE, 0x88, 0xA2,
+	0x4E, 0x53, 0xC8, 0x17, 0xFD, 0xFB, 0xBC, 0x26, 0x42, 0xBC, 0x8B, 0xA6, 0xB4, 0x1D, 0xD4, 0xEE,
+	0x2C, 0x83, 0x33, 0xA2, 0xD6, 0x7F, 0xC6, 0x8F, 0x49, 0x48, 0x3C, 0x41, 0xD9, 0x3C, 0x28, 0x85,
+	0x8A, 0x34, 0xF5, 0x27, 0x56, 0xC4, 0xFD, 0x55, 0x9E, 0xA7, 0x0E, 0x1D, 0x6A, 0x2E, 0x07, 0xB6,
+	0xDA, 0x67, 0xEF, 0x8B, 0x74, 0x1E, 0x3D, 0xF0, 0x61, 0x70, 0xE6, 0xFD, 0xA0, 0xB5, 0x4F, 0xD5,
+	0xCD, 0xC3, 0x95, 0x9F, 0x2D, 0xFE, 0xD8, 0xB8, 0x84, 0xC1, 0x58, 0xF7, 0x58, 0x27, 0xAA, 0xD5,
+	0x8A, 0xCA, 0x5D, 0xB2, 0x15, 0x93, 0xE2, 0x99, 0x55, 0xDA, 0x7D, 0x96, 0xE7, 0xA9, 0x94, 0xF9,
+	0xD8, 0x4D, 0x04, 0x79, 0xB1, 0xD4, 0x83, 0x4B, 0x5A, 0xBB, 0x1E, 0x81, 0x33, 0xB5, 0x3D, 0x56,
+	0x5A, 0x4C, 0xE8, 0x83, 0x0A, 0x8D, 0xBC, 0xD9, 0x8F, 0x82, 0xEC, 0x13, 0xD8, 0xFD, 0x90, 0xA1,
+	0xA2, 0x5B, 0x48, 0xFC, 0x1C, 0xAB, 0xAD, 0xD8, 0xC8, 0x10, 0x6F, 0xAD, 0x9C, 0x12, 0x84, 0x10,
+	0x54, 0x77, 0xE2, 0x67, 0xAF, 0xFC, 0xA9, 0x5C, 0x38, 0xEE, 0xA1, 0xFC, 0x76, 0x2B, 0x5D, 0xFB,
+	0xE8, 0xA8, 0x3C, 0xE8, 0xAF, 0x76, 0xB0, 0xFD, 0x88, 0x4D, 0x0C, 0xC4, 0x8C, 0x7C, 0x75, 0x43,
+	0xBE, 0xD0, 0x0F, 0x8D, 0x51, 0x74, 0xAF, 0x56, 0xDC, 0x5A, 0x8D, 0x72, 0x64, 0x92, 0x9A, 0xD0,
+	0x29, 0x5A, 0x3C, 0xD7, 0xF2, 0xDC, 0x3F, 0x38, 0x14, 0xC9, 0xB8, 0x53, 0x78, 0x4A, 0xBC, 0xC7,
+	0xAC, 0xBD, 0x62, 0x4D, 0xA4, 0x07, 0x9E, 0x39, 0xD9, 0x18, 0x9D, 0x99, 0x89, 0xFA, 0xDF, 0xD3,
+	0x18, 0xB1, 0x19, 0x71, 0x80, 0x58, 0x66, 0xB1, 0x57, 0xEC, 0xBC, 0x09, 0x41, 0x79, 0x21, 0xBB,
+	0x3E, 0xC2, 0x83, 0x5D, 0x5F, 0x21, 0xFD, 0xC7, 0x83, 0x63, 0x44, 0xAE, 0x8E, 0x94, 0xDD, 0xAB,
+	0x27, 0xA0, 0x68, 0x57, 0x01, 0x66, 0x5B, 0x91, 0x8A, 0xC3, 0x63, 0xA2, 0x75, 0xA1, 0x4D, 0xFB,
+	0x18, 0xA4, 0x84, 0xBE, 0x8B, 0x73, 0xF6, 0x99, 0x9C, 0x24, 0x1F, 0x08, 0x02, 0x50, 0xEA, 0x04,
+	0xE8, 0x60, 0xCD, 0x25, 0x0E, 0x4A, 0x84, 0xDF, 0xDC, 0x13, 0x88, 0x30, 0xF6, 0xA1, 0x41, 0x7A,
+	0x42, 0xAA, 0x8B, 0x15, 0x91, 0x84, 0x22, 0x96, 0xB6, 0x4E, 0x2F, 0x2A, 0xC9, 0x6A, 0xEA, 0xB5,
+	0xF5, 0xD4, 0x7D, 0x34, 0xEC, 0x07, 0xD1, 0xEF, 0x48, 0xAB, 0x4A, 0xA7, 0x83, 0x06, 0x44, 0xB5,
+	0xD7, 0xBA, 0xA0, 0x51, 0x87, 0xBF, 0xF4, 0xD8, 0x27, 0x69, 0xFB, 0x8B, 0x84, 0x0B, 0xA3, 0xDB,
+	0x3A, 0xEC, 0x94, 0x77, 0xBA, 0xA9, 0xAC, 0x0C, 0xD3, 0x1C, 0x6E, 0xAF, 0xCA, 0x3D, 0x82, 0xE4,
+	0x32, 0xCD, 0x7D, 0x9F, 0x30, 0x5D, 0xF9, 0xA3, 0x13, 0x5D, 0x36, 0x9B, 0x72, 0x02, 0xEA, 0xFF,
+	0x88, 0x49, 0x67, 0x25, 0x18, 0x52, 0x5E, 0x88, 0xFE, 0x15, 0xDB, 0x55, 0x5F, 0x59, 0xA3, 0x97,
+	0xC0, 0x57, 0x7C, 0x74, 0x71, 0x22, 0x04, 0x62, 0x22, 0x8C, 0xDA, 0xAC, 0xA3, 0xD4, 0x40, 0x9D,
+	0x28, 0xED, 0x85, 0x88, 0x3F, 0x70, 0x5D, 0x60, 0xCF, 0xBD, 0xAA, 0x62, 0xA5, 0x35, 0x96, 0x5B,
+	0xE3, 0x7D, 0x16, 0x88, 0xB9, 0x84, 0xEA, 0xB5, 0xEB, 0xDB, 0xB5, 0x36, 0x6C, 0x30, 0x82, 0x25,
+	0xD5, 0x06, 0x0A, 0x2B, 0x06, 0x01, 0x04, 0x01, 0x82, 0x37, 0x02, 0x04, 0x01, 0x31, 0x82, 0x25,
+	0xC5, 0x30, 0x82, 0x25, 0xC1, 0x06, 0x09, 0x2A, 0x86, 0x48, 0x86, 0xF7, 0x0D, 0x01, 0x07, 0x02,
+	0xA0, 0x82, 0x25, 0xB2, 0x30, 0x82, 0x25, 0xAE, 0x02, 0x01, 0x01, 0x31, 0x0F, 0x30, 0x0D, 0x06,
+	0x09, 0x60, 0x86, 0x48, 0x01, 0x65, 0x03, 0x04, 0x02, 0x01, 0x05, 0x00, 0x30, 0x5C, 0x06, 0x0A,
+	0x2B, 0x06, 0x01, 0x04, 0x01, 0x82, 0x37, 0x02, 0x01, 0x04, 0xA0, 0x4E, 0x30, 0x4C, 0x30, 0x17,
+	0x06, 0x0A, 0x2B, 0x06, 0x01, 0x04, 0x01, 0x82, 0x37, 0x02, 0x01, 0x0F, 0x30, 0x09, 0x03, 0x01,
+	0x00, 0xA0, 0x04, 0xA2, 0x02, 0x80, 0x00, 0x30, 0x31, 0x30, 0x0D, 0x06, 0x09, 0x60, 0x86, 0x48,
+	0x01, 0x65, 0x03, 0x04, 0x02, 0x01, 0x05, 0x00, 0x04, 0x20, 0xE0, 0xAE, 0xBF, 0xEA, 0x4A, 0x2E,
+	0x02, 0xD4, 0x8E, 0xA2, 0x79, 0x15, 0x25, 0xE2, 0xCF, 0x94, 0x1A, 0x79, 0xDC, 0x3B, 0x89, 0x2A,
+	0x62, 0x0C, 0x7A, 0xAD, 0xF3, 0x85, 0x75, 0x9A, 0xAA, 0x40, 0xA0, 0x82, 0x0B, 0x64, 0x30, 0x82,
+	0x05, 0x7B, 0x30, 0x82, 0x04, 0x63, 0xA0, 0x03, 0x02, 0x01, 0x02, 0x02, 0x13, 0x33, 0x00, 0x00,
+	0x00, 0xDC, 0x34, 0x1A, 0x52, 0x0F, 0xBB, 0xCF, 0x3D, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDC,
+	0x30, 0x0D, 0x06, 0x09, 0x2A, 0x86, 0x48, 0x86, 0xF7, 0x0D, 0x01, 0x01, 0x0B, 0x05, 0x00, 0x30,
+	0x81, 0x8E, 0x31, 0x0B, 0x30, 0x09, 0x06, 0x03, 0x55, 0x04, 0x06, 0x13, 0x02, 0x55, 0x53, 0x31,
+	0x13, 0x30, 0x11, 0x06, 0x03, 0x55, 0x04, 0x08, 0x13, 0x0A, 0x57, 0x61, 0x73, 0x68, 0x69, 0x6E,
+	0x67, 0x74, 0x6F, 0x6E, 0x31, 0x10, 0x30, 0x0E, 0x06, 0x03, 0x55, 0x04, 0x07, 0x13, 0x07, 0x52,
+	0x65, 0x64, 0x6D, 0x6F, 0x6E, 0x64, 0x31, 0x1E, 0x30, 0x1C, 0x06, 0x03, 0x55, 0x04, 0x0A, 0x13,
+	0x15, 0x4D, 0x69, 0x63, 0x72, 0x6F, 0x73, 0x6F, 0x66, 0x74, 0x20, 0x43, 0x6F, 0x72, 0x70, 0x6F,
+	0x72, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x31, 0x38, 0x30, 0x36, 0x06, 0x03, 0x55, 0x04, 0x03, 0x13,
+	0x2F, 0x4D, 0x69, 0x63, 0x72, 0x6F, 0x73, 0x6F, 0x66, 0x74, 0x20, 0x57, 0x69, 0x6E, 0x64, 0x6F,
+	0x77, 0x73, 0x20, 0x54, 0x68, 0x69, 0x72, 0x64, 0x20, 0x50, 0x61, 0x72, 0x74, 0x79, 0x20, 0x43,
+	0x6F, 0x6D, 0x70, 0x6F, 0x6E, 0x65, 0x6E, 0x74, 0x20, 0x43, 0x41, 0x20, 0x32, 0x30, 0x31, 0x32,
+	0x30, 0x1E, 0x17, 0x0D, 0x32, 0x32, 0x30, 0x33, 0x31, 0x30, 0x31, 0x39, 0x35, 0x38, 0x30, 0x35,
+	0x5A, 0x17, 0x0D, 0x32, 0x33, 0x30, 0x33, 0x30, 0x38, 0x31, 0x39, 0x35, 0x38, 0x30, 0x35, 0x5A,
+	0x30, 0x81, 0x91, 0x31, 0x0B, 0x30, 0x09, 0x06, 0x03, 0x55, 0x04, 0x06, 0x13, 0x02, 0x55, 0x53,
+	0x31, 0x13, 0x30, 0x11, 0x06, 0x03, 0x55, 0x04, 0x08, 0x13, 0x0A, 0x57, 0x61, 0x73, 0x68, 0x69,
+	0x6E, 0x67, 0x74, 0x6F, 0x6E, 0x31, 0x10, 0x30, 0x0E, 0x06, 0x03, 0x55, 0x04, 0x07, 0x13, 0x07,
+	0x52, 0x65, 0x64, 0x6D, 0x6F, 0x6E, 0x64, 0x31, 0x1E, 0x30, 0x1C, 0x06, 0x03, 0x55, 0x04, 0x0A,
+	0x13, 0x15, 0x4D, 0x69, 0x63, 0x72, 0x6F, 0x73, 0x6F, 0x66, 0x74, 0x20, 0x43, 0x6F, 0x72, 0x70,
+	0x6F, 0x72, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x31, 0x3B, 0x30, 0x39, 0x06, 0x03, 0x55, 0x04, 0x03,
+	0x13, 0x32, 0x4D, 0x69, 0x63, 0x72, 0x6F, 0x73, 0x6F, 0x66, 0x74, 0x20, 0x57, 0x69, 0x6E, 0x64,
+	0x6F, 0x77, 0x73, 0x20, 0x48, 0x61, 0x72, 0x64, 0x77, 0x61, 0x72, 0x65, 0x20, 0x43, 0x6F, 0x6D,
+	0x70, 0x61, 0x74, 0x69, 0x62, 0x69, 0x6C, 0x69, 0x74, 0x79, 0x20, 0x50, 0x75, 0x62, 0x6C, 0x69,
+	0x73, 0x68, 0x65, 0x72, 0x30, 0x82, 0x01, 0x22, 0x30, 0x0D, 0x06, 0x09, 0x2A, 0x86, 0x48, 0x86,
+	0xF7, 0x0D, 0x01, 0x01, 0x01, 0x05, 0x00, 0x03, 0x82, 0x01, 0x0F, 0x00, 0x30, 0x82, 0x01, 0x0A,
+	0x02, 0x82, 0x01, 0x01, 0x00, 0xA2, 0xD2, 0x93, 0x7A, 0x06, 0x61, 0x5D, 0xFC, 0x3F, 0x2F, 0x80,
+	0x6E, 0x69, 0x5D, 0x3B, 0xFD, 0x52, 0x24, 0x41, 0xD5, 0xF3, 0x2D, 0x8D, 0xBE, 0xC6, 0x03, 0x99,
+	0x7C, 0x29, 0x4D, 0x75, 0x54, 0x39, 0xE9, 0xF9, 0x8E, 0x16, 0xB5, 0xAE, 0x2D, 0x07, 0x08, 0x65,
+	0xF6, 0x3E, 0x4C, 0xF5, 0xEC, 0xA5, 0x2B, 0x4F, 0x2B, 0xD6, 0x66, 0xFF, 0x6A, 0x73, 0x78, 0x09,
+	0x53, 0xAC, 0xF5, 0x1B, 0xA5, 0xBF, 0xFA, 0x4A, 0x84, 0xBD, 0x65, 0xD1, 0xF2, 0x98, 0x01, 0x2D,
+	0xE5, 0xE4, 0x0D, 0x8C, 0x56, 0x6A, 0xE4, 0x7F, 0xC9, 0x4F, 0x88, 0xD0, 0x5B, 0xDC, 0xF6, 0x7D,
+	0x69, 0x14, 0x13, 0x72, 0x52, 0x9E, 0x4B, 0xDA, 0x28, 0x95, 0xCA, 0xE1, 0x7D, 0x68, 0x58, 0xBE,
+	0x5D, 0x71, 0xF5, 0x12, 0x46, 0xA6, 0xB0, 0x0F, 0x95, 0x1A, 0xFF, 0x7F, 0x26, 0x6D, 0xB6, 0xC0,
+	0x91, 0x25, 0x51, 0x82, 0xC6, 0xD1, 0xAE, 0x67, 0x1B, 0xE7, 0x75, 0x54, 0x6A, 0x3D, 0x98, 0x58,
+	0x27, 0x58, 0x45, 0x89, 0xAA, 0x7E, 0x6B, 0x3C, 0xD7, 0x82, 0x6B, 0x76, 0x65, 0xA2, 0x0A, 0x07,
+	0x4F, 0x86, 0xC3, 0x7E, 0x67, 0x7E, 0xCA, 0xF3, 0xB4, 0xE4, 0x0C, 0x2B, 0xFF, 0x88, 0x76, 0x72,
+	0x74, 0x81, 0x9B, 0xEC, 0xE6, 0xD4, 0xFA, 0xA1, 0xD4, 0xB9, 0xE5, 0xB6, 0xDF, 0xBE, 0x20, 0x23,
+	0x5A, 0x0D, 0x52, 0xA0, 0xFC, 0xC9, 0x9E, 0x54, 0xBA, 0x6B, 0x14, 0x9B, 0xD0, 0x7D, 0x7C, 0xD8,
+	0x41, 0x0B, 0x4B, 0x50, 0x29, 0xB3, 0x59, 0xBB, 0xE4, 0x39, 0x30, 0x24, 0xB8, 0x02, 0x64, 0x6D,
+	0x10, 0xAE, 0xE4, 0x9E, 0x47, 0xCA, 0x86, 0x3E, 0x3F, 0xF5, 0x49, 0x0B, 0x89, 0x20, 0x3A, 0xA1,
+	0xC8, 0x75, 0x75, 0x25, 0xFA, 0xB9, 0x66, 0xCA, 0x2B, 0xD5, 0xEE, 0x6F, 0x03, 0x94, 0x53, 0x3A,
+	0xF4, 0x04, 0x36, 0xFD, 0x31, 0x02, 0x03, 0x01, 0x00, 0x01, 0xA3, 0x82, 0x01, 0xCB, 0x30, 0x82,
+	0x01, 0xC7, 0x30, 0x2B, 0x06, 0x03, 0x55, 0x1D, 0x25, 0x04, 0x24, 0x30, 0x22, 0x06, 0x0A, 0x2B,
+	0x06, 0x01, 0x04, 0x01, 0x82, 0x37, 0x0A, 0x03, 0x27, 0x06, 0x0A, 0x2B, 0x06, 0x01, 0x04, 0x01,
+	0x82, 0x37, 0x0A, 0x03, 0x05, 0x06, 0x08, 0x2B, 0x06, 0x01, 0x05, 0x05, 0x07, 0x03, 0x03, 0x30,
+	0x1D, 0x06, 0x03, 0x55, 0x1D, 0x0E, 0x04, 0x16, 0x04, 0x14, 0x6C, 0x22, 0x3D, 0xF5, 0x73, 0x52,
+	0x82, 0xCC, 0xDE, 0xDA, 0x03, 0x41, 0xBF, 0xCD, 0x94, 0xDE, 0x03, 0xF4, 0x96, 0x0C, 0x30, 0x50,
+	0x06, 0x03, 0x55, 0x1D, 0x11, 0x04, 0x49, 0x30, 0x47, 0xA4, 0x45, 0x30, 0x43, 0x31, 0x29, 0x30,
+	0x27, 0x06, 0x03, 0x55, 0x04, 0x0B, 0x13, 0x20, 0x4D, 0x69, 0x63, 0x72, 0x6F, 0x73, 0x6F, 0x66,
+	0x74, 0x20, 0x4F, 0x70, 0x65, 0x72, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x20, 0x50, 0x75, 0x65,
+	0x72, 0x74, 0x6F, 0x20, 0x52, 0x69, 0x63, 0x6F, 0x31, 0x16, 0x30, 0x14, 0x06, 0x03, 0x55, 0x04,
+	0x05, 0x13, 0x0D, 0x32, 0x33, 0x32, 0x38, 0x32, 0x35, 0x2B, 0x34, 0x36, 0x39, 0x35, 0x38, 0x30,
+	0x30, 0x1F, 0x06, 0x03, 0x55, 0x1D, 0x23, 0x04, 0x18, 0x30, 0x16, 0x80, 0x14, 0x61, 0x71, 0xA7,
+	0x87, 0xAF, 0xFF, 0x69, 0xD5, 0x21, 0x76, 0x4F, 0x52, 0x93, 0x28, 0x00, 0xBE, 0x79, 0x12, 0xAB,
+	0x84, 0x30, 0x74, 0x06, 0x03, 0x55, 0x1D, 0x1F, 0x04, 0x6D, 0x30, 0x6B, 0x30, 0x69, 0xA0, 0x67,
+	0xA0, 0x65, 0x86, 0x63, 0x68, 0x74, 0x74, 0x70, 0x3A, 0x2F, 0x2F, 0x77, 0x77, 0x77, 0x2E, 0x6D,
+	0x69, 0x63, 0x72, 0x6F, 0x73, 0x6F, 0x66, 0x74, 0x2E, 0x63, 0x6F, 0x6D, 0x2F, 0x70, 0x6B, 0x69,
+	0x6F, 0x70, 0x73, 0x2F, 0x63, 0x72, 0x6C, 0x2F, 0x4D, 0x69, 0x63, 0x72, 0x6F, 0x73, 0x6F, 0x66,
+	0x74, 0x25, 0x32, 0x30, 0x57, 0x69, 0x6E, 0x64, 0x6F, 0x77, 0x73, 0x25, 0x32, 0x30, 0x54, 0x68,
+	0x69, 0x72, 0x64, 0x25, 0x32, 0x30, 0x50, 0x61, 0x72, 0x74, 0x79, 0x25, 0x32, 0x30, 0x43, 0x6F,
+	0x6D, 0x70, 0x6F, 0x6E, 0x65, 0x6E, 0x74, 0x25, 0x32, 0x30, 0x43, 0x41, 0x25, 0x32, 0x30, 0x32,
+	0x30, 0x31, 0x32, 0x2E, 0x63, 0x72, 0x6C, 0x30, 0x81, 0x81, 0x06, 0x08, 0x2B, 0x06, 0x01, 0x05,
+	0x05, 0x07, 0x01, 0x01, 0x04, 0x75, 0x30, 0x73, 0x30, 0x71, 0x06, 0x08, 0x2B, 0x06, 0x01, 0x05,
+	0x05, 0x07, 0x30, 0x02, 0x86, 0x65, 0x68, 0x74, 0x74, 0x70, 0x3A, 0x2F, 0x2F, 0x77, 0x77, 0x77,
+	0x2E, 0x6D, 0x69, 0x63, 0x72, 0x6F, 0x73, 0x6F, 0x66, 0x74, 0x2E, 0x63, 0x6F, 0x6D, 0x2F, 0x70,
+	0x6B, 0x69, 0x6F, 0x70, 0x73, 0x2F, 0x63, 0x65, 0x72, 0x74, 0x73, 0x2F, 0x4D, 0x69, 0x63, 0x72,
+	0x6F, 0x73, 0x6F, 0x66, 0x74, 0x25, 0x32, 0x30, 0x57, 0x69, 0x6E, 0x64, 0x6F, 0x77, 0x73, 0x25,
+	0x32, 0x30, 0x54, 0x68, 0x69, 0x72, 0x64, 0x25, 0x32, 0x30, 0x50, 0x61, 0x72, 0x74, 0x79, 0x25,
+	0x32, 0x30, 0x43, 0x6F, 0x6D, 0x70, 0x6F, 0x6E, 0x65, 0x6E, 0x74, 0x25, 0x32, 0x30, 0x43, 0x41,
+	0x25, 0x32, 0x30, 0x32, 0x30, 0x31, 0x32, 0x2E, 0x63, 0x72, 0x74, 0x30, 0x0C, 0x06, 0x03, 0x55,
+	0x1D, 0x13, 0x01, 0x01, 0xFF, 0x04, 0x02, 0x30, 0x00, 0x30, 0x0D, 0x06, 0x09, 0x2A, 0x86, 0x48,
+	0x86, 0xF7, 0x0D, 0x01, 0x01, 0x0B, 0x05, 0x00, 0x03, 0x82, 0x01, 0x01, 0x00, 0x61, 0xB2, 0x1F,
+	0xE5, 0x89, 0x14, 0x21, 0x22, 0x8F, 0x4B, 0xF8, 0x1E, 0xF5, 0xA0, 0x90, 0x05, 0xD4, 0x50, 0x86,
+	0x0E, 0x55, 0xD2, 0x01, 0x32, 0x53, 0xF0, 0xC9, 0x24, 0x06, 0x31, 0xC0, 0x8E, 0x16, 0x43, 0x15,
+	0x6B, 0x71, 0xE6, 0x0B, 0xF9, 0xC7, 0x8B, 0x9B, 0x11, 0x62, 0x27, 0xCE, 0xCE, 0x4C, 0xF7, 0x69,
+	0xC6, 0x9E, 0x06, 0xB3, 0x06, 0x61, 0x4C, 0xEC, 0xFB, 0x42, 0x1E, 0x11, 0xB4, 0x6F, 0x30, 0x74,
+	0xBF, 0xF1, 0xE8, 0xA5, 0x79, 0x25, 0xAA, 0x14, 0x5C, 0x7B, 0x18, 0xB8, 0x12, 0x89, 0x99, 0x08,
+	0xDB, 0x23, 0x24, 0x37, 0xF0, 0xF4, 0x4D, 0x48, 0x61, 0x54, 0x4A, 0x96, 0xEE, 0x3E, 0x40, 0xB0,
+	0x29, 0x35, 0x65, 0x9E, 0x28, 0x1C, 0x2F, 0xFC, 0x5C, 0xB0, 0x4E, 0x92, 0xEB, 0x6D, 0xB5, 0x6B,
+	0xD3, 0x5A, 0x91, 0x92, 0x27, 0x43, 0x0E, 0xE7, 0x20, 0x19, 0xC2, 0xD2, 0xF0, 0xDE, 0xB3, 0xF8,
+	0xD0, 0xB6, 0x6B, 0x21, 0x33, 0x67, 0xD4, 0x23, 0x11, 0xBB, 0xD5, 0x59, 0xB2, 0x0E, 0xCE, 0x3A,
+	0x2F, 0x89, 0x66, 0xC6, 0xB7, 0x6E, 0xBF, 0xC8, 0x45, 0x2F, 0xB4, 0xAB, 0x79, 0xD5, 0xC4, 0x73,
+	0x4C, 0xB3, 0x5D, 0x63, 0x98, 0x38, 0xA7, 0x3D, 0x65, 0x62, 0x6D, 0x0A, 0x9B, 0xB5, 0x12, 0xEE,
+	0xBA, 0x08, 0x4E, 0xCE, 0x0F, 0x8D, 0xEB, 0x22, 0x9C, 0xFB, 0x98, 0xD4, 0x3B, 0xCD, 0xEC, 0x55,
+	0x75, 0x79, 0x2F, 0x7A, 0xF7, 0x16, 0x98, 0xC4, 0x61, 0x8D, 0xB5, 0xB2, 0x72, 0x3D, 0x39, 0xFF,
+	0xEE, 0x82, 0x9B, 0x00, 0xA9, 0x6B, 0x14, 0xF7, 0x4E, 0xDD, 0x56, 0x04, 0x49, 0xB0, 0x40, 0xA7,
+	0x61, 0x1F, 0x7E, 0x1B, 0x16, 0xD9, 0xD3, 0x76, 0x35, 0x01, 0xBE, 0xC9, 0xC4, 0x83, 0xA7, 0x3E,
+	0x63, 0xF1, 0x91, 0xD2, 0x6B, 0x29, 0x02, 0xD8, 0x79, 0xC0, 0x61, 0x20, 0x40, 0x30, 0x82, 0x05,
+	0xE1, 0x30, 0x82, 0x03, 0xC9, 0xA0, 0x03, 0x02, 0x01, 0x02, 0x02, 0x0A, 0x61, 0x0B, 0xAA, 0xC1,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x30, 0x0D, 0x06, 0x09, 0x2A, 0x86, 0x48, 0x86, 0xF7, 0x0D,
+	0x01, 0x01, 0x0B, 0x05, 0x00, 0x30, 0x81, 0x88, 0x31, 0x0B, 0x30, 0x09, 0x06, 0x03, 0x55, 0x04,
+	0x06, 0x13, 0x02, 0x55, 0x53, 0x31, 0x13, 0x30, 0x11, 0x06, 0x03, 0x55, 0x04, 0x08, 0x13, 0x0A,
+	0x57, 0x61, 0x73, 0x68, 0x69, 0x6E, 0x67, 0x74, 0x6F, 0x6E, 0x31, 0x10, 0x30, 0x0E, 0x06, 0x03,
+	0x55, 0x04, 0x07, 0x13, 0x07, 0x52, 0x65, 0x64, 0x6D, 0x6F, 0x6E, 0x64, 0x31, 0x1E, 0x30, 0x1C,
+	0x06, 0x03, 0x55, 0x04, 0x0A, 0x13, 0x15, 0x4D, 0x69, 0x63, 0x72, 0x6F, 0x73, 0x6F, 0x66, 0x74,
+	0x20, 0x43, 0x6F, 0x72, 0x70, 0x6F, 0x72, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x31, 0x32, 0x30, 0x30,
+	0x06, 0x03, 0x55, 0x04, 0x03, 0x13, 0x29, 0x4D, 0x69, 0x63, 0x72, 0x6F, 0x73, 0x6F, 0x66, 0x74,
+	0x20, 0x52, 0x6F, 0x6F, 0x74, 0x20, 0x43, 0x65, 0x72, 0x74, 0x69, 0x66, 0x69, 0x63, 0x61, 0x74,
+	0x65, 0x20, 0x41, 0x75, 0x74, 0x68, 0x6F, 0x72, 0x69, 0x74, 0x79, 0x20, 0x32, 0x30, 0x31, 0x30,
+	0x30, 0x1E, 0x17, 0x0D, 0x31, 0x32, 0x30, 0x34, 0x31, 0x38, 0x32, 0x33, 0x34, 0x38, 0x33, 0x38,
+	0x5A, 0x17, 0x0D, 0x32, 0x37, 0x30, 0x34, 0x31, 0x38, 0x32, 0x33, 0x35, 0x38, 0x33, 0x38, 0x5A,
+	0x30, 0x81, 0x8E, 0x31, 0x0B, 0x30, 0x09, 0x06, 0x03, 0x55, 0x04, 0x06, 0x13, 0x02, 0x55, 0x53,
+	0x31, 0x13, 0x30, 0x11, 0x06, 0x03, 0x55, 0x04, 0x08, 0x13, 0x0A, 0x57, 0x61, 0x73, 0x68, 0x69,
+	0x6E, 0x67, 0x74, 0x6F, 0x6E, 0x31, 0x10, 0x30, 0x0E, 0x06, 0x03, 0x55, 0x04, 0x07, 0x13, 0x07,
+	0x52, 0x65, 0x64, 0x6D, 0x6F, 0x6E, 0x64, 0x31, 0x1E, 0x30, 0x1C, 0x06, 0x03, 0x55, 0x04, 0x0A,
+	0x13, 0x15, 0x4D, 0x69, 0x63, 0x72, 0x6F, 0x73, 0x6F, 0x66, 0x74, 0x20, 0x43, 0x6F, 0x72, 0x70,
+	0x6F, 0x72, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x31, 0x38, 0x30, 0x36, 0x06, 0x03, 0x55, 0x04, 0x03,
+	0x13, 0x2F, 0x4D, 0x69, 0x63, 0x72, 0x6F, 0x73, 0x6F, 0x66, 0x74, 0x20, 0x57, 0x69, 0x6E, 0x64,
+	0x6F, 0x77, 0x73, 0x20, 0x54, 0x68, 0x69, 0x72, 0x64, 0x20, 0x50, 0x61, 0x72, 0x74, 0x79, 0x20,
+	0x43, 0x6F, 0x6D, 0x70, 0x6F, 0x6E, 0x65, 0x6E, 0x74, 0x20, 0x43, 0x41, 0x20, 0x32, 0x30, 0x31,
+	0x32, 0x30, 0x82, 0x01, 0x22, 0x30, 0x0D, 0x06, 0x09, 0x2A, 0x86, 0x48, 0x86, 0xF7, 0x0D, 0x01,
+	0x01, 0x01, 0x05, 0x00, 0x03, 0x82, 0x01, 0x0F, 0x00, 0x30, 0x82, 0x01, 0x0A, 0x02, 0x82, 0x01,
+	0x01, 0x00, 0xA3, 0x9C, 0x30, 0x84, 0x09, 0xA7, 0x63, 0x2E, 0xCF, 0x0A, 0x47, 0xF0, 0xEA, 0x24,
+	0xF9, 0xA3, 0x30, 0x20, 0x0F, 0x5E, 0x57, 0x31, 0x26, 0x81, 0x9A, 0x31, 0x07, 0xB2, 0x50, 0xD4,
+	0xCE, 0x67, 0x09, 0x08, 0x65, 0x0A, 0x5A, 0xA5, 0x4B, 0xAE, 0xD5, 0xED, 0x10, 0x2E, 0xE7, 0xA5,
+	0x99, 0xB5, 0x9F, 0x68, 0x2F, 0x98, 0x8B, 0x58, 0x02, 0xAC, 0x20, 0xB4, 0x29, 0xC4, 0x71, 0xBD,
+	0x28, 0x1C, 0xA5, 0xFD, 0x3C, 0x9B, 0x64, 0xE4, 0xC5, 0xEB, 0xDF, 0x61, 0x25, 0xBC, 0xF0, 0xEE,
+	0x68, 0xBF, 0xD1, 0xA7, 0xCB, 0x7E, 0x2A, 0x02, 0x81, 0x4E, 0x64, 0x5C, 0x0C, 0x53, 0x86, 0x79,
+	0x57, 0x19, 0x37, 0x61, 0xB7, 0x98, 0xF9, 0x0C, 0xA0, 0x4E, 0x22, 0x59, 0x9B, 0xF9, 0x1B, 0x2D,
+	0x67, 0x3C, 0x27, 0x3C, 0x56, 0x90, 0x66, 0xE3, 0xFD, 0x7F, 0x65, 0x7D, 0x0F, 0x86, 0xBD, 0x35,
+	0x47, 0xE8, 0x8A, 0xCC, 0xF4, 0xDA, 0x8E, 0xE9, 0x6A, 0x4E, 0xAB, 0xA7, 0x55, 0xEC, 0xA2, 0x89,
+	0x1E, 0xD5, 0x33, 0x45, 0x53, 0xCB, 0xF9, 0x9E, 0x77, 0xBD, 0xCD, 0x2C, 0xF9, 0x05, 0xB8, 0x7F,
+	0x74, 0x01, 0x1D, 0xE8, 0xFB, 0x18, 0xE1, 0x43, 0xD1, 0x0D, 0xE9, 0xAA, 0xDC, 0x37, 0x6F, 0xBD,
+	0xFE, 0xB8, 0x0F, 0xED, 0x1D, 0x4D, 0x01, 0x46, 0x4E, 0x0A, 0xAC, 0xFC, 0x82, 0xE8, 0xEC, 0x56,
+	0x83, 0x13, 0x8E, 0x3A, 0x01, 0xED, 0x14, 0x64, 0x74, 0xEA, 0x64, 0xB2, 0x66, 0x10, 0xB6, 0x68,
+	0x6D, 0xC8, 0x70, 0x00, 0x7D, 0x50, 0x48, 0x2E, 0x3D, 0x43, 0xEE, 0xE0, 0x24, 0x95, 0xC6, 0xCD,
+	0x8E, 0xC7, 0xFD, 0xB8, 0xE4, 0x95, 0xCF, 0xDD, 0x7E, 0xFB, 0x95, 0x5E, 0xA1, 0x01, 0xCD, 0x43,
+	0xB1, 0x07, 0xD7, 0xA4, 0x30, 0xEE, 0x9B, 0x86, 0x1A, 0x2A, 0x6E, 0xC1, 0x0B, 0x59, 0xA2, 0x74,
+	0x6F, 0x8B, 0x02, 0x03, 0x01, 0x00, 0x01, 0xA3, 0x82, 0x01, 0x43, 0x30, 0x82, 0x01, 0x3F, 0x30,
+	0x10, 0x06, 0x09, 0x2B, 0x06, 0x01, 0x04, 0x01, 0x82, 0x37, 0x15, 0x01, 0x04, 0x03, 0x02, 0x01,
+	0x00, 0x30, 0x1D, 0x06, 0x03, 0x55, 0x1D, 0x0E, 0x04, 0x16, 0x04, 0x14, 0x61, 0x71, 0xA7, 0x87,
+	0xAF, 0xFF, 0x69, 0xD5, 0x21, 0x76, 0x4F, 0x52, 0x93, 0x28, 0x00, 0xBE, 0x79, 0x12, 0xAB, 0x84,
+	0x30, 0x19, 0x06, 0x09, 0x2B, 0x06, 0x01, 0x04, 0x01, 0x82, 0x37, 0x14, 0x02, 0x04, 0x0C, 0x1E,
+	0x0A, 0x00, 0x53, 0x00, 0x75, 0x00, 0x62, 0x00, 0x43, 0x00, 0x41, 0x30, 0x0B, 0x06, 0x03, 0x55,
+	0x1D, 0x0F, 0x04, 0x04, 0x03, 0x02, 0x01, 0x86, 0x30, 0x0F, 0x06, 0x03, 0x55, 0x1D, 0x13, 0x01,
+	0x01, 0xFF, 0x04, 0x05, 0x30, 0x03, 0x01, 0x01, 0xFF, 0x30, 0x1F, 0x06, 0x03, 0x55, 0x1D, 0x23,
+	0x04, 0x18, 0x30, 0x16, 0x80, 0x14, 0xD5, 0xF6, 0x56, 0xCB, 0x8F, 0xE8, 0xA2, 0x5C, 0x62, 0x68,
+	0xD1, 0x3D, 0x94, 0x90, 0x5B, 0xD7, 0xCE, 0x9A, 0x18, 0xC4, 0x30, 0x56, 0x06, 0x03, 0x55, 0x1D,
+	0x1F, 0x04, 0x4F, 0x30, 0x4D, 0x30, 0x4B, 0xA0, 0x49, 0xA0, 0x47, 0x86, 0x45, 0x68, 0x74, 0x74,
+	0x70, 0x3A, 0x2F, 0x2F, 0x63, 0x72, 0x6C, 0x2E, 0x6D, 0x69, 0x63, 0x72, 0x6F, 0x73, 0x6F, 0x66,
+	0x74, 0x2E, 0x63, 0x6F, 0x6D, 0x2F, 0x70, 0x6B, 0x69, 0x2F, 0x63, 0x72, 0x6C, 0x2F, 0x70, 0x72,
+	0x6F, 0x64, 0x75, 0x63, 0x74, 0x73, 0x2F, 0x4D, 0x69, 0x63, 0x52, 0x6F, 0x6F, 0x43, 0x65, 0x72,
+	0x41, 0x75, 0x74, 0x5F, 0x32, 0x30, 0x31, 0x30, 0x2D, 0x30, 0x36, 0x2D, 0x32, 0x33, 0x2E, 0x63,
+	0x72, 0x6C, 0x30, 0x5A, 0x06, 0x08, 0x2B, 0x06, 0x01, 0x05, 0x05, 0x07, 0x01, 0x01, 0x04, 0x4E,
+	0x30, 0x4C, 0x30, 0x4A, 0x06, 0x08, 0x2B, 0x06, 0x01, 0x05, 0x05, 0x07, 0x30, 0x02, 0x86, 0x3E,
+	0x68, 0x74, 0x74, 0x70, 0x3A, 0x2F, 0x2F, 0x77, 0x77, 0x77, 0x2E, 0x6D, 0x69, 0x63, 0x72, 0x6F,
+	0x73, 0x6F, 0x66, 0x74, 0x2E, 0x63, 0x6F, 0x6D, 0x2F, 0x70, 0x6B, 0x69, 0x2F, 0x63, 0x65, 0x72,
+	0x74, 0x73, 0x2F, 0x4D, 0x69, 0x63, 0x52, 0x6F, 0x6F, 0x43, 0x65, 0x72, 0x41, 0x75, 0x74, 0x5F,
+	0x32, 0x30, 0x31, 0x30, 0x2D, 0x30, 0x36, 0x2D, 0x32, 0x33, 0x2E, 0x63, 0x72, 0x74, 0x30, 0x0D,
+	0x06, 0x09, 0x2A, 0x86, 0x48, 0x86, 0xF7, 0x0D, 0x01, 0x01, 0x0B, 0x05, 0x00, 0x03, 0x82, 0x02,
+	0x01, 0x00, 0x5A, 0x8A, 0x67, 0xDA, 0xCC, 0xD5, 0xFD, 0x0D, 0x26, 0x41, 0x77, 0xBF, 0x0A, 0x46,
+	0x78, 0xB4, 0xB3, 0xDE, 0x12, 0x69, 0x2B, 0x77, 0x23, 0xC2, 0x65, 0x2F, 0x01, 0x5F, 0xD2, 0x03,
+	0xF4, 0x61, 0xBA, 0x50, 0x9D, 0x2E, 0x8C, 0x39, 0x72, 0xF3, 0x6C, 0x3E, 0x6A, 0xB1, 0x1E, 0x76,
+	0x6D, 0xEC, 0xB7, 0xF3, 0x82, 0xDC, 0xCC, 0xBB, 0xC5, 0x69, 0x70, 0x28, 0x73, 0x66, 0x17, 0x3F,
+	0x54, 0xEB, 0xEE, 0x01, 0x16, 0x48, 0xC4, 0x46, 0xD9, 0x1B, 0x80, 0xAE, 0x81, 0x3A, 0x8D, 0x0F,
+	0x79, 0x6D, 0x68, 0xB0, 0x9E, 0xEA, 0x2D, 0x3F, 0x39, 0xD3, 0xCA, 0x38, 0x7E, 0xBD, 0x5E, 0x7C,
+	0x08, 0x6E, 0x19, 0xDC, 0xC6, 0xC2, 0xF4, 0x38, 0x33, 0x68, 0x61, 0xE2, 0x52, 0x47, 0x83, 0xE1,
+	0x00, 0x01, 0x56, 0xD2, 0xBA, 0xCB, 0x87, 0x82, 0x05, 0x31, 0x0A, 0x41, 0x8B, 0x4E, 0xE7, 0x7F,
+	0x5F, 0x5F, 0xED, 0x5F, 0xD3, 0x39, 0x2D, 0x45, 0xEB, 0xA2, 0x13, 0xBF, 0xFD, 0x1E, 0xC2, 0x98,
+	0x41, 0x71, 0x61, 0x16, 0x5F, 0xC8, 0x0A, 0x70, 0x25, 0x7C, 0x59, 0x69, 0x31, 0x24, 0xE4, 0x71,
+	0xE7, 0x0A, 0xBB, 0x04, 0x17, 0xF7, 0x9F, 0x72, 0x1E, 0xC9, 0xD2, 0xBB, 0x1A, 0xBE, 0x3D, 0x02,
+	0xFE, 0x09, 0x0C, 0xB2, 0x43, 0xB4, 0x59, 0x1A, 0x99, 0x53, 0x93, 0x96, 0x21, 0x5F, 0xE0, 0xD6,
+	0xB7, 0x26, 0x01, 0x42, 0x95, 0x36, 0xAC, 0x27, 0xFD, 0xBE, 0xF4, 0x85, 0x77, 0x68, 0x3D, 0x18,
+	0xBD, 0xF4, 0xBE, 0x98, 0x88, 0x22, 0x11, 0x86, 0x52, 0x16, 0xF3, 0x45, 0xEC, 0x03, 0x97, 0x10,
+	0x70, 0x87, 0xA3, 0x70, 0x43, 0x71, 0x3C, 0xDB, 0xC9, 0x86, 0x03, 0x17, 0x0C, 0xF5, 0x73, 0x5B,
+	0xC6, 0x7D, 0xE1, 0x5C, 0x64, 0xED, 0xD7, 0xC5, 0x48, 0xD7, 0xED, 0x32, 0xE2, 0xD1, 0xAA, 0xD3,
+	0xCF, 0xA7, 0xF6, 0x57, 0x4E, 0x61, 0xF9, 0x77, 0xEB, 0x67, 0xF2, 0x88, 0xB3, 0xDE, 0x00, 0xDA,
+	0x03, 0x8F, 0xD0, 0x8A, 0x34, 0x37, 0x3E, 0x1D, 0xD8, 0x62, 0xB8, 0xD2, 0xB1, 0xF3, 0xE1, 0x2F,
+	0x8B, 0x72, 0x3B, 0x81, 0x96, 0x7C, 0x6F, 0xFC, 0xEC, 0x66, 0x76, 0x72, 0x60, 0x1B, 0x24, 0xF2,
+	0xA0, 0x89, 0x6D, 0x5B, 0x6D, 0x00, 0x2E, 0xEF, 0x28, 0xDD, 0x86, 0x87, 0x05, 0xC2, 0xB4, 0xB9,
+	0xE5, 0xBE, 0x64, 0xC2, 0x2A, 0xF2, 0x4A, 0x15, 0x5C, 0x98, 0xE2, 0xC4, 0x27, 0x85, 0xFF, 0x52,
+	0xE3, 0x62, 0x7E, 0x0F, 0xB2, 0x02, 0x0B, 0xD7, 0x66, 0xC7, 0x0A, 0xB2, 0xD3, 0x3D, 0x20, 0x04,
+	0x14, 0x50, 0x32, 0x59, 0x83, 0x0A, 0x7D, 0x9B, 0xED, 0x5A, 0x38, 0x12, 0x01, 0x52, 0xBA, 0x2F,
+	0x5E, 0x20, 0x72, 0x8E, 0x4A, 0xF1, 0xFD, 0xE7, 0x71, 0x02, 0x8C, 0x3B, 0xE1, 0x07, 0xBE, 0xC9,
+	0x73, 0xF4, 0xDD, 0x47, 0xD8, 0xB4, 0xEF, 0xB4, 0xA4, 0xB3, 0x30, 0xB9, 0x89, 0x3E, 0x76, 0xCA,
+	0xB9, 0x00, 0x98, 0x56, 0x7E, 0xAB, 0xEA, 0x8A, 0xB8, 0xA5, 0xD0, 0x38, 0xAB, 0x69, 0x77, 0x13,
+	0x0B, 0x14, 0x2F, 0xE9, 0xAA, 0x41, 0x1F, 0xF7, 0xBA, 0xBD, 0x3A, 0x2B, 0x34, 0x8A, 0xEE, 0x0A,
+	0xAB, 0x63, 0xE6, 0x63, 0xF7, 0x88, 0x24, 0x8E, 0x20, 0x0D, 0x2B, 0x3B, 0x9D, 0xE3, 0xC2, 0x49,
+	0x52, 0xAC, 0x9F, 0x1F, 0x0E, 0x39, 0x3B, 0x5D, 0xD4, 0x6E, 0x50, 0x6A, 0xE6, 0x7D, 0x52, 0x3A,
+	0xAA, 0x7C, 0x33, 0x15, 0x29, 0x0D, 0x26, 0x5E, 0x01, 0x58, 0xA7, 0x4E, 0xA9, 0x3D, 0x7A, 0x84,
+	0x6F, 0x74, 0x3F, 0x60, 0x9F, 0xE4, 0x32, 0x4F, 0x36, 0x00, 0xAF, 0x6D, 0x71, 0xD3, 0x3E, 0xA6,
+	0x46, 0x65, 0x5F, 0x81, 0x74, 0xF1, 0xFE, 0xC1, 0x71, 0xDA, 0x4C, 0xA0, 0x41, 0x5A, 0x82, 0xDD,
+	0xF1, 0x1F, 0x31, 0x82, 0x19, 0xD0, 0x30, 0x82, 0x19, 0xCC, 0x02, 0x01, 0x01, 0x30, 0x81, 0xA6,
+	0x30, 0x81, 0x8E, 0x31, 0x0B, 0x30, 0x09, 0x06, 0x03, 0x55, 0x04, 0x06, 0x13, 0x02, 0x55, 0x53,
+	0x31, 0x13, 0x30, 0x11, 0x06, 0x03, 0x55, 0x04, 0x08, 0x13, 0x0A, 0x57, 0x61, 0x73, 0x68, 0x69,
+	0x6E, 0x67, 0x74, 0x6F, 0x6E, 0x31, 0x10, 0x30, 0x0E, 0x06, 0x03, 0x55, 0x04, 0x07, 0x13, 0x07,
+	0x52, 0x65, 0x64, 0x6D, 0x6F, 0x6E, 0x64, 0x31, 0x1E, 0x30, 0x1C, 0x06, 0x03, 0x55, 0x04, 0x0A,
+	0x13, 0x15, 0x4D, 0x69, 0x63, 0x72, 0x6F, 0x73, 0x6F, 0x66, 0x74, 0x20, 0x43, 0x6F, 0x72, 0x70,
+	0x6F, 0x72, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x31, 0x38, 0x30, 0x36, 0x06, 0x03, 0x55, 0x04, 0x03,
+	0x13, 0x2F, 0x4D, 0x69, 0x63, 0x72, 0x6F, 0x73, 0x6F, 0x66, 0x74, 0x20, 0x57, 0x69, 0x6E, 0x64,
+	0x6F, 0x77, 0x73, 0x20, 0x54, 0x68, 0x69, 0x72, 0x64, 0x20, 0x50, 0x61, 0x72, 0x74, 0x79, 0x20,
+	0x43, 0x6F, 0x6D, 0x70, 0x6F, 0x6E, 0x65, 0x6E, 0x74, 0x20, 0x43, 0x41, 0x20, 0x32, 0x30, 0x31,
+	0x32, 0x02, 0x13, 0x33, 0x00, 0x00, 0x00, 0xDC, 0x34, 0x1A, 0x52, 0x0F, 0xBB, 0xCF, 0x3D, 0x8C,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0xDC, 0x30, 0x0D, 0x06, 0x09, 0x60, 0x86, 0x48, 0x01, 0x65, 0x03,
+	0x04, 0x02, 0x01, 0x05, 0x00, 0xA0, 0x81, 0xE3, 0x30, 0x11, 0x06, 0x0A, 0x2A, 0x86, 0x48, 0x86,
+	0xF7, 0x0D, 0x01, 0x09, 0x19, 0x04, 0x31, 0x03, 0x02, 0x01, 0x01, 0x30, 0x19, 0x06, 0x09, 0x2A,
+	0x86, 0x48, 0x86, 0xF7, 0x0D, 0x01, 0x09, 0x03, 0x31, 0x0C, 0x06, 0x0A, 0x2B, 0x06, 0x01, 0x04,
+	0x01, 0x82, 0x37, 0x02, 0x01, 0x04, 0x30, 0x1C, 0x06, 0x0A, 0x2B, 0x06, 0x01, 0x04, 0x01, 0x82,
+	0x37, 0x02, 0x01, 0x0B, 0x31, 0x0E, 0x30, 0x0C, 0x06, 0x0A, 0x2B, 0x06, 0x01, 0x04, 0x01, 0x82,
+	0x37, 0x02, 0x01, 0x15, 0x30, 0x2F, 0x06, 0x09, 0x2A, 0x86, 0x48, 0x86, 0xF7, 0x0D, 0x01, 0x09,
+	0x04, 0x31, 0x22, 0x04, 0x20, 0x86, 0xE2, 0x83, 0x08, 0x59, 0xA5, 0x08, 0x71, 0xB1, 0xE6, 0xB1,
+	0x28, 0x84, 0x80, 0xFC, 0xF0, 0xD7, 0xC0, 0x77, 0x75, 0x79, 0x69, 0xA7, 0x65, 0x9D, 0x1F, 0x29,
+	0xDE, 0x8F, 0x07, 0xE2, 0x7C, 0x30, 0x64, 0x06, 0x0A, 0x2B, 0x06, 0x01, 0x04, 0x01, 0x82, 0x37,
+	0x02, 0x01, 0x0C, 0x31, 0x56, 0x30, 0x54, 0xA0, 0x26, 0x80, 0x24, 0x00, 0x4E, 0x00, 0x56, 0x00,
+	0x49, 0x00, 0x44, 0x00, 0x49, 0x00, 0x41, 0x00, 0x20, 0x00, 0x43, 0x00, 0x6F, 0x00, 0x72, 0x00,
+	0x70, 0x00, 0x6F, 0x00, 0x72, 0x00, 0x61, 0x00, 0x74, 0x00, 0x69, 0x00, 0x6F, 0x00, 0x6E, 0xA1,
+	0x2A, 0x80, 0x28, 0x68, 0x74, 0x74, 0x70, 0x73, 0x3A, 0x2F, 0x2F, 0x77, 0x77, 0x77, 0x2E, 0x6D,
+	0x69, 0x63, 0x72, 0x6F, 0x73, 0x6F, 0x66, 0x74, 0x2E, 0x63, 0x6F, 0x6D, 0x2F, 0x65, 0x6E, 0x2D,
+	0x75, 0x73, 0x2F, 0x77, 0x69, 0x6E, 0x64, 0x6F, 0x77, 0x73, 0x20, 0x30, 0x0D, 0x06, 0x09, 0x2A,
+	0x86, 0x48, 0x86, 0xF7, 0x0D, 0x01, 0x01, 0x01, 0x05, 0x00, 0x04, 0x82, 0x01, 0x00, 0x28, 0xEB,
+	0x6E, 0x27, 0x72, 0x3D, 0x25, 0xB0, 0xB7, 0x39, 0x0A, 0x79, 0x5A, 0x60, 0x58, 0xCA, 0xDF, 0x34,
+	0x62, 0x98, 0xE6, 0x17, 0xBA, 0x01, 0xDA, 0x16, 0x9E, 0xB8, 0x27, 0x4C, 0xFE, 0x0A, 0xCD, 0xEE,
+	0xCE, 0x62, 0x0D, 0x37, 0x1C, 0x4E, 0x7F, 0xF5, 0xCF, 0x63, 0x5A, 0xB1, 0xFF, 0x7A, 0x16, 0x37,
+	0xF6, 0x4D, 0xE2, 0x3B, 0x50, 0xEF, 0x19, 0xB8, 0x1D, 0x39, 0x10, 0x27, 0x57, 0xEF, 0x1B, 0xA6,
+	0xB1, 0x08, 0x53, 0xDA, 0xDC, 0x70, 0x65, 0x87, 0xBD, 0xFA, 0x3E, 0x30, 0xE4, 0x08, 0x8C, 0x1A,
+	0x07, 0xA6, 0x5D, 0x17, 0xDE, 0x32, 0x94, 0xBD, 0x8F, 0x3D, 0xB9, 0xD5, 0xF6, 0xBE, 0xC4, 0x9B,
+	0xFA, 0xC4, 0x19, 0x31, 0xFB, 0xD6, 0x60, 0xC5, 0xE9, 0xEB, 0xF0, 0xBC, 0xC7, 0x1C, 0xD7, 0x07,
+	0x92, 0x14, 0x5D, 0x63, 0xC8, 0x08, 0x7A, 0x4A, 0xB4, 0x8A, 0xFA, 0x4A, 0x17, 0x42, 0xE1, 0xA4,
+	0x09, 0x44, 0x7C, 0xE1, 0x83, 0x50, 0x99, 0x28, 0x2E, 0xBD, 0x20, 0x79, 0x96, 0x4B, 0x78, 0x58,
+	0x87, 0x99, 0xC7, 0x8A, 0x40, 0xA5, 0x09, 0x76, 0xF2, 0x27, 0x76, 0xA7, 0x88, 0xD0, 0x65, 0x16,
+	0xE1, 0xE6, 0xF4, 0x7A, 0xD1, 0xBD, 0x41, 0x38, 0x7D, 0xF9, 0x00, 0x94, 0xB3, 0xCF, 0xFD, 0x02,
+	0x14, 0x29, 0x38, 0xEA, 0x7B, 0xEB, 0xD5, 0x5B, 0x02, 0x6D, 0x03, 0x70, 0x1A, 0x42, 0xF3, 0x7F,
+	0x7D, 0x64, 0x1A, 0x6C, 0x5A, 0x28, 0x80, 0xCD, 0xB3, 0xE4, 0xD3, 0x34, 0x6B, 0x1D, 0xE5, 0x06,
+	0xB3, 0xF2, 0x37, 0x6E, 0xE6, 0x56, 0x6C, 0x83, 0xE6, 0x57, 0x2A, 0x11, 0x4E, 0x27, 0xB8, 0x4F,
+	0xBC, 0x52, 0xF4, 0x81, 0x99, 0x44, 0x28, 0xB0, 0x08, 0x3A, 0x3B, 0xEB, 0xF4, 0xD0, 0x74, 0x86,
+	0xF9, 0xBD, 0x5C, 0x1C, 0x54, 0xCC, 0xEB, 0x24, 0x2D, 0x5F, 0xBD, 0x4A, 0x7E, 0xF0, 0xA1, 0x82,
+	0x17, 0x14, 0x30, 0x82, 0x17, 0x10, 0x06, 0x0A, 0x2B, 0x06, 0x01, 0x04, 0x01, 0x82, 0x37, 0x03,
+	0x03, 0x01, 0x31, 0x82, 0x17, 0x00, 0x30, 0x82, 0x16, 0xFC, 0x06, 0x09, 0x2A, 0x86, 0x48, 0x86,
+	0xF7, 0x0D, 0x01, 0x07, 0x02, 0xA0, 0x82, 0x16, 0xED, 0x30, 0x82, 0x16, 0xE9, 0x02, 0x01, 0x03,
+	0x31, 0x0F, 0x30, 0x0D, 0x06, 0x09, 0x60, 0x86, 0x48, 0x01, 0x65, 0x03, 0x04, 0x02, 0x01, 0x05,
+	0x00, 0x30, 0x82, 0x01, 0x57, 0x06, 0x0B, 0x2A, 0x86, 0x48, 0x86, 0xF7, 0x0D, 0x01, 0x09, 0x10,
+	0x01, 0x04, 0xA0, 0x82, 0x01, 0x46, 0x04, 0x82, 0x01, 0x42, 0x30, 0x82, 0x01, 0x3E, 0x02, 0x01,
+	0x01, 0x06, 0x0A, 0x2B, 0x06, 0x01, 0x04, 0x01, 0x84, 0x59, 0x0A, 0x03, 0x01, 0x30, 0x31, 0x30,
+	0x0D, 0x06, 0x09, 0x60, 0x86, 0x48, 0x01, 0x65, 0x03, 0x04, 0x02, 0x01, 0x05, 0x00, 0x04, 0x20,
+	0xAC, 0x5D, 0x53, 0x2A, 0x00, 0xD2, 0xAB, 0xB7, 0xBA, 0x2C, 0x5B, 0x0F, 0x96, 0x0C, 0x01, 0x1A,
+	0x81, 0x30, 0xC0, 0xFF, 0x9A, 0xF8, 0xA6, 0xEF, 0xEC, 0x44, 0x40, 0x75, 0xC3, 0x0D, 0x4D, 0xF4,
+	0x02, 0x06, 0x62, 0xDE, 0x7E, 0xEB, 0x2D, 0xB5, 0x18, 0x11, 0x32, 0x30, 0x32, 0x32, 0x30, 0x38,
+	0x30, 0x33, 0x31, 0x30, 0x34, 0x37, 0x32, 0x30, 0x2E, 0x32, 0x5A, 0x30, 0x04, 0x80, 0x02, 0x01,
+	0xF4, 0xA0, 0x81, 0xD8, 0xA4, 0x81, 0xD5, 0x30, 0x81, 0xD2, 0x31, 0x0B, 0x30, 0x09, 0x06, 0x03,
+	0x55, 0x04, 0x06, 0x13, 0x02, 0x55, 0x53, 0x31, 0x13, 0x30, 0x11, 0x06, 0x03, 0x55, 0x04, 0x08,
+	0x13, 0x0A, 0x57, 0x61, 0x73, 0x68, 0x69, 0x6E, 0x67, 0x74, 0x6F, 0x6E, 0x31, 0x10, 0x30, 0x0E,
+	0x06, 0x03, 0x55, 0x04, 0x07, 0x13, 0x07, 0x52, 0x65, 0x64, 0x6D, 0x6F, 0x6E, 0x64, 0x31, 0x1E,
+	0x30, 0x1C, 0x06, 0x03, 0x55, 0x04, 0x0A, 0x13, 0x15, 0x4D, 0x69, 0x63, 0x72, 0x6F, 0x73, 0x6F,
+	0x66, 0x74, 0x20, 0x43, 0x6F, 0x72, 0x70, 0x6F, 0x72, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x31, 0x2D,
+	0x30, 0x2B, 0x06, 0x03, 0x55, 0x04, 0x0B, 0x13, 0x24, 0x4D, 0x69, 0x63, 0x72, 0x6F, 0x73, 0x6F,
+	0x66, 0x74, 0x20, 0x49, 0x72, 0x65, 0x6C, 0x61, 0x6E, 0x64, 0x20, 0x4F, 0x70, 0x65, 0x72, 0x61,
+	0x74, 0x69, 0x6F, 0x6E, 0x73, 0x20, 0x4C, 0x69, 0x6D, 0x69, 0x74, 0x65, 0x64, 0x31, 0x26, 0x30,
+	0x24, 0x06, 0x03, 0x55, 0x04, 0x0B, 0x13, 0x1D, 0x54, 0x68, 0x61, 0x6C, 0x65, 0x73, 0x20, 0x54,
+	0x53, 0x53, 0x20, 0x45, 0x53, 0x4E, 0x3A, 0x46, 0x43, 0x34, 0x31, 0x2D, 0x34, 0x42, 0x44, 0x34,
+	0x2D, 0x44, 0x32, 0x32, 0x30, 0x31, 0x25, 0x30, 0x23, 0x06, 0x03, 0x55, 0x04, 0x03, 0x13, 0x1C,
+	0x4D, 0x69, 0x63, 0x72, 0x6F, 0x73, 0x6F, 0x66, 0x74, 0x20, 0x54, 0x69, 0x6D, 0x65, 0x2D, 0x53,
+	0x74, 0x61, 0x6D, 0x70, 0x20, 0x53, 0x65, 0x72, 0x76, 0x69, 0x63, 0x65, 0xA0, 0x82, 0x11, 0x65,
+	0x30, 0x82, 0x07, 0x14, 0x30, 0x82, 0x04, 0xFC, 0xA0, 0x03, 0x02, 0x01, 0x02, 0x02, 0x13, 0x33,
+	0x00, 0x00, 0x01, 0x8E, 0x59, 0xDB, 0x46, 0x00, 0xA8, 0x10, 0x94, 0xCC, 0x00, 0x01, 0x00, 0x00,
+	0x01, 0x8E, 0x30, 0x0D, 0x06, 0x09, 0x2A, 0x86, 0x48, 0x86, 0xF7, 0x0D, 0x01, 0x01, 0x0B, 0x05,
+	0x00, 0x30, 0x7C, 0x31, 0x0B, 0x30, 0x09, 0x06, 0x03, 0x55, 0x04, 0x06, 0x13, 0x02, 0x55, 0x53,
+	0x31, 0x13, 0x30, 0x11, 0x06, 0x03, 0x55, 0x04, 0x08, 0x13, 0x0A, 0x57, 0x61, 0x73, 0x68, 0x69,
+	0x6E, 0x67, 0x74, 0x6F, 0x6E, 0x31, 0x10, 0x30, 0x0E, 0x06, 0x03, 0x55, 0x04, 0x07, 0x13, 0x07,
+	0x52, 0x65, 0x64, 0x6D, 0x6F, 0x6E, 0x64, 0x31, 0x1E, 0x30, 0x1C, 0x06, 0x03, 0x55, 0x04, 0x0A,
+	0x13, 0x15, 0x4D, 0x69, 0x63, 0x72, 0x6F, 0x73, 0x6F, 0x66, 0x74, 0x20, 0x43, 0x6F, 0x72, 0x70,
+	0x6F, 0x72, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x31, 0x26, 0x30, 0x24, 0x06, 0x03, 0x55, 0x04, 0x03,
+	0x13, 0x1D, 0x4D, 0x69, 0x63, 0x72, 0x6F, 0x73, 0x6F, 0x66, 0x74, 0x20, 0x54, 0x69, 0x6D, 0x65,
+	0x2D, 0x53, 0x74, 0x61, 0x6D, 0x70, 0x20, 0x50, 0x43, 0x41, 0x20, 0x32, 0x30, 0x31, 0x30, 0x30,
+	0x1E, 0x17, 0x0D, 0x32, 0x31, 0x31, 0x30, 0x32, 0x38, 0x31, 0x39, 0x32, 0x37, 0x34, 0x35, 0x5A,
+	0x17, 0x0D, 0x32, 0x33, 0x30, 0x31, 0x32, 0x36, 0x31, 0x39, 0x32, 0x37, 0x34, 0x35, 0x5A, 0x30,
+	0x81, 0xD2, 0x31, 0x0B, 0x30, 0x09, 0x06, 0x03, 0x55, 0x04, 0x06, 0x13, 0x02, 0x55, 0x53, 0x31,
+	0x13, 0x30, 0x11, 0x06, 0x03, 0x55, 0x04, 0x08, 0x13, 0x0A, 0x57, 0x61, 0x73, 0x68, 0x69, 0x6E,
+	0x67, 0x74, 0x6F, 0x6E, 0x31, 0x10, 0x30, 0x0E, 0x06, 0x03, 0x55, 0x04, 0x07, 0x13, 0x07, 0x52,
+	0x65, 0x64, 0x6D, 0x6F, 0x6E, 0x64, 0x31, 0x1E, 0x30, 0x1C, 0x06, 0x03, 0x55, 0x04, 0x0A, 0x13,
+	0x15, 0x4D, 0x69, 0x63, 0x72, 0x6F, 0x73, 0x6F, 0x66, 0x74, 0x20, 0x43, 0x6F, 0x72, 0x70, 0x6F,
+	0x72, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x31, 0x2D, 0x30, 0x2B, 0x06, 0x03, 0x55, 0x04, 0x0B, 0x13,
+	0x24, 0x4D, 0x69, 0x63, 0x72, 0x6F, 0x73, 0x6F, 0x66, 0x74, 0x20, 0x49, 0x72, 0x65, 0x6C, 0x61,
+	0x6E, 0x64, 0x20, 0x4F, 0x70, 0x65, 0x72, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x20, 0x4C, 0x69,
+	0x6D, 0x69, 0x74, 0x65, 0x64, 0x31, 0x26, 0x30, 0x24, 0x06, 0x03, 0x55, 0x04, 0x0B, 0x13, 0x1D,
+	0x54, 0x68, 0x61, 0x6C, 0x65, 0x73, 0x20, 0x54, 0x53, 0x53, 0x20, 0x45, 0x53, 0x4E, 0x3A, 0x46,
+	0x43, 0x34, 0x31, 0x2D, 0x34, 0x42, 0x44, 0x34, 0x2D, 0x44, 0x32, 0x32, 0x30, 0x31, 0x25, 0x30,
+	0x23, 0x06, 0x03, 0x55, 0x04, 0x03, 0x13, 0x1C, 0x4D, 0x69, 0x63, 0x72, 0x6F, 0x73, 0x6F, 0x66,
+	0x74, 0x20, 0x54, 0x69, 0x6D, 0x65, 0x2D, 0x53, 0x74, 0x61, 0x6D, 0x70, 0x20, 0x53, 0x65, 0x72,
+	0x76, 0x69, 0x63, 0x65, 0x30, 0x82, 0x02, 0x22, 0x30, 0x0D, 0x06, 0x09, 0x2A, 0x86, 0x48, 0x86,
+	0xF7, 0x0D, 0x01, 0x01, 0x01, 0x05, 0x00, 0x03, 0x82, 0x02, 0x0F, 0x00, 0x30, 0x82, 0x02, 0x0A,
+	0x02, 0x82, 0x02, 0x01, 0x00, 0xAA, 0x23, 0x02, 0xAB, 0xA3, 0x8C, 0xCC, 0xB6, 0xB9, 0xC2, 0xBB,
+	0x5C, 0x7F, 0xB0, 0x5F, 0xF5, 0xFD, 0x56, 0x5D, 0x6F, 0x64, 0xA6, 0xA6, 0xCE, 0x07, 0x38, 0x0F,
+	0x26, 0xF6, 0x86, 0x2E, 0xB6, 0x46, 0xEE, 0xDC, 0x20, 0xC2, 0xA4, 0xD1, 0x59, 0xFD, 0x45, 0x92,
+	0x3A, 0x49, 0x28, 0x13, 0x86, 0xE5, 0x03, 0xC8, 0x47, 0x2E, 0xDA, 0xE8, 0x81, 0x55, 0x03, 0x2D,
+	0x16, 0xFA, 0xD0, 0x5A, 0x15, 0x7E, 0x08, 0x9F, 0x80, 0xDB, 0x05, 0xFD, 0xAD, 0x1A, 0xE6, 0xF2,
+	0x63, 0xDF, 0xA1, 0x45, 0x4F, 0xA1, 0x45, 0xEC, 0x0F, 0x24, 0x7E, 0x42, 0x60, 0xEB, 0xE9, 0x3E,
+	0x1E, 0xFB, 0x15, 0xF1, 0x8C, 0xEB, 0x7F, 0x8E, 0x97, 0x04, 0x57, 0xA7, 0x96, 0x04, 0x47, 0xAB,
+	0x42, 0xD1, 0x64, 0x4A, 0x9F, 0x79, 0xAB, 0xC9, 0x6A, 0x6D, 0xE0, 0x2C, 0x00, 0x0E, 0xE1, 0xAF,
+	0xD0, 0xB0, 0xF6, 0x42, 0x39, 0xE1, 0x86, 0x0B, 0x51, 0x56, 0x27, 0x6C, 0x88, 0x39, 0xE7, 0xF7,
+	0xE6, 0x8B, 0x8C, 0xCB, 0x8D, 0x6A, 0x95, 0x21, 0xB2, 0xD1, 0xAA, 0x0A, 0xBE, 0xC9, 0x71, 0x06,
+	0x6D, 0xD1, 0x9A, 0xCF, 0x50, 0x75, 0xBF, 0x4E, 0xA4, 0xC9, 0xCA, 0x67, 0x94, 0xD5, 0xEA, 0xA0,
+	0x36, 0x8A, 0xC4, 0x6D, 0x37, 0x9D, 0xE9, 0x44, 0x32, 0x2D, 0xA4, 0xD5, 0x02, 0x68, 0x57, 0x35,
+	0x05, 0xC3, 0x0A, 0x17, 0xDA, 0xE7, 0x6E, 0xA7, 0x5B, 0xB4, 0x50, 0xEC, 0xBE, 0x2D, 0x5D, 0x7F,
+	0x4B, 0x73, 0x4A, 0x20, 0xBA, 0x20, 0x92, 0x90, 0xF9, 0x6E, 0xE5, 0xDA, 0xCD, 0x03, 0xA3, 0x4C,
+	0xF3, 0x3F, 0x94, 0x5D, 0x03, 0x80, 0x1F, 0x15, 0x5F, 0x21, 0x05, 0xE6, 0x8B, 0xE6, 0x37, 0x49,
+	0x5D, 0xA1, 0xAF, 0x67, 0x5C, 0xC5, 0xBC, 0xBD, 0x9E, 0x54, 0xF3, 0x62, 0xF7, 0xF8, 0x64, 0x3A,
+	0xF9, 0x5A, 0x97, 0x30, 0xB7, 0xBB, 0x53, 0x75, 0x12, 0x09, 0x89, 0xB5, 0xC7, 0xB1, 0x75, 0x8C,
+	0x2A, 0xB9, 0x8E, 0xCE, 0x29, 0x62, 0x18, 0x34, 0xE8, 0x2F, 0x1D, 0xF8, 0x6B, 0xF7, 0x2D, 0x64,
+	0x4E, 0x0D, 0x38, 0xB9, 0xE5, 0xAC, 0xA4, 0x16, 0x37, 0xD6, 0x46, 0xF8, 0xEC, 0x79, 0xCD, 0x16,
+	0xAB, 0x2B, 0x51, 0x21, 0x4A, 0x16, 0xA1, 0x33, 0x4B, 0x90, 0x36, 0x16, 0xFA, 0x04, 0x98, 0xE9,
+	0xDF, 0xE7, 0x34, 0x78, 0xDC, 0xCC, 0x14, 0x9D, 0xAA, 0x2D, 0x9A, 0x83, 0xA7, 0x6F, 0xF7, 0x62,
+	0x5E, 0x50, 0xFB, 0x89, 0x3E, 0x30, 0x31, 0xCB, 0x4E, 0x2A, 0x4F, 0xE9, 0x50, 0x5D, 0xC5, 0xC7,
+	0x55, 0x7D, 0xDE, 0x26, 0x82, 0xB5, 0x53, 0xC7, 0x76, 0x9F, 0x3B, 0x92, 0x8D, 0x7E, 0x03, 0x27,
+	0x80, 0x61, 0x9F, 0x85, 0x26, 0xB0, 0x1A, 0xB6, 0x91, 0x5B, 0x6F, 0x04, 0x86, 0xB2, 0xCE, 0xB2,
+	0x99, 0x88, 0xC6, 0x28, 0xBD, 0xD8, 0x4E, 0xEF, 0x8E, 0x77, 0x09, 0xDA, 0xD7, 0x23, 0x84, 0xB0,
+	0xA3, 0x04, 0x0A, 0xD5, 0xA4, 0xF8, 0x77, 0x71, 0x91, 0xB9, 0x83, 0x76, 0x55, 0xCB, 0x98, 0xA2,
+	0x01, 0xAA, 0x03, 0x6A, 0xCC, 0x29, 0x36, 0x09, 0xCC, 0x14, 0x02, 0xB9, 0x52, 0x7D, 0x6B, 0x78,
+	0xAF, 0x8C, 0x16, 0x13, 0xE2, 0xF6, 0x23, 0x27, 0xBD, 0x43, 0xF0, 0xB5, 0x30, 0xC3, 0x26, 0xDE,
+	0x58, 0x10, 0x3E, 0x43, 0x01, 0x3D, 0xE6, 0x05, 0x4C, 0x69, 0xE5, 0x01, 0xF7, 0xB7, 0xB4, 0x61,
+	0x67, 0x00, 0x09, 0x34, 0xB5, 0x8B, 0xB6, 0x94, 0xDE, 0x18, 0x5E, 0xEE, 0x6F, 0xCD, 0x6C, 0x48,
+	0xA6, 0x2F, 0xD9, 0xAA, 0xDD, 0x6B, 0x30, 0x1E, 0xF5, 0x72, 0xD2, 0xD7, 0x4B, 0x55, 0xDA, 0x83,
+	0x8F, 0xAD, 0xC9, 0xE2, 0x18, 0x9C, 0xE5, 0x5D, 0x6E, 0xD5, 0x3E, 0xFC, 0x6A, 0x40, 0xDC, 0x5E,
+	0xF2, 0x50, 0x83, 0x03, 0x6D, 0x02, 0x03, 0x01, 0x00, 0x01, 0xA3, 0x82, 0x01, 0x36, 0x30, 0x82,
+	0x01, 0x32, 0x30, 0x1D, 0x06, 0x03, 0x55, 0x1D, 0x0E, 0x04, 0x16, 0x04, 0x14, 0xEC, 0x41, 0xF9,
+	0x33, 0xF6, 0x04, 0xF8, 0xE0, 0xDF, 0xF9, 0x1B, 0xCB, 0xCD, 0x1D, 0xAC, 0x9E, 0xA7, 0xE6, 0x95,
+	0xE4, 0x30, 0x1F, 0x06, 0x03, 0x55, 0x1D, 0x23, 0x04, 0x18, 0x30, 0x16, 0x80, 0x14, 0x9F, 0xA7,
+	0x15, 0x5D, 0x00, 0x5E, 0x62, 0x5D, 0x83, 0xF4, 0xE5, 0xD2, 0x65, 0xA7, 0x1B, 0x53, 0x35, 0x19,
+	0xE9, 0x72, 0x30, 0x5F, 0x06, 0x03, 0x55, 0x1D, 0x1F, 0x04, 0x58, 0x30, 0x56, 0x30, 0x54, 0xA0,
+	0x52, 0xA0, 0x50, 0x86, 0x4E, 0x68, 0x74, 0x74, 0x70, 0x3A, 0x2F, 0x2F, 0x77, 0x77, 0x77, 0x2E,
+	0x6D, 0x69, 0x63, 0x72, 0x6F, 0x73, 0x6F, 0x66, 0x74, 0x2E, 0x63, 0x6F, 0x6D, 0x2F, 0x70, 0x6B,
+	0x69, 0x6F, 0x70, 0x73, 0x2F, 0x63, 0x72, 0x6C, 0x2F, 0x4D, 0x69, 0x63, 0x72, 0x6F, 0x73, 0x6F,
+	0x66, 0x74, 0x25, 0x32, 0x30, 0x54, 0x69, 0x6D, 0x65, 0x2D, 0x53, 0x74, 0x61, 0x6D, 0x70, 0x25,
+	0x32, 0x30, 0x50, 0x43, 0x41, 0x25, 0x32, 0x30, 0x32, 0x30, 0x31, 0x30, 0x28, 0x31, 0x29, 0x2E,
+	0x63, 0x72, 0x6C, 0x30, 0x6C, 0x06, 0x08, 0x2B, 0x06, 0x01, 0x05, 0x05, 0x07, 0x01, 0x01, 0x04,
+	0x60, 0x30, 0x5E, 0x30, 0x5C, 0x06, 0x08, 0x2B, 0x06, 0x01, 0x05, 0x05, 0x07, 0x30, 0x02, 0x86,
+	0x50, 0x68, 0x74, 0x74, 0x70, 0x3A, 0x2F, 0x2F, 0x77, 0x77, 0x77, 0x2E, 0x6D, 0x69, 0x63, 0x72,
+	0x6F, 0x73, 0x6F, 0x66, 0x74, 0x2E, 0x63, 0x6F, 0x6D, 0x2F, 0x70, 0x6B, 0x69, 0x6F, 0x70, 0x73,
+	0x2F, 0x63, 0x65, 0x72, 0x74, 0x73, 0x2F, 0x4D, 0x69, 0x63, 0x72, 0x6F, 0x73, 0x6F, 0x66, 0x74,
+	0x25, 0x32, 0x30, 0x54, 0x69, 0x6D, 0x65, 0x2D, 0x53, 0x74, 0x61, 0x6D, 0x70, 0x25, 0x32, 0x30,
+	0x50, 0x43, 0x41, 0x25, 0x32, 0x30, 0x32, 0x30, 0x31, 0x30, 0x28, 0x31, 0x29, 0x2E, 0x63, 0x72,
+	0x74, 0x30, 0x0C, 0x06, 0x03, 0x55, 0x1D, 0x13, 0x01, 0x01, 0xFF, 0x04, 0x02, 0x30, 0x00, 0x30,
+	0x13, 0x06, 0x03, 0x55, 0x1D, 0x25, 0x04, 0x0C, 0x30, 0x0A, 0x06, 0x08, 0x2B, 0x06, 0x01, 0x05,
+	0x05, 0x07, 0x03, 0x08, 0x30, 0x0D, 0x06, 0x09, 0x2A, 0x86, 0x48, 0x86, 0xF7, 0x0D, 0x01, 0x01,
+	0x0B, 0x05, 0x00, 0x03, 0x82, 0x02, 0x01, 0x00, 0x35, 0x50, 0xAF, 0x71, 0xCC, 0x87, 0x93, 0x94,
+	0xA8, 0x52, 0x6C, 0xB9, 0xF4, 0x6D, 0xE9, 0x11, 0xE6, 0x06, 0x21, 0xE9, 0xB0, 0x75, 0x5D, 0x0A,
+	0x65, 0xB8, 0x2A, 0x82, 0x03, 0x5E, 0x6C, 0x91, 0x9D, 0xFB, 0x52, 0x29, 0x5A, 0x14, 0x9C, 0x3C,
+	0xF8, 0x69, 0x25, 0x0C, 0xBC, 0xE5, 0x36, 0x14, 0x8F, 0xDA, 0x63, 0xA2, 0x3B, 0x35, 0x72, 0x0A,
+	0xAF, 0x24, 0x92, 0x9A, 0xA7, 0x7D, 0x47, 0x34, 0xD5, 0x96, 0x81, 0x7B, 0x34, 0x31, 0x83, 0xBE,
+	0xEA, 0x7A, 0xF8, 0xF6, 0x88, 0xCC, 0xA0, 0xDF, 0xD6, 0x09, 0x7D, 0xE8, 0x82, 0x22, 0x1C, 0x58,
+	0x38, 0x5B, 0xA0, 0xC1, 0xEA, 0x58, 0xAC, 0xF3, 0xBC, 0x32, 0x50, 0x7F, 0xA2, 0xE7, 0xBF, 0x56,
+	0x12, 0x22, 0x0D, 0xBD, 0x5E, 0x35, 0x84, 0xE5, 0x3D, 0x29, 0xAF, 0xDE, 0x96, 0xA5, 0xB2, 0x0B,
+	0x64, 0xAD, 0xBD, 0x28, 0xA3, 0x41, 0x74, 0xB9, 0x69, 0x97, 0xE0, 0x44, 0x15, 0x18, 0xA4, 0x68,
+	0xD1, 0x41, 0x0D, 0xB5, 0x97, 0xAD, 0x54, 0x8C, 0x5A, 0xD0, 0x9F, 0x43, 0xA5, 0x47, 0x63, 0x41,
+	0x63, 0xDE, 0x12, 0x1F, 0x5C, 0x10, 0xCF, 0x91, 0x80, 0x4D, 0xBA, 0xE7, 0x0E, 0x56, 0x01, 0x56,
+	0xFE, 0x58, 0xDC, 0x74, 0x89, 0x68, 0x85, 0xE2, 0x24, 0xDB, 0x0A, 0x6A, 0xD6, 0x69, 0x51, 0x0E,
+	0x5F, 0xDD, 0x9D, 0x36, 0xA0, 0x66, 0xF5, 0xB4, 0xF5, 0x53, 0xB9, 0xC6, 0xC0, 0xDE, 0x42, 0xCA,
+	0x0A, 0x4D, 0x02, 0x01, 0x1A, 0x62, 0x7A, 0xD3, 0x33, 0x1D, 0x4D, 0xE0, 0x08, 0xF1, 0x39, 0xB0,
+	0x02, 0x0C, 0xDE, 0x43, 0x76, 0xF1, 0xA5, 0xBB, 0xF3, 0xB4, 0x0D, 0xF3, 0x16, 0x55, 0xCE, 0xAA,
+	0x93, 0xA8, 0x8A, 0x0C, 0x50, 0xBA, 0x5A, 0x95, 0xD0, 0x4A, 0x43, 0x25, 0xAE, 0x55, 0xC8, 0x23,
+	0xF3, 0x61, 0xA7, 0xED, 0x3E, 0x9E, 0x85, 0x3A, 0xB5, 0xF1, 0x29, 0x1C, 0xA2, 0xED, 0xED, 0xF6,
+	0x26, 0xF6, 0x87, 0xF9, 0x8B, 0xF4, 0x28, 0x99, 0xC0, 0xB0, 0xA3, 0xF7, 0xA4, 0x88, 0xE0, 0xA3,
+	0x62, 0x4B, 0x69, 0xDF, 0xDD, 0xE8, 0xBE, 0x80, 0xB5, 0x3B, 0x6B, 0x8B, 0xB5, 0xB2, 0xE7, 0x31,
+	0x59, 0x44, 0xE6, 0xB6, 0x81, 0x2C, 0x13, 0x52, 0x6C, 0x83, 0x59, 0xE9, 0x02, 0xF1, 0x88, 0x0E,
+	0x35, 0x95, 0x79, 0xD5, 0x54, 0xB2, 0x33, 0x0E, 0x28, 0x54, 0x2F, 0xC3, 0x14, 0xF4, 0x23, 0x2F,
+	0x1B, 0x8B, 0x1D, 0x6E, 0x19, 0x36, 0x15, 0x7F, 0x33, 0xBE, 0xBB, 0x0F, 0xE4, 0xF7, 0x81, 0x23,
+	0x0D, 0x5F, 0x69, 0xE9, 0xCC, 0x66, 0xEC, 0xF4, 0x57, 0x75, 0x17, 0x0A, 0xD5, 0x39, 0x3A, 0x4C,
+	0x79, 0x7E, 0x68, 0xA8, 0x5A, 0x28, 0x8B, 0x65, 0x20, 0xA2, 0xD6, 0x58, 0xDA, 0xC5, 0x7F, 0x81,
+	0x13, 0x04, 0x22, 0x8A, 0x70, 0xA2, 0xFA, 0xF1, 0x39, 0xF5, 0xB4, 0xD8, 0x23, 0x91, 0x5B, 0xB9,
+	0x1F, 0x2D, 0x0E, 0xE1, 0x8B, 0x89, 0x5B, 0xBF, 0x25, 0x2A, 0x55, 0x15, 0x7A, 0xF3, 0x58, 0xC3,
+	0xF6, 0x2A, 0x7D, 0x75, 0xB0, 0x22, 0xC0, 0x18, 0x48, 0xEA, 0x25, 0x85, 0x26, 0x3B, 0x5B, 0x51,
+	0x63, 0x6F, 0x4A, 0x77, 0xB1, 0xDC, 0x22, 0x3D, 0xA7, 0x89, 0x20, 0x74, 0x3D, 0x03, 0x82, 0x8D,
+	0x89, 0x67, 0x0A, 0x7C, 0xB0, 0x9C, 0x38, 0xA7, 0xA9, 0x2D, 0x42, 0x5E, 0xF4, 0x6C, 0x8A, 0xC8,
+	0xD5, 0x95, 0x2D, 0x51, 0xA7, 0x84, 0xE6, 0xBA, 0x4B, 0x3E, 0xA4, 0x6C, 0x62, 0x30, 0x6C, 0xC5,
+	0xE7, 0xCC, 0xDC, 0x6F, 0xE8, 0x68, 0x14, 0xAC, 0x8E, 0x36, 0xE2, 0xF7, 0x6F, 0xEB, 0x60, 0xC5,
+	0x30, 0x33, 0xDE, 0xC1, 0x77, 0x05, 0x55, 0xFD, 0xBA, 0x4F, 0x4C, 0xE4, 0x5F, 0x8E, 0x12, 0x87,
+	0xB2, 0x2F, 0x21, 0x9F, 0x2D, 0xE9, 0x0D, 0x02, 0x30, 0x82, 0x07, 0x71, 0x30, 0x82, 0x05, 0x59,
+	0xA0, 0x03, 0x02, 0x01, 0x02, 0x02, 0x13, 0x33, 0x00, 0x00, 0x00, 0x15, 0xC5, 0xE7, 0x6B, 0x9E,
+	0x02, 0x9B, 0x49, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x30, 0x0D, 0x06, 0x09, 0x2A, 0x86,
+	0x48, 0x86, 0xF7, 0x0D, 0x01, 0x01, 0x0B, 0x05, 0x00, 0x30, 0x81, 0x88, 0x31, 0x0B, 0x30, 0x09,
+	0x06, 0x03, 0x55, 0x04, 0x06, 0x13, 0x02, 0x55, 0x53, 0x31, 0x13, 0x30, 0x11, 0x06, 0x03, 0x55,
+	0x04, 0x08, 0x13, 0x0A, 0x57, 0x61, 0x73, 0x68, 0x69, 0x6E, 0x67, 0x74, 0x6F, 0x6E, 0x31, 0x10,
+	0x30, 0x0E, 0x06, 0x03, 0x55, 0x04, 0x07, 0x13, 0x07, 0x52, 0x65, 0x64, 0x6D, 0x6F, 0x6E, 0x64,
+	0x31, 0x1E, 0x30, 0x1C, 0x06, 0x03, 0x55, 0x04, 0x0A, 0x13, 0x15, 0x4D, 0x69, 0x63, 0x72, 0x6F,
+	0x73, 0x6F, 0x66, 0x74, 0x20, 0x43, 0x6F, 0x72, 0x70, 0x6F, 0x72, 0x61, 0x74, 0x69, 0x6F, 0x6E,
+	0x31, 0x32, 0x30, 0x30, 0x06, 0x03, 0x55, 0x04, 0x03, 0x13, 0x29, 0x4D, 0x69, 0x63, 0x72, 0x6F,
+	0x73, 0x6F, 0x66, 0x74, 0x20, 0x52, 0x6F, 0x6F, 0x74, 0x20, 0x43, 0x65, 0x72, 0x74, 0x69, 0x66,
+	0x69, 0x63, 0x61, 0x74, 0x65, 0x20, 0x41, 0x75, 0x74, 0x68, 0x6F, 0x72, 0x69, 0x74, 0x79, 0x20,
+	0x32, 0x30, 0x31, 0x30, 0x30, 0x1E, 0x17, 0x0D, 0x32, 0x31, 0x30, 0x39, 0x33, 0x30, 0x31, 0x38,
+	0x32, 0x32, 0x32, 0x35, 0x5A, 0x17, 0x0D, 0x33, 0x30, 0x30, 0x39, 0x33, 0x30, 0x31, 0x38, 0x33,
+	0x32, 0x32, 0x35, 0x5A, 0x30, 0x7C, 0x31, 0x0B, 0x30, 0x09, 0x06, 0x03, 0x55, 0x04, 0x06, 0x13,
+	0x02, 0x55, 0x53, 0x31, 0x13, 0x30, 0x11, 0x06, 0x03, 0x55, 0x04, 0x08, 0x13, 0x0A, 0x57, 0x61,
+	0x73, 0x68, 0x69, 0x6E, 0x67, 0x74, 0x6F, 0x6E, 0x31, 0x10, 0x30, 0x0E, 0x06, 0x03, 0x55, 0x04,
+	0x07, 0x13, 0x07, 0x52, 0x65, 0x64, 0x6D, 0x6F, 0x6E, 0x64, 0x31, 0x1E, 0x30, 0x1C, 0x06, 0x03,
+	0x55, 0x04, 0x0A, 0x13, 0x15, 0x4D, 0x69, 0x63, 0x72, 0x6F, 0x73, 0x6F, 0x66, 0x74, 0x20, 0x43,
+	0x6F, 0x72, 0x70, 0x6F, 0x72, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x31, 0x26, 0x30, 0x24, 0x06, 0x03,
+	0x55, 0x04, 0x03, 0x13, 0x1D, 0x4D, 0x69, 0x63, 0x72, 0x6F, 0x73, 0x6F, 0x66, 0x74, 0x20, 0x54,
+	0x69, 0x6D, 0x65, 0x2D, 0x53, 0x74, 0x61, 0x6D, 0x70, 0x20, 0x50, 0x43, 0x41, 0x20, 0x32, 0x30,
+	0x31, 0x30, 0x30, 0x82, 0x02, 0x22, 0x30, 0x0D, 0x06, 0x09, 0x2A, 0x86, 0x48, 0x86, 0xF7, 0x0D,
+	0x01, 0x01, 0x01, 0x05, 0x00, 0x03, 0x82, 0x02, 0x0F, 0x00, 0x30, 0x82, 0x02, 0x0A, 0x02, 0x82,
+	0x02, 0x01, 0x00, 0xE4, 0xE1, 0xA6, 0x4C, 0xE7, 0xB4, 0x72, 0x21, 0x0B, 0x79, 0xA2, 0xCB, 0xD7,
+	0x24, 0x79, 0xBD, 0x0E, 0xD5, 0x82, 0xD3, 0xFD, 0xEE, 0x9C, 0x07, 0x07, 0xD2, 0xA9, 0x6C, 0x4E,
+	0x75, 0xC8, 0xCA, 0x35, 0x57, 0xF6, 0x01, 0x7F, 0x6C, 0x4A, 0xE0, 0xE2, 0xBD, 0xB9, 0x3E, 0x17,
+	0x60, 0x33, 0xFF, 0x5C, 0x4F, 0xC7, 0x66, 0xF7, 0x95, 0x53, 0x71, 0x5A, 0xE2, 0x7E, 0x4A, 0x5A,
+	0xFE, 0xB8, 0x36, 0x67, 0x85, 0x46, 0x23, 0x0C, 0xB5, 0x8D, 0x13, 0xCF, 0x77, 0x32, 0xC0, 0x10,
+	0x18, 0xE8, 0x60, 0x7D, 0x6A, 0x52, 0x83, 0x44, 0xB7, 0xA6, 0x8E, 0x46, 0x6B, 0x07, 0x14, 0xF3,
+	0xC5, 0x76, 0xF5, 0x86, 0x50, 0xDC, 0xC1, 0x44, 0xC8, 0x71, 0x5C, 0x51, 0x31, 0x37, 0xA0, 0x0A,
+	0x38, 0x6E, 0x8D, 0xED, 0xD7, 0x0F, 0xD8, 0x26, 0x53, 0x7C, 0x39, 0x61, 0x02, 0x7A, 0xC4, 0xAA,
+	0xFD, 0x72, 0x69, 0xAF, 0x1D, 0xAB, 0xAC, 0xF6, 0x36, 0xBE, 0x35, 0x26, 0x64, 0xDA, 0x98, 0x3B,
+	0xBA, 0x1A, 0x7B, 0x33, 0xAD, 0x80, 0x5B, 0x7E, 0x8C, 0x10, 0x1C, 0x9D, 0x52, 0xFE, 0xB6, 0xE8,
+	0x62, 0x25, 0xDC, 0x6A, 0x0F, 0xCF, 0x5D, 0xF4, 0xFE, 0x8E, 0x53, 0xCF, 0xD6, 0xEC, 0x85, 0x56,
+	0x4D, 0xEF, 0xDD, 0xBC, 0x8D, 0xA4, 0xE3, 0x91, 0x8F, 0xB2, 0x39, 0x2C, 0x51, 0x9C, 0xE9, 0x70,
+	0x69, 0x0D, 0xCA, 0x36, 0x2D, 0x70, 0x8E, 0x31, 0xC8, 0x35, 0x28, 0xBD, 0xE3, 0xB4, 0x87, 0x24,
+	0xC3, 0xE0, 0xC9, 0x8F, 0x7E, 0xB5, 0x54, 0x8F, 0xDC, 0xFA, 0x05, 0x55, 0x98, 0x6D, 0x68, 0x3B,
+	0x9A, 0x46, 0xBD, 0xED, 0xA4, 0xAE, 0x7A, 0x29, 0x37, 0xAC, 0xCB, 0xEB, 0x83, 0x45, 0xE7, 0x46,
+	0x6E, 0xCA, 0x32, 0xD5, 0xC0, 0x86, 0x30, 0x5C, 0x4F, 0x2C, 0xE2, 0x62, 0xB2, 0xCD, 0xB9, 0xE2,
+	0x8D, 0x88, 0xE4, 0x96, 0xAC, 0x01, 0x4A, 0xBB, 0xBE, 0x71, 0xA9, 0x17, 0x5B, 0x67, 0x60, 0xDE,
+	0xF8, 0x92, 0x91, 0x1E, 0x1D, 0x3D, 0xFD, 0x20, 0xCF, 0x73, 0x7D, 0x41, 0x9A, 0x46, 0x75, 0xCD,
+	0xC4, 0x5F, 0x34, 0xDD, 0x12, 0x89, 0xD6, 0xFD, 0xA5, 0x20, 0x7D, 0x7E, 0xFC, 0xD9, 0x9E, 0x45,
+	0xDF, 0xB6, 0x72, 0x2F, 0xDB, 0x7D, 0x5F, 0x80, 0xBA, 0xDB, 0xAA, 0x7E, 0x36, 0xEC, 0x36, 0x4C,
+	0xF6, 0x2B, 0x6E, 0xA8, 0x12, 0x51, 0xE8, 0xBF, 0x05, 0x03, 0xA3, 0xD1, 0x73, 0xA6, 0x4D, 0x37,
+	0x74, 0x94, 0x1C, 0x34, 0x82, 0x0F, 0xF0, 0x10, 0xF2, 0xB7, 0x47, 0x18, 0xED, 0xA7, 0xE8, 0x99,
+	0x7C, 0x3F, 0x4C, 0xDB, 0xAF, 0x5E, 0xC2, 0xF3, 0xD5, 0xD8, 0x73, 0x3D, 0x43, 0x4E, 0xC1, 0x33,
+	0x39, 0x4C, 0x8E, 0x02, 0xBC, 0x42, 0x68, 0x2E, 0x10, 0xEA, 0x84, 0x51, 0x46, 0xE2, 0xD1, 0xBD,
+	0x6A, 0x18, 0x5A, 0x61, 0x01, 0x73, 0xCA, 0x67, 0xA2, 0x5E, 0xD7, 0x28, 0x76, 0x02, 0xE2, 0x33,
+	0x18, 0x72, 0xD7, 0xA7, 0x20, 0xF0, 0xC2, 0xFA, 0x12, 0x0A, 0xD7, 0x63, 0x6F, 0x0C, 0xC9, 0x36,
+	0x64, 0x8B, 0x5B, 0xA0, 0xA6, 0x83, 0x21, 0x5D, 0x5F, 0x30, 0x74, 0x91, 0x94, 0x94, 0xD8, 0xB9,
+	0x50, 0xF9, 0x0B, 0x89, 0x61, 0xF3, 0x36, 0x06, 0x35, 0x18, 0x84, 0x47, 0xDB, 0xDC, 0x1B, 0xD1,
+	0xFD, 0xB2, 0xD4, 0x1C, 0xC5, 0x6B, 0xF6, 0x5C, 0x52, 0x51, 0x5D, 0x12, 0xDB, 0x25, 0xBA, 0xAF,
+	0x50, 0x05, 0x7A, 0x6C, 0xC5, 0x11, 0x1D, 0x72, 0xEF, 0x8D, 0xF9, 0x52, 0xC4, 0x85, 0x17, 0x93,
+	0xC0, 0x3C, 0x15, 0xDB, 0x1A, 0x37, 0xC7, 0x08, 0x15, 0x18, 0x3F, 0x78, 0xAB, 0x45, 0xB6, 0xF5,
+	0x1E, 0x87, 0x5E, 0xDA, 0x8F, 0x9E, 0x16, 0x72, 0x69, 0xC6, 0xAE, 0x7B, 0xB7, 0xB7, 0x3E, 0x6A,
+	0xE2, 0x2E, 0xAD, 0x02, 0x03, 0x01, 0x00, 0x01, 0xA3, 0x82, 0x01, 0xDD, 0x30, 0x82, 0x01, 0xD9,
+	0x30, 0x12, 0x06, 0x09, 0x2B, 0x06, 0x01, 0x04, 0x01, 0x82, 0x37, 0x15, 0x01, 0x04, 0x05, 0x02,
+	0x03, 0x01, 0x00, 0x01, 0x30, 0x23, 0x06, 0x09, 0x2B, 0x06, 0x01, 0x04, 0x01, 0x82, 0x37, 0x15,
+	0x02, 0x04, 0x16, 0x04, 0x14, 0x2A, 0xA7, 0x52, 0xFE, 0x64, 0xC4, 0x9A, 0xBE, 0x82, 0x91, 0x3C,
+	0x46, 0x35, 0x29, 0xCF, 0x10, 0xFF, 0x2F, 0x04, 0xEE, 0x30, 0x1D, 0x06, 0x03, 0x55, 0x1D, 0x0E,
+	0x04, 0x16, 0x04, 0x14, 0x9F, 0xA7, 0x15, 0x5D, 0x00, 0x5E, 0x62, 0x5D, 0x83, 0xF4, 0xE5, 0xD2,
+	0x65, 0xA7, 0x1B, 0x53, 0x35, 0x19, 0xE9, 0x72, 0x30, 0x5C, 0x06, 0x03, 0x55, 0x1D, 0x20, 0x04,
+	0x55, 0x30, 0x53, 0x30, 0x51, 0x06, 0x0C, 0x2B, 0x06, 0x01, 0x04, 0x01, 0x82, 0x37, 0x4C, 0x83,
+	0x7D, 0x01, 0x01, 0x30, 0x41, 0x30, 0x3F, 0x06, 0x08, 0x2B, 0x06, 0x01, 0x05, 0x05, 0x07, 0x02,
+	0x01, 0x16, 0x33, 0x68, 0x74, 0x74, 0x70, 0x3A, 0x2F, 0x2F, 0x77, 0x77, 0x77, 0x2E, 0x6D, 0x69,
+	0x63, 0x72, 0x6F, 0x73, 0x6F, 0x66, 0x74, 0x2E, 0x63, 0x6F, 0x6D, 0x2F, 0x70, 0x6B, 0x69, 0x6F,
+	0x70, 0x73, 0x2F, 0x44, 0x6F, 0x63, 0x73, 0x2F, 0x52, 0x65, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x6F,
+	0x72, 0x79, 0x2E, 0x68, 0x74, 0x6D, 0x30, 0x13, 0x06, 0x03, 0x55, 0x1D, 0x25, 0x04, 0x0C, 0x30,
+	0x0A, 0x06, 0x08, 0x2B, 0x06, 0x01, 0x05, 0x05, 0x07, 0x03, 0x08, 0x30, 0x19, 0x06, 0x09, 0x2B,
+	0x06, 0x01, 0x04, 0x01, 0x82, 0x37, 0x14, 0x02, 0x04, 0x0C, 0x1E, 0x0A, 0x00, 0x53, 0x00, 0x75,
+	0x00, 0x62, 0x00, 0x43, 0x00, 0x41, 0x30, 0x0B, 0x06, 0x03, 0x55, 0x1D, 0x0F, 0x04, 0x04, 0x03,
+	0x02, 0x01, 0x86, 0x30, 0x0F, 0x06, 0x03, 0x55, 0x1D, 0x13, 0x01, 0x01, 0xFF, 0x04, 0x05, 0x30,
+	0x03, 0x01, 0x01, 0xFF, 0x30, 0x1F, 0x06, 0x03, 0x55, 0x1D, 0x23, 0x04, 0x18, 0x30, 0x16, 0x80,
+	0x14, 0xD5, 0xF6, 0x56, 0xCB, 0x8F, 0xE8, 0xA2, 0x5C, 0x62, 0x68, 0xD1, 0x3D, 0x94, 0x90, 0x5B,
+	0xD7, 0xCE, 0x9A, 0x18, 0xC4, 0x30, 0x56, 0x06, 0x03, 0x55, 0x1D, 0x1F, 0x04, 0x4F, 0x30, 0x4D,
+	0x30, 0x4B, 0xA0, 0x49, 0xA0, 0x47, 0x86, 0x45, 0x68, 0x74, 0x74, 0x70, 0x3A, 0x2F, 0x2F, 0x63,
+	0x72, 0x6C, 0x2E, 0x6D, 0x69, 0x63, 0x72, 0x6F, 0x73, 0x6F, 0x66, 0x74, 0x2E, 0x63, 0x6F, 0x6D,
+	0x2F, 0x70, 0x6B, 0x69, 0x2F, 0x63, 0x72, 0x6C, 0x2F, 0x70, 0x72, 0x6F, 0x64, 0x75, 0x63, 0x74,
+	0x73, 0x2F, 0x4D, 0x69, 0x63, 0x52, 0x6F, 0x6F, 0x43, 0x65, 0x72, 0x41, 0x75, 0x74, 0x5F, 0x32,
+	0x30, 0x31, 0x30, 0x2D, 0x30, 0x36, 0x2D, 0x32, 0x33, 0x2E, 0x63, 0x72, 0x6C, 0x30, 0x5A, 0x06,
+	0x08, 0x2B, 0x06, 0x01, 0x05, 0x05, 0x07, 0x01, 0x01, 0x04, 0x4E, 0x30, 0x4C, 0x30, 0x4A, 0x06,
+	0x08, 0x2B, 0x06, 0x01, 0x05, 0x05, 0x07, 0x30, 0x02, 0x86, 0x3E, 0x68, 0x74, 0x74, 0x70, 0x3A,
+	0x2F, 0x2F, 0x77, 0x77, 0x77, 0x2E, 0x6D, 0x69, 0x63, 0x72, 0x6F, 0x73, 0x6F, 0x66, 0x74, 0x2E,
+	0x63, 0x6F, 0x6D, 0x2F, 0x70, 0x6B, 0x69, 0x2F, 0x63, 0x65, 0x72, 0x74, 0x73, 0x2F, 0x4D, 0x69,
+	0x63, 0x52, 0x6F, 0x6F, 0x43, 0x65, 0x72, 0x41, 0x75, 0x74, 0x5F, 0x32, 0x30, 0x31, 0x30, 0x2D,
+	0x30, 0x36, 0x2D, 0x32, 0x33, 0x2E, 0x63, 0x72, 0x74, 0x30, 0x0D, 0x06, 0x09, 0x2A, 0x86, 0x48,
+	0x86, 0xF7, 0x0D, 0x01, 0x01, 0x0B, 0x05, 0x00, 0x03, 0x82, 0x02, 0x01, 0x00, 0x9D, 0x55, 0x7D,
+	0xFC, 0x2A, 0xAD, 0xE1, 0x2C, 0x1F, 0x67, 0x01, 0x31, 0x24, 0x5B, 0xE1, 0x9E, 0x72, 0x4B, 0xFC,
+	0xA9, 0x6F, 0xEA, 0x5C, 0x14, 0xB6, 0x3E, 0x4E, 0x47, 0x64, 0x78, 0xB1, 0x06, 0x93, 0x97, 0x3D,
+	0x31, 0x33, 0xB5, 0x39, 0xD7, 0xC2, 0x71, 0x36, 0x3F, 0xDA, 0x64, 0x6C, 0x7C, 0xD0, 0x75, 0x39,
+	0x6D, 0xBB, 0x0F, 0x31, 0xE4, 0xC2, 0x8F, 0xFB, 0x6C, 0xD1, 0xA1, 0x94, 0x18, 0x22, 0xEE, 0xE9,
+	0x66, 0x67, 0x3A, 0x53, 0x4D, 0xDD, 0x98, 0xBA, 0xB6, 0x1E, 0x78, 0xD8, 0x36, 0x2E, 0x9C, 0xA9,
+	0x82, 0x56, 0x00, 0x03, 0xB0, 0x05, 0xBE, 0x89, 0xE8, 0x69, 0xE0, 0xBA, 0x09, 0xEE, 0x7B, 0xDF,
+	0x6A, 0x6F, 0xBE, 0x29, 0xCB, 0x6E, 0xD8, 0x3F, 0x48, 0x75, 0x01, 0xD9, 0x18, 0xDE, 0x6D, 0x82,
+	0x0C, 0xF5, 0x6D, 0x23, 0x54, 0xE4, 0x78, 0x53, 0x75, 0x24, 0x57, 0xB9, 0xDD, 0x9F, 0xF3, 0x8E,
+	0x3D, 0xC6, 0xF3, 0x68, 0xDF, 0x65, 0xF6, 0xA4, 0x56, 0xAA, 0xF7, 0x95, 0xB6, 0x28, 0x55, 0x27,
+	0xD0, 0x24, 0xBD, 0x40, 0xA0, 0xBF, 0x19, 0xB6, 0x12, 0x12, 0x11, 0x5D, 0x3D, 0x27, 0xE0, 0x40,
+	0x96, 0x38, 0xAC, 0xF7, 0xF9, 0x29, 0x89, 0xC3, 0xBC, 0x17, 0xB0, 0x54, 0x85, 0x42, 0xB3, 0xFC,
+	0x0C, 0x9E, 0x8B, 0x19, 0x89, 0xE7, 0xF0, 0x0B, 0x6A, 0x81, 0xC2, 0x81, 0x19, 0x42, 0x19, 0x52,
+	0x75, 0x8A, 0x36, 0xC2, 0x1D, 0xC3, 0x61, 0x73, 0x2E, 0x2C, 0x6B, 0x7B, 0x6E, 0x3F, 0x2C, 0x09,
+	0x78, 0x14, 0xE9, 0x91, 0xB2, 0xA9, 0x5B, 0xDF, 0x49, 0xA3, 0x74, 0x0C, 0xBC, 0xEC, 0x91, 0x80,
+	0xD2, 0x3D, 0xE6, 0x4A, 0x3E, 0x66, 0x3B, 0x4F, 0xBB, 0x86, 0xFA, 0x32, 0x1A, 0xD9, 0x96, 0xF4,
+	0x8F, 0xF6, 0x91, 0x01, 0xF6, 0xCE, 0xC6, 0x74, 0xFD, 0xF6, 0x4C, 0x72, 0x6F, 0x10, 0xAB, 0x75,
+	0x30, 0xC5, 0x34, 0xB0, 0x7A, 0xD8, 0x50, 0xFE, 0x0A, 0x58, 0xDD, 0x40, 0x3C, 0xC7, 0x54, 0x6D,
+	0x9D, 0x63, 0x74, 0x48, 0x2C, 0xB1, 0x4E, 0x47, 0x2D, 0xC1, 0x14, 0x04, 0x71, 0xBF, 0x64, 0xF9,
+	0x24, 0xBE, 0x73, 0x6D, 0xCA, 0x8E, 0x09, 0xBD, 0xB3, 0x01, 0x57, 0x49, 0x54, 0x64, 0xD9, 0x73,
+	0xD7, 0x7F, 0x1E, 0x5B, 0x44, 0x01, 0x8E, 0x5A, 0x19, 0x91, 0x6B, 0x0D, 0x9F, 0xA4, 0x28, 0xDC,
+	0x67, 0x19, 0x28, 0x24, 0xBA, 0x38, 0x4B, 0x9A, 0x6E, 0xFB, 0x21, 0x54, 0x6B, 0x6A, 0x45, 0x11,
+	0x47, 0xA9, 0xF1, 0xB7, 0xAE, 0xC8, 0xE8, 0x89, 0x5E, 0x4F, 0x9D, 0xD2, 0xD0, 0x4C, 0x76, 0xB5,
+	0x57, 0x54, 0x09, 0xB1, 0x69, 0x01, 0x44, 0x7E, 0x7C, 0xA1, 0x61, 0x6C, 0x73, 0xFE, 0x0A, 0xBB,
+	0xEC, 0x41, 0x66, 0x3D, 0x69, 0xFD, 0xCB, 0xC1, 0x41, 0x49, 0x7E, 0x7E, 0x93, 0xBE, 0xCB, 0xF8,
+	0x3B, 0xE4, 0xB7, 0x15, 0xBF, 0xB4, 0xCE, 0x3E, 0xA5, 0x31, 0x51, 0x84, 0xBC, 0xBF, 0x02, 0xC1,
+	0x82, 0xA2, 0x7B, 0x17, 0x1D, 0x15, 0x89, 0x8D, 0x70, 0xFE, 0xE7, 0xB5, 0xD0, 0x28, 0x1A, 0x89,
+	0x0B, 0x8F, 0x36, 0xDA, 0xBA, 0x4C, 0xF9, 0x9B, 0xFF, 0x0A, 0xE9, 0x34, 0xF8, 0x24, 0x35, 0x67,
+	0x2B, 0xE0, 0x0D, 0xB8, 0xE6, 0x8C, 0x99, 0xD6, 0xE1, 0x22, 0xEA, 0xF0, 0x27, 0x42, 0x3D, 0x25,
+	0x94, 0xE6, 0x74, 0x74, 0x5B, 0x6A, 0xD1, 0x9E, 0x3E, 0xED, 0x7E, 0xA0, 0x31, 0x33, 0x7D, 0xBC,
+	0xCB, 0xE9, 0x7B, 0xBF, 0x38, 0x70, 0x44, 0xD1, 0x90, 0xF1, 0xC8, 0xAB, 0x3A, 0x8A, 0x3A, 0x08,
+	0x62, 0x7F, 0xD9, 0x70, 0x63, 0x53, 0x4D, 0x8D, 0xEE, 0x82, 0x6D, 0xA5, 0x05, 0x10, 0xC1, 0x71,
+	0x06, 0x6A, 0x10, 0xB4, 0x1D, 0x55, 0x33, 0x58, 0xB3, 0xA1, 0x70, 0x66, 0xF2, 0xA1, 0x82, 0x02,
+	0xD4, 0x30, 0x82, 0x02, 0x3D, 0x02, 0x01, 0x01, 0x30, 0x82, 0x01, 0x00, 0xA1, 0x81, 0xD8, 0xA4,
+	0x81, 0xD5, 0x30, 0x81, 0xD2, 0x31, 0x0B, 0x30, 0x09, 0x06, 0x03, 0x55, 0x04, 0x06, 0x13, 0x02,
+	0x55, 0x53, 0x31, 0x13, 0x30, 0x11, 0x06, 0x03, 0x55, 0x04, 0x08, 0x13, 0x0A, 0x57, 0x61, 0x73,
+	0x68, 0x69, 0x6E, 0x67, 0x74, 0x6F, 0x6E, 0x31, 0x10, 0x30, 0x0E, 0x06, 0x03, 0x55, 0x04, 0x07,
+	0x13, 0x07, 0x52, 0x65, 0x64, 0x6D, 0x6F, 0x6E, 0x64, 0x31, 0x1E, 0x30, 0x1C, 0x06, 0x03, 0x55,
+	0x04, 0x0A, 0x13, 0x15, 0x4D, 0x69, 0x63, 0x72, 0x6F, 0x73, 0x6F, 0x66, 0x74, 0x20, 0x43, 0x6F,
+	0x72, 0x70, 0x6F, 0x72, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x31, 0x2D, 0x30, 0x2B, 0x06, 0x03, 0x55,
+	0x04, 0x0B, 0x13, 0x24, 0x4D, 0x69, 0x63, 0x72, 0x6F, 0x73, 0x6F, 0x66, 0x74, 0x20, 0x49, 0x72,
+	0x65, 0x6C, 0x61, 0x6E, 0x64, 0x20, 0x4F, 0x70, 0x65, 0x72, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x73,
+	0x20, 0x4C, 0x69, 0x6D, 0x69, 0x74, 0x65, 0x64, 0x31, 0x26, 0x30, 0x24, 0x06, 0x03, 0x55, 0x04,
+	0x0B, 0x13, 0x1D, 0x54, 0x68, 0x61, 0x6C, 0x65, 0x73, 0x20, 0x54, 0x53, 0x53, 0x20, 0x45, 0x53,
+	0x4E, 0x3A, 0x46, 0x43, 0x34, 0x31, 0x2D, 0x34, 0x42, 0x44, 0x34, 0x2D, 0x44, 0x32, 0x32, 0x30,
+	0x31, 0x25, 0x30, 0x23, 0x06, 0x03, 0x55, 0x04, 0x03, 0x13, 0x1C, 0x4D, 0x69, 0x63, 0x72, 0x6F,
+	0x73, 0x6F, 0x66, 0x74, 0x20, 0x54, 0x69, 0x6D, 0x65, 0x2D, 0x53, 0x74, 0x61, 0x6D, 0x70, 0x20,
+	0x53, 0x65, 0x72, 0x76, 0x69, 0x63, 0x65, 0xA2, 0x23, 0x0A, 0x01, 0x01, 0x30, 0x07, 0x06, 0x05,
+	0x2B, 0x0E, 0x03, 0x02, 0x1A, 0x03, 0x15, 0x00, 0x3D, 0x62, 0x2B, 0xEA, 0x4F, 0x4E, 0x11, 0xEA,
+	0x82, 0x96, 0xB9, 0xC6, 0xC3, 0xE6, 0x89, 0x8A, 0xEE, 0x59, 0x5B, 0x8C, 0xA0, 0x81, 0x83, 0x30,
+	0x81, 0x80, 0xA4, 0x7E, 0x30, 0x7C, 0x31, 0x0B, 0x30, 0x09, 0x06, 0x03, 0x55, 0x04, 0x06, 0x13,
+	0x02, 0x55, 0x53, 0x31, 0x13, 0x30, 0x11, 0x06, 0x03, 0x55, 0x04, 0x08, 0x13, 0x0A, 0x57, 0x61,
+	0x73, 0x68, 0x69, 0x6E, 0x67, 0x74, 0x6F, 0x6E, 0x31, 0x10, 0x30, 0x0E, 0x06, 0x03, 0x55, 0x04,
+	0x07, 0x13, 0x07, 0x52, 0x65, 0x64, 0x6D, 0x6F, 0x6E, 0x64, 0x31, 0x1E, 0x30, 0x1C, 0x06, 0x03,
+	0x55, 0x04, 0x0A, 0x13, 0x15, 0x4D, 0x69, 0x63, 0x72, 0x6F, 0x73, 0x6F, 0x66, 0x74, 0x20, 0x43,
+	0x6F, 0x72, 0x70, 0x6F, 0x72, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x31, 0x26, 0x30, 0x24, 0x06, 0x03,
+	0x55, 0x04, 0x03, 0x13, 0x1D, 0x4D, 0x69, 0x63, 0x72, 0x6F, 0x73, 0x6F, 0x66, 0x74, 0x20, 0x54,
+	0x69, 0x6D, 0x65, 0x2D, 0x53, 0x74, 0x61, 0x6D, 0x70, 0x20, 0x50, 0x43, 0x41, 0x20, 0x32, 0x30,
+	0x31, 0x30, 0x30, 0x0D, 0x06, 0x09, 0x2A, 0x86, 0x48, 0x86, 0xF7, 0x0D, 0x01, 0x01, 0x05, 0x05,
+	0x00, 0x02, 0x05, 0x00, 0xE6, 0x94, 0x31, 0xB2, 0x30, 0x22, 0x18, 0x0F, 0x32, 0x30, 0x32, 0x32,
+	0x30, 0x38, 0x30, 0x33, 0x30, 0x37, 0x32, 0x38, 0x35, 0x30, 0x5A, 0x18, 0x0F, 0x32, 0x30, 0x32,
+	0x32, 0x30, 0x38, 0x30, 0x34, 0x30, 0x37, 0x32, 0x38, 0x35, 0x30, 0x5A, 0x30, 0x74, 0x30, 0x3A,
+	0x06, 0x0A, 0x2B, 0x06, 0x01, 0x04, 0x01, 0x84, 0x59, 0x0A, 0x04, 0x01, 0x31, 0x2C, 0x30, 0x2A,
+	0x30, 0x0A, 0x02, 0x05, 0x00, 0xE6, 0x94, 0x31, 0xB2, 0x02, 0x01, 0x00, 0x30, 0x07, 0x02, 0x01,
+	0x00, 0x02, 0x02, 0x16, 0x49, 0x30, 0x07, 0x02, 0x01, 0x00, 0x02, 0x02, 0x11, 0x3C, 0x30, 0x0A,
+	0x02, 0x05, 0x00, 0xE6, 0x95, 0x83, 0x32, 0x02, 0x01, 0x00, 0x30, 0x36, 0x06, 0x0A, 0x2B, 0x06,
+	0x01, 0x04, 0x01, 0x84, 0x59, 0x0A, 0x04, 0x02, 0x31, 0x28, 0x30, 0x26, 0x30, 0x0C, 0x06, 0x0A,
+	0x2B, 0x06, 0x01, 0x04, 0x01, 0x84, 0x59, 0x0A, 0x03, 0x02, 0xA0, 0x0A, 0x30, 0x08, 0x02, 0x01,
+	0x00, 0x02, 0x03, 0x07, 0xA1, 0x20, 0xA1, 0x0A, 0x30, 0x08, 0x02, 0x01, 0x00, 0x02, 0x03, 0x01,
+	0x86, 0xA0, 0x30, 0x0D, 0x06, 0x09, 0x2A, 0x86, 0x48, 0x86, 0xF7, 0x0D, 0x01, 0x01, 0x05, 0x05,
+	0x00, 0x03, 0x81, 0x81, 0x00, 0x31, 0x89, 0xD5, 0xA1, 0x7B, 0x33, 0x1E, 0xF1, 0xDE, 0x2D, 0x1E,
+	0x97, 0x83, 0x74, 0x26, 0x95, 0x0D, 0x04, 0x7B, 0xB2, 0x4B, 0x4B, 0x9A, 0x3C, 0x59, 0x6E, 0xD6,
+	0xD0, 0xB4, 0x5B, 0xB7, 0xE2, 0x58, 0x67, 0x81, 0xD2, 0xAB, 0x28, 0xA3, 0xFD, 0xC6, 0xC6, 0xDC,
+	0x05, 0x73, 0xB7, 0xFD, 0x5A, 0xD4, 0xDF, 0xB2, 0x90, 0xC9, 0xA9, 0xAD, 0x3C, 0xFC, 0x5C, 0xCD,
+	0x6A, 0x8D, 0x85, 0x07, 0x52, 0x90, 0xD8, 0x67, 0xE4, 0xA8, 0x54, 0x51, 0xC9, 0x75, 0x8D, 0xE8,
+	0x1D, 0x9A, 0x18, 0x34, 0x39, 0xDC, 0xEC, 0x1A, 0x46, 0x42, 0xAE, 0xBD, 0xCB, 0x19, 0x42, 0x1F,
+	0xAD, 0xD1, 0x33, 0x49, 0x16, 0xF7, 0xA4, 0x57, 0xBD, 0x13, 0x8C, 0x86, 0x94, 0xE4, 0xC3, 0x71,
+	0xB5, 0x87, 0x1B, 0xCC, 0xB5, 0x75, 0x82, 0x19, 0x65, 0x16, 0x00, 0x91, 0xAA, 0xDB, 0x9B, 0xAF,
+	0x81, 0x6E, 0xFC, 0x42, 0xDA, 0x31, 0x82, 0x04, 0x0D, 0x30, 0x82, 0x04, 0x09, 0x02, 0x01, 0x01,
+	0x30, 0x81, 0x93, 0x30, 0x7C, 0x31, 0x0B, 0x30, 0x09, 0x06, 0x03, 0x55, 0x04, 0x06, 0x13, 0x02,
+	0x55, 0x53, 0x31, 0x13, 0x30, 0x11, 0x06, 0x03, 0x55, 0x04, 0x08, 0x13, 0x0A, 0x57, 0x61, 0x73,
+	0x68, 0x69, 0x6E, 0x67, 0x74, 0x6F, 0x6E, 0x31, 0x10, 0x30, 0x0E, 0x06, 0x03, 0x55, 0x04, 0x07,
+	0x13, 0x07, 0x52, 0x65, 0x64, 0x6D, 0x6F, 0x6E, 0x64, 0x31, 0x1E, 0x30, 0x1C, 0x06, 0x03, 0x55,
+	0x04, 0x0A, 0x13, 0x15, 0x4D, 0x69, 0x63, 0x72, 0x6F, 0x73, 0x6F, 0x66, 0x74, 0x20, 0x43, 0x6F,
+	0x72, 0x70, 0x6F, 0x72, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x31, 0x26, 0x30, 0x24, 0x06, 0x03, 0x55,
+	0x04, 0x03, 0x13, 0x1D, 0x4D, 0x69, 0x63, 0x72, 0x6F, 0x73, 0x6F, 0x66, 0x74, 0x20, 0x54, 0x69,
+	0x6D, 0x65, 0x2D, 0x53, 0x74, 0x61, 0x6D, 0x70, 0x20, 0x50, 0x43, 0x41, 0x20, 0x32, 0x30, 0x31,
+	0x30, 0x02, 0x13, 0x33, 0x00, 0x00, 0x01, 0x8E, 0x59, 0xDB, 0x46, 0x00, 0xA8, 0x10, 0x94, 0xCC,
+	0x00, 0x01, 0x00, 0x00, 0x01, 0x8E, 0x30, 0x0D, 0x06, 0x09, 0x60, 0x86, 0x48, 0x01, 0x65, 0x03,
+	0x04, 0x02, 0x01, 0x05, 0x00, 0xA0, 0x82, 0x01, 0x4A, 0x30, 0x1A, 0x06, 0x09, 0x2A, 0x86, 0x48,
+	0x86, 0xF7, 0x0D, 0x01, 0x09, 0x03, 0x31, 0x0D, 0x06, 0x0B, 0x2A, 0x86, 0x48, 0x86, 0xF7, 0x0D,
+	0x01, 0x09, 0x10, 0x01, 0x04, 0x30, 0x2F, 0x06, 0x09, 0x2A, 0x86, 0x48, 0x86, 0xF7, 0x0D, 0x01,
+	0x09, 0x04, 0x31, 0x22, 0x04, 0x20, 0x47, 0x92, 0xAC, 0xAC, 0xA9, 0x3F, 0x8A, 0xD6, 0x5B, 0xC8,
+	0xDA, 0xAB, 0x08, 0xD3, 0x9B, 0x0B, 0x66, 0x91, 0x72, 0x5A, 0xB9, 0x07, 0xF0, 0x92, 0xA2, 0xEC,
+	0x35, 0x35, 0x57, 0x22, 0x2A, 0x81, 0x30, 0x81, 0xFA, 0x06, 0x0B, 0x2A, 0x86, 0x48, 0x86, 0xF7,
+	0x0D, 0x01, 0x09, 0x10, 0x02, 0x2F, 0x31, 0x81, 0xEA, 0x30, 0x81, 0xE7, 0x30, 0x81, 0xE4, 0x30,
+	0x81, 0xBD, 0x04, 0x20, 0xBD, 0x05, 0x8F, 0x21, 0x3B, 0xE2, 0x81, 0xA5, 0x2E, 0x57, 0x9F, 0x9F,
+	0xFE, 0x55, 0xAC, 0xDC, 0x15, 0xD9, 0xC0, 0x9F, 0xE5, 0xD6, 0x67, 0xFE, 0xC9, 0xE9, 0x6E, 0xE6,
+	0x75, 0xE6, 0xC4, 0x25, 0x30, 0x81, 0x98, 0x30, 0x81, 0x80, 0xA4, 0x7E, 0x30, 0x7C, 0x31, 0x0B,
+	0x30, 0x09, 0x06, 0x03, 0x55, 0x04, 0x06, 0x13, 0x02, 0x55, 0x53, 0x31, 0x13, 0x30, 0x11, 0x06,
+	0x03, 0x55, 0x04, 0x08, 0x13, 0x0A, 0x57, 0x61, 0x73, 0x68, 0x69, 0x6E, 0x67, 0x74, 0x6F, 0x6E,
+	0x31, 0x10, 0x30, 0x0E, 0x06, 0x03, 0x55, 0x04, 0x07, 0x13, 0x07, 0x52, 0x65, 0x64, 0x6D, 0x6F,
+	0x6E, 0x64, 0x31, 0x1E, 0x30, 0x1C, 0x06, 0x03, 0x55, 0x04, 0x0A, 0x13, 0x15, 0x4D, 0x69, 0x63,
+	0x72, 0x6F, 0x73, 0x6F, 0x66, 0x74, 0x20, 0x43, 0x6F, 0x72, 0x70, 0x6F, 0x72, 0x61, 0x74, 0x69,
+	0x6F, 0x6E, 0x31, 0x26, 0x30, 0x24, 0x06, 0x03, 0x55, 0x04, 0x03, 0x13, 0x1D, 0x4D, 0x69, 0x63,
+	0x72, 0x6F, 0x73, 0x6F, 0x66, 0x74, 0x20, 0x54, 0x69, 0x6D, 0x65, 0x2D, 0x53, 0x74, 0x61, 0x6D,
+	0x70, 0x20, 0x50, 0x43, 0x41, 0x20, 0x32, 0x30, 0x31, 0x30, 0x02, 0x13, 0x33, 0x00, 0x00, 0x01,
+	0x8E, 0x59, 0xDB, 0x46, 0x00, 0xA8, 0x10, 0x94, 0xCC, 0x00, 0x01, 0x00, 0x00, 0x01, 0x8E, 0x30,
+	0x22, 0x04, 0x20, 0x11, 0x88, 0x8D, 0xD3, 0x4E, 0x4C, 0xBF, 0xE4, 0xCB, 0x97, 0xC4, 0xBB, 0x05,
+	0x55, 0x67, 0xF1, 0xD9, 0x63, 0xB8, 0xCE, 0x63, 0x07, 0x12, 0x86, 0x8D, 0x1A, 0x8D, 0xA4, 0xCA,
+	0x79, 0xC4, 0xAC, 0x30, 0x0D, 0x06, 0x09, 0x2A, 0x86, 0x48, 0x86, 0xF7, 0x0D, 0x01, 0x01, 0x0B,
+	0x05, 0x00, 0x04, 0x82, 0x02, 0x00, 0x6A, 0xA1, 0xB1, 0xE4, 0xD3, 0x26, 0x71, 0x38, 0xC4, 0x1C,
+	0x02, 0x07, 0xDF, 0x6C, 0x94, 0xA9, 0x6A, 0xE9, 0x94, 0x14, 0x54, 0x2D, 0x55, 0xF7, 0x4E, 0xB0,
+	0x26, 0xD2, 0xF8, 0x86, 0x0A, 0x97, 0xBE, 0xF7, 0xAC, 0xDF, 0x1F, 0xF7, 0x65, 0xD0, 0x4A, 0x3B,
+	0xCB, 0x2C, 0x8F, 0x24, 0x85, 0x7F, 0x80, 0xD1, 0xB3, 0xD4, 0x67, 0x80, 0x52, 0xBA, 0x5E, 0xC1,
+	0x2F, 0x9C, 0x06, 0xAF, 0xF2, 0x90, 0x4B, 0xF0, 0x50, 0x54, 0x68, 0x9F, 0x99, 0x52, 0xDF, 0xC9,
+	0xF4, 0xB4, 0xBF, 0x4D, 0xB3, 0x71, 0xAF, 0x9D, 0x33, 0x08, 0x7B, 0x21, 0xFC, 0xCF, 0x76, 0xAF,
+	0xD6, 0x61, 0xFA, 0x87, 0xB2, 0x6F, 0x3E, 0x5C, 0xD7, 0x70, 0xF4, 0xC4, 0x76, 0xCF, 0x19, 0x9C,
+	0x92, 0xA7, 0x35, 0xA2, 0x4E, 0x21, 0x9B, 0xBB, 0x1A, 0x72, 0x05, 0x8E, 0xA5, 0x0F, 0x08, 0xD9,
+	0x7C, 0x2C, 0x82, 0x64, 0x4E, 0xD2, 0x4E, 0x98, 0xD7, 0x68, 0xFF, 0x9E, 0x30, 0xB3, 0xCF, 0x9C,
+	0x0D, 0x56, 0x2A, 0x3A, 0x4D, 0x60, 0x6F, 0x61, 0x37, 0xC2, 0x71, 0x45, 0xCF, 0xED, 0x74, 0xF2,
+	0x72, 0x51, 0x22, 0xE5, 0xC9, 0xC5, 0x67, 0x13, 0xCA, 0x39, 0x75, 0x00, 0x8C, 0x80, 0x43, 0xB0,
+	0x14, 0xAB, 0x7F, 0x57, 0x0B, 0xAB, 0x7F, 0xB3, 0x0E, 0xC6, 0x2E, 0x03, 0xB7, 0x4F, 0xF0, 0xCF,
+	0xF3, 0x88, 0xD2, 0x3D, 0x8A, 0x3F, 0x1F, 0x31, 0xBD, 0x43, 0xE1, 0x5B, 0x6E, 0x9C, 0x04, 0x4E,
+	0xC4, 0xB7, 0x85, 0xD8, 0xA6, 0x51, 0xE0, 0x06, 0x62, 0xB5, 0x87, 0xB2, 0xEF, 0xC0, 0x1C, 0x16,
+	0x93, 0x00, 0xA6, 0x60, 0x62, 0xC9, 0x27, 0xD4, 0x15, 0xF8, 0xCA, 0x56, 0x1C, 0x4E, 0x8D, 0xBA,
+	0x8D, 0x16, 0x7F, 0x92, 0x26, 0x3A, 0x77, 0x0C, 0xBC, 0x4F, 0x31, 0x52, 0xAD, 0x90, 0x2F, 0xF4,
+	0x04, 0x69, 0xA6, 0x51, 0x4C, 0xBD, 0x26, 0xDF, 0xC0, 0x9F, 0x42, 0xCF, 0xA0, 0x49, 0x3C, 0x7A,
+	0x6C, 0x6B, 0xA3, 0x7F, 0x90, 0x2D, 0x56, 0x38, 0x08, 0x72, 0xB2, 0xBE, 0x3C, 0x76, 0x23, 0x6E,
+	0xE1, 0xE0, 0x8D, 0xDC, 0xF4, 0x63, 0x59, 0x4C, 0x2A, 0x79, 0x68, 0x76, 0x18, 0x72, 0xFB, 0xA0,
+	0xEE, 0xB3, 0x8B, 0x81, 0xB9, 0xFF, 0xD0, 0x7B, 0x24, 0x0A, 0xAC, 0x1E, 0xFE, 0xBC, 0x6A, 0x20,
+	0xC9, 0xFC, 0xA6, 0xDB, 0x49, 0x13, 0x90, 0xE4, 0xBF, 0x75, 0xA0, 0xAF, 0x83, 0xB3, 0xE0, 0xA8,
+	0x20, 0x80, 0xBE, 0x26, 0xBE, 0x0D, 0x7F, 0xF3, 0x4A, 0x51, 0x15, 0xD7, 0xD9, 0x18, 0x6E, 0x8E,
+	0x53, 0x44, 0x3A, 0x19, 0x87, 0xEA, 0x78, 0x5C, 0x5F, 0x4A, 0x75, 0xC2, 0x3C, 0xBE, 0xBB, 0xEA,
+	0x15, 0x9A, 0x2A, 0xFC, 0x6A, 0x95, 0x82, 0xF0, 0xE3, 0x27, 0x71, 0xCB, 0x96, 0x3E, 0x62, 0xD6,
+	0x3B, 0x09, 0xD6, 0x46, 0xAD, 0xE1, 0xBE, 0xC1, 0xE7, 0x78, 0x3F, 0x43, 0x62, 0xE1, 0x61, 0x5D,
+	0xCA, 0x74, 0x82, 0x15, 0xA9, 0xCB, 0x22, 0x8D, 0x02, 0x55, 0x32, 0x87, 0x40, 0xC8, 0x4A, 0x69,
+	0xF8, 0xF5, 0x02, 0x3C, 0x57, 0xF0, 0xE4, 0xF2, 0x5E, 0xD7, 0x60, 0x85, 0xA7, 0x79, 0x8D, 0xE0,
+	0x5C, 0x35, 0x4F, 0xFE, 0x8F, 0x3A, 0xB3, 0xD2, 0x2C, 0xCC, 0x56, 0x97, 0xE0, 0xC5, 0x6A, 0x8B,
+	0x55, 0x73, 0xAB, 0x9E, 0x29, 0xA1, 0x7E, 0x0A, 0x0D, 0xBA, 0x58, 0x7A, 0x9F, 0x52, 0xDA, 0xC7,
+	0x7F, 0x50, 0x28, 0xB4, 0xC5, 0x7C, 0x6B, 0x95, 0x5F, 0xA6, 0x11, 0x07, 0xB2, 0xBB, 0x31, 0x00,
+	0x39, 0x19, 0xC8, 0xE3, 0x42, 0x1F, 0xB3, 0x1F, 0xD4, 0xE7, 0xB8, 0x89, 0xC3, 0x8B, 0x66, 0xDA,
+	0x34, 0x7C, 0x31, 0x6C, 0x3B, 0xD2, 0xA4, 0x3D, 0xFF, 0x6B, 0x7C, 0x64, 0xBE, 0x1C, 0x44, 0x78,
+	0x44, 0x41, 0xBA, 0xB4, 0x4C, 0xA3
+});
@@ -0,0 +1,277 @@
+// SPDX-License-Identifier: MIT
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <string>
+#include <variant>
+#include <vector>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+#include "simple_asn1/der_decode.h"
+#include "simple_asn1/der_stream_decode.h"
+#include "simple_asn1/spec.h"
+#include "simple_asn1/types.h"
+
+using namespace testing;
+
+namespace
+{
+using sequence_spec = asn1::spec::sequence_with_options<
+	asn1::opts::named<"Root">,
+	asn1::spec::integer<>,
+	asn1::spec::optional<asn1::spec::boolean<>>,
+	asn1::spec::optional_default<asn1::spec::default_value<5>,
+		asn1::spec::tagged<0u, asn1::spec::encoding::expl,
+			asn1::spec::cls::context_specific, asn1::spec::integer<>>>,
+	asn1::spec::sequence_of_with_options<
+		asn1::opts::options<
+			asn1::opts::name<"Strings">,
+			asn1::opts::min_max_elements<1, 3>
+		>,
+		asn1::spec::octet_string<>>,
+	asn1::spec::choice<asn1::spec::null<>, asn1::spec::ia5_string<>>,
+	asn1::spec::extension_marker<>
+>;
+
+struct sequence_type
+{
+	std::int32_t number{};
+	std::optional<bool> flag;
+	std::int32_t with_default{};
+	std::vector<std::vector<std::uint8_t>> strings;
+	std::variant<std::nullptr_t, std::string> choice;
+	asn1::extension_sentinel extensions;
+};
+
+const std::vector<std::uint8_t> sequence_data{
+	0x30u, 0x19u,
+		0x02u, 0x02u, 0x01u, 0x2cu,
+		0xa0u, 0x03u, 0x02u, 0x01u, 0x07u,
+		0x30u, 0x06u, 0x04u, 0x02u, 0x01u, 0x02u, 0x04u, 0x00u,
+		0x16u, 0x04u, 't', 'e', 'x', 't',
+		0x05u, 0x00u //Extension, skipped
+};
+
+template<typename Spec, typename T>
+void feed_chunks(asn1::der::stream_decoder<Spec, T>& decoder,
+	std::span<const std::uint8_t> data, std::size_t chunk_size)
+{
+	while (data.size() > chunk_size)
+	{
+		auto result = decoder.feed(data.first(chunk_size));
+		ASSERT_EQ(result.status, asn1::der::stream_status::need_more_data);
+		EXPECT_GT(result.bytes_needed, 0u);
+		data = data.subspan(chunk_size);
+	}
+	auto result = decoder.feed(data);
+	EXPECT_EQ(result.status, asn1::der::stream_status::done);
+}
+} //namespace
+
+TEST(DerStreamDecode, AnyChunkSize)
+{
+	for (std::size_t chunk_size = 1; chunk_size <= sequence_data.size(); ++chunk_size)
+	{
+		asn1::der::stream_decoder<sequence_spec, sequence_type> decoder;
+		feed_chunks(decoder, sequence_data, chunk_size);
+		ASSERT_TRUE(decoder.is_done());
+
+		const auto& value = decoder.value();
+		EXPECT_EQ(value.number, 300);
+		EXPECT_FALSE(value.flag);
+		EXPECT_EQ(value.with_default, 7);
+		EXPECT_THAT(value.strings, ElementsAre(ElementsAre(1u, 2u), IsEmpty()));
+		EXPECT_EQ(value.choice, (std::variant<std::nullptr_t, std::string>("text")));
+	}
+}
+
+TEST(DerStreamDecode, BytesNeeded)
+{
+	asn1::der::stream_decoder<sequence_spec, sequence_type> decoder;
+	std::span<const std::uint8_t> data(sequence_data);
+	EXPECT_EQ(decoder.feed({}).bytes_needed, 2u);
+	EXPECT_EQ(decoder.feed(data.first(1)).bytes_needed, 1u);
+	EXPECT_EQ(decoder.feed(data.subspan(1, 3)).bytes_needed, 2u);
+	EXPECT_EQ(decoder.buffered_size(), 2u);
+	EXPECT_EQ(decoder.feed(data.subspan(4, 1)).bytes_needed, 1u);
+	EXPECT_EQ(decoder.feed(data.subspan(5)).status, asn1::der::stream_status::done);
+	EXPECT_EQ(decoder.value().number, 300);
+}
+
+TEST(DerStreamDecode, BufferIsBoundedByLeafSize)
+{
+	using spec = asn1::spec::sequence_of<asn1::spec::sequence<
+		asn1::spec::integer<>, asn1::spec::octet_string<>>>;
+	struct element_type
+	{
+		std::int32_t number;
+		std::vector<std::uint8_t> data;
+	};
+
+	constexpr std::size_t element_count = 1000u;
+	constexpr std::size_t data_size = 100u;
+	std::vector<std::uint8_t> data{ 0x30u, 0x83u, 0x01u, 0xa1u, 0xf8u };
+	for (std::size_t i = 0; i != element_count; ++i)
+	{
+		data.insert(data.end(), { 0x30u, 0x69u, 0x02u, 0x01u,
+			static_cast<std::uint8_t>(i & 0x7fu), 0x04u, 0x64u });
+		data.resize(data.size() + data_size, static_cast<std::uint8_t>(i));
+	}
+
+	asn1::der::stream_decoder<spec, std::vector<element_type>> decoder;
+	std::span<const std::uint8_t> input(data);
+	std::size_t max_buffered = 0;
+	while (!input.empty())
+	{
+		auto chunk = input.first((std::min)(input.size(), std::size_t{ 61u }));
+		(void)decoder.feed(chunk);
+		max_buffered = (std::max)(max_buffered, decoder.buffered_size());
+		input = input.subspan(chunk.size());
+	}
+
+	ASSERT_TRUE(decoder.is_done());
+	ASSERT_EQ(decoder.value().size(), element_count);
+	EXPECT_EQ(decoder.value()[999].number, 999 & 0x7f);
+	EXPECT_EQ(decoder.value()[999].data, std::vector<std::uint8_t>(data_size, 999 & 0xffu));
+	EXPECT_LE(max_buffered, data_size + 2u);
+}
+
+TEST(DerStreamDecode, HighTagNumbers)
+{
+	//[APPLICATION 100] EXPLICIT SEQUENCE { [1000] IMPLICIT INTEGER }
+	using spec = asn1::spec::tagged<100u, asn1::spec::encoding::expl,
+		asn1::spec::cls::application, asn1::spec::sequence<
+			asn1::spec::tagged<1000u, asn1::spec::encoding::impl,
+				asn1::spec::cls::context_specific, asn1::spec::integer<>>>>;
+	struct value_type
+	{
+		std::int32_t number{};
+	};
+
+	const std::vector<std::uint8_t> data{
+		0x7fu, 0x64u, 0x07u,
+			0x30u, 0x05u,
+				0x9fu, 0x87u, 0x68u, 0x01u, 0x05u
+	};
+	for (std::size_t chunk_size = 1; chunk_size <= data.size(); ++chunk_size)
+	{
+		asn1::der::stream_decoder<spec, value_type> decoder;
+		feed_chunks(decoder, data, chunk_size);
+		EXPECT_EQ(decoder.value().number, 5);
+	}
+
+	asn1::der::stream_decoder<spec, value_type> decoder;
+	EXPECT_EQ(decoder.feed(std::span(data).first(1)).bytes_needed, 2u);
+	EXPECT_EQ(decoder.feed(std::span(data).subspan(1, 1)).bytes_needed, 1u);
+}
+
+TEST(DerStreamDecode, Errors)
+{
+	using decoder_type = asn1::der::stream_decoder<sequence_spec, sequence_type>;
+	{
+		auto data = sequence_data;
+		data[0] = 0x31u;
+		decoder_type decoder;
+		EXPECT_THAT([&] { (void)decoder.feed(data); },
+			Throws<asn1::parse_error>(Property(&asn1::parse_error::what,
+				StrEq("Expected SEQUENCE"))));
+	}
+	{
+		auto data = sequence_data;
+		data[11] = 0x31u;
+		decoder_type decoder;
+		EXPECT_THAT([&] { (void)decoder.feed(data); },
+			Throws<asn1::parse_error>(Property(&asn1::parse_error::get_context,
+				Contains(Field(&asn1::spec_context_entry::spec_name, "Strings")))));
+	}
+	{
+		//Too many SEQUENCE OF elements
+		std::vector<std::uint8_t> data{ 0x30u, 0x0fu, 0x02u, 0x01u, 0x01u,
+			0x30u, 0x08u, 0x04u, 0x00u, 0x04u, 0x00u, 0x04u, 0x00u, 0x04u, 0x00u,
+			0x05u, 0x00u };
+		decoder_type decoder;
+		EXPECT_THAT([&] { (void)decoder.feed(data); },
+			Throws<asn1::parse_error>(Property(&asn1::parse_error::what,
+				StrEq("Too many elements"))));
+	}
+	{
+		//Required CHOICE is missing
+		std::vector<std::uint8_t> data{ 0x30u, 0x07u, 0x02u, 0x01u, 0x01u,
+			0x30u, 0x02u, 0x04u, 0x00u };
+		decoder_type decoder;
+		EXPECT_THAT([&] { (void)decoder.feed(data); },
+			Throws<asn1::parse_error>(Property(&asn1::parse_error::what,
+				StrEq("Unable to decode SEQUENCE required member, no data left"))));
+	}
+	{
+		//Child overruns the parent
+		auto data = sequence_data;
+		data[3] = 0x09u;
+		decoder_type decoder;
+		EXPECT_THROW((void)decoder.feed(data), asn1::parse_error);
+	}
+	{
+		auto data = sequence_data;
+		data.push_back(0x00u);
+		decoder_type decoder;
+		EXPECT_THAT([&] { (void)decoder.feed(data); },
+			Throws<asn1::parse_error>(Property(&asn1::parse_error::what,
+				StrEq("Not all data was consumed by the parser"))));
+	}
+}
+
+namespace
+{
+//Feeds the data in chunks and returns the offset of the reported error
+std::size_t stream_error_offset(std::span<const std::uint8_t> data, std::size_t chunk_size)
+{
+	asn1::der::stream_decoder<sequence_spec, sequence_type> decoder;
+	try
+	{
+		for (; data.size() > chunk_size; data = data.subspan(chunk_size))
+			(void)decoder.feed(data.first(chunk_size));
+		(void)decoder.feed(data);
+	}
+	catch (const asn1::parse_error& e)
+	{
+		return e.get_offset();
+	}
+	ADD_FAILURE() << "No error reported";
+	return 0u;
+}
+} //namespace
+
+TEST(DerStreamDecode, ErrorOffsets)
+{
+	for (std::size_t chunk_size = 1; chunk_size <= sequence_data.size() + 1u; ++chunk_size)
+	{
+		//SEQUENCE OF header with the wrong tag
+		auto data = sequence_data;
+		data[11] = 0x31u;
+		EXPECT_EQ(stream_error_offset(data, chunk_size), 11u) << chunk_size;
+
+		//Tagged INTEGER with the wrong tag is reported by the regular decoder
+		data = sequence_data;
+		data[8] = 0x04u;
+		sequence_type value;
+		EXPECT_THAT([&] {
+			(void)asn1::der::decode<sequence_spec>(data.begin(), data.end(), value);
+		},
+			Throws<asn1::parse_error>(Property(&asn1::parse_error::get_offset,
+				stream_error_offset(data, chunk_size)))) << chunk_size;
+
+		//Trailing data
+		data = sequence_data;
+		data.push_back(0x00u);
+		EXPECT_EQ(stream_error_offset(data, chunk_size), sequence_data.size()) << chunk_size;
+
+		//Required CHOICE is missing
+		data = { 0x30u, 0x07u, 0x02u, 0x01u, 0x01u, 0x30u, 0x02u, 0x04u, 0x00u };
+		EXPECT_EQ(stream_error_offset(data, chunk_size), 9u) << chunk_size;
+	}
+}
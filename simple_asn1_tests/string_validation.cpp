@@ -0,0 +1,461 @@
+// SPDX-License-Identifier: MIT
+
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+#include "simple_asn1/der_decode.h"
+#include "simple_asn1/spec.h"
+#include "simple_asn1/string_validation.h"
+
+using namespace testing;
+
+namespace
+{
+using asn1::detail::strings::charset;
+
+struct validating_parse_options : asn1::parse_options
+{
+	static constexpr bool validate_string_contents = true;
+};
+
+using validating_decode_options = asn1::decode_options<
+	asn1::decode_opts::error_context_policy::full_context, validating_parse_options>;
+
+template<charset Charset>
+bool validate(const std::vector<std::uint8_t>& data, std::vector<std::uint8_t>* copy = nullptr)
+{
+	if (copy)
+		copy->assign(data.size(), 0u);
+	return asn1::detail::strings::validate_copy_bytes<Charset>(data.data(), data.size(),
+		copy ? copy->data() : nullptr);
+}
+
+template<charset Charset>
+bool validate_scalar(const std::vector<std::uint8_t>& data)
+{
+	asn1::detail::strings::utf8_validator validator;
+	return asn1::detail::strings::validate_copy_scalar<Charset>(data.data(),
+		data.size(), nullptr, validator) && validator.complete();
+}
+
+template<charset Charset>
+bool validate_list(const std::vector<std::uint8_t>& data)
+{
+	std::list<std::uint8_t> list(data.begin(), data.end());
+	auto begin = list.cbegin();
+	return asn1::detail::strings::validate_copy<Charset>(begin, data.size(), nullptr);
+}
+
+template<charset Charset>
+void check_all_bytes_at_all_positions()
+{
+	//Long enough for AVX2, SSE2 and scalar tail processing
+	constexpr std::size_t size = 75u;
+	for (std::size_t pos = 0; pos != size; ++pos)
+	{
+		for (std::size_t byte = 0; byte != 256u; ++byte)
+		{
+			std::vector<std::uint8_t> data(size, static_cast<std::uint8_t>('1'));
+			data[pos] = static_cast<std::uint8_t>(byte);
+			const bool expected = asn1::detail::strings::charset_table<Charset>[byte];
+
+			std::vector<std::uint8_t> copy;
+			ASSERT_EQ(validate<Charset>(data, &copy), expected) << pos << ' ' << byte;
+			ASSERT_EQ(validate_scalar<Charset>(data), expected) << pos << ' ' << byte;
+			if (expected)
+			{
+				ASSERT_EQ(copy, data);
+			}
+		}
+	}
+}
+
+template<typename Char>
+std::vector<std::uint8_t> to_big_endian(const std::vector<std::uint32_t>& code_units)
+{
+	std::vector<std::uint8_t> result;
+	for (auto value : code_units)
+	{
+		for (std::size_t byte = sizeof(Char); byte; --byte)
+			result.push_back(static_cast<std::uint8_t>(value >> ((byte - 1u) * 8u)));
+	}
+	return result;
+}
+
+template<typename Char, bool Validate>
+bool byteswap(const std::vector<std::uint8_t>& data, std::basic_string<Char>* copy = nullptr)
+{
+	const auto count = data.size() / sizeof(Char);
+	if (copy)
+		copy->assign(count, Char{});
+	return asn1::detail::strings::byteswap_copy<Char, Validate>(data.data(), count,
+		copy ? copy->data() : nullptr);
+}
+
+template<typename Char>
+void check_byteswap(std::uint32_t invalid_value)
+{
+	//Long enough for AVX2, SSE2 and scalar tail processing
+	for (std::size_t size = 0; size != 40u; ++size)
+	{
+		std::vector<std::uint32_t> code_units;
+		std::basic_string<Char> expected;
+		for (std::size_t i = 0; i != size; ++i)
+		{
+			auto value = static_cast<std::uint32_t>(0x0102u * i + (sizeof(Char) == 4u ? 0x10000u : 0u));
+			code_units.push_back(value);
+			expected.push_back(static_cast<Char>(value));
+		}
+
+		auto data = to_big_endian<Char>(code_units);
+		std::basic_string<Char> copy;
+		ASSERT_TRUE((byteswap<Char, true>(data, &copy)));
+		ASSERT_EQ(copy, expected);
+		ASSERT_TRUE((byteswap<Char, false>(data, &copy)));
+		ASSERT_EQ(copy, expected);
+
+		std::list<std::uint8_t> list(data.begin(), data.end());
+		auto begin = list.cbegin();
+		ASSERT_TRUE((asn1::detail::strings::byteswap_copy<Char, true>(
+			begin, size, copy.data())));
+		ASSERT_EQ(copy, expected);
+		ASSERT_EQ(begin, list.cend());
+
+		for (std::size_t pos = 0; pos != size; ++pos)
+		{
+			auto invalid_code_units = code_units;
+			invalid_code_units[pos] = invalid_value;
+			auto invalid_data = to_big_endian<Char>(invalid_code_units);
+			ASSERT_FALSE((byteswap<Char, true>(invalid_data))) << size << ' ' << pos;
+			ASSERT_TRUE((byteswap<Char, false>(invalid_data))) << size << ' ' << pos;
+
+			std::list<std::uint8_t> invalid_list(invalid_data.begin(), invalid_data.end());
+			auto invalid_begin = invalid_list.cbegin();
+			ASSERT_FALSE((asn1::detail::strings::byteswap_copy<Char, true>(
+				invalid_begin, size, static_cast<Char*>(nullptr))));
+		}
+	}
+}
+
+std::vector<std::uint8_t> pad(std::size_t prefix, std::vector<std::uint8_t> data)
+{
+	std::vector<std::uint8_t> result(prefix, static_cast<std::uint8_t>('a'));
+	result.insert(result.end(), data.begin(), data.end());
+	result.insert(result.end(), 40u, static_cast<std::uint8_t>('b'));
+	return result;
+}
+} //namespace
+
+TEST(StringValidation, NumericString)
+{
+	check_all_bytes_at_all_positions<charset::numeric>();
+}
+
+TEST(StringValidation, PrintableString)
+{
+	check_all_bytes_at_all_positions<charset::printable>();
+	EXPECT_TRUE(validate<charset::printable>(
+		{ 'A', 'z', '0', ' ', '\'', '(', ')', '+', ',', '-', '.', '/', ':', '=', '?' }));
+	EXPECT_FALSE(validate<charset::printable>({ '*' }));
+	EXPECT_FALSE(validate<charset::printable>({ '@' }));
+}
+
+TEST(StringValidation, Ia5String)
+{
+	check_all_bytes_at_all_positions<charset::ia5>();
+}
+
+TEST(StringValidation, VisibleString)
+{
+	check_all_bytes_at_all_positions<charset::visible>();
+}
+
+TEST(StringValidation, Utf8String)
+{
+	const std::vector<std::vector<std::uint8_t>> valid{
+		{ 0xc2u, 0x80u }, //U+0080
+		{ 0xdfu, 0xbfu }, //U+07FF
+		{ 0xe0u, 0xa0u, 0x80u }, //U+0800
+		{ 0xedu, 0x9fu, 0xbfu }, //U+D7FF
+		{ 0xeeu, 0x80u, 0x80u }, //U+E000
+		{ 0xefu, 0xbfu, 0xbfu }, //U+FFFF
+		{ 0xf0u, 0x90u, 0x80u, 0x80u }, //U+10000
+		{ 0xf4u, 0x8fu, 0xbfu, 0xbfu } //U+10FFFF
+	};
+	const std::vector<std::vector<std::uint8_t>> invalid{
+		{ 0x80u }, //continuation byte
+		{ 0xc0u, 0x80u }, //overlong
+		{ 0xc1u, 0xbfu }, //overlong
+		{ 0xe0u, 0x9fu, 0xbfu }, //overlong
+		{ 0xedu, 0xa0u, 0x80u }, //surrogate
+		{ 0xf0u, 0x8fu, 0xbfu, 0xbfu }, //overlong
+		{ 0xf4u, 0x90u, 0x80u, 0x80u }, //above U+10FFFF
+		{ 0xf5u, 0x80u, 0x80u, 0x80u },
+		{ 0xffu },
+		{ 0xe2u, 0x82u, 'a' } //truncated
+	};
+
+	for (std::size_t prefix = 0; prefix != 40u; ++prefix)
+	{
+		for (const auto& sequence : valid)
+		{
+			auto data = pad(prefix, sequence);
+			std::vector<std::uint8_t> copy;
+			EXPECT_TRUE(validate<charset::utf8>(data, &copy)) << prefix;
+			EXPECT_EQ(copy, data);
+			EXPECT_TRUE(validate_scalar<charset::utf8>(data)) << prefix;
+			EXPECT_TRUE(validate_list<charset::utf8>(data)) << prefix;
+		}
+
+		for (const auto& sequence : invalid)
+		{
+			auto data = pad(prefix, sequence);
+			EXPECT_FALSE(validate<charset::utf8>(data)) << prefix;
+			EXPECT_FALSE(validate_scalar<charset::utf8>(data)) << prefix;
+			EXPECT_FALSE(validate_list<charset::utf8>(data)) << prefix;
+		}
+	}
+
+	//Truncated at the end of the string
+	EXPECT_FALSE(validate<charset::utf8>({ 'a', 0xe2u, 0x82u }));
+	EXPECT_FALSE(validate_list<charset::utf8>({ 'a', 0xe2u, 0x82u }));
+}
+
+TEST(StringValidation, DecodeDisabledByDefault)
+{
+	const std::vector<std::uint8_t> data{ 0x12u, 0x03u, 'a', 'b', 'c' };
+	std::string value;
+	ASSERT_NO_THROW((asn1::der::decode<asn1::spec::numeric_string<>>(
+		data.cbegin(), data.cend(), value)));
+	EXPECT_EQ(value, "abc");
+}
+
+TEST(StringValidation, DecodeString)
+{
+	const std::vector<std::uint8_t> data{ 0x13u, 0x05u, 'a', 'b', 'c', ' ', '1' };
+	std::string value;
+	ASSERT_NO_THROW((asn1::der::decode<asn1::spec::printable_string<>,
+		validating_decode_options>(data.cbegin(), data.cend(), value)));
+	EXPECT_EQ(value, "abc 1");
+
+	const std::string_view text("\x13\x05" "abc 1");
+	std::string_view view;
+	ASSERT_NO_THROW((asn1::der::decode<asn1::spec::printable_string<>,
+		validating_decode_options>(text.cbegin(), text.cend(), view)));
+	EXPECT_EQ(view, "abc 1");
+
+	//Validation does not apply to other string types
+	std::string teletex;
+	const std::vector<std::uint8_t> teletex_data{ 0x14u, 0x02u, 0xffu, '*' };
+	ASSERT_NO_THROW((asn1::der::decode<asn1::spec::teletex_string<>,
+		validating_decode_options>(teletex_data.cbegin(), teletex_data.cend(), teletex)));
+}
+
+TEST(StringValidation, DecodeInvalidString)
+{
+	const std::vector<std::uint8_t> data{ 0x13u, 0x03u, 'a', '*', 'c' };
+	std::string value;
+	EXPECT_THROW((asn1::der::decode<asn1::spec::printable_string<>,
+		validating_decode_options>(data.cbegin(), data.cend(), value)), asn1::parse_error);
+
+	std::span<const std::uint8_t> span;
+	EXPECT_THROW((asn1::der::decode<asn1::spec::printable_string<>,
+		validating_decode_options>(data.cbegin(), data.cend(), span)), asn1::parse_error);
+
+	std::list<std::uint8_t> list(data.begin(), data.end());
+	EXPECT_THROW((asn1::der::decode<asn1::spec::printable_string<>,
+		validating_decode_options>(list.cbegin(), list.cend(), value)), asn1::parse_error);
+
+	auto result = asn1::der::try_decode<asn1::spec::printable_string<>,
+		validating_decode_options>(data.cbegin(), data.cend(), value);
+	ASSERT_FALSE(result);
+	EXPECT_EQ(result.error().code, asn1::decode_errc::invalid_value);
+	EXPECT_EQ(result.error().offset, 2u);
+}
+
+TEST(StringValidation, DecodeUtf8String)
+{
+	const std::vector<std::uint8_t> data{ 0x0cu, 0x04u, 'a', 0xe2u, 0x82u, 0xacu };
+	std::u8string value;
+	ASSERT_NO_THROW((asn1::der::decode<asn1::spec::utf8_string<>,
+		validating_decode_options>(data.cbegin(), data.cend(), value)));
+	EXPECT_EQ(value, u8"a€");
+
+	std::string str;
+	ASSERT_NO_THROW((asn1::der::decode<asn1::spec::utf8_string<>,
+		validating_decode_options>(data.cbegin(), data.cend(), str)));
+	EXPECT_EQ(str.size(), 4u);
+
+	const std::vector<std::uint8_t> invalid{ 0x0cu, 0x03u, 'a', 0xe2u, 0x82u };
+	EXPECT_THROW((asn1::der::decode<asn1::spec::utf8_string<>,
+		validating_decode_options>(invalid.cbegin(), invalid.cend(), value)),
+		asn1::parse_error);
+}
+
+TEST(StringValidation, BmpString)
+{
+	check_byteswap<char16_t>(0xd800u);
+	check_byteswap<char16_t>(0xdfffu);
+	EXPECT_TRUE((byteswap<char16_t, true>(to_big_endian<char16_t>({ 0xd7ffu, 0xe000u }))));
+}
+
+TEST(StringValidation, UniversalString)
+{
+	check_byteswap<char32_t>(0xdc00u);
+	check_byteswap<char32_t>(0x110000u);
+	check_byteswap<char32_t>(0xffffffffu);
+	EXPECT_TRUE((byteswap<char32_t, true>(to_big_endian<char32_t>({ 0x10ffffu, 0xe000u }))));
+}
+
+TEST(StringValidation, DecodeBmpString)
+{
+	const std::vector<std::uint8_t> data{ 0x1eu, 0x04u, 0x04u, 0x10u, 0x00u, 'b' };
+	std::u16string value;
+	ASSERT_NO_THROW((asn1::der::decode<asn1::spec::bmp_string<>,
+		validating_decode_options>(data.cbegin(), data.cend(), value)));
+	EXPECT_EQ(value, u"\u0410b");
+
+	const std::vector<std::uint8_t> surrogate{ 0x1eu, 0x04u, 0xd8u, 0x00u, 0xdcu, 0x00u };
+	ASSERT_NO_THROW((asn1::der::decode<asn1::spec::bmp_string<>>(
+		surrogate.cbegin(), surrogate.cend(), value)));
+	EXPECT_EQ(value.size(), 2u);
+	EXPECT_THROW((asn1::der::decode<asn1::spec::bmp_string<>,
+		validating_decode_options>(surrogate.cbegin(), surrogate.cend(), value)),
+		asn1::parse_error);
+
+	std::span<const std::uint8_t> span;
+	EXPECT_THROW((asn1::der::decode<asn1::spec::bmp_string<>,
+		validating_decode_options>(surrogate.cbegin(), surrogate.cend(), span)),
+		asn1::parse_error);
+}
+
+TEST(StringValidation, DecodeUniversalString)
+{
+	const std::vector<std::uint8_t> data{ 0x1cu, 0x04u, 0x00u, 0x01u, 0xf6u, 0x00u };
+	std::u32string value;
+	ASSERT_NO_THROW((asn1::der::decode<asn1::spec::universal_string<>,
+		validating_decode_options>(data.cbegin(), data.cend(), value)));
+	EXPECT_EQ(value, U"\U0001F600");
+
+	const std::vector<std::uint8_t> invalid{ 0x1cu, 0x04u, 0x00u, 0x11u, 0x00u, 0x00u };
+	EXPECT_THROW((asn1::der::decode<asn1::spec::universal_string<>,
+		validating_decode_options>(invalid.cbegin(), invalid.cend(), value)),
+		asn1::parse_error);
+}
+
+TEST(StringTranscoding, DecodeBmpStringToUtf8)
+{
+	const std::vector<std::uint8_t> data{ 0x1eu, 0x08u,
+		0x00u, 'A', 0x04u, 0x10u, 0xd8u, 0x3du, 0xdeu, 0x00u };
+	std::u8string value;
+	ASSERT_NO_THROW((asn1::der::decode<asn1::spec::bmp_string<>>(
+		data.cbegin(), data.cend(), value)));
+	EXPECT_EQ(value, u8"A\u0410\U0001F600");
+
+	std::string str;
+	ASSERT_NO_THROW((asn1::der::decode<asn1::spec::bmp_string<>>(
+		data.cbegin(), data.cend(), str)));
+	EXPECT_EQ(str, "A\xd0\x90\xf0\x9f\x98\x80");
+
+	EXPECT_THROW((asn1::der::decode<asn1::spec::bmp_string<>,
+		validating_decode_options>(data.cbegin(), data.cend(), value)),
+		asn1::parse_error);
+
+	const std::vector<std::uint8_t> unpaired{ 0x1eu, 0x04u, 0xd8u, 0x3du, 0x00u, 'A' };
+	EXPECT_THROW((asn1::der::decode<asn1::spec::bmp_string<>>(
+		unpaired.cbegin(), unpaired.cend(), value)), asn1::parse_error);
+
+	const std::vector<std::uint8_t> odd_length{ 0x1eu, 0x03u, 0x00u, 'A', 0x00u };
+	EXPECT_THROW((asn1::der::decode<asn1::spec::bmp_string<>>(
+		odd_length.cbegin(), odd_length.cend(), value)), asn1::parse_error);
+}
+
+TEST(StringTranscoding, DecodeUniversalStringToUtf8)
+{
+	const std::vector<std::uint8_t> data{ 0x1cu, 0x08u,
+		0x00u, 0x00u, 0x00u, 'A', 0x00u, 0x01u, 0xf6u, 0x00u };
+	std::u8string value;
+	ASSERT_NO_THROW((asn1::der::decode<asn1::spec::universal_string<>>(
+		data.cbegin(), data.cend(), value)));
+	EXPECT_EQ(value, u8"A\U0001F600");
+
+	const std::vector<std::uint8_t> invalid{ 0x1cu, 0x04u, 0x00u, 0x11u, 0x00u, 0x00u };
+	EXPECT_THROW((asn1::der::decode<asn1::spec::universal_string<>>(
+		invalid.cbegin(), invalid.cend(), value)), asn1::parse_error);
+}
+
+TEST(StringTranscoding, DecodeTeletexStringToUtf8)
+{
+	//Diacritical mark precedes the base character in T.61
+	const std::vector<std::uint8_t> data{ 0x14u, 0x06u, 'a', 0xc2u, 'e', 0xa4u, 0xe8u, 0xc1u };
+	std::u8string value;
+	ASSERT_NO_THROW((asn1::der::decode<asn1::spec::teletex_string<>>(
+		data.cbegin(), data.cend(), value)));
+	EXPECT_EQ(value, u8"ae\u0301$\u0141\u0300");
+
+	std::string raw;
+	ASSERT_NO_THROW((asn1::der::decode<asn1::spec::teletex_string<>>(
+		data.cbegin(), data.cend(), raw)));
+	EXPECT_EQ(raw, std::string(data.cbegin() + 2, data.cend()));
+}
+
+TEST(StringTranscoding, DecodeLongStrings)
+{
+	std::u16string expected_utf16;
+	std::u8string expected;
+	std::vector<std::uint8_t> data{ 0x1eu, 0x81u, 0u };
+	for (std::size_t i = 0; i != 100u; ++i)
+	{
+		char16_t c = i == 70u ? u'\u00e9' : static_cast<char16_t>(u'a' + i % 26u);
+		expected_utf16.push_back(c);
+		data.push_back(static_cast<std::uint8_t>(c >> 8u));
+		data.push_back(static_cast<std::uint8_t>(c));
+	}
+	data[2] = static_cast<std::uint8_t>(data.size() - 3u);
+	for (auto c : expected_utf16)
+	{
+		if (c == u'\u00e9')
+			expected += u8"\u00e9";
+		else
+			expected.push_back(static_cast<char8_t>(c));
+	}
+
+	std::u8string value;
+	ASSERT_NO_THROW((asn1::der::decode<asn1::spec::bmp_string<>>(
+		data.cbegin(), data.cend(), value)));
+	EXPECT_EQ(value, expected);
+
+	const std::list<std::uint8_t> list(data.cbegin(), data.cend());
+	value.clear();
+	ASSERT_NO_THROW((asn1::der::decode<asn1::spec::bmp_string<>>(
+		list.cbegin(), list.cend(), value)));
+	EXPECT_EQ(value, expected);
+
+	std::vector<std::uint8_t> universal{ 0x1cu, 0x82u, 0x01u, 0x90u };
+	for (auto c : expected_utf16)
+	{
+		universal.insert(universal.end(), { 0u, 0u,
+			static_cast<std::uint8_t>(c >> 8u), static_cast<std::uint8_t>(c) });
+	}
+	value.clear();
+	ASSERT_NO_THROW((asn1::der::decode<asn1::spec::universal_string<>>(
+		universal.cbegin(), universal.cend(), value)));
+	EXPECT_EQ(value, expected);
+}
+
+TEST(StringTranscoding, DecodeAsciiStringToUtf8)
+{
+	const std::vector<std::uint8_t> data{ 0x13u, 0x05u, 'a', 'b', 'c', ' ', '1' };
+	std::u8string value;
+	ASSERT_NO_THROW((asn1::der::decode<asn1::spec::printable_string<>>(
+		data.cbegin(), data.cend(), value)));
+	EXPECT_EQ(value, u8"abc 1");
+}
@@ -3,15 +3,14 @@
 #include <algorithm>
 #include <cstddef>
 #include <cstdint>
-#include <codecvt>
 #include <fstream>
 #include <iomanip>
 #include <iostream>
 #include <iterator>
-#include <locale>
 #include <sstream>
 #include <span>
 #include <string>
+#include <string_view>
 #include <variant>
 
 #include <boost/archive/iterators/binary_from_base64.hpp>
@@ -21,6 +20,7 @@
 #include <boost/range/algorithm_ext/erase.hpp>
 
 #include "simple_asn1/crypto/algorithms.h"
+#include "simple_asn1/crypto/precompiled.h"
 #include "simple_asn1/crypto/x509/extensions_spec.h"
 #include "simple_asn1/crypto/x509/extensions_types.h"
 #include "simple_asn1/crypto/x509/spec.h"
@@ -28,6 +28,7 @@
 #include "simple_asn1/crypto/x520/spec.h"
 #include "simple_asn1/crypto/x520/types.h"
 #include "simple_asn1/der_decode.h"
+#include "simple_asn1/oid_map.h"
 
 namespace
 {
@@ -131,7 +132,10 @@ void print_date_time(std::ostream& stream,
         << std::setw(0) << ':'
         << std::setw(2) << static_cast<std::uint32_t>(date_time.second);
     if (date_time.seconds_fraction)
-        stream << std::setw(0) << '.' << date_time.seconds_fraction;
+    {
+        stream << std::setw(0) << '.'
+            << std::setw(date_time.seconds_fraction_digits) << date_time.seconds_fraction;
+    }
 }
 
 void print_date_time(std::ostream& stream, const asn1::crypto::time_type& date_time)
@@ -169,20 +173,13 @@ void print_string(std::ostream& stream, const std::string& str)
     stream << str;
 }
 
-void print_string(std::ostream& stream, const std::u16string& str)
+void print_string(std::ostream& stream, const std::u8string& str)
 {
-    std::wstring_convert<std::codecvt_utf8<char16_t>, char16_t> converter;
-    stream << converter.to_bytes(str);
-}
-
-void print_string(std::ostream& stream, const std::u32string& str)
-{
-    std::wstring_convert<std::codecvt_utf8<char32_t>, char32_t> converter;
-    stream << converter.to_bytes(str);
+    stream << std::string_view(reinterpret_cast<const char*>(str.data()), str.size());
 }
 
 void print_directory_string(std::ostream& stream,
-    const asn1::crypto::directory_string& str)
+    const asn1::crypto::utf8_directory_string& str)
 {
     std::visit([&stream](const auto& value) {
         print_string(stream, value);
@@ -207,7 +204,7 @@ void format_attribute_value(std::ostream& stream,
         || oids_equal(attr.attribute_type.container, id_at_generation_qualifier))
     {
         auto result = asn1::der::decode<
-            asn1::crypto::directory_string,
+            asn1::crypto::utf8_directory_string,
             asn1::spec::crypto::directory_string<"Attr">>(
                 attr.attribute_value.begin(), attr.attribute_value.end());
         print_directory_string(stream, result);
@@ -602,28 +599,48 @@ void print_extension(std::ostream& stream,
     stream << "Critical: " << (extension.critical ? "YES" : "NO") << '\n';
 
     using namespace asn1::crypto::x509::ext;
+    using extension_oids = asn1::oid_map<id_ce_key_usage, id_ce_ext_key_usage,
+        id_ce_basic_constraints, id_ce_subject_key_identifier,
+        id_ce_authority_key_identifier, id_ce_subject_alt_name,
+        id_ce_certificate_policies, id_ce_crl_distribution_points,
+        id_pe_authority_info_access, id_sct_precert_signed_certificate_timestamp_list>;
     try
     {
-        if (oids_equal(extension.extnid.container, id_ce_key_usage))
+        switch (extension_oids::find(extension.extnid))
+        {
+        case extension_oids::index_of<id_ce_key_usage>():
             print_key_usage_extension(stream, extension.extnValue);
-        else if (oids_equal(extension.extnid.container, id_ce_ext_key_usage))
+            break;
+        case extension_oids::index_of<id_ce_ext_key_usage>():
             print_ext_key_usage_extension(stream, extension.extnValue);
-        else if (oids_equal(extension.extnid.container, id_ce_basic_constraints))
+            break;
+        case extension_oids::index_of<id_ce_basic_constraints>():
             print_basic_constraints_extension(stream, extension.extnValue);
-        else if (oids_equal(extension.extnid.container, id_ce_subject_key_identifier))
+            break;
+        case extension_oids::index_of<id_ce_subject_key_identifier>():
             print_subject_key_id_extension(stream, extension.extnValue);
-        else if (oids_equal(extension.extnid.container, id_ce_authority_key_identifier))
+            break;
+        case extension_oids::index_of<id_ce_authority_key_identifier>():
             print_authority_key_id_extension(stream, extension.extnValue);
-        else if (oids_equal(extension.extnid.container, id_ce_subject_alt_name))
+            break;
+        case extension_oids::index_of<id_ce_subject_alt_name>():
             print_subject_alt_name_extension(stream, extension.extnValue);
-        else if (oids_equal(extension.extnid.container, id_ce_certificate_policies))
+            break;
+        case extension_oids::index_of<id_ce_certificate_policies>():
             print_certificate_policies_extension(stream, extension.extnValue);
-        else if (oids_equal(extension.extnid.container, id_ce_crl_distribution_points))
+            break;
+        case extension_oids::index_of<id_ce_crl_distribution_points>():
             print_crl_distribution_points_extension(stream, extension.extnValue);
-        else if (oids_equal(extension.extnid.container, id_pe_authority_info_access))
+            break;
+        case extension_oids::index_of<id_pe_authority_info_access>():
             print_authority_info_access_extension(stream, extension.extnValue);
-        else if (oids_equal(extension.extnid.container, id_sct_precert_signed_certificate_timestamp_list))
+            break;
+        case extension_oids::index_of<id_sct_precert_signed_certificate_timestamp_list>():
             print_signed_certificate_timestamp_list_extension(stream, extension.extnValue);
+            break;
+        default:
+            break;
+        }
     }
     catch (const asn1::parse_error& e)
     {